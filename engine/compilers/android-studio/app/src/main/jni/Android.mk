@@ -199,6 +199,7 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
                     ../../../../../../lib/libvorbis/window.c \
 					../../../../../../source/2d/assets/AnimationAsset.cc \
 					../../../../../../source/2d/assets/ImageAsset.cc \
+					../../../../../../source/2d/assets/ImageAtlas.cc \
 					../../../../../../source/2d/assets/ParticleAsset.cc \
 					../../../../../../source/2d/assets/ParticleAssetEmitter.cc \
 					../../../../../../source/2d/assets/ParticleAssetField.cc \
@@ -243,11 +244,14 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/2d/scene/SceneRenderFactories.cpp \
 					../../../../../../source/2d/scene/SceneRenderQueue.cpp \
 					../../../../../../source/2d/scene/WorldQuery.cc \
+					../../../../../../source/2d/scene/SceneContactSet.cc \
 					../../../../../../source/algorithm/crc.cc \
 					../../../../../../source/algorithm/hashFunction.cc \
 					../../../../../../source/assets/assetBase.cc \
 					../../../../../../source/assets/assetFieldTypes.cc \
 					../../../../../../source/assets/assetManager.cc \
+					../../../../../../source/assets/assetAsyncLoader.cc \
+					../../../../../../source/assets/assetDeclarationCache.cc \
 					../../../../../../source/assets/assetQuery.cc \
 					../../../../../../source/assets/assetTagsManifest.cc \
 					../../../../../../source/assets/declaredAssets.cc \
@@ -402,6 +406,7 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/io/zip/zipTempStream.cc \
 					../../../../../../source/math/rectClipper.cpp \
 					../../../../../../source/memory/dataChunker.cc \
+					../../../../../../source/memory/frameAllocator.cc \
 					../../../../../../source/memory/frameAllocator_ScriptBinding.cc \
 					../../../../../../source/messaging/dispatcher.cc \
 					../../../../../../source/messaging/eventManager.cc \
@@ -461,6 +466,7 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/console/consoleObject.cc \
 					../../../../../../source/console/consoleParser.cc \
 					../../../../../../source/console/consoleTypes.cc \
+					../../../../../../source/console/consoleValue.cc \
 					../../../../../../source/game/gameConnection.cc \
 					../../../../../../source/game/version.cc \
 					../../../../../../source/math/math_ScriptBinding.cc \
@@ -492,6 +498,7 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/platform/platformNetwork_ScriptBinding.cc \
 					../../../../../../source/platform/platformString.cc \
 					../../../../../../source/platform/platformVideo.cc \
+					../../../../../../source/platform/threads/threadPool.cc \
 					../../../../../../source/platform/platformNetAsync.unix.cc \
 					../../../../../../source/platform/menus/popupMenu.cc \
 					../../../../../../source/platform/nativeDialogs/msgBox.cpp \
@@ -598,6 +605,19 @@ LOCAL_SRC_FILES :=  ../../../../../../lib/ljpeg/jcapimin.c \
 					../../../../../../source/gui/editor/guiMenuBar.cc \
 					../../../../../../source/gui/editor/guiSeparatorCtrl.cc 
 #					../../../../../../source/testing/tests/platformFileIoTests.cc \
+#					../../../../../../source/testing/tests/batchRenderTests.cc \
+#					../../../../../../source/testing/tests/box2dParallelSolveTests.cc \
+#					../../../../../../source/testing/tests/particleAssetFieldTests.cc \
+#					../../../../../../source/testing/tests/simEventQueueTests.cc \
+#					../../../../../../source/testing/tests/consoleDispatchTests.cc \
+#					../../../../../../source/testing/tests/sceneContactSetTests.cc \
+#					../../../../../../source/testing/tests/sceneRenderQueueTests.cc \
+#					../../../../../../source/testing/tests/consoleValueTests.cc \
+#					../../../../../../source/testing/tests/frameAllocatorTests.cc \
+#					../../../../../../source/testing/tests/assetAsyncLoaderTests.cc \
+#					../../../../../../source/testing/tests/tamlBinaryTests.cc \
+#					../../../../../../source/testing/tests/skeletonObjectTests.cc \
+#					../../../../../../source/testing/tests/assetDeclarationCacheTests.cc \
 #					../../../../../../source/testing/tests/platformMemoryTests.cc \
 #					../../../../../../source/testing/tests/platformStringTests.cc \
 #					../../../../../../source/testing/unitTesting.cc
@@ -52,6 +52,10 @@
 #include "2d/assets/ImageAsset.h"
 #endif
 
+#ifndef _IMAGE_ATLAS_H_
+#include "2d/assets/ImageAtlas.h"
+#endif
+
 // Script bindings.
 #include "ImageAsset_ScriptBinding.h"
 
@@ -172,8 +176,10 @@ ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
                             mCellCountY(0),
                             mCellWidth(0),
                             mCellHeight(0),
+                            mAtlasGroup(StringTable->EmptyString),
 
-                            mImageTextureHandle(NULL)
+                            mImageTextureHandle(NULL),
+                            mpAtlasPage(NULL)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mFrames );
@@ -184,6 +190,8 @@ ImageAsset::ImageAsset() :  mImageFile(StringTable->EmptyString),
 
 ImageAsset::~ImageAsset()
 {
+    // Release any atlas image.
+    releaseAtlasImage();
 }
 
 //------------------------------------------------------------------------------
@@ -208,6 +216,7 @@ void ImageAsset::initPersistFields()
     addProtectedField("CellCountY", TypeS32, Offset(mCellCountY, ImageAsset), &setCellCountY, &defaultProtectedGetFn, &writeCellCountY, "");
     addProtectedField("CellWidth", TypeS32, Offset(mCellWidth, ImageAsset), &setCellWidth, &defaultProtectedGetFn, &writeCellWidth, "");
     addProtectedField("CellHeight", TypeS32, Offset(mCellHeight, ImageAsset), &setCellHeight, &defaultProtectedGetFn, &writeCellHeight, "");
+    addProtectedField("AtlasGroup", TypeString, Offset(mAtlasGroup, ImageAsset), &setAtlasGroup, &defaultProtectedGetFn, &writeAtlasGroup, "Images with the same atlas group are packed into shared textures.");
 }
 
 //------------------------------------------------------------------------------
@@ -277,6 +286,7 @@ void ImageAsset::copyTo(SimObject* object)
     pAsset->setCellCountY( getCellCountY() );
     pAsset->setCellWidth( getCellWidth() );
     pAsset->setCellHeight( getCellHeight() );
+    pAsset->setAtlasGroup( getAtlasGroup() );
 
     // Finish if not in explicit mode.
     if ( !getExplicitMode() )
@@ -555,6 +565,27 @@ void ImageAsset::setCellHeight( const S32 cellheight )
 
 //------------------------------------------------------------------------------
 
+void ImageAsset::setAtlasGroup( const char* pAtlasGroup )
+{
+    // Sanity!
+    AssertFatal( pAtlasGroup != NULL, "Cannot use a NULL atlas group." );
+
+    // Fetch atlas group.
+    StringTableEntry atlasGroup = StringTable->insert( pAtlasGroup );
+
+    // Ignore no change,
+    if ( atlasGroup == mAtlasGroup )
+        return;
+
+    // Update.
+    mAtlasGroup = atlasGroup;
+
+    // Refresh the asset.
+    refreshAsset();
+}
+
+//------------------------------------------------------------------------------
+
 Vector2 ImageAsset::getExplicitCellOffset(const S32 cellIndex)
 {
     if ( !getExplicitMode() )
@@ -677,6 +708,22 @@ bool ImageAsset::containsNamedRegion(const char* regionName)
 
 //------------------------------------------------------------------------------
 
+S32 ImageAsset::getNamedFrameIndex(const char* regionName) const
+{
+    // Iterate the frames.
+    for( U32 frameIndex = 0; frameIndex < (U32)mFrames.size(); ++frameIndex )
+    {
+        // Check to see if the name matches the argument
+        if (!dStrcmp(mFrames[frameIndex].mPixelArea.mRegionName, regionName))
+            return (S32)frameIndex;
+    }
+
+    // Didn't find it.
+    return -1;
+}
+
+//------------------------------------------------------------------------------
+
 bool ImageAsset::clearExplicitCells( void )
 {
     // Are we in explicit mode?
@@ -1031,33 +1078,30 @@ void ImageAsset::setTextureFilter( const TextureFilterMode filterMode )
     if ( mImageTextureHandle.IsNull() )
         return;
 
-    // Select Hardware Filter Mode.
-    GLint glFilterMode;
+    // Set the texture objects filter mode.
+    mImageTextureHandle.setFilter( getTextureFilter( filterMode ) );
+}
+
+//------------------------------------------------------------------------------
 
+GLint ImageAsset::getTextureFilter( const TextureFilterMode filterMode )
+{
+    // Select Hardware Filter Mode.
     switch( filterMode )
     {
         // Nearest ("none").
         case FILTER_NEAREST:
-        {
-            glFilterMode = GL_NEAREST;
-
-        } break;
+            return GL_NEAREST;
 
         // Bilinear ("smooth").
         case FILTER_BILINEAR:
-        {
-            glFilterMode = GL_LINEAR;
-
-        } break;
+            return GL_LINEAR;
 
         // Huh?
         default:
             // Oh well...
-            glFilterMode = GL_LINEAR;
+            return GL_LINEAR;
     };
-
-    // Set the texture objects filter mode.
-    mImageTextureHandle.setFilter( glFilterMode );
 }
 
 //------------------------------------------------------------------------------
@@ -1121,32 +1165,13 @@ void ImageAsset::calculateImage( void )
     // Clear frames.
     mFrames.clear();
 
-    // If we have an existing texture and we're setting to the same bitmap then force the texture manager
-    // to refresh the texture itself.
-    if ( !mImageTextureHandle.IsNull() && dStricmp(mImageTextureHandle.getTextureKey(), mImageFile) == 0 )
-        TextureManager::refresh( mImageFile );
-
-    // Get image texture.
-    mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit() );
-
-    // Is the texture valid?
-    if ( mImageTextureHandle.IsNull() )
-    {
-        // No, so warn.
-        Con::warnf( "Image '%s' could not load texture '%s'.", getAssetId(), mImageFile );
-        return;
-    }
+    // Release any atlas image.
+    releaseAtlasImage();
 
     // Is the local filter mode specified?
-    if ( mLocalFilterMode != FILTER_INVALID )
-    {
-        // Yes, so set filter mode.
-        setTextureFilter( mLocalFilterMode );
-    }
-    else
+    TextureFilterMode filterMode = mLocalFilterMode;
+    if ( filterMode == FILTER_INVALID )
     {
-        TextureFilterMode filterMode = FILTER_NEAREST;
-
         // No, so fetch the global filter.
         const char* pGlobalFilter = Con::getVariable( "$pref::T2D::imageAssetGlobalFilterMode" );
 
@@ -1157,11 +1182,43 @@ void ImageAsset::calculateImage( void )
         // If global filter mode is invalid then use local filter mode.
         if ( filterMode == FILTER_INVALID )
             filterMode = FILTER_NEAREST;
+    }
+
+    // Is an atlas group specified?
+    if ( mAtlasGroup != StringTable->EmptyString && !getForce16Bit() )
+    {
+        // Yes, so pack the image into an atlas page.
+        mpAtlasPage = ImageAtlas::acquireImage( mAtlasGroup, mImageFile, getTextureFilter( filterMode ), mAtlasArea );
 
-        // Set filter mode.
-        setTextureFilter( filterMode );
+        // Use the page texture if the image was packed.
+        if ( mpAtlasPage != NULL )
+            mImageTextureHandle = mpAtlasPage->getTextureHandle();
+        else
+            Con::warnf( "Image '%s' could not be packed into atlas group '%s' so will use its own texture.", getAssetId(), mAtlasGroup );
     }
 
+    if ( mpAtlasPage == NULL )
+    {
+        // If we have an existing texture and we're setting to the same bitmap then force the texture manager
+        // to refresh the texture itself.
+        if ( !mImageTextureHandle.IsNull() && dStricmp(mImageTextureHandle.getTextureKey(), mImageFile) == 0 )
+            TextureManager::refresh( mImageFile );
+
+        // Get image texture.
+        mImageTextureHandle.set( mImageFile, TextureHandle::BitmapTexture, true, getForce16Bit() );
+    }
+
+    // Is the texture valid?
+    if ( mImageTextureHandle.IsNull() )
+    {
+        // No, so warn.
+        Con::warnf( "Image '%s' could not load texture '%s'.", getAssetId(), mImageFile );
+        return;
+    }
+
+    // Set filter mode.
+    setTextureFilter( filterMode );
+
     // Calculate according to mode.
     if ( mExplicitMode )
     {
@@ -1171,6 +1228,50 @@ void ImageAsset::calculateImage( void )
     {
         calculateImplicitMode();
     }
+
+    // Move the frames into the atlas page.
+    if ( mpAtlasPage != NULL )
+        calculateAtlasFrames();
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::calculateAtlasFrames( void )
+{
+    // Sanity!
+    AssertFatal( mpAtlasPage != NULL, "Cannot calculate atlas frames when not in an atlas page." );
+
+    // Fetch the texture object.
+    TextureObject* pTextureObject = ((TextureObject*)mImageTextureHandle);
+
+    // Calculate the texel offset of the image in the page.
+    const Vector2 texelOffset(
+        (F32)mAtlasArea.point.x / (F32)pTextureObject->getTextureWidth(),
+        (F32)mAtlasArea.point.y / (F32)pTextureObject->getTextureHeight() );
+
+    // Offset the frame texels.
+    // NOTE:- Pixel areas remain relative to the image so cell configuration is unaffected.
+    for( typeFrameAreaVector::iterator frameItr = mFrames.begin(); frameItr != mFrames.end(); ++frameItr )
+    {
+        FrameArea::TexelArea& texelArea = frameItr->mTexelArea;
+        texelArea.mTexelLower += texelOffset;
+        texelArea.mTexelUpper += texelOffset;
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void ImageAsset::releaseAtlasImage( void )
+{
+    // Finish if not in an atlas page.
+    if ( mpAtlasPage == NULL )
+        return;
+
+    // Release the page texture before the page.
+    mImageTextureHandle.clear();
+
+    ImageAtlas::releaseImage( mpAtlasPage );
+    mpAtlasPage = NULL;
 }
 
 //------------------------------------------------------------------------------
@@ -41,6 +41,10 @@
 
 //-----------------------------------------------------------------------------
 
+class ImageAtlasPage;
+
+//-----------------------------------------------------------------------------
+
 DefineConsoleType( TypeImageAssetPtr )
 
 //-----------------------------------------------------------------------------
@@ -175,12 +179,17 @@ private:
     S32                         mCellHeight;
     S32                         mCellCountX;
     S32                         mCellCountY;
+    StringTableEntry            mAtlasGroup;
 
     /// Imagery.
     typeFrameAreaVector         mFrames;
     typeExplicitFrameAreaVector mExplicitFrames;
     TextureHandle               mImageTextureHandle;
 
+    /// Atlas.
+    ImageAtlasPage*             mpAtlasPage;
+    RectI                       mAtlasArea;
+
 public:
     ImageAsset();
     virtual ~ImageAsset();
@@ -229,6 +238,11 @@ public:
 
     void                    setCellHeight( const S32 cellheight );
     inline S32              getCellHeight( void) const                      { return mCellHeight; }
+
+    void                    setAtlasGroup( const char* pAtlasGroup );
+    inline StringTableEntry getAtlasGroup( void ) const                     { return mAtlasGroup; }
+    inline bool             getAtlased( void ) const                        { return mpAtlasPage != NULL; }
+    inline Point2I          getAtlasOffset( void ) const                    { return mpAtlasPage != NULL ? mAtlasArea.point : Point2I( 0, 0 ); }
     
     Vector2                 getExplicitCellOffset(const S32 cellIndex);
     S32                     getExplicitCellWidth(const S32 cellIndex);
@@ -237,10 +251,11 @@ public:
     S32                     getExplicitCellIndex(const char* regionName);
     
     bool                    containsNamedRegion(const char* regionName);
+    S32                     getNamedFrameIndex(const char* regionName) const;
 
     inline TextureHandle&   getImageTexture( void )                         { return mImageTextureHandle; }
-    inline S32              getImageWidth( void ) const                     { return mImageTextureHandle.getWidth(); }
-    inline S32              getImageHeight( void ) const                    { return mImageTextureHandle.getHeight(); }
+    inline S32              getImageWidth( void ) const                     { return mpAtlasPage != NULL ? mAtlasArea.extent.x : mImageTextureHandle.getWidth(); }
+    inline S32              getImageHeight( void ) const                    { return mpAtlasPage != NULL ? mAtlasArea.extent.y : mImageTextureHandle.getHeight(); }
     inline U32              getFrameCount( void ) const                     { return (U32)mFrames.size(); };
     inline bool             containsFrame( const char* namedFrame )         { return containsNamedRegion(namedFrame); };
     
@@ -274,7 +289,10 @@ private:
     void calculateImage( void );
     void calculateImplicitMode( void );
     void calculateExplicitMode( void );
+    void calculateAtlasFrames( void );
+    void releaseAtlasImage( void );
     void setTextureFilter( const TextureFilterMode filterMode );
+    static GLint getTextureFilter( const TextureFilterMode filterMode );
 
 protected:
     virtual void initializeAsset( void );
@@ -328,6 +346,9 @@ protected:
 
     static bool setCellHeight( void* obj, const char* data )                { static_cast<ImageAsset*>(obj)->setCellHeight(dAtoi(data)); return false; }
     static bool writeCellHeight( void* obj, StringTableEntry pFieldName )   { ImageAsset* pImageAsset = static_cast<ImageAsset*>(obj); return !pImageAsset->getExplicitMode() && pImageAsset->getCellHeight() != 0; }
+
+    static bool setAtlasGroup( void* obj, const char* data )                { static_cast<ImageAsset*>(obj)->setAtlasGroup(data); return false; }
+    static bool writeAtlasGroup( void* obj, StringTableEntry pFieldName )   { return static_cast<ImageAsset*>(obj)->getAtlasGroup() != StringTable->EmptyString; }
 };
 
 //-----------------------------------------------------------------------------
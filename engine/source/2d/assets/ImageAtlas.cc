@@ -0,0 +1,367 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _IMAGE_ATLAS_H_
+#include "2d/assets/ImageAtlas.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+// Script bindings.
+#include "ImageAtlas_ScriptBinding.h"
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+ImageAtlas::typePageVector ImageAtlas::mPages;
+U32 ImageAtlas::mImageCount = 0;
+
+//-----------------------------------------------------------------------------
+
+ImageAtlasPage::ImageAtlasPage( StringTableEntry atlasGroup, const U32 pageSize, const GLuint filter ) :
+    mAtlasGroup( atlasGroup ),
+    mPageSize( pageSize ),
+    mFilter( filter ),
+    mImageCount( 0 ),
+    mUsedArea( 0 )
+{
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mSkyline );
+
+    // Start with an empty skyline.
+    SkylineNode node;
+    node.mX = 0;
+    node.mY = 0;
+    node.mWidth = pageSize;
+    mSkyline.push_back( node );
+
+    // Create the page texture.
+    // NOTE:- The bitmap is owned by the texture manager and kept so that images can be copied into it.
+    GBitmap* pBitmap = new GBitmap( pageSize, pageSize, false, GBitmap::RGBA );
+    dMemset( pBitmap->getWritableBits(), 0, pBitmap->byteSize );
+    mTextureHandle.set( TextureManager::getUniqueTextureKey(), pBitmap, TextureHandle::BitmapKeepTexture, true );
+    mTextureHandle.setFilter( filter );
+}
+
+//-----------------------------------------------------------------------------
+
+bool ImageAtlasPage::insertBitmap( GBitmap* pBitmap, RectI& area )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ImageAtlasPage_InsertBitmap);
+
+    // Calculate the padded size.
+    const S32 width = pBitmap->getWidth() + (IMAGE_ATLAS_PADDING * 2);
+    const S32 height = pBitmap->getHeight() + (IMAGE_ATLAS_PADDING * 2);
+
+    // Find the skyline position with the lowest bottom edge.
+    S32 bestIndex = -1;
+    S32 bestX = 0;
+    S32 bestY = 0;
+    S32 bestBottom = S32_MAX;
+    S32 bestWidth = S32_MAX;
+    for ( U32 nodeIndex = 0; nodeIndex < (U32)mSkyline.size(); ++nodeIndex )
+    {
+        // Skip if the bitmap does not fit here.
+        const S32 y = fitSkyline( nodeIndex, width, height );
+        if ( y < 0 )
+            continue;
+
+        // Prefer the lowest bottom edge then the narrowest node.
+        const S32 bottom = y + height;
+        const S32 nodeWidth = mSkyline[nodeIndex].mWidth;
+        if ( bottom < bestBottom || (bottom == bestBottom && nodeWidth < bestWidth) )
+        {
+            bestIndex = nodeIndex;
+            bestX = mSkyline[nodeIndex].mX;
+            bestY = y;
+            bestBottom = bottom;
+            bestWidth = nodeWidth;
+        }
+    }
+
+    // Finish if the bitmap does not fit.
+    if ( bestIndex == -1 )
+        return false;
+
+    // Raise the skyline.
+    addSkyline( bestIndex, bestX, bestY, width, height );
+
+    // Copy the bitmap into the page.
+    copyBitmap( pBitmap, bestX + IMAGE_ATLAS_PADDING, bestY + IMAGE_ATLAS_PADDING );
+
+    // Update the texture.
+    mTextureHandle.refresh( RectI( bestX, bestY, width, height ) );
+
+    // Set the image area.
+    area.set( bestX + IMAGE_ATLAS_PADDING, bestY + IMAGE_ATLAS_PADDING, pBitmap->getWidth(), pBitmap->getHeight() );
+
+    mUsedArea += width * height;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+S32 ImageAtlasPage::fitSkyline( const U32 nodeIndex, const S32 width, const S32 height ) const
+{
+    // Finish if the area is beyond the right of the page.
+    const S32 x = mSkyline[nodeIndex].mX;
+    if ( x + width > (S32)mPageSize )
+        return -1;
+
+    // Find the highest node the area spans.
+    S32 y = mSkyline[nodeIndex].mY;
+    S32 widthRemaining = width;
+    for ( U32 index = nodeIndex; widthRemaining > 0 && index < (U32)mSkyline.size(); ++index )
+    {
+        y = getMax( y, mSkyline[index].mY );
+
+        // Finish if the area is beyond the bottom of the page.
+        if ( y + height > (S32)mPageSize )
+            return -1;
+
+        widthRemaining -= mSkyline[index].mWidth;
+    }
+
+    return y;
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageAtlasPage::addSkyline( const U32 nodeIndex, const S32 x, const S32 y, const S32 width, const S32 height )
+{
+    // Insert the new node.
+    SkylineNode node;
+    node.mX = x;
+    node.mY = y + height;
+    node.mWidth = width;
+    mSkyline.insert( nodeIndex );
+    mSkyline[nodeIndex] = node;
+
+    // Shrink or remove the nodes now covered by the new node.
+    for ( U32 index = nodeIndex + 1; index < (U32)mSkyline.size(); )
+    {
+        const SkylineNode& previousNode = mSkyline[index-1];
+        SkylineNode& currentNode = mSkyline[index];
+
+        // Finish if the node is not covered.
+        const S32 previousRight = previousNode.mX + previousNode.mWidth;
+        if ( currentNode.mX >= previousRight )
+            break;
+
+        // Shrink the node.
+        const S32 shrink = previousRight - currentNode.mX;
+        currentNode.mX += shrink;
+        currentNode.mWidth -= shrink;
+
+        // Finish if the node is only partially covered.
+        if ( currentNode.mWidth > 0 )
+            break;
+
+        // Remove the covered node.
+        mSkyline.erase( index );
+    }
+
+    // Merge neighbouring nodes at the same height.
+    for ( U32 index = 0; index + 1 < (U32)mSkyline.size(); )
+    {
+        if ( mSkyline[index].mY == mSkyline[index+1].mY )
+        {
+            mSkyline[index].mWidth += mSkyline[index+1].mWidth;
+            mSkyline.erase( index+1 );
+            continue;
+        }
+
+        ++index;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageAtlasPage::copyBitmap( GBitmap* pBitmap, const S32 x, const S32 y )
+{
+    // Fetch the page bitmap.
+    GBitmap* pPageBitmap = mTextureHandle.getBitmap();
+
+    // Sanity!
+    AssertFatal( pPageBitmap != NULL, "ImageAtlasPage::copyBitmap() - The page bitmap is not available." );
+
+    const S32 width = pBitmap->getWidth();
+    const S32 height = pBitmap->getHeight();
+    const bool hasAlpha = pBitmap->getFormat() == GBitmap::RGBA;
+
+    // Copy the bitmap including its repeated edge pixels.
+    for ( S32 row = -IMAGE_ATLAS_PADDING; row < height + IMAGE_ATLAS_PADDING; ++row )
+    {
+        const S32 sourceRow = mClamp( row, 0, height-1 );
+        U8* pDest = pPageBitmap->getAddress( x - IMAGE_ATLAS_PADDING, y + row );
+
+        for ( S32 column = -IMAGE_ATLAS_PADDING; column < width + IMAGE_ATLAS_PADDING; ++column )
+        {
+            const U8* pSource = pBitmap->getAddress( mClamp( column, 0, width-1 ), sourceRow );
+            pDest[0] = pSource[0];
+            pDest[1] = pSource[1];
+            pDest[2] = pSource[2];
+            pDest[3] = hasAlpha ? pSource[3] : 255;
+            pDest += 4;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+ImageAtlasPage* ImageAtlas::acquireImage( StringTableEntry atlasGroup, StringTableEntry imageFile, const GLuint filter, RectI& area )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ImageAtlas_AcquireImage);
+
+    // Load the bitmap.
+    GBitmap* pBitmap = TextureManager::loadBitmap( imageFile );
+
+    // Finish if the bitmap could not be loaded.
+    if ( pBitmap == NULL )
+        return NULL;
+
+    // Only colour bitmaps that fit within a page can be atlased.
+    const GBitmap::BitmapFormat format = pBitmap->getFormat();
+    if ( (format != GBitmap::RGB && format != GBitmap::RGBA) ||
+        pBitmap->getWidth() + (IMAGE_ATLAS_PADDING * 2) > IMAGE_ATLAS_PAGE_SIZE ||
+        pBitmap->getHeight() + (IMAGE_ATLAS_PADDING * 2) > IMAGE_ATLAS_PAGE_SIZE )
+    {
+        delete pBitmap;
+        return NULL;
+    }
+
+    // Try the existing pages of the atlas group.
+    ImageAtlasPage* pPage = NULL;
+    for ( typePageVector::iterator pageItr = mPages.begin(); pageItr != mPages.end(); ++pageItr )
+    {
+        // Skip if not the same atlas group and filter.
+        ImageAtlasPage* pExistingPage = *pageItr;
+        if ( pExistingPage->getAtlasGroup() != atlasGroup || pExistingPage->getFilter() != filter )
+            continue;
+
+        // Finish if the bitmap was inserted.
+        if ( pExistingPage->insertBitmap( pBitmap, area ) )
+        {
+            pPage = pExistingPage;
+            break;
+        }
+    }
+
+    // Create a new page if the bitmap was not inserted.
+    if ( pPage == NULL )
+    {
+        pPage = new ImageAtlasPage( atlasGroup, IMAGE_ATLAS_PAGE_SIZE, filter );
+        const bool inserted = pPage->insertBitmap( pBitmap, area );
+
+        // Finish if the bitmap could not be inserted into an empty page.
+        if ( !inserted )
+        {
+            Con::warnf( "ImageAtlas::acquireImage() - Failed to insert '%s' into an empty page.", imageFile );
+            delete pPage;
+            delete pBitmap;
+            return NULL;
+        }
+
+        mPages.push_back( pPage );
+    }
+
+    // The bitmap is no longer required.
+    delete pBitmap;
+
+    pPage->addImage();
+    mImageCount++;
+
+    return pPage;
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageAtlas::releaseImage( ImageAtlasPage* pPage )
+{
+    // Sanity!
+    AssertFatal( pPage != NULL, "ImageAtlas::releaseImage() - Cannot release a NULL page." );
+    AssertFatal( mImageCount > 0, "ImageAtlas::releaseImage() - No images to release." );
+
+    pPage->removeImage();
+    mImageCount--;
+
+    // Finish if the page is still used.
+    if ( pPage->getImageCount() > 0 )
+        return;
+
+    // Delete the page.
+    for ( typePageVector::iterator pageItr = mPages.begin(); pageItr != mPages.end(); ++pageItr )
+    {
+        if ( *pageItr == pPage )
+        {
+            mPages.erase( pageItr );
+            break;
+        }
+    }
+
+    delete pPage;
+}
+
+//-----------------------------------------------------------------------------
+
+void ImageAtlas::dumpMetrics( void )
+{
+    Con::printSeparator();
+    Con::printBlankLine();
+    Con::printf( "Dumping image atlas metrics:" );
+
+    for ( typePageVector::iterator pageItr = mPages.begin(); pageItr != mPages.end(); ++pageItr )
+    {
+        ImageAtlasPage* pPage = *pageItr;
+        const U32 pageArea = pPage->getPageSize() * pPage->getPageSize();
+
+        // Info.
+        Con::printf( "Group: %s, PageSize: %d, Images: %d, Used: %0.1f%%, Texture: %s",
+            pPage->getAtlasGroup(),
+            pPage->getPageSize(),
+            pPage->getImageCount(),
+            (pPage->getUsedArea() * 100.0f) / pageArea,
+            pPage->getTextureHandle().getTextureKey() );
+    }
+
+    // Info.
+    Con::printf( "Metrics Totals:" );
+    Con::printf( "PageCount: %d, ImageCount: %d", getPageCount(), getImageCount() );
+
+    Con::printBlankLine();
+    Con::printSeparator();
+}
@@ -0,0 +1,113 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _IMAGE_ATLAS_H_
+#define _IMAGE_ATLAS_H_
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _VECTOR_H_
+#include "collection/vector.h"
+#endif
+
+#ifndef _MRECT_H_
+#include "math/mRect.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define IMAGE_ATLAS_PAGE_SIZE           1024
+#define IMAGE_ATLAS_PADDING             1
+
+//-----------------------------------------------------------------------------
+
+/// An atlas page packs the images of an atlas group into a single texture.
+/// Images are packed with a skyline packer and surrounded by their repeated edge pixels
+/// so that filtering does not sample neighbouring images.
+class ImageAtlasPage
+{
+private:
+    struct SkylineNode
+    {
+        S32 mX;
+        S32 mY;
+        S32 mWidth;
+    };
+
+    typedef Vector<SkylineNode> typeSkylineVector;
+
+    StringTableEntry    mAtlasGroup;
+    U32                 mPageSize;
+    GLuint              mFilter;
+    TextureHandle       mTextureHandle;
+    typeSkylineVector   mSkyline;
+    U32                 mImageCount;
+    U32                 mUsedArea;
+
+public:
+    ImageAtlasPage( StringTableEntry atlasGroup, const U32 pageSize, const GLuint filter );
+    virtual ~ImageAtlasPage() {}
+
+    bool insertBitmap( GBitmap* pBitmap, RectI& area );
+
+    inline StringTableEntry getAtlasGroup( void ) const         { return mAtlasGroup; }
+    inline U32 getPageSize( void ) const                        { return mPageSize; }
+    inline GLuint getFilter( void ) const                       { return mFilter; }
+    inline TextureHandle& getTextureHandle( void )              { return mTextureHandle; }
+    inline U32 getUsedArea( void ) const                        { return mUsedArea; }
+
+    inline void addImage( void )                                { mImageCount++; }
+    inline void removeImage( void )                             { AssertFatal( mImageCount > 0, "ImageAtlasPage::removeImage() - No images to remove." ); mImageCount--; }
+    inline U32 getImageCount( void ) const                      { return mImageCount; }
+
+private:
+    S32 fitSkyline( const U32 nodeIndex, const S32 width, const S32 height ) const;
+    void addSkyline( const U32 nodeIndex, const S32 x, const S32 y, const S32 width, const S32 height );
+    void copyBitmap( GBitmap* pBitmap, const S32 x, const S32 y );
+};
+
+//-----------------------------------------------------------------------------
+
+/// The image atlas owns all the atlas pages.
+/// Pages are shared by images with the same atlas group and filter and are deleted when they have no images.
+/// NOTE:- Space used by a released image is not reused until its page is deleted.
+class ImageAtlas
+{
+private:
+    typedef Vector<ImageAtlasPage*> typePageVector;
+
+    static typePageVector   mPages;
+    static U32              mImageCount;
+
+public:
+    static ImageAtlasPage* acquireImage( StringTableEntry atlasGroup, StringTableEntry imageFile, const GLuint filter, RectI& area );
+    static void releaseImage( ImageAtlasPage* pPage );
+
+    static U32 getPageCount( void )                             { return (U32)mPages.size(); }
+    static U32 getImageCount( void )                            { return mImageCount; }
+
+    static void dumpMetrics( void );
+};
+
+#endif // _IMAGE_ATLAS_H_
@@ -1070,4 +1070,15 @@ ConsoleMethodWithDocs(ParticleAssetEmitter, getValueScale, ConsoleFloat, 2, 2, (
    return object->getParticleFields().getValueScale();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Gets the maximum error between the fields' baked lookup table and its data-keys.
+    The lookup table resolution is set with "$pref::T2D::ParticleAssetFieldLookupResolution" when the field is changed.
+    @return The maximum error between the fields' baked lookup table and its data-keys.
+*/
+ConsoleMethodWithDocs(ParticleAssetEmitter, getLookupError, ConsoleFloat, 2, 2, ())
+{
+   return object->getParticleFields().getLookupError();
+}
+
 ConsoleMethodGroupEndWithDocs(ParticleAssetEmitter)
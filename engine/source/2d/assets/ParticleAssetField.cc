@@ -64,10 +64,13 @@ ParticleAssetField::ParticleAssetField() :
                         mMaxValue( 0.0f ),
                         mDefaultValue( 1.0f ),
                         mValueScale( 1.0f ),
-                        mValueBoundsDirty( true )
+                        mValueBoundsDirty( true ),
+                        mLookupTimeScale( 0.0f ),
+                        mLookupError( 0.0f )
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mDataKeys );
+    VECTOR_SET_ASSOCIATION( mLookupTable );
 }
 
 //-----------------------------------------------------------------------------
@@ -170,6 +173,9 @@ void ParticleAssetField::setValueBounds( F32 maxTime, F32 minValue, F32 maxValue
 
     // Flag the value bounds as dirty.
     mValueBoundsDirty = true;
+
+    // Bake the lookup table as the max-time may have changed.
+    bakeLookupTable();
 }
 
 //-----------------------------------------------------------------------------
@@ -223,6 +229,9 @@ bool ParticleAssetField::setValueScale( const F32 valueScale )
     // Set Value Scale/
     mValueScale = valueScale;
 
+    // Bake the lookup table.
+    bakeLookupTable();
+
     // Return Okay.
     return true;
 }
@@ -273,6 +282,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
             // Yes, so set time.
             mDataKeys[index].mValue = value;
 
+            // Bake the lookup table.
+            bakeLookupTable();
+
             // Return Index.
             return index;
         }
@@ -289,6 +301,9 @@ S32 ParticleAssetField::addDataKey( const F32 time, const F32 value )
     mDataKeys[index].mTime = time;
     mDataKeys[index].mValue = value;
 
+    // Bake the lookup table.
+    bakeLookupTable();
+
     // Return Index.
     return index;
 }
@@ -316,6 +331,9 @@ bool ParticleAssetField::removeDataKey( const U32 index )
     // Remove Index.
     mDataKeys.erase(index);
 
+    // Bake the lookup table.
+    bakeLookupTable();
+
     // Return Okay.
     return true;
 }
@@ -343,6 +361,9 @@ bool ParticleAssetField::setDataKeyValue( const U32 index, const F32 value )
     // Set Data Key Value.
     mDataKeys[index].mValue = value;
 
+    // Bake the lookup table.
+    bakeLookupTable();
+
     // Return Okay.
     return true;
 }
@@ -398,6 +419,41 @@ const ParticleAssetField::DataKey& ParticleAssetField::getDataKey( const U32 ind
 //-----------------------------------------------------------------------------
 
 F32 ParticleAssetField::getFieldValue( F32 time ) const
+{
+    // Return First Entry if it's the only one or we're using zero time.
+    if ( mIsZero(time) || getDataKeyCount() < 2)
+        return mDataKeys[0].mValue * mValueScale;
+
+    // Fetch the lookup resolution.
+    const U32 resolution = getLookupResolution();
+
+    // Use the keyed evaluation if no lookup table is baked.
+    if ( resolution == 0 )
+        return getFieldValueKeyed( time );
+
+    // Clamp Key-Time.
+    time = getMin(getMax( 0.0f, time ), mMaxTime);
+
+    // Repeat Time.
+    // NOTE:-   The modulo is the identity for a unit repeat-time as the time is already clamped.
+    if ( mNotEqual( mRepeatTime, 1.0f ) )
+        time = mFmod( time * mRepeatTime, mMaxTime + FLT_EPSILON );
+
+    // Fetch the lookup position.
+    const F32 position = time * mLookupTimeScale;
+    const U32 index = getMin( (U32)position, resolution-2 );
+    const F32 fraction = position - (F32)index;
+
+    // Fetch the adjacent samples.
+    const F32* pSamples = mLookupTable.address() + index;
+
+    // Return lerped Value.
+    return pSamples[0] + (pSamples[1] - pSamples[0]) * fraction;
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ParticleAssetField::getFieldValueKeyed( F32 time ) const
 {
     // Return First Entry if it's the only one or we're using zero time.
     if ( mIsZero(time) || getDataKeyCount() < 2)
@@ -409,6 +465,74 @@ F32 ParticleAssetField::getFieldValue( F32 time ) const
     // Repeat Time.
     time = mFmod( time * mRepeatTime, mMaxTime + FLT_EPSILON );
 
+    // Return the keyed value.
+    return sampleDataKeys( time );
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleAssetField::bakeLookupTable( void )
+{
+    // Bake using the configured resolution.
+    bakeLookupTable( (U32)getMax( Con::getIntVariable( PARTICLE_ASSET_FIELD_LOOKUP_RESOLUTION, PARTICLE_ASSET_FIELD_DEFAULT_LOOKUP_RESOLUTION ), 0 ) );
+}
+
+//-----------------------------------------------------------------------------
+
+void ParticleAssetField::bakeLookupTable( const U32 resolution )
+{
+    // Reset the lookup table.
+    mLookupTable.clear();
+    mLookupTimeScale = 0.0f;
+    mLookupError = 0.0f;
+
+    // Finish if the lookup table is disabled or the field is constant.
+    // NOTE:-   A constant field is always returned directly from the first data-key.
+    if ( resolution == 0 || getDataKeyCount() < 2 )
+        return;
+
+    // Clamp the resolution.
+    const U32 sampleCount = getMin( getMax( resolution, (U32)2 ), (U32)PARTICLE_ASSET_FIELD_MAX_LOOKUP_RESOLUTION );
+
+    // Calculate the sample spacing.
+    const F32 sampleTime = mMaxTime / (F32)(sampleCount-1);
+    mLookupTimeScale = (F32)(sampleCount-1) / mMaxTime;
+
+    // Sample the data keys.
+    mLookupTable.setSize( sampleCount );
+    for ( U32 index = 0; index < sampleCount; ++index )
+    {
+        mLookupTable[index] = sampleDataKeys( index == sampleCount-1 ? mMaxTime : (F32)index * sampleTime );
+    }
+
+    // Measure the approximation error at each sample mid-point.
+    for ( U32 index = 0; index < sampleCount-1; ++index )
+    {
+        const F32 time = ((F32)index + 0.5f) * sampleTime;
+        const F32 lookupValue = (mLookupTable[index] + mLookupTable[index+1]) * 0.5f;
+        mLookupError = getMax( mLookupError, mFabs( lookupValue - sampleDataKeys( time ) ) );
+    }
+
+    // Measure the approximation error at each data-key (where the largest errors occur).
+    for ( U32 keyIndex = 0; keyIndex < getDataKeyCount(); ++keyIndex )
+    {
+        const F32 time = mDataKeys[keyIndex].mTime;
+        const F32 position = time * mLookupTimeScale;
+        const U32 index = getMin( (U32)position, sampleCount-2 );
+        const F32 fraction = position - (F32)index;
+        const F32 lookupValue = mLookupTable[index] + (mLookupTable[index+1] - mLookupTable[index]) * fraction;
+        mLookupError = getMax( mLookupError, mFabs( lookupValue - sampleDataKeys( time ) ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+F32 ParticleAssetField::sampleDataKeys( const F32 time ) const
+{
+    // Return First Value if we're on/before the first time.
+    if ( time <= mDataKeys[0].mTime )
+        return mDataKeys[0].mValue * mValueScale;
+
     // Fetch Max Key Index.
     const U32 maxKeyIndex = getDataKeyCount()-1;
 
@@ -694,6 +818,9 @@ void ParticleAssetField::onTamlCustomRead( const TamlCustomNode* pCustomNode )
 
     // Set the data keys.
     mDataKeys = keys;
+
+    // Bake the lookup table.
+    bakeLookupTable();
 }
 
 //-----------------------------------------------------------------------------
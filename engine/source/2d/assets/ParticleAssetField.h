@@ -33,6 +33,12 @@
 
 ///-----------------------------------------------------------------------------
 
+#define PARTICLE_ASSET_FIELD_LOOKUP_RESOLUTION          "$pref::T2D::ParticleAssetFieldLookupResolution"
+#define PARTICLE_ASSET_FIELD_DEFAULT_LOOKUP_RESOLUTION  256
+#define PARTICLE_ASSET_FIELD_MAX_LOOKUP_RESOLUTION      4096
+
+///-----------------------------------------------------------------------------
+
 class ParticleAssetField
 {
 public:
@@ -71,6 +77,12 @@ private:
 
     Vector<DataKey> mDataKeys;
 
+    /// Baked lookup table.
+    /// NOTE:-  Samples are evenly spaced over the (repeated) key-time and include the value scale.
+    Vector<F32> mLookupTable;
+    F32 mLookupTimeScale;
+    F32 mLookupError;
+
 public:
     ParticleAssetField();
     virtual ~ParticleAssetField();
@@ -104,6 +116,12 @@ public:
     inline U32 getDataKeyCount( void ) const { return (U32)mDataKeys.size(); }
     const DataKey& getDataKey( const U32 index ) const;
     F32 getFieldValue( F32 time ) const;
+    F32 getFieldValueKeyed( F32 time ) const;
+
+    void bakeLookupTable( void );
+    void bakeLookupTable( const U32 resolution );
+    inline U32 getLookupResolution( void ) const { return (U32)mLookupTable.size(); }
+    inline F32 getLookupError( void ) const { return mLookupError; }
 
     static F32 calculateFieldBV( const ParticleAssetField& base, const ParticleAssetField& variation, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
     static F32 calculateFieldBVE( const ParticleAssetField& base, const ParticleAssetField& variation, const ParticleAssetField& effect, const F32 effectAge, const bool modulate = false, const F32 modulo = 0.0f );
@@ -113,6 +131,9 @@ public:
     void onTamlCustomRead( const TamlCustomNode* pCustomNode );
 
     void WriteCustomTamlSchema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement );
+
+private:
+    F32 sampleDataKeys( const F32 time ) const;
 };
 
 //-----------------------------------------------------------------------------
@@ -419,6 +419,22 @@ F32 ParticleAssetFieldCollection::getValueScale( void ) const
     return mpSelectedField->getValueScale();
 }
 
+//-----------------------------------------------------------------------------
+
+F32 ParticleAssetFieldCollection::getLookupError( void ) const
+{
+    // Have we got a valid field selected?
+    if ( !mpSelectedField )
+    {
+        // No, so warn.
+        Con::warnf( "ParticleAssetFieldCollection::getLookupError() - No field selected." );
+        return 0.0f;
+    }
+
+    // Get Lookup Error.
+    return mpSelectedField->getLookupError();
+}
+
 //------------------------------------------------------------------------------
 
 void ParticleAssetFieldCollection::onTamlCustomWrite( TamlCustomNodes& customNodes )
@@ -80,6 +80,7 @@ public:
     F32 getRepeatTime( void ) const;
     bool setValueScale( const F32 valueScale );
     F32 getValueScale( void ) const;    
+    F32 getLookupError( void ) const;
 
     void onTamlCustomWrite( TamlCustomNodes& customNodes );
     void onTamlCustomRead( const TamlCustomNodes& customNodes );
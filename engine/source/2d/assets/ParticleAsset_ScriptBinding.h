@@ -339,6 +339,17 @@ ConsoleMethodWithDocs(ParticleAsset, getValueScale, ConsoleFloat, 2, 2, ())
    return object->getParticleFields().getValueScale();
 }
 
+//-----------------------------------------------------------------------------
+
+/*! Gets the maximum error between the fields' baked lookup table and its data-keys.
+    The lookup table resolution is set with "$pref::T2D::ParticleAssetFieldLookupResolution" when the field is changed.
+    @return The maximum error between the fields' baked lookup table and its data-keys.
+*/
+ConsoleMethodWithDocs(ParticleAsset, getLookupError, ConsoleFloat, 2, 2, ())
+{
+   return object->getParticleFields().getLookupError();
+}
+
 //-----------------------------------------------------------------------------
 /// Emitter asset methods.
 //-----------------------------------------------------------------------------
@@ -31,29 +31,96 @@
 
 //-----------------------------------------------------------------------------
 
+// Buffer usage for streamed vertices/indices (OpenGL ES 1.1 has no stream usage).
+#ifdef GL_STREAM_DRAW
+#define BATCHRENDER_STREAM_USAGE    GL_STREAM_DRAW
+#else
+#define BATCHRENDER_STREAM_USAGE    GL_DYNAMIC_DRAW
+#endif
+
+//-----------------------------------------------------------------------------
+
+U16 BatchRender::smQuadIndices[ BATCHRENDER_MAXQUADS * 6 ];
+bool BatchRender::smQuadIndicesGenerated = false;
+U32 BatchRenderCache::smContextGeneration = 0;
+
+//-----------------------------------------------------------------------------
+
+static EnumTable::Enums vertexFormatLookup[] =
+                {
+                { BatchRender::VERTEX_FORMAT_FLOAT,         "Float" },
+                { BatchRender::VERTEX_FORMAT_PACKED_COLOR,  "PackedColor" },
+                { BatchRender::VERTEX_FORMAT_PACKED,        "Packed" },
+                };
+
+//-----------------------------------------------------------------------------
+
 BatchRender::BatchRender() :
+    NoColor( -1.0f, -1.0f, -1.0f ),
+    mVertexFormat( VERTEX_FORMAT_INVALID ),
+    mVertexStride( 0 ),
+    mBatchVertexFormat( VERTEX_FORMAT_INVALID ),
+    mBatchVertexStride( 0 ),
+    mVertexBuffer( NULL ),
     mTriangleCount( 0 ),
     mVertexCount( 0 ),
-    mTextureCoordCount( 0 ),
     mIndexCount( 0 ),
     mColorCount( 0 ),
-    NoColor( -1.0f, -1.0f, -1.0f ),
-    mStrictOrderMode( false ),
-    mpDebugStats( NULL ),
+    mQuadsOnly( true ),
+    mVertexBufferName( 0 ),
+    mIndexBufferName( 0 ),
+    mQuadIndexBufferName( 0 ),
+    mVertexRingOffset( 0 ),
     mBlendMode( true ),
     mSrcBlendFactor( GL_SRC_ALPHA ),
     mDstBlendFactor( GL_ONE_MINUS_SRC_ALPHA ),
     mBlendColor( ColorF(1.0f,1.0f,1.0f,1.0f) ),
     mAlphaTestMode( -1.0f ),
+    mStrictOrderMode( false ),
+    mpDebugStats( NULL ),
     mWireframeMode( false ),
-    mBatchEnabled( true )
+    mBatchEnabled( true ),
+    mpCaptureCache( NULL )
 {
+    // Generate the shared quad indices if not already done.
+    if ( !smQuadIndicesGenerated )
+    {
+        U16* pQuadIndex = smQuadIndices;
+        for ( U32 quadIndex = 0; quadIndex < BATCHRENDER_MAXQUADS; ++quadIndex )
+        {
+            const U16 vertexIndex = (U16)(quadIndex * 4);
+            *(pQuadIndex++) = vertexIndex;
+            *(pQuadIndex++) = vertexIndex + 1;
+            *(pQuadIndex++) = vertexIndex + 2;
+            *(pQuadIndex++) = vertexIndex + 3;
+            *(pQuadIndex++) = vertexIndex + 2;
+            *(pQuadIndex++) = vertexIndex + 1;
+        }
+
+        smQuadIndicesGenerated = true;
+    }
+
+    // Register for texture events so the buffers are released with the render context.
+    mTextureEventKey = TextureManager::registerEventCallback( textureEventCallback, this );
+
+    // Set the default vertex format.
+    setVertexFormat( BATCHRENDER_DEFAULT_VERTEXFORMAT );
 }
 
 //-----------------------------------------------------------------------------
 
 BatchRender::~BatchRender()
 {
+    // Unregister texture events.
+    TextureManager::unregisterEventCallback( mTextureEventKey );
+
+    // Destroy the vertex/index buffers.
+    destroyBuffers();
+
+    // Free the vertices.
+    dFree( mVertexBuffer );
+    mVertexBuffer = NULL;
+
     // Destroy index vectors in texture batch map.
     for ( textureBatchType::iterator itr = mTextureBatchMap.begin(); itr != mTextureBatchMap.end(); ++itr )
     {
@@ -71,6 +138,149 @@ BatchRender::~BatchRender()
 
 //-----------------------------------------------------------------------------
 
+void BatchRender::setVertexFormat( const VertexFormat vertexFormat )
+{
+    // Ignore no change.
+    if ( vertexFormat == mVertexFormat )
+        return;
+
+    // Fetch the vertex stride.
+    const U32 vertexStride = getVertexFormatStride( vertexFormat );
+
+    // Is the vertex format valid?
+    if ( vertexStride == 0 )
+    {
+        // No, so warn.
+        Con::warnf( "BatchRender::setVertexFormat() - Invalid vertex format." );
+        return;
+    }
+
+    // Flush.
+    flushInternal();
+
+    // The vertex ring is sized by the vertex stride so destroy it.
+    destroyBuffers();
+
+    // Resize the vertices.
+    dFree( mVertexBuffer );
+    mVertexBuffer = (U8*)dMalloc( BATCHRENDER_BUFFERSIZE * getVertexCapacityStride( vertexFormat ) );
+
+    mVertexFormat = vertexFormat;
+    mVertexStride = vertexStride;
+    mBatchVertexFormat = vertexFormat;
+    mBatchVertexStride = vertexStride;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::selectBatchVertexFormat( const U32 vertexCount, const Vector2* pTextureArray )
+{
+    // Finish if the texture coordinates are not packed.
+    if ( mVertexFormat != VERTEX_FORMAT_PACKED )
+        return;
+
+    // Are the texture coordinates within the packed range?
+    bool packedRange = true;
+    for( U32 n = 0; n < vertexCount; ++n )
+    {
+        const Vector2& texCoord = pTextureArray[n];
+        if ( texCoord.x < 0.0f || texCoord.x > 1.0f || texCoord.y < 0.0f || texCoord.y > 1.0f )
+        {
+            packedRange = false;
+            break;
+        }
+    }
+
+    if ( packedRange )
+    {
+        // Yes, so revert to packing the texture coordinates if the batch is empty.
+        // NOTE: A batch already using unpacked texture coordinates can hold these as-is.
+        if ( mTriangleCount == 0 )
+        {
+            mBatchVertexFormat = VERTEX_FORMAT_PACKED;
+            mBatchVertexStride = sizeof(PackedVertex);
+        }
+
+        return;
+    }
+
+    // Finish if the batch already uses unpacked texture coordinates.
+    if ( mBatchVertexFormat == VERTEX_FORMAT_PACKED_COLOR )
+        return;
+
+    // Flush the packed batch.
+    flush( mpDebugStats->batchTexCoordRangeFlush );
+
+    // Use unpacked texture coordinates so they are not clamped.
+    mBatchVertexFormat = VERTEX_FORMAT_PACKED_COLOR;
+    mBatchVertexStride = sizeof(PackedColorVertex);
+}
+
+//-----------------------------------------------------------------------------
+
+U32 BatchRender::getVertexFormatStride( const VertexFormat vertexFormat )
+{
+    switch( vertexFormat )
+    {
+        case VERTEX_FORMAT_FLOAT:
+            return sizeof(FloatVertex);
+
+        case VERTEX_FORMAT_PACKED_COLOR:
+            return sizeof(PackedColorVertex);
+
+        case VERTEX_FORMAT_PACKED:
+            return sizeof(PackedVertex);
+
+        default:
+            return 0;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+U32 BatchRender::getVertexCapacityStride( const VertexFormat vertexFormat )
+{
+    // Packed batches can fall back to unpacked texture coordinates so size for those.
+    if ( vertexFormat == VERTEX_FORMAT_PACKED )
+        return sizeof(PackedColorVertex);
+
+    return getVertexFormatStride( vertexFormat );
+}
+
+//-----------------------------------------------------------------------------
+
+BatchRender::VertexFormat BatchRender::getVertexFormatEnum( const char* label )
+{
+    // Search for Mnemonic.
+    for(U32 i = 0; i < (sizeof(vertexFormatLookup) / sizeof(EnumTable::Enums)); i++)
+        if( dStricmp(vertexFormatLookup[i].label, label) == 0)
+            return((VertexFormat)vertexFormatLookup[i].index);
+
+    // Warn.
+    Con::warnf( "BatchRender::getVertexFormatEnum() - Invalid vertex format of '%s'", label );
+
+    return VERTEX_FORMAT_INVALID;
+}
+
+//-----------------------------------------------------------------------------
+
+const char* BatchRender::getVertexFormatDescription( const VertexFormat vertexFormat )
+{
+    // Search for Mnemonic.
+    for (U32 i = 0; i < (sizeof(vertexFormatLookup) / sizeof(EnumTable::Enums)); i++)
+    {
+        if( vertexFormatLookup[i].index == vertexFormat )
+            return vertexFormatLookup[i].label;
+    }
+
+    // Warn.
+    Con::warnf( "BatchRender::getVertexFormatDescription() - Invalid vertex format." );
+
+    return StringTable->EmptyString;
+}
+
+//-----------------------------------------------------------------------------
+
 void BatchRender::setBlendMode( const SceneRenderRequest* pSceneRenderRequest )
 {
     // Are we blending?
@@ -141,6 +351,9 @@ void BatchRender::SubmitTriangles(
         }
     }
 
+    // Select the batch vertex format for the texture coordinates.
+    selectBatchVertexFormat( vertexCount, pTextureArray );
+
     // Strict order mode?
     if ( mStrictOrderMode )
     {
@@ -168,31 +381,14 @@ void BatchRender::SubmitTriangles(
     else
     {
         // No, so add triangle run.
-        findTextureBatch( texture )->push_back( TriangleRun( TriangleRun::TRIANGLE, triangleCount, mVertexCount ) );
+        addTriangleRun( texture, TriangleRun::TRIANGLE, triangleCount );
     }
 
-    // Is a color specified?
-    if ( color != NoColor )
-    {
-        // Yes, so add colors.
-        for( U32 n = 0; n < triangleCount; ++n )
-        {
-            mColorBuffer[mColorCount++] = color;
-            mColorBuffer[mColorCount++] = color;
-            mColorBuffer[mColorCount++] = color;
-        }
-    }
+    // Flag as not only quads.
+    mQuadsOnly = false;
 
     // Add textured vertices.
-    for( U32 n = 0; n < triangleCount; ++n )
-    {
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mVertexBuffer[mVertexCount++]   = *(pVertexArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
-        mTextureBuffer[mTextureCoordCount++] = *(pTextureArray++);
-    }
+    writeVertices( vertexCount, pVertexArray, pTextureArray, color );
 
     // Stats.
     mpDebugStats->batchTrianglesSubmitted += triangleCount;
@@ -260,6 +456,11 @@ void BatchRender::SubmitQuad(
         }
     }
 
+    // Select the batch vertex format for the texture coordinates.
+    // NOTE: We swap #2/#3 here.
+    const Vector2 textureArray[4] = { texturePos0, texturePos1, texturePos3, texturePos2 };
+    selectBatchVertexFormat( 4, textureArray );
+
     // Strict order mode?
     if ( mStrictOrderMode )
     {
@@ -284,29 +485,13 @@ void BatchRender::SubmitQuad(
     else
     {
         // No, so add triangle run.
-        findTextureBatch( texture )->push_back( TriangleRun( TriangleRun::QUAD, 1, mVertexCount ) );
-    }
-
-    // Is a color specified?
-    if ( color != NoColor )
-    {
-        // Yes, so add colors.
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
-        mColorBuffer[mColorCount++] = color;
+        addTriangleRun( texture, TriangleRun::QUAD, 1 );
     }
 
     // Add textured vertices.
     // NOTE: We swap #2/#3 here.
-    mVertexBuffer[mVertexCount++]   = vertexPos0;
-    mVertexBuffer[mVertexCount++]   = vertexPos1;
-    mVertexBuffer[mVertexCount++]   = vertexPos3;
-    mVertexBuffer[mVertexCount++]   = vertexPos2;
-    mTextureBuffer[mTextureCoordCount++] = texturePos0;
-    mTextureBuffer[mTextureCoordCount++] = texturePos1;
-    mTextureBuffer[mTextureCoordCount++] = texturePos3;
-    mTextureBuffer[mTextureCoordCount++] = texturePos2;
+    const Vector2 vertexArray[4] = { vertexPos0, vertexPos1, vertexPos3, vertexPos2 };
+    writeVertices( 4, vertexArray, textureArray, color );
 
     // Stats.
     mpDebugStats->batchTrianglesSubmitted+=2;
@@ -362,76 +547,199 @@ void BatchRender::flush( void )
 
 //-----------------------------------------------------------------------------
 
-void BatchRender::flushInternal( void )
+void BatchRender::discard( void )
 {
-    // Debug Profiling.
-    PROFILE_SCOPE(T2D_BatchRender_flush);
+    // Return index vectors to pool.
+    for( textureBatchType::iterator batchItr = mTextureBatchMap.begin(); batchItr != mTextureBatchMap.end(); ++batchItr )
+    {
+        indexVectorType* pIndexVector = batchItr->value;
+        pIndexVector->clear();
+        mIndexVectorPool.push_back( pIndexVector );
+    }
 
-    // Finish if no triangles to flush.
-    if ( mTriangleCount == 0 )
+    // Clear texture batch map.
+    mTextureBatchMap.clear();
+
+    // Reset batch state.
+    mTriangleCount = 0;
+    mVertexCount = 0;
+    mIndexCount = 0;
+    mColorCount = 0;
+    mQuadsOnly = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::beginCapture( BatchRenderCache* pBatchRenderCache )
+{
+    // Sanity!
+    AssertFatal( pBatchRenderCache != NULL, "BatchRender::beginCapture() - Cannot capture into a NULL cache." );
+    AssertFatal( mpCaptureCache == NULL, "BatchRender::beginCapture() - Already capturing." );
+
+    // Flush any pending batches so they are not captured.
+    flushInternal();
+
+    // Clear the cache.
+    pBatchRenderCache->clear();
+
+    // Flag the render context the cache is captured in.
+    pBatchRenderCache->mContextGeneration = BatchRenderCache::smContextGeneration;
+
+    // Flag the textures the cache is captured with.
+    pBatchRenderCache->mTextureGeneration = TextureManager::getTextureNameGeneration();
+
+    mpCaptureCache = pBatchRenderCache;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::endCapture( void )
+{
+    // Finish if not capturing.
+    if ( mpCaptureCache == NULL )
         return;
 
-    // Stats.
-    mpDebugStats->batchFlushes++;
+    // Flush any pending batches so they are captured.
+    flushInternal();
 
-    if ( mWireframeMode )
-    {
-        // Disable texturing.    
-        glDisable( GL_TEXTURE_2D );
+    mpCaptureCache = NULL;
+}
 
-        // Set the polygon mode to line.
-        glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
-    }
-    else
-    {
-        // Enable texturing.    
-        glEnable( GL_TEXTURE_2D );
-        glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
+//-----------------------------------------------------------------------------
 
-        // Set the polygon mode to fill.
-        glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
-    }
+void BatchRender::render( BatchRenderCache* pBatchRenderCache )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(T2D_BatchRender_renderCache);
 
-    // Set blend mode.
-    if ( mBlendMode )
+    // Sanity!
+    AssertFatal( pBatchRenderCache != NULL, "BatchRender::render() - Cannot render a NULL cache." );
+    AssertFatal( pBatchRenderCache != mpCaptureCache, "BatchRender::render() - Cannot render a cache while capturing into it." );
+    AssertFatal( pBatchRenderCache->isValid(), "BatchRender::render() - Cannot render a cache captured in a previous render context or with deleted textures." );
+
+    // Flush any pending batches.
+    flushInternal();
+
+    // Finish if nothing cached.
+    if ( pBatchRenderCache->isEmpty() )
+        return;
+
+    // Create the cache vertex/index buffers if needed.
+    // NOTE: The cached batches never change so they are uploaded once.
+    if ( pBatchRenderCache->mVertexBufferName == 0 && dglDoesSupportVertexBuffer() )
     {
-        glEnable( GL_BLEND );
-        glBlendFunc( mSrcBlendFactor, mDstBlendFactor );
-        glColor4f(mBlendColor.red, mBlendColor.green, mBlendColor.blue, mBlendColor.alpha );
+        glGenBuffers( 1, &pBatchRenderCache->mVertexBufferName );
+        glGenBuffers( 1, &pBatchRenderCache->mIndexBufferName );
+
+        const U32 vertexBytes = pBatchRenderCache->mVertices.size();
+        glBindBuffer( GL_ARRAY_BUFFER, pBatchRenderCache->mVertexBufferName );
+        glBufferData( GL_ARRAY_BUFFER, vertexBytes, pBatchRenderCache->mVertices.address(), GL_STATIC_DRAW );
+
+        const U32 indexBytes = pBatchRenderCache->mIndices.size() * sizeof(U16);
+        glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, pBatchRenderCache->mIndexBufferName );
+        glBufferData( GL_ELEMENT_ARRAY_BUFFER, indexBytes, pBatchRenderCache->mIndices.address(), GL_STATIC_DRAW );
+
+        // Stats.
+        mpDebugStats->batchBytesUploaded += vertexBytes + indexBytes;
     }
-    else
+    else if ( pBatchRenderCache->mVertexBufferName != 0 )
     {
-        glDisable( GL_BLEND );
-        glColor4f( 1.0f, 1.0f, 1.0f, 1.0f );
+        // Bind the cache vertex/index buffers.
+        glBindBuffer( GL_ARRAY_BUFFER, pBatchRenderCache->mVertexBufferName );
+        glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, pBatchRenderCache->mIndexBufferName );
     }
 
-    // Set alpha-blend mode.
-    if ( mAlphaTestMode >= 0.0f )
+    // Fetch the vertex/index bases.
+    // NOTE: When using the buffers these are offsets into the buffers rather than addresses.
+    const bool useBuffers = pBatchRenderCache->mVertexBufferName != 0;
+    const U8* pVertexBase = useBuffers ? (const U8*)NULL : pBatchRenderCache->mVertices.address();
+    const U16* pIndexBase = useBuffers ? (const U16*)NULL : pBatchRenderCache->mIndices.address();
+
+    // Iterate cached batches.
+    for( BatchRenderCache::typeCachedBatchVector::iterator batchItr = pBatchRenderCache->mBatches.begin(); batchItr != pBatchRenderCache->mBatches.end(); ++batchItr )
     {
-        glEnable( GL_ALPHA_TEST );
-        glAlphaFunc( GL_GREATER, mAlphaTestMode );
+        // Fetch cached batch.
+        const BatchRenderCache::CachedBatch& cachedBatch = *batchItr;
+
+        // Are the texture coordinates packed?
+        const bool packedTexCoords = cachedBatch.mVertexFormat == VERTEX_FORMAT_PACKED && !cachedBatch.mWireframeMode;
+
+        // Apply the render state.
+        applyRenderState(
+            cachedBatch.mWireframeMode,
+            cachedBatch.mBlendMode,
+            cachedBatch.mSrcBlendFactor,
+            cachedBatch.mDstBlendFactor,
+            cachedBatch.mBlendColor,
+            cachedBatch.mAlphaTestMode,
+            cachedBatch.mColors,
+            packedTexCoords );
+
+        // Set the interleaved arrays.
+        setVertexArrays( cachedBatch.mVertexFormat, pVertexBase + cachedBatch.mVertexStart, cachedBatch.mColors );
+
+        // Iterate cached draws.
+        const BatchRenderCache::CachedDraw* pCachedDraw = pBatchRenderCache->mDraws.address() + cachedBatch.mDrawStart;
+        for( U32 n = 0; n < cachedBatch.mDrawCount; ++n, ++pCachedDraw )
+        {
+            // Bind the texture if not in wireframe mode.
+            if ( !cachedBatch.mWireframeMode )
+                glBindTexture( GL_TEXTURE_2D, pCachedDraw->mTextureName );
+
+            // Draw the triangles.
+            glDrawElements( GL_TRIANGLES, pCachedDraw->mIndexCount, GL_UNSIGNED_SHORT, pIndexBase + pCachedDraw->mIndexStart );
+
+            // Stats.
+            mpDebugStats->batchDrawCallsCached++;
+
+            // Stats.
+            // NOTE: Client-side arrays are copied by the driver on every draw.
+            if ( !useBuffers )
+                mpDebugStats->batchBytesUploaded += pCachedDraw->mIndexCount * sizeof(U16);
+        }
+
+        // Reset the render state.
+        resetRenderState( packedTexCoords );
     }
-    else
+
+    // Unbind the buffers so client-side arrays can be used elsewhere.
+    if ( useBuffers )
     {
-        glDisable( GL_ALPHA_TEST );
+        glBindBuffer( GL_ARRAY_BUFFER, 0 );
+        glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
     }
+}
 
-    // Enable vertex and texture arrays.
-    glEnableClientState( GL_VERTEX_ARRAY );
-    glVertexPointer( 2, GL_FLOAT, 0, mVertexBuffer );
-    glTexCoordPointer( 2, GL_FLOAT, 0, mTextureBuffer );
+//-----------------------------------------------------------------------------
 
-    // Use the texture coordinates if not in wireframe mode.
-    if ( !mWireframeMode )
-        glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+void BatchRender::flushInternal( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(T2D_BatchRender_flush);
 
-    // Do we have any colors?
-    if ( mColorCount > 0 )
-    {
-        // Yes, so enable color array.
-        glEnableClientState( GL_COLOR_ARRAY );
-        glColorPointer( 4, GL_FLOAT, 0, mColorBuffer );
-    }
+    // Finish if no triangles to flush.
+    if ( mTriangleCount == 0 )
+        return;
+
+    // Stats.
+    mpDebugStats->batchFlushes++;
+
+    // Are the texture coordinates packed?
+    const bool packedTexCoords = mBatchVertexFormat == VERTEX_FORMAT_PACKED && !mWireframeMode;
+
+    // Apply the render state.
+    applyRenderState( mWireframeMode, mBlendMode, mSrcBlendFactor, mDstBlendFactor, mBlendColor, mAlphaTestMode, mColorCount > 0, packedTexCoords );
+
+    // Create the vertex/index buffers if needed.
+    if ( mVertexBufferName == 0 )
+        createBuffers();
+
+    // Upload the vertices.
+    uploadVertices();
+
+    // Capture the batch if capturing.
+    if ( mpCaptureCache != NULL )
+        captureBatch();
 
     // Strict order mode?
     if ( mStrictOrderMode )
@@ -440,8 +748,20 @@ void BatchRender::flushInternal( void )
         if ( !mWireframeMode )
             glBindTexture( GL_TEXTURE_2D, mStrictOrderTextureHandle.getGLName() );
 
-        // Draw the triangles
-        glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
+        // Draw the triangles.
+        if ( mQuadsOnly )
+            drawQuads( 0, mVertexCount / 4 );
+        else
+            drawIndexed( mIndexBuffer, mIndexCount );
+
+        // Capture the draw if capturing.
+        if ( mpCaptureCache != NULL )
+        {
+            if ( mQuadsOnly )
+                captureDraw( mStrictOrderTextureHandle.getGLName(), smQuadIndices, (mVertexCount / 4) * 6, 0 );
+            else
+                captureDraw( mStrictOrderTextureHandle.getGLName(), mIndexBuffer, mIndexCount, 0 );
+        }
 
         // Stats.
         mpDebugStats->batchDrawCallsStrict++;
@@ -460,69 +780,53 @@ void BatchRender::flushInternal( void )
         // No, so iterate texture batch map.
         for( textureBatchType::iterator batchItr = mTextureBatchMap.begin(); batchItr != mTextureBatchMap.end(); ++batchItr )
         {
-            // Reset index count.
-            mIndexCount = 0;
-
             // Fetch index vector.
             indexVectorType* pIndexVector = batchItr->value;
 
-            // Iterate indexes.
-            for( indexVectorType::iterator indexItr = pIndexVector->begin(); indexItr != pIndexVector->end(); ++indexItr )
+            // Bind the texture if not in wireframe mode.
+            if ( !mWireframeMode )
+                glBindTexture( GL_TEXTURE_2D, batchItr->key );
+
+            // Is the batch a single run of quads?
+            if ( pIndexVector->size() == 1 && pIndexVector->first().mPrimitiveMode == TriangleRun::QUAD )
             {
-                // Fetch triangle run.
-                const TriangleRun& triangleRun = *indexItr;
+                // Yes, so fetch the triangle run.
+                const TriangleRun& triangleRun = pIndexVector->first();
 
-                // Fetch primitivecount.
-                const U32 primitiveCount = triangleRun.mPrimitiveCount;
+                // Draw the quads using the cached quad indices.
+                drawQuads( triangleRun.mStartIndex, triangleRun.mPrimitiveCount );
 
-                // Fetch triangle index start.
-                U16 triangleIndex = (U16)triangleRun.mStartIndex;
+                // Capture the draw if capturing.
+                if ( mpCaptureCache != NULL )
+                    captureDraw( batchItr->key, smQuadIndices, triangleRun.mPrimitiveCount * 6, triangleRun.mStartIndex );
 
-                // Fetch primitive mode.
-                const TriangleRun::PrimitiveMode& primitiveMode = triangleRun.mPrimitiveMode;
+                // Stats.
+                mpDebugStats->batchDrawCallsSorted++;
 
-                // Handle primitive mode.
-                if ( primitiveMode == TriangleRun::QUAD )
-                {
-                    // Add triangle run for quad.
-                    for( U32 n = 0; n < primitiveCount; ++n )
-                    {
-                        // Add new indices.
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex--;
-                        mIndexBuffer[mIndexCount++] = triangleIndex--;
-                        mIndexBuffer[mIndexCount++] = triangleIndex--;
-                    }
-                }
-                else if ( primitiveMode == TriangleRun::TRIANGLE )
-                {
-                    // Add triangle run for triangles.
-                    for( U32 n = 0; n < primitiveCount; ++n )
-                    {
-                        // Add new indices.
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                        mIndexBuffer[mIndexCount++] = triangleIndex++;
-                    }
-                }
-                else
-                {
-                    // Sanity!
-                    AssertFatal( false, "BatchRender::flushInternal() - Unrecognized primitive mode encountered for triangle run." );
-                }
-            }
+                // Stats.
+                if ( mVertexCount > mpDebugStats->batchMaxVertexBuffer )
+                    mpDebugStats->batchMaxVertexBuffer = mVertexCount;
 
-            // Sanity!
-            AssertFatal( mIndexCount > 0, "No batching indexes are present." );
+                // Stats.
+                const U32 trianglesDrawn = triangleRun.mPrimitiveCount * 2;
+                if ( trianglesDrawn > mpDebugStats->batchMaxTriangleDrawn )
+                    mpDebugStats->batchMaxTriangleDrawn = trianglesDrawn;
 
-            // Bind the texture if not in wireframe mode.
-            if ( !mWireframeMode )
-                glBindTexture( GL_TEXTURE_2D, batchItr->key );
+                // Return index vector to pool.
+                pIndexVector->clear();
+                mIndexVectorPool.push_back( pIndexVector );
+                continue;
+            }
+
+            // Build the batch indices.
+            buildBatchIndices( pIndexVector );
 
             // Draw the triangles.
-            glDrawElements( GL_TRIANGLES, mIndexCount, GL_UNSIGNED_SHORT, mIndexBuffer );
+            drawIndexed( mIndexBuffer, mIndexCount );
+
+            // Capture the draw if capturing.
+            if ( mpCaptureCache != NULL )
+                captureDraw( batchItr->key, mIndexBuffer, mIndexCount, 0 );
 
             // Stats.
             mpDebugStats->batchDrawCallsSorted++;
@@ -545,6 +849,237 @@ void BatchRender::flushInternal( void )
         mTextureBatchMap.clear();
     }
 
+    // Are we using the vertex/index buffers?
+    if ( mVertexBufferName != 0 )
+    {
+        // Yes, so advance the vertex ring.
+        mVertexRingOffset += mVertexCount * mBatchVertexStride;
+
+        // Unbind the buffers so client-side arrays can be used elsewhere.
+        glBindBuffer( GL_ARRAY_BUFFER, 0 );
+        glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+    }
+
+    // Reset the render state.
+    resetRenderState( packedTexCoords );
+
+    // Reset batch state.
+    mTriangleCount = 0;
+    mVertexCount = 0;
+    mIndexCount = 0;
+    mColorCount = 0;
+    mQuadsOnly = true;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::buildBatchIndices( const indexVectorType* pIndexVector )
+{
+    // Reset index count.
+    mIndexCount = 0;
+
+    // Iterate indexes.
+    for( indexVectorType::const_iterator indexItr = pIndexVector->begin(); indexItr != pIndexVector->end(); ++indexItr )
+    {
+        // Fetch triangle run.
+        const TriangleRun& triangleRun = *indexItr;
+
+        // Fetch primitivecount.
+        const U32 primitiveCount = triangleRun.mPrimitiveCount;
+
+        // Fetch triangle index start.
+        U16 triangleIndex = (U16)triangleRun.mStartIndex;
+
+        // Fetch primitive mode.
+        const TriangleRun::PrimitiveMode& primitiveMode = triangleRun.mPrimitiveMode;
+
+        // Handle primitive mode.
+        if ( primitiveMode == TriangleRun::QUAD )
+        {
+            // Add triangle run for quad.
+            for( U32 n = 0; n < primitiveCount; ++n )
+            {
+                // Add new indices.
+                mIndexBuffer[mIndexCount++] = triangleIndex++;
+                mIndexBuffer[mIndexCount++] = triangleIndex++;
+                mIndexBuffer[mIndexCount++] = triangleIndex++;
+                mIndexBuffer[mIndexCount++] = triangleIndex--;
+                mIndexBuffer[mIndexCount++] = triangleIndex--;
+                mIndexBuffer[mIndexCount++] = triangleIndex--;
+
+                // Move to the next quad.
+                triangleIndex += 4;
+            }
+        }
+        else if ( primitiveMode == TriangleRun::TRIANGLE )
+        {
+            // Add triangle run for triangles.
+            for( U32 n = 0; n < primitiveCount; ++n )
+            {
+                // Add new indices.
+                mIndexBuffer[mIndexCount++] = triangleIndex++;
+                mIndexBuffer[mIndexCount++] = triangleIndex++;
+                mIndexBuffer[mIndexCount++] = triangleIndex++;
+            }
+        }
+        else
+        {
+            // Sanity!
+            AssertFatal( false, "BatchRender::buildBatchIndices() - Unrecognized primitive mode encountered for triangle run." );
+        }
+    }
+
+    // Sanity!
+    AssertFatal( mIndexCount > 0, "No batching indexes are present." );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::captureBatch( void )
+{
+    // Fetch the cache.
+    BatchRenderCache* pBatchRenderCache = mpCaptureCache;
+
+    // Add a cached batch.
+    pBatchRenderCache->mBatches.increment();
+    BatchRenderCache::CachedBatch& cachedBatch = pBatchRenderCache->mBatches.last();
+    cachedBatch.mVertexFormat = mBatchVertexFormat;
+    cachedBatch.mVertexStart = pBatchRenderCache->mVertices.size();
+    cachedBatch.mColors = mColorCount > 0;
+    cachedBatch.mWireframeMode = mWireframeMode;
+    cachedBatch.mBlendMode = mBlendMode;
+    cachedBatch.mSrcBlendFactor = mSrcBlendFactor;
+    cachedBatch.mDstBlendFactor = mDstBlendFactor;
+    cachedBatch.mBlendColor = mBlendColor;
+    cachedBatch.mAlphaTestMode = mAlphaTestMode;
+    cachedBatch.mDrawStart = pBatchRenderCache->mDraws.size();
+    cachedBatch.mDrawCount = 0;
+
+    // Copy the vertices.
+    const U32 vertexBytes = mVertexCount * mBatchVertexStride;
+    pBatchRenderCache->mVertices.setSize( cachedBatch.mVertexStart + vertexBytes );
+    dMemcpy( pBatchRenderCache->mVertices.address() + cachedBatch.mVertexStart, mVertexBuffer, vertexBytes );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::captureDraw( const GLuint textureName, const U16* pIndices, const U32 indexCount, const U32 startVertex )
+{
+    // Fetch the cache.
+    BatchRenderCache* pBatchRenderCache = mpCaptureCache;
+
+    // Sanity!
+    AssertFatal( pBatchRenderCache->mBatches.size() > 0, "BatchRender::captureDraw() - No cached batch to capture the draw into." );
+
+    // Add a cached draw.
+    pBatchRenderCache->mDraws.increment();
+    BatchRenderCache::CachedDraw& cachedDraw = pBatchRenderCache->mDraws.last();
+    cachedDraw.mTextureName = textureName;
+    cachedDraw.mIndexStart = pBatchRenderCache->mIndices.size();
+    cachedDraw.mIndexCount = indexCount;
+    pBatchRenderCache->mBatches.last().mDrawCount++;
+
+    // Copy the indices rebased to the start vertex.
+    pBatchRenderCache->mIndices.setSize( cachedDraw.mIndexStart + indexCount );
+    U16* pCachedIndex = pBatchRenderCache->mIndices.address() + cachedDraw.mIndexStart;
+    for( U32 n = 0; n < indexCount; ++n )
+    {
+        *(pCachedIndex++) = (U16)(startVertex + *(pIndices++));
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::applyRenderState(
+        const bool wireframeMode,
+        const bool blendMode,
+        const GLenum srcBlendFactor,
+        const GLenum dstBlendFactor,
+        const ColorF& blendColor,
+        const F32 alphaTestMode,
+        const bool colors,
+        const bool packedTexCoords )
+{
+    if ( wireframeMode )
+    {
+        // Disable texturing.    
+        glDisable( GL_TEXTURE_2D );
+
+        // Set the polygon mode to line.
+        glPolygonMode( GL_FRONT_AND_BACK, GL_LINE );
+    }
+    else
+    {
+        // Enable texturing.    
+        glEnable( GL_TEXTURE_2D );
+        glTexEnvi( GL_TEXTURE_ENV, GL_TEXTURE_ENV_MODE, GL_MODULATE );
+
+        // Set the polygon mode to fill.
+        glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+    }
+
+    // Set blend mode.
+    if ( blendMode )
+    {
+        glEnable( GL_BLEND );
+        glBlendFunc( srcBlendFactor, dstBlendFactor );
+        glColor4f(blendColor.red, blendColor.green, blendColor.blue, blendColor.alpha );
+    }
+    else
+    {
+        glDisable( GL_BLEND );
+        glColor4f( 1.0f, 1.0f, 1.0f, 1.0f );
+    }
+
+    // Set alpha-blend mode.
+    if ( alphaTestMode >= 0.0f )
+    {
+        glEnable( GL_ALPHA_TEST );
+        glAlphaFunc( GL_GREATER, alphaTestMode );
+    }
+    else
+    {
+        glDisable( GL_ALPHA_TEST );
+    }
+
+    // Enable vertex and texture arrays.
+    glEnableClientState( GL_VERTEX_ARRAY );
+
+    // Use the texture coordinates if not in wireframe mode.
+    if ( !wireframeMode )
+        glEnableClientState( GL_TEXTURE_COORD_ARRAY );
+
+    // Do we have any colors?
+    if ( colors )
+    {
+        // Yes, so enable color array.
+        glEnableClientState( GL_COLOR_ARRAY );
+    }
+
+    // Are the texture coordinates packed?
+    if ( packedTexCoords )
+    {
+        // Yes, so scale them back to normalized texture coordinates.
+        glMatrixMode( GL_TEXTURE );
+        glPushMatrix();
+        glLoadIdentity();
+        glScalef( 1.0f / BATCHRENDER_TEXCOORD_SCALE, 1.0f / BATCHRENDER_TEXCOORD_SCALE, 1.0f );
+        glMatrixMode( GL_MODELVIEW );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::resetRenderState( const bool packedTexCoords )
+{
+    // Restore the texture matrix.
+    if ( packedTexCoords )
+    {
+        glMatrixMode( GL_TEXTURE );
+        glPopMatrix();
+        glMatrixMode( GL_MODELVIEW );
+    }
+
     // Reset common render state.
     glDisableClientState( GL_VERTEX_ARRAY );
     glDisableClientState( GL_TEXTURE_COORD_ARRAY );
@@ -553,13 +1088,293 @@ void BatchRender::flushInternal( void )
     glDisable( GL_BLEND );
     glDisable( GL_TEXTURE_2D );
     glPolygonMode( GL_FRONT_AND_BACK, GL_FILL );
+}
 
-    // Reset batch state.
-    mTriangleCount = 0;
-    mVertexCount = 0;
-    mTextureCoordCount = 0;
-    mIndexCount = 0;
-    mColorCount = 0;
+//-----------------------------------------------------------------------------
+
+void BatchRender::setVertexArrays( const VertexFormat vertexFormat, const U8* pVertexBase, const bool colors )
+{
+    // Fetch the vertex stride.
+    const U32 vertexStride = getVertexFormatStride( vertexFormat );
+
+    // Set the interleaved arrays.
+    // NOTE: All vertex formats start with the position followed by the texture coordinate.
+    glVertexPointer( 2, GL_FLOAT, vertexStride, pVertexBase );
+
+    switch( vertexFormat )
+    {
+        case VERTEX_FORMAT_PACKED_COLOR:
+            glTexCoordPointer( 2, GL_FLOAT, vertexStride, pVertexBase + sizeof(Vector2) );
+            if ( colors )
+                glColorPointer( 4, GL_UNSIGNED_BYTE, vertexStride, pVertexBase + sizeof(Vector2) * 2 );
+            break;
+
+        case VERTEX_FORMAT_PACKED:
+            glTexCoordPointer( 2, GL_SHORT, vertexStride, pVertexBase + sizeof(Vector2) );
+            if ( colors )
+                glColorPointer( 4, GL_UNSIGNED_BYTE, vertexStride, pVertexBase + sizeof(Vector2) + sizeof(S16) * 2 );
+            break;
+
+        default:
+            glTexCoordPointer( 2, GL_FLOAT, vertexStride, pVertexBase + sizeof(Vector2) );
+            if ( colors )
+                glColorPointer( 4, GL_FLOAT, vertexStride, pVertexBase + sizeof(Vector2) * 2 );
+            break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::uploadVertices( void )
+{
+    // Are we using a vertex buffer?
+    if ( mVertexBufferName != 0 )
+    {
+        // Yes, so bind it.
+        glBindBuffer( GL_ARRAY_BUFFER, mVertexBufferName );
+
+        // Would the vertices overrun the vertex ring?
+        // NOTE: The vertex ring is tracked in bytes as the batch vertex stride can vary.
+        const U32 vertexBytes = mVertexCount * mBatchVertexStride;
+        const U32 ringBytes = BATCHRENDER_RINGBUFFERSIZE * getVertexCapacityStride( mVertexFormat );
+        if ( (mVertexRingOffset + vertexBytes) > ringBytes )
+        {
+            // Yes, so orphan the buffer storage so we don't stall on draws still using it.
+            glBufferData( GL_ARRAY_BUFFER, ringBytes, NULL, BATCHRENDER_STREAM_USAGE );
+
+            // Restart the vertex ring.
+            mVertexRingOffset = 0;
+        }
+
+        // Upload the vertices.
+        glBufferSubData( GL_ARRAY_BUFFER, mVertexRingOffset, vertexBytes, mVertexBuffer );
+
+        // Stats.
+        mpDebugStats->batchBytesUploaded += vertexBytes;
+    }
+
+    // Bind the vertex arrays.
+    bindVertexArrays( 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::bindVertexArrays( const U32 startVertex )
+{
+    // Fetch the vertex base.
+    // NOTE: When using a vertex buffer this is an offset into the buffer rather than an address.
+    const U8* pVertexBase = mVertexBufferName != 0 ?
+        (const U8*)NULL + mVertexRingOffset + startVertex * mBatchVertexStride :
+        mVertexBuffer + startVertex * mBatchVertexStride;
+
+    // Set the interleaved arrays.
+    setVertexArrays( mBatchVertexFormat, pVertexBase, mColorCount > 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::drawIndexed( const U16* pIndices, const U32 indexCount )
+{
+    // Are we using an index buffer?
+    if ( mIndexBufferName != 0 )
+    {
+        // Yes, so upload the indices into fresh buffer storage.
+        const U32 indexBytes = indexCount * sizeof(U16);
+        glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, mIndexBufferName );
+        glBufferData( GL_ELEMENT_ARRAY_BUFFER, indexBytes, pIndices, BATCHRENDER_STREAM_USAGE );
+
+        // Draw the triangles.
+        glDrawElements( GL_TRIANGLES, indexCount, GL_UNSIGNED_SHORT, NULL );
+
+        // Stats.
+        mpDebugStats->batchBytesUploaded += indexBytes;
+    }
+    else
+    {
+        // No, so draw the triangles from client-side arrays.
+        glDrawElements( GL_TRIANGLES, indexCount, GL_UNSIGNED_SHORT, pIndices );
+
+        // Stats.
+        // NOTE: Client-side arrays are copied by the driver on every draw.
+        mpDebugStats->batchBytesUploaded += indexCount * sizeof(U16) + mVertexCount * mBatchVertexStride;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::drawQuads( const U32 startVertex, const U32 quadCount )
+{
+    // Sanity!
+    AssertFatal( quadCount <= BATCHRENDER_MAXQUADS, "BatchRender::drawQuads() - Invalid quad count." );
+
+    // Rebase the vertex arrays if not starting at the first vertex.
+    if ( startVertex != 0 )
+        bindVertexArrays( startVertex );
+
+    // Are we using an index buffer?
+    if ( mQuadIndexBufferName != 0 )
+    {
+        // Yes, so draw the quads using the cached quad indices.
+        glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, mQuadIndexBufferName );
+        glDrawElements( GL_TRIANGLES, quadCount * 6, GL_UNSIGNED_SHORT, NULL );
+    }
+    else
+    {
+        // No, so draw the quads from client-side arrays.
+        glDrawElements( GL_TRIANGLES, quadCount * 6, GL_UNSIGNED_SHORT, smQuadIndices );
+
+        // Stats.
+        // NOTE: Client-side arrays are copied by the driver on every draw.
+        mpDebugStats->batchBytesUploaded += quadCount * (6 * sizeof(U16) + 4 * mBatchVertexStride);
+    }
+
+    // Restore the vertex arrays.
+    if ( startVertex != 0 )
+        bindVertexArrays( 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::createBuffers( void )
+{
+    // Finish if vertex buffers are not supported.
+    if ( !dglDoesSupportVertexBuffer() )
+        return;
+
+    // Generate the buffers.
+    glGenBuffers( 1, &mVertexBufferName );
+    glGenBuffers( 1, &mIndexBufferName );
+    glGenBuffers( 1, &mQuadIndexBufferName );
+
+    // Allocate the vertex ring.
+    glBindBuffer( GL_ARRAY_BUFFER, mVertexBufferName );
+    glBufferData( GL_ARRAY_BUFFER, BATCHRENDER_RINGBUFFERSIZE * getVertexCapacityStride( mVertexFormat ), NULL, BATCHRENDER_STREAM_USAGE );
+    glBindBuffer( GL_ARRAY_BUFFER, 0 );
+    mVertexRingOffset = 0;
+
+    // Upload the cached quad indices.
+    glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, mQuadIndexBufferName );
+    glBufferData( GL_ELEMENT_ARRAY_BUFFER, sizeof(smQuadIndices), smQuadIndices, GL_STATIC_DRAW );
+    glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::destroyBuffers( void )
+{
+    // Finish if no buffers.
+    if ( mVertexBufferName == 0 )
+        return;
+
+    // Delete the buffers.
+    const GLuint bufferNames[] = { mVertexBufferName, mIndexBufferName, mQuadIndexBufferName };
+    glDeleteBuffers( 3, bufferNames );
+
+    mVertexBufferName = 0;
+    mIndexBufferName = 0;
+    mQuadIndexBufferName = 0;
+    mVertexRingOffset = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::textureEventCallback( const TextureManager::TextureEventCode eventCode, void* pUserData )
+{
+    // Release the buffers when the render context is going away.
+    // NOTE: They are recreated on demand at the next flush.
+    if ( eventCode == TextureManager::BeginZombification )
+    {
+        static_cast<BatchRender*>( pUserData )->destroyBuffers();
+
+        // Invalidate any cached batches as their buffers and textures are going away too.
+        BatchRenderCache::smContextGeneration++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+template< class VertexType >
+void BatchRender::writeVertices( const U32 vertexCount, const Vector2* pVertexArray, const Vector2* pTextureArray, const ColorF& color )
+{
+    // Fetch the first vertex.
+    VertexType* pVertex = reinterpret_cast<VertexType*>( mVertexBuffer ) + mVertexCount;
+
+    // Is a color specified?
+    if ( color != NoColor )
+    {
+        // Yes, so fetch the vertex color.
+        const typename VertexType::ColorType vertexColor = VertexType::packColor( color );
+
+        // Add colored vertices.
+        for( U32 n = 0; n < vertexCount; ++n, ++pVertex )
+        {
+            pVertex->mPosition = *(pVertexArray++);
+            pVertex->setTexCoord( *(pTextureArray++) );
+            pVertex->mColor = vertexColor;
+        }
+
+        mColorCount += vertexCount;
+    }
+    else
+    {
+        // No, so add textured vertices.
+        for( U32 n = 0; n < vertexCount; ++n, ++pVertex )
+        {
+            pVertex->mPosition = *(pVertexArray++);
+            pVertex->setTexCoord( *(pTextureArray++) );
+        }
+    }
+
+    // Increase vertex count.
+    mVertexCount += vertexCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::writeVertices( const U32 vertexCount, const Vector2* pVertexArray, const Vector2* pTextureArray, const ColorF& color )
+{
+    // Write vertices for the batch vertex format.
+    switch( mBatchVertexFormat )
+    {
+        case VERTEX_FORMAT_PACKED_COLOR:
+            writeVertices<PackedColorVertex>( vertexCount, pVertexArray, pTextureArray, color );
+            break;
+
+        case VERTEX_FORMAT_PACKED:
+            writeVertices<PackedVertex>( vertexCount, pVertexArray, pTextureArray, color );
+            break;
+
+        default:
+            writeVertices<FloatVertex>( vertexCount, pVertexArray, pTextureArray, color );
+            break;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRender::addTriangleRun( TextureHandle& handle, const TriangleRun::PrimitiveMode primitive, const U32 primitiveCount )
+{
+    // Fetch texture batch.
+    indexVectorType* pIndexVector = findTextureBatch( handle );
+
+    // Do we have a previous triangle run?
+    if ( pIndexVector->size() > 0 )
+    {
+        // Yes, so fetch it.
+        TriangleRun& lastRun = pIndexVector->last();
+
+        // Is the new run contiguous with the previous one?
+        const U32 verticesPerPrimitive = primitive == TriangleRun::QUAD ? 4 : 3;
+        if ( lastRun.mPrimitiveMode == primitive && (lastRun.mStartIndex + lastRun.mPrimitiveCount * verticesPerPrimitive) == mVertexCount )
+        {
+            // Yes, so extend the previous run.
+            lastRun.mPrimitiveCount += primitiveCount;
+            return;
+        }
+    }
+
+    // Add triangle run.
+    pIndexVector->push_back( TriangleRun( primitive, primitiveCount, mVertexCount ) );
 }
 
 //-----------------------------------------------------------------------------
@@ -606,3 +1421,55 @@ BatchRender::indexVectorType* BatchRender::findTextureBatch( TextureHandle& hand
 }
 
 
+
+//-----------------------------------------------------------------------------
+
+BatchRenderCache::BatchRenderCache() :
+    mVertexBufferName( 0 ),
+    mIndexBufferName( 0 ),
+    mContextGeneration( smContextGeneration ),
+    mTextureGeneration( TextureManager::getTextureNameGeneration() )
+{
+}
+
+//-----------------------------------------------------------------------------
+
+BatchRenderCache::~BatchRenderCache()
+{
+    // Destroy the vertex/index buffers.
+    destroyBuffers();
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderCache::clear( void )
+{
+    // Destroy the vertex/index buffers.
+    destroyBuffers();
+
+    // Clear the cached batches.
+    // NOTE: The storage is kept so recapturing doesn't reallocate.
+    mVertices.clear();
+    mIndices.clear();
+    mDraws.clear();
+    mBatches.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void BatchRenderCache::destroyBuffers( void )
+{
+    // Finish if no buffers.
+    if ( mVertexBufferName == 0 )
+        return;
+
+    // Delete the buffers if they belong to the current render context.
+    if ( isContextValid() )
+    {
+        const GLuint bufferNames[] = { mVertexBufferName, mIndexBufferName };
+        glDeleteBuffers( 2, bufferNames );
+    }
+
+    mVertexBufferName = 0;
+    mIndexBufferName = 0;
+}
@@ -51,15 +51,42 @@
 
 #define BATCHRENDER_BUFFERSIZE      (65535)
 #define BATCHRENDER_MAXTRIANGLES    (BATCHRENDER_BUFFERSIZE/3)
+#define BATCHRENDER_MAXQUADS        (BATCHRENDER_BUFFERSIZE/4)
+#define BATCHRENDER_RINGBUFFERSIZE  (BATCHRENDER_BUFFERSIZE*2)
+
+/// Scale of packed (normalized 16-bit) texture coordinates.
+#define BATCHRENDER_TEXCOORD_SCALE  (32767.0f)
+
+/// The vertex format used unless one is specified.
+#ifndef BATCHRENDER_DEFAULT_VERTEXFORMAT
+#define BATCHRENDER_DEFAULT_VERTEXFORMAT    BatchRender::VERTEX_FORMAT_FLOAT
+#endif
 
 //-----------------------------------------------------------------------------
 
 class SceneRenderRequest;
+class BatchRenderCache;
 
 //-----------------------------------------------------------------------------
 
 class BatchRender
 {
+public:
+    enum VertexFormat
+    {
+        VERTEX_FORMAT_INVALID,
+
+        /// Float position, texture coordinate and color (32 bytes).
+        VERTEX_FORMAT_FLOAT,
+
+        /// Float position and texture coordinate with an RGBA8 color (20 bytes).
+        VERTEX_FORMAT_PACKED_COLOR,
+
+        /// Float position, normalized 16-bit texture coordinate and an RGBA8 color (16 bytes).
+        /// NOTE: Texture coordinates are clamped to [0,1] so repeating texture coordinates are not supported.
+        VERTEX_FORMAT_PACKED,
+    };
+
 private:
     struct TriangleRun
     {
@@ -80,6 +107,56 @@ private:
         U32 mStartIndex;
     };
 
+    /// Interleaved vertex layouts as uploaded to the vertex buffer.
+    struct FloatVertex
+    {
+        typedef ColorF ColorType;
+
+        Vector2 mPosition;
+        Vector2 mTexCoord;
+        ColorF  mColor;
+
+        inline void setTexCoord( const Vector2& texCoord ) { mTexCoord = texCoord; }
+        static inline const ColorF& packColor( const ColorF& color ) { return color; }
+    };
+
+    struct PackedColorVertex
+    {
+        typedef ColorI ColorType;
+
+        Vector2 mPosition;
+        Vector2 mTexCoord;
+        ColorI  mColor;
+
+        inline void setTexCoord( const Vector2& texCoord ) { mTexCoord = texCoord; }
+        static inline ColorI packColor( const ColorF& color )
+        {
+            return ColorI(
+                (U8)(mClampF( color.red, 0.0f, 1.0f ) * 255.0f + 0.5f),
+                (U8)(mClampF( color.green, 0.0f, 1.0f ) * 255.0f + 0.5f),
+                (U8)(mClampF( color.blue, 0.0f, 1.0f ) * 255.0f + 0.5f),
+                (U8)(mClampF( color.alpha, 0.0f, 1.0f ) * 255.0f + 0.5f) );
+        }
+    };
+
+    /// Texture coordinates are clamped to [0,1] so batches with coordinates outside
+    /// that range (tiling, scrolling) fall back to the packed color format.
+    struct PackedVertex
+    {
+        typedef ColorI ColorType;
+
+        Vector2 mPosition;
+        S16     mTexCoord[2];
+        ColorI  mColor;
+
+        inline void setTexCoord( const Vector2& texCoord )
+        {
+            mTexCoord[0] = (S16)(mClampF( texCoord.x, 0.0f, 1.0f ) * BATCHRENDER_TEXCOORD_SCALE + 0.5f);
+            mTexCoord[1] = (S16)(mClampF( texCoord.y, 0.0f, 1.0f ) * BATCHRENDER_TEXCOORD_SCALE + 0.5f);
+        }
+        static inline ColorI packColor( const ColorF& color ) { return PackedColorVertex::packColor( color ); }
+    };
+
     typedef Vector<TriangleRun> indexVectorType;
     typedef HashMap<U32, indexVectorType*> textureBatchType;
 
@@ -88,16 +165,27 @@ private:
 
     const ColorF        NoColor;
 
-    Vector2             mVertexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    Vector2             mTextureBuffer[ BATCHRENDER_BUFFERSIZE ];
+    VertexFormat        mVertexFormat;
+    U32                 mVertexStride;
+    VertexFormat        mBatchVertexFormat;
+    U32                 mBatchVertexStride;
+    U8*                 mVertexBuffer;
     U16                 mIndexBuffer[ BATCHRENDER_BUFFERSIZE ];
-    ColorF              mColorBuffer[ BATCHRENDER_BUFFERSIZE ];
    
     U32                 mTriangleCount;
     U32                 mVertexCount;
-    U32                 mTextureCoordCount;
     U32                 mIndexCount;
     U32                 mColorCount;
+    bool                mQuadsOnly;
+
+    GLuint              mVertexBufferName;
+    GLuint              mIndexBufferName;
+    GLuint              mQuadIndexBufferName;
+    U32                 mVertexRingOffset;
+    U32                 mTextureEventKey;
+
+    static U16          smQuadIndices[ BATCHRENDER_MAXQUADS * 6 ];
+    static bool         smQuadIndicesGenerated;
 
     bool                mBlendMode;
     GLenum              mSrcBlendFactor;
@@ -112,6 +200,8 @@ private:
     bool                mWireframeMode;
     bool                mBatchEnabled;
 
+    BatchRenderCache*   mpCaptureCache;
+
 public:
     BatchRender();
     virtual ~BatchRender();
@@ -216,6 +306,18 @@ public:
     /// Gets the batch enabled mode.
     inline bool getBatchEnabled( void ) const { return mBatchEnabled; }
 
+    /// Sets the vertex format.
+    void setVertexFormat( const VertexFormat vertexFormat );
+
+    /// Gets the vertex format.
+    inline VertexFormat getVertexFormat( void ) const { return mVertexFormat; }
+
+    /// Gets the vertex stride (in bytes) of the vertex format.
+    inline U32 getVertexStride( void ) const { return mVertexStride; }
+
+    /// Gets the vertex format used by the current batch.
+    inline VertexFormat getBatchVertexFormat( void ) const { return mBatchVertexFormat; }
+
     /// Sets the debug stats to use.
     inline void setDebugStats( DebugStats* pDebugStats ) { mpDebugStats = pDebugStats; }
 
@@ -285,12 +387,166 @@ public:
     /// Flush (render) any pending batches.
     void flush( void );
 
+    /// Discard any pending batches without rendering them.
+    void discard( void );
+
+    /// Start capturing flushed batches into the specified cache.
+    /// NOTE: Batches are still rendered as they are captured.
+    void beginCapture( BatchRenderCache* pBatchRenderCache );
+
+    /// Stop capturing flushed batches.
+    void endCapture( void );
+
+    /// Gets whether flushed batches are being captured.
+    inline bool isCapturing( void ) const { return mpCaptureCache != NULL; }
+
+    /// Render the batches previously captured into the specified cache.
+    void render( BatchRenderCache* pBatchRenderCache );
+
+    static VertexFormat getVertexFormatEnum( const char* label );
+    static const char* getVertexFormatDescription( const VertexFormat vertexFormat );
+
 private:
     /// Flush (render) any pending batches.
     void flushInternal( void );
 
+    /// Build the triangle indices for a texture batch into the index buffer.
+    void buildBatchIndices( const indexVectorType* pIndexVector );
+
     /// Find texture batch.
     indexVectorType* findTextureBatch( TextureHandle& handle );
+
+    /// Write vertices using the specified vertex layout.
+    template< class VertexType > void writeVertices( const U32 vertexCount, const Vector2* pVertexArray, const Vector2* pTextureArray, const ColorF& color );
+
+    /// Write vertices using the current vertex format.
+    void writeVertices( const U32 vertexCount, const Vector2* pVertexArray, const Vector2* pTextureArray, const ColorF& color );
+
+    /// Add a triangle run to a texture batch, merging it with the previous run if contiguous.
+    void addTriangleRun( TextureHandle& handle, const TriangleRun::PrimitiveMode primitive, const U32 primitiveCount );
+
+    /// Upload the pending vertices and bind the vertex arrays.
+    void uploadVertices( void );
+
+    /// Bind the vertex arrays starting at the specified vertex.
+    void bindVertexArrays( const U32 startVertex );
+
+    /// Draw indexed triangles from the pending vertices.
+    void drawIndexed( const U16* pIndices, const U32 indexCount );
+
+    /// Draw a contiguous run of quads using the cached quad indices.
+    void drawQuads( const U32 startVertex, const U32 quadCount );
+
+    /// Capture the pending vertices and render state as a new cached batch.
+    void captureBatch( void );
+
+    /// Capture a draw of the pending vertices into the current cached batch.
+    void captureDraw( const GLuint textureName, const U16* pIndices, const U32 indexCount, const U32 startVertex );
+
+    /// Apply the render state used to draw a batch.
+    static void applyRenderState(
+            const bool wireframeMode,
+            const bool blendMode,
+            const GLenum srcBlendFactor,
+            const GLenum dstBlendFactor,
+            const ColorF& blendColor,
+            const F32 alphaTestMode,
+            const bool colors,
+            const bool packedTexCoords );
+
+    /// Reset the render state used to draw a batch.
+    static void resetRenderState( const bool packedTexCoords );
+
+    /// Set the interleaved vertex arrays for the specified vertex format.
+    static void setVertexArrays( const VertexFormat vertexFormat, const U8* pVertexBase, const bool colors );
+
+    /// Gets the vertex stride (in bytes) of the specified vertex format.
+    static U32 getVertexFormatStride( const VertexFormat vertexFormat );
+
+    /// Gets the vertex stride (in bytes) the vertex buffers are sized by for the specified vertex format.
+    static U32 getVertexCapacityStride( const VertexFormat vertexFormat );
+
+    /// Select the vertex format of the current batch for the specified texture coordinates.
+    void selectBatchVertexFormat( const U32 vertexCount, const Vector2* pTextureArray );
+
+    /// Create the vertex/index buffers if supported.
+    void createBuffers( void );
+
+    /// Destroy the vertex/index buffers.
+    void destroyBuffers( void );
+
+    /// Texture manager event callback (used to track context loss).
+    static void textureEventCallback( const TextureManager::TextureEventCode eventCode, void* pUserData );
+};
+
+//-----------------------------------------------------------------------------
+
+/// The compiled and sorted batches captured by a BatchRender so they can be
+/// rendered again without re-submitting any geometry.
+class BatchRenderCache
+{
+    friend class BatchRender;
+
+private:
+    struct CachedDraw
+    {
+        GLuint  mTextureName;
+        U32     mIndexStart;
+        U32     mIndexCount;
+    };
+
+    struct CachedBatch
+    {
+        BatchRender::VertexFormat mVertexFormat;
+        U32     mVertexStart;
+        bool    mColors;
+        bool    mWireframeMode;
+        bool    mBlendMode;
+        GLenum  mSrcBlendFactor;
+        GLenum  mDstBlendFactor;
+        ColorF  mBlendColor;
+        F32     mAlphaTestMode;
+        U32     mDrawStart;
+        U32     mDrawCount;
+    };
+
+    typedef Vector<CachedDraw> typeCachedDrawVector;
+    typedef Vector<CachedBatch> typeCachedBatchVector;
+
+    Vector<U8>              mVertices;
+    Vector<U16>             mIndices;
+    typeCachedDrawVector    mDraws;
+    typeCachedBatchVector   mBatches;
+
+    GLuint                  mVertexBufferName;
+    GLuint                  mIndexBufferName;
+    U32                     mContextGeneration;
+    U32                     mTextureGeneration;
+
+    static U32              smContextGeneration;
+
+public:
+    BatchRenderCache();
+    virtual ~BatchRenderCache();
+
+    /// Clear the cached batches.
+    void clear( void );
+
+    /// Gets whether there are any cached batches.
+    inline bool isEmpty( void ) const { return mBatches.size() == 0; }
+
+    /// Gets whether the cached batches were captured in the current render context.
+    inline bool isContextValid( void ) const { return mContextGeneration == smContextGeneration; }
+
+    /// Gets whether the cached batches can be rendered i.e. the render context is the same and none of the texture names used may have been deleted.
+    inline bool isValid( void ) const { return isContextValid() && mTextureGeneration == TextureManager::getTextureNameGeneration(); }
+
+    /// Gets the cached triangle count.
+    inline U32 getTriangleCount( void ) const { return mIndices.size() / 3; }
+
+private:
+    /// Destroy the vertex/index buffers.
+    void destroyBuffers( void );
 };
 
 #endif
\ No newline at end of file
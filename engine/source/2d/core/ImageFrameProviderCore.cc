@@ -280,6 +280,10 @@ void ImageFrameProviderCore::renderGui( GuiControl& owner, Point2I offset, const
         const ImageAsset::FrameArea& frameArea = getProviderImageFrameArea();
         RectI sourceRegion( frameArea.mPixelArea.mPixelOffset, Point2I(frameArea.mPixelArea.mPixelWidth, frameArea.mPixelArea.mPixelHeight) );
 
+        // Offset the source region if the image is in an atlas page.
+        const ImageAsset* pImageAsset = isStaticFrameProvider() ? (const ImageAsset*)(*mpImageAsset) : (const ImageAsset*)((*mpAnimationAsset)->getImage());
+        sourceRegion.point += pImageAsset->getAtlasOffset();
+
         // Calculate destination region.
         RectI destinationRegion(offset, owner.mBounds.extent);
 
@@ -372,6 +376,9 @@ bool ImageFrameProviderCore::setImageFrame( const U32 frame )
     // Using a numerical frame index.
     mUsingNamedFrame = false;
 
+    // Frame changed.
+    onFrameChanged();
+
     // Return Okay.
     return true;
 }
@@ -402,6 +409,9 @@ bool ImageFrameProviderCore::setNamedImageFrame(const char* pNamedFrame)
     // Set Frame.
     mNamedImageFrame = StringTable->insert(pNamedFrame);
     mUsingNamedFrame = true;
+
+    // Frame changed.
+    onFrameChanged();
     
     // Return Okay.
     return true;
@@ -580,6 +590,9 @@ bool ImageFrameProviderCore::playAnimation( const AssetPtr<AnimationAsset>& anim
     // Do an initial animation update.
     updateAnimation(0.0f);
 
+    // Frame changed.
+    onFrameChanged();
+
     // Return Okay.
     return true;
 }
@@ -647,6 +660,10 @@ bool ImageFrameProviderCore::updateAnimation( const F32 elapsedTime )
     // Reset Last Frame.
     mLastFrameIndex = mCurrentFrameIndex;
 
+    // Notify if the frame changed.
+    if ( frameChanged )
+        onFrameChanged();
+
     // Return Frame-Changed Flag.
     return frameChanged;
 }
@@ -695,6 +712,9 @@ void ImageFrameProviderCore::clearAssets( void )
     mNamedImageFrame = StringTable->EmptyString;
     mStaticProvider = true;
     setProcessTicks( false );
+
+    // Frame changed.
+    onFrameChanged();
 }
 
 //-----------------------------------------------------------------------------
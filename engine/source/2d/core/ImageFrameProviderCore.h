@@ -154,6 +154,7 @@ public:
 
 protected:
     virtual void onAnimationEnd( void ) {}
+    virtual void onFrameChanged( void ) {}
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 };
 
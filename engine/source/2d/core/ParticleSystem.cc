@@ -46,89 +46,162 @@ void ParticleSystem::destroy( void )
 //------------------------------------------------------------------------------
 
 ParticleSystem::ParticleSystem() :
-                    mParticlePoolBlockSize(512)
+                    mActiveParticleCount(0),
+                    mAllocatedParticleCount(0)
 {
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
-
-    // Reset the active particle count.
-    mActiveParticleCount = 0;
 }
 
 //------------------------------------------------------------------------------
 
 ParticleSystem::~ParticleSystem()
 {
-    // Destroy all the particle pool blocks.
-    for ( U32 n = 0; n < (U32)mParticlePool.size(); n++ )
-        delete [] mParticlePool[n];
+    // Sanity!
+    AssertWarn( mActiveParticleCount == 0, "ParticleSystem::~ParticleSystem() - Particles are still active." );
+}
+
+//------------------------------------------------------------------------------
+
+// Stream alignment (in bytes).
+#define PARTICLE_STORE_ALIGNMENT        16
 
-    // Clear the particle pool.
-    mParticlePool.clear();
+// Initial stream capacity (in particles).
+#define PARTICLE_STORE_MIN_CAPACITY     32
 
-    // Reset the free particle head.
-    mpFreeParticleNodes = NULL;
+//------------------------------------------------------------------------------
+
+static inline dsize_t alignParticleStream( const dsize_t size )
+{
+    return (size + (PARTICLE_STORE_ALIGNMENT-1)) & ~((dsize_t)PARTICLE_STORE_ALIGNMENT-1);
 }
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticleSystem::createParticle( void )
+ParticleSystem::ParticleStore::ParticleStore() :
+                    mpBlock(NULL),
+                    mCount(0),
+                    mCapacity(0),
+                    mpColors(NULL),
+                    mpFrames(NULL),
+                    mpRenderOOBBs(NULL)
 {
-    // Have we got any free particle nodes?
-    if ( mpFreeParticleNodes == NULL )
-    {
-        // No, so generate a new free pool block.
-        ParticleNode* pFreePoolBlock = new ParticleNode[mParticlePoolBlockSize];
+    for ( U32 stream = 0; stream < STREAM_COUNT; ++stream )
+        mStreams[stream] = NULL;
+}
 
-        // Store new free pool block.
-        mParticlePool.push_back( pFreePoolBlock );
+//------------------------------------------------------------------------------
 
-        // Initialise Free Pool Block.
-        for ( U32 n = 0; n < (mParticlePoolBlockSize-1); n++ )
-        {
-            pFreePoolBlock[n].mPreviousNode = NULL;
-            pFreePoolBlock[n].mNextNode     = pFreePoolBlock+n+1;
-        }
+ParticleSystem::ParticleStore::~ParticleStore()
+{
+    // Free all the particles.
+    freeAllParticles();
 
-        // Insert Last Node Preceding any existing free nodes.
-        pFreePoolBlock[mParticlePoolBlockSize-1].mPreviousNode = NULL;
-        pFreePoolBlock[mParticlePoolBlockSize-1].mNextNode = mpFreeParticleNodes;
+    // Finish if nothing allocated.
+    if ( mpBlock == NULL )
+        return;
 
-        // Set Free References.
-        mpFreeParticleNodes = pFreePoolBlock;
-    }
+    // Free the streams.
+    dFree( mpBlock );
 
-    // Fetch a free node,
-    ParticleNode* pFreeParticleNode = mpFreeParticleNodes;
+    // Update the allocated particle count.
+    ParticleSystem::Instance->mAllocatedParticleCount -= mCapacity;
+}
 
-    // Set the new free node reference.
-    mpFreeParticleNodes = mpFreeParticleNodes->mNextNode;
+//------------------------------------------------------------------------------
 
-    // Reset any previous or next node references.
-    pFreeParticleNode->mNextNode        = NULL;
-    pFreeParticleNode->mPreviousNode    = NULL;
+U32 ParticleSystem::ParticleStore::createParticle( void )
+{
+    // Grow the streams if full.
+    if ( mCount == mCapacity )
+        reserve( mCapacity == 0 ? PARTICLE_STORE_MIN_CAPACITY : mCapacity * 2 );
 
     // Increase the active particle count.
-    mActiveParticleCount++;
+    ParticleSystem::Instance->mActiveParticleCount++;
 
-    return pFreeParticleNode;
+    return mCount++;
 }
 
 //------------------------------------------------------------------------------
 
-void ParticleSystem::freeParticle( ParticleNode* pParticleNode )
+void ParticleSystem::ParticleStore::moveParticle( const U32 toIndex, const U32 fromIndex )
 {
-    // Reset the particle.
-    pParticleNode->resetState();
+    // Sanity!
+    AssertFatal( toIndex < mCount && fromIndex < mCount, "ParticleStore::moveParticle() - Particle index is out of range." );
+
+    // Move the streams.
+    for ( U32 stream = 0; stream < STREAM_COUNT; ++stream )
+        mStreams[stream][toIndex] = mStreams[stream][fromIndex];
+
+    mpColors[toIndex] = mpColors[fromIndex];
+    mpFrames[toIndex] = mpFrames[fromIndex];
+    dMemcpy( mpRenderOOBBs + (toIndex * 4), mpRenderOOBBs + (fromIndex * 4), sizeof(Vector2) * 4 );
+}
 
-    // Remove the previous node reference.
-    pParticleNode->mPreviousNode = NULL;
-    
-    // Insert the node into the free pool.
-    pParticleNode->mNextNode = mpFreeParticleNodes;
-    mpFreeParticleNodes = pParticleNode;
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::freeParticles( const U32 startIndex )
+{
+    // Finish if there's nothing to free.
+    if ( startIndex >= mCount )
+        return;
 
     // Decrease the active particle count.
-    mActiveParticleCount--;
+    ParticleSystem::Instance->mActiveParticleCount -= mCount - startIndex;
+
+    // Truncate the particles.
+    mCount = startIndex;
 }
 
+//------------------------------------------------------------------------------
+
+void ParticleSystem::ParticleStore::reserve( const U32 capacity )
+{
+    // Finish if there's already enough capacity.
+    if ( capacity <= mCapacity )
+        return;
+
+    // Calculate the size of the streams.
+    const dsize_t streamSize = alignParticleStream( sizeof(F32) * capacity );
+    const dsize_t colorSize = alignParticleStream( sizeof(ColorF) * capacity );
+    const dsize_t frameSize = alignParticleStream( sizeof(U32) * capacity );
+    const dsize_t renderOOBBSize = alignParticleStream( sizeof(Vector2) * 4 * capacity );
+
+    // Allocate the new streams.
+    void* pBlock = dMalloc( (streamSize * STREAM_COUNT) + colorSize + frameSize + renderOOBBSize + PARTICLE_STORE_ALIGNMENT );
+
+    // Align the start of the streams.
+    // NOTE:- The address is offset rather than converted to dsize_t and back as that is only 32-bit on some 64-bit targets.
+    U8* pStream = (U8*)pBlock;
+    pStream += (PARTICLE_STORE_ALIGNMENT - ((size_t)pStream & (PARTICLE_STORE_ALIGNMENT-1))) & (PARTICLE_STORE_ALIGNMENT-1);
+
+    // Assign the new streams, copying any existing particles.
+    for ( U32 stream = 0; stream < STREAM_COUNT; ++stream )
+    {
+        if ( mCount > 0 )
+            dMemcpy( pStream, mStreams[stream], sizeof(F32) * mCount );
+
+        mStreams[stream] = (F32*)pStream;
+        pStream += streamSize;
+    }
+
+    if ( mCount > 0 )
+    {
+        dMemcpy( pStream, mpColors, sizeof(ColorF) * mCount );
+        dMemcpy( pStream + colorSize, mpFrames, sizeof(U32) * mCount );
+        dMemcpy( pStream + colorSize + frameSize, mpRenderOOBBs, sizeof(Vector2) * 4 * mCount );
+    }
+
+    mpColors = (ColorF*)pStream;
+    mpFrames = (U32*)(pStream + colorSize);
+    mpRenderOOBBs = (Vector2*)(pStream + colorSize + frameSize);
+
+    // Free the old streams.
+    if ( mpBlock != NULL )
+        dFree( mpBlock );
+
+    mpBlock = pBlock;
+
+    // Update the allocated particle count.
+    ParticleSystem::Instance->mAllocatedParticleCount += capacity - mCapacity;
+
+    mCapacity = capacity;
+}
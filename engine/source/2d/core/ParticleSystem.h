@@ -32,59 +32,82 @@
 class ParticleSystem
 {
 public:
-    /// Particle node.
-    struct ParticleNode : public IFactoryObjectReset
+    /// Particle store.
+    /// Particles are stored as a structure-of-arrays so that each component is contiguous
+    /// and can be integrated in tight loops.  Particles are ordered oldest first.
+    class ParticleStore
     {
-        /// Particle Node Linkages.
-        ParticleNode*           mPreviousNode;
-        ParticleNode*           mNextNode;
-
-        /// Suppress Movement.
-        bool                    mSuppressMovement;
-
-        /// Particle Components.
-        F32                     mParticleLifetime;
-        F32                     mParticleAge;
-        Vector2                 mPosition;
-        Vector2                 mVelocity;
-        F32                     mOrientationAngle;
-        Vector2                 mRenderOOBB[4];
-        b2Transform             mTransform;
-        ImageFrameProviderCore  mFrameProvider;
-
-        /// Render Properties.
-        Vector2                 mRenderSize;
-        F32                     mRenderSpeed;
-        F32                     mRenderSpin;
-        F32                     mRenderFixedForce;
-        F32                     mRenderRandomMotion;
-
-        /// Base Properties.
-        Vector2                 mSize;
-        F32                     mSpeed;
-        F32                     mSpin;
-        F32                     mFixedForce;
-        F32                     mRandomMotion;
-        ColorF                  mColor;    
-
-        /// Interpolated Tick Position.
-        Vector2                 mPreTickPosition;
-        Vector2                 mPostTickPosition;
-        Vector2                 mRenderTickPosition;
-
-        ParticleNode() { constructInPlace<ImageFrameProviderCore>(&mFrameProvider); resetState(); }
-
-        virtual void resetState( void )
+    public:
+        /// Particle streams.
+        enum ParticleStream
         {
-            mFrameProvider.resetState();
-        }
+            /// Particle components.
+            AGE,
+            LIFETIME,
+            POSITION_X,
+            POSITION_Y,
+            VELOCITY_X,
+            VELOCITY_Y,
+            ORIENTATION_ANGLE,
+            ANIMATION_TIME,
+
+            /// Render properties.
+            RENDER_SIZE_X,
+            RENDER_SIZE_Y,
+            RENDER_SPEED,
+            RENDER_FIXED_FORCE,
+            RENDER_RANDOM_MOTION,
+
+            /// Base properties.
+            SIZE_X,
+            SIZE_Y,
+            SPEED,
+            SPIN,
+            FIXED_FORCE,
+            RANDOM_MOTION,
+
+            /// Pre-tick position.
+            PRE_TICK_POSITION_X,
+            PRE_TICK_POSITION_Y,
+
+            STREAM_COUNT
+        };
+
+    private:
+        void*                   mpBlock;
+        U32                     mCount;
+        U32                     mCapacity;
+
+        F32*                    mStreams[STREAM_COUNT];
+        ColorF*                 mpColors;
+        U32*                    mpFrames;
+        Vector2*                mpRenderOOBBs;
+
+    public:
+        ParticleStore();
+        ~ParticleStore();
+
+        U32 createParticle( void );
+        void moveParticle( const U32 toIndex, const U32 fromIndex );
+        void freeParticles( const U32 startIndex );
+        inline void freeAllParticles( void ) { freeParticles( 0 ); }
+
+        inline U32 getCount( void ) const { return mCount; }
+        inline U32 getCapacity( void ) const { return mCapacity; }
+
+        inline F32* getStream( const ParticleStream stream ) const { return mStreams[stream]; }
+        inline ColorF* getColors( void ) const { return mpColors; }
+        inline U32* getFrames( void ) const { return mpFrames; }
+        inline Vector2* getRenderOOBBs( void ) const { return mpRenderOOBBs; }
+        inline Vector2* getRenderOOBB( const U32 index ) const { return mpRenderOOBBs + (index * 4); }
+
+    private:
+        void reserve( const U32 capacity );
     };
 
 private:
-    const U32               mParticlePoolBlockSize;
-    Vector<ParticleNode*>   mParticlePool;
-    ParticleNode*           mpFreeParticleNodes;
     U32                     mActiveParticleCount;
+    U32                     mAllocatedParticleCount;
 
 public:
     static void Init( void );
@@ -94,11 +117,8 @@ public:
     ParticleSystem();
     ~ParticleSystem();
 
-    ParticleNode* createParticle( void );
-    void freeParticle( ParticleNode* pParticleNode );
-
     inline U32 getActiveParticleCount( void ) const { return mActiveParticleCount; };
-    inline U32 getAllocatedParticleCount( void ) const { return (U32)mParticlePool.size() * mParticlePoolBlockSize; }
+    inline U32 getAllocatedParticleCount( void ) const { return mAllocatedParticleCount; }
 };
 
 #endif // _PARTICLE_SYSTEM_H_
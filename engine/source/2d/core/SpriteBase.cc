@@ -37,7 +37,8 @@ IMPLEMENT_CONOBJECT(SpriteBase);
 
 //------------------------------------------------------------------------------
 
-SpriteBase::SpriteBase()
+SpriteBase::SpriteBase() :
+    mAnimationEndPending( false )
 {
 }
 
@@ -71,6 +72,23 @@ void SpriteBase::integrateObject( const F32 totalTime, const F32 elapsedTime, De
     ImageFrameProvider::update( elapsedTime );
 }
 
+//-----------------------------------------------------------------------------
+
+void SpriteBase::integrateDeferred( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+{
+    // Call Parent.
+    Parent::integrateDeferred( totalTime, elapsedTime, pDebugStats );
+
+    // Finish if the animation did not end during a concurrent tick.
+    if ( !mAnimationEndPending )
+        return;
+
+    mAnimationEndPending = false;
+
+    // Do script callback.
+    Con::executef( this, 1, "onAnimationEnd" );
+}
+
 //------------------------------------------------------------------------------
 
 bool SpriteBase::validRender( void ) const
@@ -99,6 +117,13 @@ void SpriteBase::copyTo(SimObject* object)
 
 void SpriteBase::onAnimationEnd( void )
 {
+    // Defer the callback if ticking concurrently.
+    if ( getTickConcurrent() )
+    {
+        mAnimationEndPending = true;
+        return;
+    }
+
     // Do script callback.
     Con::executef( this, 1, "onAnimationEnd" );
 }
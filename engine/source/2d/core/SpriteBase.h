@@ -44,6 +44,7 @@ public:
     static void initPersistFields();
 
     virtual void integrateObject( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    virtual void integrateDeferred( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
 
     virtual bool validRender( void ) const;
     virtual bool shouldRender( void ) const { return true; }
@@ -55,6 +56,10 @@ public:
 
 protected:
     virtual void onAnimationEnd( void );
+    virtual void onFrameChanged( void ) { invalidateRenderCache(); }
+
+private:
+    bool mAnimationEndPending;
 
 protected:
     static bool setImage(void* obj, const char* data)                           { DYNAMIC_VOID_CAST_TO(SpriteBase, ImageFrameProvider, obj)->setImage(data); return false; };
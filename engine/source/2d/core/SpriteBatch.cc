@@ -46,7 +46,8 @@ SpriteBatch::SpriteBatch() :
     mDefaultSpriteSize( 1.0f, 1.0f ),
     mDefaultSpriteAngle( 0.0f ),
     mpSpriteBatchQuery( NULL ),
-    mBatchCulling( true )
+    mBatchCulling( true ),
+    mBatchChunkSize( 0.0f )
 {
     // Reset batch transform.
     mBatchTransform.SetIdentity();
@@ -82,6 +83,9 @@ void SpriteBatch::onRemove()
     // Clear the sprites.
     clearSprites();
 
+    // Delete the chunks.
+    destroyChunks();
+
     // Delete the sprite batch query.
     destroySpriteBatchQuery();
 }
@@ -99,6 +103,42 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
     // Calculate local AABB.
     const b2AABB localAABB = calculateLocalAABB( pSceneRenderState->mRenderAABB );
 
+    // Are we using chunks?
+    if ( mBatchChunkSize > 0.0f )
+    {
+        // Yes, so update any chunks that have changed.
+        updateChunks();
+
+        // Debug Profiling.
+        PROFILE_SCOPE(SpriteBatch_PrepareRenderChunks);
+
+        // Iterate chunks.
+        for( typeSpriteBatchChunkHash::iterator chunkItr = mChunks.begin(); chunkItr != mChunks.end(); ++chunkItr )
+        {
+            // Fetch chunk.
+            SpriteBatchChunk* pSpriteBatchChunk = chunkItr->value;
+
+            // Skip if the chunk is not in view.
+            if ( !b2TestOverlap( pSpriteBatchChunk->mLocalAABB, localAABB ) )
+                continue;
+
+            // Create a render request.
+            SceneRenderRequest* pSceneRenderRequest = pSceneRenderQueue->createRenderRequest();
+
+            // Set the chunk position.
+            pSceneRenderRequest->mWorldPosition = b2Mul( mBatchTransform, pSpriteBatchChunk->mLocalAABB.GetCenter() );
+            pSceneRenderRequest->mSerialId = (S32)pSpriteBatchChunk->mChunkKey;
+
+            // Set identity.
+            pSceneRenderRequest->mpSceneRenderObject = pSceneRenderObject;
+
+            // Set custom data.
+            pSceneRenderRequest->mpCustomData2 = pSpriteBatchChunk;
+        }
+
+        return;
+    }
+
     // Do we have a sprite batch query?
     if ( mpSpriteBatchQuery != NULL )
     {
@@ -181,6 +221,14 @@ void SpriteBatch::prepareRender( SceneRenderObject* pSceneRenderObject, const Sc
 
 void SpriteBatch::render( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer )
 {
+    // Is this a chunk?
+    if ( pSceneRenderRequest->mpCustomData2 != NULL )
+    {
+        // Yes, so render the chunk.
+        renderChunk( (SpriteBatchChunk*)pSceneRenderRequest->mpCustomData2, pBatchRenderer );
+        return;
+    }
+
     // Fetch sprite batch Item.
     SpriteBatchItem* pSpriteBatchItem = (SpriteBatchItem*)pSceneRenderRequest->mpCustomData1;
 
@@ -275,6 +323,9 @@ void SpriteBatch::copyTo( SpriteBatch* pSpriteBatch ) const
     // Set batch culling.
     pSpriteBatch->setBatchCulling( getBatchCulling() );
 
+    // Set batch chunk size.
+    pSpriteBatch->setBatchChunkSize( getBatchChunkSize() );
+
     // Set sprite default size and angle.
     pSpriteBatch->setDefaultSpriteStride( getDefaultSpriteStride() );
     pSpriteBatch->setDefaultSpriteSize( getDefaultSpriteSize() );
@@ -402,6 +453,27 @@ void SpriteBatch::setBatchCulling( const bool batchCulling )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::setBatchChunkSize( const F32 chunkSize )
+{
+    // Fetch the new chunk size.
+    const F32 newChunkSize = chunkSize > 0.0f ? chunkSize : 0.0f;
+
+    // Finish if no change.
+    if ( mIsEqual( mBatchChunkSize, newChunkSize ) )
+        return;
+
+    // Destroy the existing chunks.
+    destroyChunks();
+
+    // Set batch chunk size.
+    mBatchChunkSize = newChunkSize;
+
+    // Create the new chunks.
+    createChunks();
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::selectSprite( const SpriteBatchItem::LogicalPosition& logicalPosition )
 {
     // Select sprite.
@@ -627,6 +699,7 @@ void SpriteBatch::clearSpriteAsset( void )
 
     // Clear the asset.
     mSelectedSprite->clearAssets();
+    mSelectedSprite->invalidateRenderCache();
 }
 
 //------------------------------------------------------------------------------
@@ -1355,6 +1428,310 @@ void SpriteBatch::destroySpriteBatchQuery( void )
 
 //------------------------------------------------------------------------------
 
+void SpriteBatch::createChunks( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_CreateChunks);
+
+    // Finish if chunks are not being used.
+    if ( mBatchChunkSize <= 0.0f )
+        return;
+
+    // Add all the sprites to chunks.
+    for( typeSpriteBatchHash::iterator spriteItr = mSprites.begin(); spriteItr != mSprites.end(); ++spriteItr )
+    {
+        addChunkSprite( spriteItr->value );
+    }
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::destroyChunks( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_DestroyChunks);
+
+    // Iterate chunks.
+    for( typeSpriteBatchChunkHash::iterator chunkItr = mChunks.begin(); chunkItr != mChunks.end(); ++chunkItr )
+    {
+        // Fetch chunk.
+        SpriteBatchChunk* pSpriteBatchChunk = chunkItr->value;
+
+        // Remove the sprites from the chunk.
+        for( Vector<SpriteBatchItem*>::iterator spriteItr = pSpriteBatchChunk->mSprites.begin(); spriteItr != pSpriteBatchChunk->mSprites.end(); ++spriteItr )
+        {
+            (*spriteItr)->setSpriteBatchChunk( NULL );
+        }
+
+        delete pSpriteBatchChunk;
+    }
+
+    mChunks.clear();
+    mChunkMoves.clear();
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::addChunkSprite( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch::addChunkSprite() - Cannot add a NULL sprite batch item to a chunk." );
+
+    // Finish if chunks are not being used.
+    if ( mBatchChunkSize <= 0.0f )
+        return;
+
+    // Move the sprite to its chunk.
+    moveChunkSprite( pSpriteBatchItem, getChunkKey( pSpriteBatchItem->getLocalPosition() ) );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::removeChunkSprite( SpriteBatchItem* pSpriteBatchItem )
+{
+    // Sanity!
+    AssertFatal( pSpriteBatchItem != NULL, "SpriteBatch::removeChunkSprite() - Cannot remove a NULL sprite batch item from a chunk." );
+
+    // Fetch chunk.
+    SpriteBatchChunk* pSpriteBatchChunk = pSpriteBatchItem->getSpriteBatchChunk();
+
+    // Finish if the sprite is not in a chunk.
+    if ( pSpriteBatchChunk == NULL )
+        return;
+
+    // Remove the sprite from the chunk.
+    Vector<SpriteBatchItem*>& chunkSprites = pSpriteBatchChunk->mSprites;
+    for ( U32 index = 0; index < (U32)chunkSprites.size(); ++index )
+    {
+        if ( chunkSprites[index] != pSpriteBatchItem )
+            continue;
+
+        chunkSprites.erase_fast( index );
+        break;
+    }
+    pSpriteBatchItem->setSpriteBatchChunk( NULL );
+    pSpriteBatchChunk->mDirty = true;
+
+    // Finish if the chunk still has sprites.
+    if ( chunkSprites.size() > 0 )
+        return;
+
+    // Delete the empty chunk.
+    mChunks.erase( pSpriteBatchChunk->mChunkKey );
+    delete pSpriteBatchChunk;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::moveChunkSprite( SpriteBatchItem* pSpriteBatchItem, const U32 chunkKey )
+{
+    // Remove from any existing chunk.
+    removeChunkSprite( pSpriteBatchItem );
+
+    // Find the chunk.
+    SpriteBatchChunk* pSpriteBatchChunk;
+    typeSpriteBatchChunkHash::iterator chunkItr = mChunks.find( chunkKey );
+
+    // Did we find the chunk?
+    if ( chunkItr == mChunks.end() )
+    {
+        // No, so create it.
+        pSpriteBatchChunk = new SpriteBatchChunk( chunkKey );
+        mChunks.insert( chunkKey, pSpriteBatchChunk );
+    }
+    else
+    {
+        // Yes, so use it.
+        pSpriteBatchChunk = chunkItr->value;
+    }
+
+    // Add the sprite to the chunk.
+    pSpriteBatchChunk->mSprites.push_back( pSpriteBatchItem );
+    pSpriteBatchItem->setSpriteBatchChunk( pSpriteBatchChunk );
+    pSpriteBatchChunk->mDirty = true;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::updateChunks( void )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_UpdateChunks);
+
+    // Update the chunks that have changed.
+    for( typeSpriteBatchChunkHash::iterator chunkItr = mChunks.begin(); chunkItr != mChunks.end(); ++chunkItr )
+    {
+        if ( chunkItr->value->mDirty )
+            updateChunk( chunkItr->value );
+    }
+
+    // Finish if no sprites have moved chunk.
+    if ( mChunkMoves.size() == 0 )
+        return;
+
+    // Move the sprites to their new chunks.
+    // NOTE:- This is done after iterating the chunks as it can create and delete chunks.
+    for( Vector<SpriteBatchItem*>::iterator spriteItr = mChunkMoves.begin(); spriteItr != mChunkMoves.end(); ++spriteItr )
+    {
+        moveChunkSprite( *spriteItr, getChunkKey( (*spriteItr)->getLocalPosition() ) );
+    }
+    mChunkMoves.clear();
+
+    // Update the chunks the sprites moved to and from.
+    for( typeSpriteBatchChunkHash::iterator chunkItr = mChunks.begin(); chunkItr != mChunks.end(); ++chunkItr )
+    {
+        if ( chunkItr->value->mDirty )
+            updateChunk( chunkItr->value );
+    }
+
+    // Sanity!
+    AssertFatal( mChunkMoves.size() == 0, "SpriteBatch::updateChunks() - Sprites moved chunk after being moved to their chunk." );
+}
+
+//------------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK chunkSpriteBatchIdSort( const void* a, const void* b )
+{
+    const U32 batchIdA = (*(SpriteBatchItem**)a)->getBatchId();
+    const U32 batchIdB = (*(SpriteBatchItem**)b)->getBatchId();
+
+    return batchIdA < batchIdB ? -1 : batchIdA > batchIdB ? 1 : 0;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::updateChunk( SpriteBatchChunk* pSpriteBatchChunk )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_UpdateChunk);
+
+    // Fetch the chunk sprites.
+    Vector<SpriteBatchItem*>& chunkSprites = pSpriteBatchChunk->mSprites;
+
+    // Sort the sprites so they always render in the order they were added.
+    dQsort( chunkSprites.address(), chunkSprites.size(), sizeof(SpriteBatchItem*), chunkSpriteBatchIdSort );
+
+    // Reset the chunk.
+    pSpriteBatchChunk->mCacheable = true;
+    pSpriteBatchChunk->mCacheValid = false;
+    pSpriteBatchChunk->mLocalAABB.lowerBound.SetZero();
+    pSpriteBatchChunk->mLocalAABB.upperBound.SetZero();
+
+    bool firstSprite = true;
+
+    // Iterate the chunk sprites.
+    for( Vector<SpriteBatchItem*>::iterator spriteItr = chunkSprites.begin(); spriteItr != chunkSprites.end(); ++spriteItr )
+    {
+        // Fetch sprite batch item.
+        SpriteBatchItem* pSpriteBatchItem = *spriteItr;
+
+        // Has the sprite moved to another chunk?
+        if ( getChunkKey( pSpriteBatchItem->getLocalPosition() ) != pSpriteBatchChunk->mChunkKey )
+        {
+            // Yes, so move it later.
+            mChunkMoves.push_back( pSpriteBatchItem );
+            continue;
+        }
+
+        // Fetch the sprite local AABB.
+        const b2AABB& localAABB = pSpriteBatchItem->getLocalAABB();
+
+        // Combine with the chunk local AABB.
+        if ( firstSprite )
+        {
+            pSpriteBatchChunk->mLocalAABB = localAABB;
+            firstSprite = false;
+        }
+        else
+        {
+            pSpriteBatchChunk->mLocalAABB.Combine( localAABB );
+        }
+
+        // Animated sprites change without the chunk knowing so the chunk cannot be cached.
+        if ( !pSpriteBatchItem->isStaticFrameProvider() )
+            pSpriteBatchChunk->mCacheable = false;
+    }
+
+    // Flag the chunk as NOT dirty.
+    pSpriteBatchChunk->mDirty = false;
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatch::renderChunk( SpriteBatchChunk* pSpriteBatchChunk, BatchRender* pBatchRenderer )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatch_RenderChunk);
+
+    // Can the chunk render from its cache?
+    // NOTE:- When the renderer is already capturing (a static layer) the sprites are submitted so they are captured there too.
+    if ( pSpriteBatchChunk->mCacheValid &&
+        pSpriteBatchChunk->mCachedBatchTransformId == mBatchTransformId &&
+        pSpriteBatchChunk->mBatchCache.isValid() &&
+        !pBatchRenderer->isCapturing() )
+    {
+        // Yes, so render the cached batches.
+        pBatchRenderer->render( &pSpriteBatchChunk->mBatchCache );
+        return;
+    }
+
+    // Capture the chunk if it can be cached.
+    const bool captureChunk = pSpriteBatchChunk->mCacheable && !pBatchRenderer->isCapturing();
+    if ( captureChunk )
+        pBatchRenderer->beginCapture( &pSpriteBatchChunk->mBatchCache );
+
+    bool cacheComplete = true;
+
+    // Render the chunk sprites.
+    for( Vector<SpriteBatchItem*>::iterator spriteItr = pSpriteBatchChunk->mSprites.begin(); spriteItr != pSpriteBatchChunk->mSprites.end(); ++spriteItr )
+    {
+        // Fetch sprite batch item.
+        SpriteBatchItem* pSpriteBatchItem = *spriteItr;
+
+        // Skip if not visible.
+        if ( !pSpriteBatchItem->getVisible() )
+            continue;
+
+        // Skip if cannot render.
+        // NOTE:- The sprite may become renderable without the chunk knowing (e.g. a pending asset) so don't cache it.
+        if ( !pSpriteBatchItem->validRender() )
+        {
+            cacheComplete = false;
+            continue;
+        }
+
+        // The cache would keep the placeholder of a texture still uploading.
+        TextureObject* pTextureObject = pSpriteBatchItem->getProviderTexture();
+        if ( pTextureObject != NULL && pTextureObject->getUploadPending() )
+            cacheComplete = false;
+
+        // Render the sprite.
+        pSpriteBatchItem->render( pBatchRenderer, mBatchTransformId );
+    }
+
+    // Finish if not capturing.
+    if ( !captureChunk )
+        return;
+
+    // Finish capturing the chunk.
+    pBatchRenderer->endCapture();
+
+    // Is the cache complete?
+    if ( cacheComplete )
+    {
+        // Yes, so use it until the chunk changes.
+        pSpriteBatchChunk->mCacheValid = true;
+        pSpriteBatchChunk->mCachedBatchTransformId = mBatchTransformId;
+    }
+    else
+    {
+        // No, so release it.
+        pSpriteBatchChunk->mBatchCache.clear();
+    }
+}
+
+//------------------------------------------------------------------------------
+
 bool SpriteBatch::destroySprite( const U32 batchId )
 {
     // Debug Profiling.
@@ -1398,6 +1775,19 @@ bool SpriteBatch::checkSpriteSelected( void ) const
 
 //------------------------------------------------------------------------------
 
+U32 SpriteBatch::getChunkKey( const Vector2& localPosition ) const
+{
+    // Calculate chunk coordinates.
+    const S32 chunkX = (S32)mFloor( localPosition.x / mBatchChunkSize );
+    const S32 chunkY = (S32)mFloor( localPosition.y / mBatchChunkSize );
+
+    // Pack the chunk coordinates.
+    // NOTE:- Chunks that are far enough apart to alias simply share a chunk.
+    return ((U32)(chunkX & 0xFFFF) << 16) | (U32)(chunkY & 0xFFFF);
+}
+
+//------------------------------------------------------------------------------
+
 b2AABB SpriteBatch::calculateLocalAABB( const b2AABB& renderAABB )
 {
     // Debug Profiling.
@@ -46,6 +46,7 @@ protected:
     typedef HashMap< U32, SpriteBatchItem* > typeSpriteBatchHash;
     typedef HashMap< SpriteBatchItem::LogicalPosition, SpriteBatchItem* > typeSpritePositionHash;
     typedef HashMap< StringTableEntry, SpriteBatchItem* > typeSpriteNameHash;
+    typedef HashMap< U32, SpriteBatchChunk* > typeSpriteBatchChunkHash;
 
     typeSpriteBatchHash             mSprites;
     typeSpritePositionHash          mSpritePositions;
@@ -53,6 +54,7 @@ protected:
     SpriteBatchItem*                mSelectedSprite;
     SceneRenderQueue::RenderSort    mBatchSortMode;
     bool                            mBatchCulling;
+    F32                             mBatchChunkSize;
     Vector2                         mDefaultSpriteStride;
     Vector2                         mDefaultSpriteSize;
     F32                             mDefaultSpriteAngle;
@@ -68,6 +70,9 @@ private:
     Vector2                         mLocalExtents;
     bool                            mLocalExtentsDirty;
 
+    typeSpriteBatchChunkHash        mChunks;
+    Vector<SpriteBatchItem*>        mChunkMoves;
+
 public:
     SpriteBatch();
     virtual ~SpriteBatch();
@@ -92,6 +97,9 @@ public:
     void moveQueryProxy( SpriteBatchItem* pSpriteBatchItem, const b2AABB& localAABB );    
     SpriteBatchQuery* getSpriteBatchQuery( const bool clearQuery = false );
 
+    void addChunkSprite( SpriteBatchItem* pSpriteBatchItem );
+    void removeChunkSprite( SpriteBatchItem* pSpriteBatchItem );
+
     virtual void copyTo( SpriteBatch* pSpriteBatch ) const;
 
     inline U32 getSpriteCount( void ) { return (U32)mSprites.size(); }
@@ -106,6 +114,10 @@ public:
     void setBatchCulling( const bool batchCulling );
     inline bool getBatchCulling( void ) const { return mBatchCulling; }
 
+    void setBatchChunkSize( const F32 chunkSize );
+    inline F32 getBatchChunkSize( void ) const { return mBatchChunkSize; }
+    inline U32 getBatchChunkCount( void ) const { return (U32)mChunks.size(); }
+
     inline void setDefaultSpriteStride( const Vector2& defaultStride ) { mDefaultSpriteStride = defaultStride; }
     inline const Vector2& getDefaultSpriteStride( void ) const { return mDefaultSpriteStride; }
 
@@ -204,6 +216,10 @@ protected:
     void createSpriteBatchQuery( void );
     void destroySpriteBatchQuery( void );
 
+    void createChunks( void );
+    void destroyChunks( void );
+    void updateChunks( void );
+
     void onTamlCustomWrite( TamlCustomNodes& customNodes  );
     void onTamlCustomRead( const TamlCustomNodes& customNodes );
 
@@ -211,6 +227,11 @@ private:
     bool destroySprite( const U32 batchId );
     bool checkSpriteSelected( void ) const;
 
+    U32 getChunkKey( const Vector2& localPosition ) const;
+    void moveChunkSprite( SpriteBatchItem* pSpriteBatchItem, const U32 chunkKey );
+    void updateChunk( SpriteBatchChunk* pSpriteBatchChunk );
+    void renderChunk( SpriteBatchChunk* pSpriteBatchChunk, BatchRender* pBatchRenderer );
+
     b2AABB calculateLocalAABB( const b2AABB& renderAABB );
 };
 
@@ -0,0 +1,75 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SPRITE_BATCH_CHUNK_H_
+#define _SPRITE_BATCH_CHUNK_H_
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+class SpriteBatchItem;
+
+///-----------------------------------------------------------------------------
+
+/// A fixed-size spatial region of sprites in a sprite batch.
+///
+/// Chunks are culled as a whole and their geometry is captured once then rendered
+/// from the cache until any sprite in the chunk changes.
+struct SpriteBatchChunk
+{
+    SpriteBatchChunk( const U32 chunkKey ) :
+        mChunkKey( chunkKey ),
+        mDirty( true ),
+        mCacheable( false ),
+        mCacheValid( false ),
+        mCachedBatchTransformId( 0 )
+    {
+        mLocalAABB.lowerBound.SetZero();
+        mLocalAABB.upperBound.SetZero();
+    }
+
+    /// The packed chunk coordinates.
+    U32                         mChunkKey;
+
+    /// The sprites within the chunk.
+    Vector<SpriteBatchItem*>    mSprites;
+
+    /// The combined local AABB of the sprites.
+    b2AABB                      mLocalAABB;
+
+    /// Whether any sprite in the chunk has changed since the chunk was last updated.
+    bool                        mDirty;
+
+    /// Whether the chunk can be rendered from its cache i.e. nothing in it animates.
+    bool                        mCacheable;
+
+    /// Whether the cache holds the current chunk geometry and the batch transform it was captured with.
+    bool                        mCacheValid;
+    U32                         mCachedBatchTransformId;
+
+    BatchRenderCache            mBatchCache;
+};
+
+#endif // _SPRITE_BATCH_CHUNK_H_
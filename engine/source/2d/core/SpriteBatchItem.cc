@@ -61,7 +61,9 @@ static StringTableEntry spriteUserDataName          = StringTable->insert("UserD
 
 //------------------------------------------------------------------------------
 
-SpriteBatchItem::SpriteBatchItem() : mProxyId( SpriteBatch::INVALID_SPRITE_PROXY )
+SpriteBatchItem::SpriteBatchItem() :
+    mProxyId( SpriteBatch::INVALID_SPRITE_PROXY ),
+    mpSpriteBatchChunk( NULL )
 {
     resetState();
 }
@@ -90,6 +92,16 @@ void SpriteBatchItem::resetState( void )
         mSpriteBatch->destroyQueryProxy( this );
     }
 
+    // Are we in a chunk?
+    if ( mpSpriteBatchChunk != NULL )
+    {
+        // Sanity!
+        AssertFatal( mSpriteBatch != NULL, "Cannot remove from chunk with NULL sprite batch." );
+
+        // Remove from chunk.
+        mSpriteBatch->removeChunkSprite( this );
+    }
+
     mSpriteBatch = NULL;
     mBatchId = 0;
     mName = StringTable->EmptyString;
@@ -152,6 +164,9 @@ void SpriteBatchItem::setBatchParent( SpriteBatch* pSpriteBatch, const U32 batch
 
     // Create proxy.
     mSpriteBatch->createQueryProxy( this );
+
+    // Add to chunk.
+    mSpriteBatch->addChunkSprite( this );
 }
 
 //------------------------------------------------------------------------------
@@ -232,6 +247,34 @@ void SpriteBatchItem::render( BatchRender* pBatchRenderer, const SceneRenderRequ
 
 //------------------------------------------------------------------------------
 
+void SpriteBatchItem::render( BatchRender* pBatchRenderer, const U32 batchTransformId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SpriteBatchItem_RenderDirect);
+
+    // Update the world transform.
+    updateWorldTransform( batchTransformId );
+
+    // Set the blend mode.
+    if ( mBlendMode )
+        pBatchRenderer->setBlendMode( mSrcBlendFactor, mDstBlendFactor, mBlendColor );
+    else
+        pBatchRenderer->setBlendOff();
+
+    // Set the alpha test mode.
+    pBatchRenderer->setAlphaTestMode( mAlphaTest );
+
+    // Render.
+    Parent::render( mFlipX, mFlipY,
+                    mRenderOOBB[0],
+                    mRenderOOBB[1],
+                    mRenderOOBB[2],
+                    mRenderOOBB[3],
+                    pBatchRenderer );
+}
+
+//------------------------------------------------------------------------------
+
 void SpriteBatchItem::setExplicitVertices( const Vector2* explicitVertices )
 {
     mExplicitMode = true;
@@ -240,6 +283,70 @@ void SpriteBatchItem::setExplicitVertices( const Vector2* explicitVertices )
     mExplicitVerts[1] = explicitVertices[1];
     mExplicitVerts[2] = explicitVertices[2];
     mExplicitVerts[3] = explicitVertices[3];
+
+    // Flag the local transform as dirty.
+    mLocalTransformDirty = true;
+    invalidateRenderCache();
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setImage( const char* pImageAssetId, const U32 frame )
+{
+    invalidateRenderCache();
+
+    // Call parent.
+    return Parent::setImage( pImageAssetId, frame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setImage( const char* pImageAssetId, const char* pNamedFrame )
+{
+    invalidateRenderCache();
+
+    // Call parent.
+    return Parent::setImage( pImageAssetId, pNamedFrame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setImageFrame( const U32 frame )
+{
+    invalidateRenderCache();
+
+    // Call parent.
+    return Parent::setImageFrame( frame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setNamedImageFrame( const char* frame )
+{
+    invalidateRenderCache();
+
+    // Call parent.
+    return Parent::setNamedImageFrame( frame );
+}
+
+//------------------------------------------------------------------------------
+
+bool SpriteBatchItem::setAnimation( const char* pAnimationAssetId )
+{
+    invalidateRenderCache();
+
+    // Call parent.
+    return Parent::setAnimation( pAnimationAssetId );
+}
+
+//------------------------------------------------------------------------------
+
+void SpriteBatchItem::onAssetRefreshed( AssetPtrBase* pAssetPtrBase )
+{
+    invalidateRenderCache();
+
+    // Call parent.
+    Parent::onAssetRefreshed( pAssetPtrBase );
 }
 
 //------------------------------------------------------------------------------
@@ -27,6 +27,10 @@
 #include "2d/core/ImageFrameProvider.h"
 #endif
 
+#ifndef _SPRITE_BATCH_CHUNK_H_
+#include "2d/core/SpriteBatchChunk.h"
+#endif
+
 //------------------------------------------------------------------------------  
 
 class SpriteBatch;
@@ -227,6 +231,8 @@ protected:
 
     U32                 mSpriteBatchQueryKey;
 
+    SpriteBatchChunk*   mpSpriteBatchChunk;
+
     void*               mUserData;
 
 public:
@@ -243,21 +249,21 @@ public:
     inline void setLogicalPosition( const LogicalPosition& logicalPosition ) { mLogicalPosition = logicalPosition; }
     inline const LogicalPosition& getLogicalPosition( void ) const { return mLogicalPosition; }
 
-    inline void setVisible( const bool visible ) { mVisible = visible; }
+    inline void setVisible( const bool visible ) { mVisible = visible; invalidateRenderCache(); }
     inline bool getVisible( void ) const { return mVisible; }
 
-    inline void setExplicitMode( const bool explicitMode ) { mExplicitMode = explicitMode; }
+    inline void setExplicitMode( const bool explicitMode ) { mExplicitMode = explicitMode; mLocalTransformDirty = true; invalidateRenderCache(); }
     inline bool getExplicitMode( void ) const { return mExplicitMode; }
 
-    inline void setLocalPosition( const Vector2& localPosition ) { mLocalPosition = localPosition; mLocalTransformDirty = true; }
+    inline void setLocalPosition( const Vector2& localPosition ) { mLocalPosition = localPosition; mLocalTransformDirty = true; invalidateRenderCache(); }
     inline Vector2 getLocalPosition( void ) const { return mLocalPosition; }
 
     void setExplicitVertices( const Vector2* explicitVertices );
 
-    inline void setLocalAngle( const F32 localAngle ) { mLocalAngle = localAngle; mLocalTransformDirty = true; }
+    inline void setLocalAngle( const F32 localAngle ) { mLocalAngle = localAngle; mLocalTransformDirty = true; invalidateRenderCache(); }
     inline F32 getLocalAngle( void ) const { return mLocalAngle; }
 
-    inline void setSize( const Vector2& size ) { mSize = size; mLocalTransformDirty = true; }
+    inline void setSize( const Vector2& size ) { mSize = size; mLocalTransformDirty = true; invalidateRenderCache(); }
     inline Vector2 getSize( void ) const { return mSize; }
 
     inline const b2AABB& getLocalAABB( void ) { if ( mLocalTransformDirty ) updateLocalTransform(); return mLocalAABB; }
@@ -265,10 +271,10 @@ public:
     void setDepth( const F32 depth ) { mDepth = depth; }
     F32 getDepth( void ) const { return mDepth; }
 
-    inline void setFlipX( const bool flipX ) { mFlipX = flipX; }
+    inline void setFlipX( const bool flipX ) { mFlipX = flipX; invalidateRenderCache(); }
     inline bool getFlipX( void ) const { return mFlipX; }
 
-    inline void setFlipY( const bool flipY ) { mFlipY = flipY; }
+    inline void setFlipY( const bool flipY ) { mFlipY = flipY; invalidateRenderCache(); }
     inline bool getFlipY( void ) const { return mFlipY; }
 
     inline void setSortPoint( const Vector2& sortPoint ) { mSortPoint = sortPoint; }
@@ -276,18 +282,18 @@ public:
     inline void setRenderGroup( const char* pRenderGroup ) { mRenderGroup = StringTable->insert( pRenderGroup ); }
     inline StringTableEntry getRenderGroup( void ) const { return mRenderGroup; }
 
-    inline void setBlendMode( const bool blendMode ) { mBlendMode = blendMode; }
+    inline void setBlendMode( const bool blendMode ) { mBlendMode = blendMode; invalidateRenderCache(); }
     inline bool getBlendMode( void ) const { return mBlendMode; }
-    inline void setSrcBlendFactor( GLenum srcBlendFactor ) { mSrcBlendFactor = srcBlendFactor; }
+    inline void setSrcBlendFactor( GLenum srcBlendFactor ) { mSrcBlendFactor = srcBlendFactor; invalidateRenderCache(); }
     inline GLenum getSrcBlendFactor( void ) const { return mSrcBlendFactor; }
-    inline void setDstBlendFactor( GLenum dstBlendFactor ) { mDstBlendFactor = dstBlendFactor; }
+    inline void setDstBlendFactor( GLenum dstBlendFactor ) { mDstBlendFactor = dstBlendFactor; invalidateRenderCache(); }
     inline GLenum getDstBlendFactor( void ) const { return mDstBlendFactor; }
-    inline void setBlendColor( const ColorF& blendColor ) { mBlendColor = blendColor; }
+    inline void setBlendColor( const ColorF& blendColor ) { mBlendColor = blendColor; invalidateRenderCache(); }
     inline const ColorF& getBlendColor( void ) const { return mBlendColor; }
-    inline void setBlendAlpha( const F32 alpha ) { mBlendColor.alpha = alpha; }
+    inline void setBlendAlpha( const F32 alpha ) { mBlendColor.alpha = alpha; invalidateRenderCache(); }
     inline F32 getBlendAlpha( void ) const { return mBlendColor.alpha; }
 
-    inline void setAlphaTest( const F32 alphaTest ) { mAlphaTest = alphaTest; }
+    inline void setAlphaTest( const F32 alphaTest ) { mAlphaTest = alphaTest; invalidateRenderCache(); }
     inline F32 getAlphaTest( void ) const { return mAlphaTest; }
 
     inline void setDataObject( SimObject* pDataObject ) { mDataObject = pDataObject; }
@@ -300,6 +306,17 @@ public:
     inline void setSpriteBatchQueryKey( const U32 key ) { mSpriteBatchQueryKey = key; }
     inline U32  getSpriteBatchQueryKey( void ) const { return mSpriteBatchQueryKey; }
 
+    /// Flag the chunk containing the sprite (if any) as needing its render cache rebuilding.
+    inline void invalidateRenderCache( void ) { if ( mpSpriteBatchChunk != NULL ) mpSpriteBatchChunk->mDirty = true; }
+    inline SpriteBatchChunk* getSpriteBatchChunk( void ) const { return mpSpriteBatchChunk; }
+
+    inline bool setImage( const char* pImageAssetId ) { return setImage( pImageAssetId, mImageFrame ); }
+    virtual bool setImage( const char* pImageAssetId, const U32 frame );
+    virtual bool setImage( const char* pImageAssetId, const char* pNamedFrame );
+    virtual bool setImageFrame( const U32 frame );
+    virtual bool setNamedImageFrame( const char* frame );
+    virtual bool setAnimation( const char* pAnimationAssetId );
+
     virtual void copyTo( SpriteBatchItem* pSpriteBatchItem ) const;
 
     inline const Vector2* getLocalOOBB( void ) const { return mLocalOOBB; }
@@ -307,6 +324,7 @@ public:
 
     void prepareRender( SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId );
     void render( BatchRender* pBatchRenderer, const SceneRenderRequest* pSceneRenderRequest, const U32 batchTransformId );
+    void render( BatchRender* pBatchRenderer, const U32 batchTransformId );
 
     static void WriteCustomTamlSchema( const AbstractClassRep* pClassRep, TiXmlElement* pParentElement );
 
@@ -314,11 +332,14 @@ protected:
     void setBatchParent( SpriteBatch* pSpriteBatch, const U32 batchId );
     inline void setProxyId( const S32 proxyId ) { mProxyId = proxyId; }
     inline void setName( const char* pName ) { mName = StringTable->insert( pName ); }
+    inline void setSpriteBatchChunk( SpriteBatchChunk* pSpriteBatchChunk ) { mpSpriteBatchChunk = pSpriteBatchChunk; }
     void updateLocalTransform( void );
     void updateWorldTransform( const U32 batchTransformId );
 
     void onTamlCustomWrite( TamlCustomNode* pParentNode );
     void onTamlCustomRead( const TamlCustomNode* pSpriteNode );
+
+    virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 };
 
 //------------------------------------------------------------------------------  
@@ -34,6 +34,14 @@
 #include "assets/assetManager.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#ifndef _IMAGE_ATLAS_H_
+#include "2d/assets/ImageAtlas.h"
+#endif
+
 // Script bindings.
 #include "SceneWindow_ScriptBinding.h"
 
@@ -1745,7 +1753,7 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     const S32 metricsOffset = (S32)font->getStrWidth( "WWWWWWWWWWWW" );
 
     // Set Banner Height.
-    F32 bannerLineHeight = fullMetrics ? 17.0f : 1.0f;
+    F32 bannerLineHeight = fullMetrics ? 20.0f : 1.0f;
 
     // Add an extra line if we're monitoring a scene object.
     if ( pDebugSceneObject != NULL )
@@ -1785,12 +1793,14 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
     {
         // Rendering.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Render", NULL );
-        dSprintf( mDebugText, sizeof( mDebugText ), "- FPS=%4.1f<%4.1f/%4.1f>, Frames=%u, Picked=%d<%d>, RenderRequests=%d<%d>, RenderFallbacks=%d<%d>",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- FPS=%4.1f<%4.1f/%4.1f>, Frames=%u, Picked=%d<%d>, RenderRequests=%d<%d>, RenderFallbacks=%d<%d>, CachedLayers=%d<%d>, CacheRebuilds=%d<%d>",
             debugStats.fps, debugStats.minFPS, debugStats.maxFPS,
             debugStats.frameCount,
             debugStats.renderPicked, debugStats.maxRenderPicked,
             debugStats.renderRequests, debugStats.maxRenderRequests,
-            debugStats.renderFallbacks, debugStats.maxRenderFallbacks );
+            debugStats.renderFallbacks, debugStats.maxRenderFallbacks,
+            debugStats.renderCachedLayers, debugStats.maxRenderCachedLayers,
+            debugStats.renderCacheRebuilds, debugStats.maxRenderCacheRebuilds );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
@@ -1807,6 +1817,18 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Ticking.
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Ticking", NULL );
+        dSprintf( mDebugText, sizeof( mDebugText ), "- %sWorkers=%d, Concurrent=%d<%d>, PreIntegrate=%0.2f<%0.2f>, Integrate=%0.2f<%0.2f>, PostIntegrate=%0.2f<%0.2f>",
+            pScene->getTickJobs() ? "" : "(OFF) ",
+            ThreadPool::Instance == NULL ? 0 : ThreadPool::Instance->getWorkerCount(),
+            debugStats.tickObjectsConcurrent, debugStats.maxTickObjectsConcurrent,
+            debugStats.tickPreIntegrateTime, debugStats.maxTickPreIntegrateTime,
+            debugStats.tickIntegrateTime, debugStats.maxTickIntegrateTime,
+            debugStats.tickPostIntegrateTime, debugStats.maxTickPostIntegrateTime );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
         // Camera Window #1.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Camera", NULL );
         Vector2 cameraPosition = getCameraPosition();
@@ -1836,13 +1858,16 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
 
         // Batching #1.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Batching", NULL );
-        dSprintf( mDebugText, sizeof( mDebugText ), "- %sTris=%d<%d>, MaxTriDraw=%d, MaxVerts=%d, Strict=%d<%d>, Sorted=%d<%d>",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- %s%sTris=%d<%d>, MaxTriDraw=%d, MaxVerts=%d, Strict=%d<%d>, Sorted=%d<%d>, Cached=%d<%d>, UploadKB=%0.1f<%0.1f>",
             pScene->getBatchingEnabled() ? "" : "(OFF) ",
+            dglDoesSupportVertexBuffer() ? "(VBO) " : "",
             debugStats.batchTrianglesSubmitted, debugStats.maxBatchTrianglesSubmitted,
             debugStats.batchMaxTriangleDrawn,
             debugStats.batchMaxVertexBuffer,
             debugStats.batchDrawCallsStrict, debugStats.maxBatchDrawCallsStrict,
-            debugStats.batchDrawCallsSorted, debugStats.maxBatchDrawCallsSorted                   
+            debugStats.batchDrawCallsSorted, debugStats.maxBatchDrawCallsSorted,
+            debugStats.batchDrawCallsCached, debugStats.maxBatchDrawCallsCached,
+            debugStats.batchBytesUploaded / 1024.0f, debugStats.maxBatchBytesUploaded / 1024.0f
             );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
@@ -1859,23 +1884,26 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         linePositionY += linePositionOffsetY;
 
         // Batching #3.
-        dSprintf( mDebugText, sizeof( mDebugText ), "- IsolatedFlush=%d<%d>, FullFlush=%d<%d>, LayerFlush=%d<%d>, NoBatchFlush=%d<%d>, AnonFlush=%d<%d>",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- IsolatedFlush=%d<%d>, FullFlush=%d<%d>, LayerFlush=%d<%d>, NoBatchFlush=%d<%d>, AnonFlush=%d<%d>, TexCoordFlush=%d<%d>",
             debugStats.batchIsolatedFlush, debugStats.maxBatchIsolatedFlush,
             debugStats.batchBufferFullFlush, debugStats.maxBatchBufferFullFlush,
             debugStats.batchLayerFlush, debugStats.maxBatchLayerFlush,
             debugStats.batchNoBatchFlush, debugStats.maxBatchNoBatchFlush,
-            debugStats.batchAnonymousFlush, debugStats.maxBatchAnonymousFlush
+            debugStats.batchAnonymousFlush, debugStats.maxBatchAnonymousFlush,
+            debugStats.batchTexCoordRangeFlush, debugStats.maxBatchTexCoordRangeFlush
             );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
         // Textures.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Textures", NULL );
-        dSprintf( mDebugText, sizeof( mDebugText ), "- TextureCount=%d, TextureSize=%d, TextureWaste=%d, BitmapSize=%d",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- TextureCount=%d, TextureSize=%d, TextureWaste=%d, BitmapSize=%d, AtlasPages=%d, AtlasImages=%d",
             TextureManager::getTextureResidentCount(),
             TextureManager::getTextureResidentSize(),
             TextureManager::getTextureResidentWasteSize(),
-            TextureManager::getBitmapResidentSize()
+            TextureManager::getBitmapResidentSize(),
+            ImageAtlas::getPageCount(),
+            ImageAtlas::getImageCount()
             );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
@@ -1895,10 +1923,14 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
 
         // Physics timings #1.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Timings", NULL );
-        dSprintf( mDebugText, sizeof( mDebugText ), "- Step=%0.0f<%0.0f>, Collide=%0.0f<%0.0f>, BroadPhase=%0.0f<%0.0f>",
+        dSprintf( mDebugText, sizeof( mDebugText ), "- %sStep=%0.0f<%0.0f>, Collide=%0.0f<%0.0f>, NarrowPhase=%0.0f<%0.0f>, BroadPhase=%0.0f<%0.0f>, PairQuery=%0.0f<%0.0f>, AddPairs=%0.0f<%0.0f>",
+            pScene->getPhysicsJobs() ? "(JOBS) " : "",
             worldProfile.step, maxWorldProfile.step,
             worldProfile.collide, maxWorldProfile.collide,
-            worldProfile.broadphase, maxWorldProfile.broadphase );
+            worldProfile.narrowphase, maxWorldProfile.narrowphase,
+            worldProfile.broadphase, maxWorldProfile.broadphase,
+            worldProfile.pairQuery, maxWorldProfile.pairQuery,
+            worldProfile.addPairs, maxWorldProfile.addPairs );
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
@@ -1934,6 +1966,18 @@ void SceneWindow::renderMetricsOverlay( Point2I offset, const RectI& updateRect
         dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
         linePositionY += linePositionOffsetY;
 
+        // Frame allocator (in kilobytes).
+        const FrameAllocator::Stats& frameAllocatorStats = debugStats.frameAllocatorStats;
+        dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "FrameAlloc", NULL );
+        dSprintf( mDebugText, sizeof( mDebugText ), "- Main=%0.1f<%0.1f>/%d, Threads=%d, Thread=%0.1f<%0.1f>/%d",
+            frameAllocatorStats.mainFramePeak / 1024.0f, frameAllocatorStats.mainPeak / 1024.0f,
+            frameAllocatorStats.mainArenaSize / 1024,
+            frameAllocatorStats.threadArenaCount,
+            frameAllocatorStats.threadFramePeak / 1024.0f, frameAllocatorStats.threadPeak / 1024.0f,
+            frameAllocatorStats.threadArenaSize / 1024 );
+        dglDrawText( font, bannerOffset + Point2I(metricsOffset,(S32)linePositionY), mDebugText, NULL );
+        linePositionY += linePositionOffsetY;
+
         // Asset Manager.
         dglDrawText( font, bannerOffset + Point2I(0,(S32)linePositionY), "Assets", NULL );
         dSprintf( mDebugText, sizeof( mDebugText ), "- AcquiredRefs=%d, Declared=%d, Referenced=%d, LoadedInternal=%d<%d>, LoadedExternal=%d<%d>, LoadedPrivate=%d<%d>",
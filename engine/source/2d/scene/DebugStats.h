@@ -35,6 +35,10 @@
 #include "platform/platformMemory.h"
 #endif
 
+#ifndef _FRAMEALLOCATOR_H_
+#include "memory/frameAllocator.h"
+#endif
+
 #ifndef BOX2D_H
 #include "Box2D/Box2D.h"
 #endif
@@ -78,11 +82,14 @@ public:
         if ( renderPicked > maxRenderPicked ) maxRenderPicked = renderPicked;
         if ( renderRequests > maxRenderRequests ) maxRenderRequests = renderRequests;
         if ( renderFallbacks > maxRenderFallbacks ) maxRenderFallbacks = renderFallbacks;
+        if ( renderCachedLayers > maxRenderCachedLayers ) maxRenderCachedLayers = renderCachedLayers;
+        if ( renderCacheRebuilds > maxRenderCacheRebuilds ) maxRenderCacheRebuilds = renderCacheRebuilds;
 
         // Batching.
         if ( batchTrianglesSubmitted > maxBatchTrianglesSubmitted ) maxBatchTrianglesSubmitted = batchTrianglesSubmitted;
         if ( batchDrawCallsStrict > maxBatchDrawCallsStrict ) maxBatchDrawCallsStrict = batchDrawCallsStrict;
         if ( batchDrawCallsSorted > maxBatchDrawCallsSorted ) maxBatchDrawCallsSorted = batchDrawCallsSorted;
+        if ( batchDrawCallsCached > maxBatchDrawCallsCached ) maxBatchDrawCallsCached = batchDrawCallsCached;
         if ( batchFlushes > maxBatchFlushes ) maxBatchFlushes = batchFlushes;
         if ( batchBlendStateFlush > maxBatchBlendStateFlush ) maxBatchBlendStateFlush = batchBlendStateFlush;
         if ( batchColorStateFlush > maxBatchColorStateFlush ) maxBatchColorStateFlush = batchColorStateFlush;
@@ -93,10 +100,18 @@ public:
         if ( batchLayerFlush > maxBatchLayerFlush ) maxBatchLayerFlush = batchLayerFlush;
         if ( batchNoBatchFlush > maxBatchNoBatchFlush ) maxBatchNoBatchFlush = batchNoBatchFlush;
         if ( batchAnonymousFlush > maxBatchAnonymousFlush ) maxBatchAnonymousFlush = batchAnonymousFlush;
+        if ( batchTexCoordRangeFlush > maxBatchTexCoordRangeFlush ) maxBatchTexCoordRangeFlush = batchTexCoordRangeFlush;
+        if ( batchBytesUploaded > maxBatchBytesUploaded ) maxBatchBytesUploaded = batchBytesUploaded;
 
         // Particles.
         if ( particlesUsed > maxParticlesUsed ) maxParticlesUsed = particlesUsed;
 
+        // Ticking.
+        if ( tickObjectsConcurrent > maxTickObjectsConcurrent ) maxTickObjectsConcurrent = tickObjectsConcurrent;
+        if ( tickPreIntegrateTime > maxTickPreIntegrateTime ) maxTickPreIntegrateTime = tickPreIntegrateTime;
+        if ( tickIntegrateTime > maxTickIntegrateTime ) maxTickIntegrateTime = tickIntegrateTime;
+        if ( tickPostIntegrateTime > maxTickPostIntegrateTime ) maxTickPostIntegrateTime = tickPostIntegrateTime;
+
         // World profile.
         if ( worldProfile.step > maxWorldProfile.step ) maxWorldProfile.step = worldProfile.step;
         if ( worldProfile.collide > maxWorldProfile.collide ) maxWorldProfile.collide = worldProfile.collide;
@@ -106,6 +121,9 @@ public:
         if ( worldProfile.solvePosition > maxWorldProfile.solvePosition ) maxWorldProfile.solvePosition = worldProfile.solvePosition;
         if ( worldProfile.broadphase > maxWorldProfile.broadphase ) maxWorldProfile.broadphase = worldProfile.broadphase;
         if ( worldProfile.solveTOI > maxWorldProfile.solveTOI ) maxWorldProfile.solveTOI = worldProfile.solveTOI;
+        if ( worldProfile.narrowphase > maxWorldProfile.narrowphase ) maxWorldProfile.narrowphase = worldProfile.narrowphase;
+        if ( worldProfile.pairQuery > maxWorldProfile.pairQuery ) maxWorldProfile.pairQuery = worldProfile.pairQuery;
+        if ( worldProfile.addPairs > maxWorldProfile.addPairs ) maxWorldProfile.addPairs = worldProfile.addPairs;
     }
 
     /// Reset debug stats.
@@ -132,6 +150,12 @@ public:
         renderFallbacks = 0;
         maxRenderFallbacks = 0;
 
+        renderCachedLayers = 0;
+        maxRenderCachedLayers = 0;
+
+        renderCacheRebuilds = 0;
+        maxRenderCacheRebuilds = 0;
+
         bodyCount = 0;
         maxBodyCount = 0;
 
@@ -156,6 +180,9 @@ public:
         batchDrawCallsSorted = 0;
         maxBatchDrawCallsSorted = 0;
 
+        batchDrawCallsCached = 0;
+        maxBatchDrawCallsCached = 0;
+
         batchFlushes = 0;
         maxBatchFlushes = 0;
 
@@ -186,11 +213,29 @@ public:
         batchAnonymousFlush = 0;
         maxBatchAnonymousFlush = 0;
 
+        batchTexCoordRangeFlush = 0;
+        maxBatchTexCoordRangeFlush = 0;
+
+        batchBytesUploaded = 0;
+        maxBatchBytesUploaded = 0;
+
         particlesAlloc = 0;
         particlesFree = 0;
         particlesUsed = 0;
         maxParticlesUsed = 0;
 
+        tickObjectsConcurrent = 0;
+        maxTickObjectsConcurrent = 0;
+
+        tickPreIntegrateTime = 0.0f;
+        maxTickPreIntegrateTime = 0.0f;
+
+        tickIntegrateTime = 0.0f;
+        maxTickIntegrateTime = 0.0f;
+
+        tickPostIntegrateTime = 0.0f;
+        maxTickPostIntegrateTime = 0.0f;
+
         fps = 0.0f;
         minFPS = 10000.0f;
         maxFPS = 0.0f;
@@ -199,6 +244,8 @@ public:
 
         dMemset( &worldProfile, 0, sizeof(worldProfile) );
         dMemset( &maxWorldProfile, 0, sizeof(maxWorldProfile) );
+
+        dMemset( &frameAllocatorStats, 0, sizeof(frameAllocatorStats) );
     }
 
     U32     objectsCount;
@@ -222,6 +269,12 @@ public:
     U32     renderFallbacks;
     U32     maxRenderFallbacks;
 
+    /// Static layers rendered from/rebuilt into their render cache.
+    U32     renderCachedLayers;
+    U32     maxRenderCachedLayers;
+    U32     renderCacheRebuilds;
+    U32     maxRenderCacheRebuilds;
+
     U32     bodyCount;
     U32     maxBodyCount;
 
@@ -246,6 +299,9 @@ public:
     U32     batchDrawCallsSorted;
     U32     maxBatchDrawCallsSorted;
 
+    U32     batchDrawCallsCached;
+    U32     maxBatchDrawCallsCached;
+
     U32     batchFlushes;
     U32     maxBatchFlushes;
 
@@ -276,11 +332,30 @@ public:
     U32     batchAnonymousFlush;
     U32     maxBatchAnonymousFlush;
 
+    /// Flushes caused by texture coordinates outside the packed range.
+    U32     batchTexCoordRangeFlush;
+    U32     maxBatchTexCoordRangeFlush;
+
+    /// Vertex/index bytes handed to the driver.
+    U32     batchBytesUploaded;
+    U32     maxBatchBytesUploaded;
+
     U32     particlesAlloc;
     U32     particlesFree;
     U32     particlesUsed;
     U32     maxParticlesUsed;
 
+    U32     tickObjectsConcurrent;
+    U32     maxTickObjectsConcurrent;
+
+    /// Tick stage timings (in milliseconds).
+    F32     tickPreIntegrateTime;
+    F32     maxTickPreIntegrateTime;
+    F32     tickIntegrateTime;
+    F32     maxTickIntegrateTime;
+    F32     tickPostIntegrateTime;
+    F32     maxTickPostIntegrateTime;
+
     F32     fps;
     F32     minFPS;
     F32     maxFPS;
@@ -289,6 +364,9 @@ public:
 
     b2Profile worldProfile;
     b2Profile maxWorldProfile;
+
+    /// Frame allocator arena usage (already includes the peaks).
+    FrameAllocator::Stats frameAllocatorStats;
 };
 
 #endif // _DEBUG_STATS_H_
@@ -56,6 +56,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
 // Script bindings.
 #include "Scene_ScriptBinding.h"
 
@@ -144,6 +148,84 @@ static StringTableEntry controllerCustomNodeName          = StringTable->insert(
 static StringTableEntry assetPreloadNodeName              = StringTable->insert( "AssetPreloads" );
 static StringTableEntry assetNodeName                     = StringTable->insert( "Asset" );
 
+// Contact callback names (ordered as Scene::ContactCallback).
+static StringTableEntry contactCallbackNames[] =
+{
+    StringTable->insert( "onSceneCollision" ),
+    StringTable->insert( "onSceneEndCollision" ),
+    StringTable->insert( "onSceneCollisionBatch" ),
+    StringTable->insert( "onSceneEndCollisionBatch" ),
+    StringTable->insert( "onCollision" ),
+    StringTable->insert( "onEndCollision" ),
+};
+
+// Number of scene objects integrated per tick job batch.
+#define SCENE_TICK_JOB_BATCH_SIZE   64
+
+//-----------------------------------------------------------------------------
+
+struct SceneTickJob
+{
+    SceneObject**   mpSceneObjects;
+    F32             mTotalTime;
+    F32             mElapsedTime;
+    DebugStats*     mpDebugStats;
+};
+
+//-----------------------------------------------------------------------------
+
+static void scenePreIntegrateJob( void* pContext, const U32 startIndex, const U32 endIndex, const U32 threadIndex )
+{
+    SceneTickJob* pTickJob = static_cast<SceneTickJob*>( pContext );
+
+    for ( U32 i = startIndex; i < endIndex; ++i )
+        pTickJob->mpSceneObjects[i]->preIntegrate( pTickJob->mTotalTime, pTickJob->mElapsedTime, pTickJob->mpDebugStats );
+}
+
+//-----------------------------------------------------------------------------
+
+static void sceneIntegrateJob( void* pContext, const U32 startIndex, const U32 endIndex, const U32 threadIndex )
+{
+    SceneTickJob* pTickJob = static_cast<SceneTickJob*>( pContext );
+
+    for ( U32 i = startIndex; i < endIndex; ++i )
+        pTickJob->mpSceneObjects[i]->integrateObject( pTickJob->mTotalTime, pTickJob->mElapsedTime, pTickJob->mpDebugStats );
+}
+
+//-----------------------------------------------------------------------------
+
+/// Runs physics world tasks on the thread pool.
+class ScenePhysicsExecutor : public b2ParallelExecutor
+{
+    struct PhysicsJob
+    {
+        b2ParallelTask  mpTask;
+        void*           mpContext;
+    };
+
+    static void physicsJob( void* pContext, const U32 startIndex, const U32 endIndex, const U32 threadIndex )
+    {
+        PhysicsJob* pPhysicsJob = static_cast<PhysicsJob*>( pContext );
+        pPhysicsJob->mpTask( pPhysicsJob->mpContext, (int32)startIndex, (int32)endIndex, (int32)threadIndex );
+    }
+
+public:
+    virtual int32 GetThreadCount() const
+    {
+        return (int32)ThreadPool::Instance->getConcurrency();
+    }
+
+    virtual void ParallelFor( b2ParallelTask task, void* context, int32 count, int32 batchSize )
+    {
+        PhysicsJob physicsJob;
+        physicsJob.mpTask = task;
+        physicsJob.mpContext = context;
+        ThreadPool::Instance->parallelFor( &ScenePhysicsExecutor::physicsJob, &physicsJob, (U32)count, (U32)batchSize );
+    }
+};
+
+static ScenePhysicsExecutor scenePhysicsExecutor;
+
 //-----------------------------------------------------------------------------
 
 Scene::Scene() :
@@ -164,6 +246,9 @@ Scene::Scene() :
     mDebugMask(0X00000000),
     mpDebugSceneObject(NULL),
 
+    /// Static layers.
+    mLayerStaticMargin(0.5f),
+
     /// Window rendering.
     mpCurrentRenderWindow(NULL),
     
@@ -171,7 +256,13 @@ Scene::Scene() :
     mIsEditorScene(0),
     mUpdateCallback(false),
     mRenderCallback(false),
-    mSceneIndex(0)
+    mTickJobs(false),
+    mPhysicsJobs(false),
+    mSceneIndex(0),
+
+    /// Contact callbacks.
+    mBatchCollisionCallbacks(false),
+    mContactCallbackSequence(0)
 {
     // Set Vector Associations.
     VECTOR_SET_ASSOCIATION( mSceneObjects );
@@ -180,9 +271,12 @@ Scene::Scene() :
     VECTOR_SET_ASSOCIATION( mEndContacts );
     VECTOR_SET_ASSOCIATION( mAssetPreloads );
      
-    // Initialize layer sort mode.
+    // Initialize layer sort mode and static layers.
     for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; ++n )
+    {
        mLayerSortModes[n] = SceneRenderQueue::RENDER_SORT_NEWEST;
+       mLayerStatic[n] = false;
+    }
 
     // Set debug stats for batch renderer.
     mBatchRenderer.setDebugStats( &mDebugStats );
@@ -191,6 +285,12 @@ Scene::Scene() :
     mControllers = new SimSet();
     mControllers->registerObject();
 
+    // Register the contact sets.
+    mBeginContactSet = new SceneContactSet();
+    mBeginContactSet->registerObject();
+    mEndContactSet = new SceneContactSet();
+    mEndContactSet->registerObject();
+
     // Assign scene index.    
     mSceneIndex = ++sSceneMasterIndex;
     sSceneCount++;
@@ -204,6 +304,12 @@ Scene::~Scene()
     if ( mControllers.notNull() )
         mControllers->deleteObject();
 
+    // Unregister the contact sets.
+    if ( mBeginContactSet.notNull() )
+        mBeginContactSet->deleteObject();
+    if ( mEndContactSet.notNull() )
+        mEndContactSet->deleteObject();
+
     // Decrease scene count.
     --sSceneCount;
 }
@@ -315,11 +421,28 @@ void Scene::initPersistFields()
        addField( buffer, TypeEnum, OffsetNonConst(mLayerSortModes[n], Scene), &writeLayerSortMode, 1, &SceneRenderQueue::renderSortTable, "");
     }
 
+    // Static layers.
+    for ( U32 n = 0; n < MAX_LAYERS_SUPPORTED; n++ )
+    {
+       dSprintf( buffer, 64, "layerStatic%d", n );
+       addField( buffer, TypeBool, OffsetNonConst(mLayerStatic[n], Scene), &writeLayerStatic, "");
+    }
+    addField("LayerStaticMargin", TypeF32, Offset(mLayerStaticMargin, Scene), &writeLayerStaticMargin, "The margin (as a fraction of the view size) cached around the view for static layers.");
+
+    // Frame snapshots.
+
     addProtectedField("Controllers", TypeSimObjectPtr, Offset(mControllers, Scene), &defaultProtectedNotSetFn, &defaultProtectedGetFn, &defaultProtectedNotWriteFn, "The scene controllers to use.");
     
     // Callbacks.
     addField("UpdateCallback", TypeBool, Offset(mUpdateCallback, Scene), &writeUpdateCallback, "");
     addField("RenderCallback", TypeBool, Offset(mRenderCallback, Scene), &writeRenderCallback, "");
+
+    // Ticking.
+    addField("TickJobs", TypeBool, Offset(mTickJobs, Scene), &writeTickJobs, "Whether thread-safe scene objects are integrated on the thread pool.");
+    addField("PhysicsJobs", TypeBool, Offset(mPhysicsJobs, Scene), &writePhysicsJobs, "Whether physics contacts are updated, broad-phase pairs found and independent islands solved on the thread pool.");
+
+    // Contact callbacks.
+    addField("BatchCollisionCallbacks", TypeBool, Offset(mBatchCollisionCallbacks, Scene), &writeBatchCollisionCallbacks, "Whether the scene receives its collision callbacks once per tick as a contact set (onSceneCollisionBatch/onSceneEndCollisionBatch).");
 }
 
 //-----------------------------------------------------------------------------
@@ -461,6 +584,9 @@ void Scene::dispatchBeginContactCallbacks( void )
     if ( contactCount == 0 )
         return;
 
+    // Reset the contact set.
+    mBeginContactSet->clear();
+
     // Iterate all contacts.
     for ( typeContactHash::iterator contactItr = mBeginContacts.begin(); contactItr != mBeginContacts.end(); ++contactItr )
     {
@@ -479,119 +605,36 @@ void Scene::dispatchBeginContactCallbacks( void )
         if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
             continue;
 
-        // Fetch normal and contact points.
-        const U32& pointCount = tickContact.mPointCount;
-        const b2Vec2& normal = tickContact.mWorldManifold.normal;
-        const b2Vec2& point1 = tickContact.mWorldManifold.points[0];
-        const b2Vec2& point2 = tickContact.mWorldManifold.points[1];
-        const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
-        const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
-
-        // Sanity!
-        AssertFatal( shapeIndexA >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-        AssertFatal( shapeIndexB >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-
-        // Fetch collision impulse information
-        const F32 normalImpulse1 = tickContact.mNormalImpulses[0];
-        const F32 normalImpulse2 = tickContact.mNormalImpulses[1];
-        const F32 tangentImpulse1 = tickContact.mTangentImpulses[0];
-        const F32 tangentImpulse2 = tickContact.mTangentImpulses[1];
-
-        // Format objects.
-        char sceneObjectABuffer[16];
-        char sceneObjectBBuffer[16];
-        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", pSceneObjectA->getId() );
-        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", pSceneObjectB->getId() );
-
-        // Format miscellaneous information.
-        char miscInfoBuffer[128];
-        if ( pointCount == 2 )
-        {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                normal.x, normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1,
-                point2.x, point2.y,
-                normalImpulse2,
-                tangentImpulse2 );
-        }
-        else if ( pointCount == 1 )
-        {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
-                shapeIndexA, shapeIndexB,
-                normal.x, normal.y,
-                point1.x, point1.y,
-                normalImpulse1,
-                tangentImpulse1 );
-        }
-        else
+        // Fetch contact.
+        SceneContact contact;
+        contact.mSceneObjectA = pSceneObjectA->getId();
+        contact.mSceneObjectB = pSceneObjectB->getId();
+        contact.mShapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
+        contact.mShapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+        contact.mPointCount = tickContact.mPointCount;
+        contact.mNormal = tickContact.mWorldManifold.normal;
+        for ( U32 n = 0; n < b2_maxManifoldPoints; ++n )
         {
-            dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
-                "%d %d",
-                shapeIndexA, shapeIndexB );
+            contact.mPoints[n] = tickContact.mWorldManifold.points[n];
+            contact.mNormalImpulses[n] = tickContact.mNormalImpulses[n];
+            contact.mTangentImpulses[n] = tickContact.mTangentImpulses[n];
         }
 
-        // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneCollision" ) ) != NULL )
-        {
-            // Yes, so perform script callback on the Scene.
-            Con::executef( this, 4, "onSceneCollision",
-                sceneObjectABuffer,
-                sceneObjectBBuffer,
-                miscInfoBuffer );
-        }
-        else
-        {
-            // No, so call it on its behaviors.
-            const char* args[5] = { "onSceneCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
-            callOnBehaviors( 5, args );
-        }
+        // Sanity!
+        AssertFatal( contact.mShapeIndexA >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
+        AssertFatal( contact.mShapeIndexB >= 0, "Scene::dispatchBeginContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
 
-        // Is object A allowed to collide with object B?
-        if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
-                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
-        {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectA->isMethod("onCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onCollision",
-                    sceneObjectBBuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onCollision", "", sceneObjectBBuffer, miscInfoBuffer };
-                pSceneObjectA->callOnBehaviors( 4, args );
-            }
-        }
+        // Add to the contact set if the scene callback is batched.
+        if ( mBatchCollisionCallbacks )
+            mBeginContactSet->addContact( contact );
 
-        // Is object B allowed to collide with object A?
-        if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
-                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
-        {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectB->isMethod("onCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onCollision",
-                    sceneObjectABuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onCollision", "", sceneObjectABuffer, miscInfoBuffer };
-                pSceneObjectB->callOnBehaviors( 4, args );
-            }
-        }
+        // Dispatch the contact callbacks.
+        dispatchContactCallbacks( contact, pSceneObjectA, pSceneObjectB, true );
     }
+
+    // Dispatch the batched scene callback.
+    if ( mBatchCollisionCallbacks )
+        dispatchContactBatchCallback( mBeginContactSet, true );
 }
 
 //-----------------------------------------------------------------------------
@@ -611,6 +654,9 @@ void Scene::dispatchEndContactCallbacks( void )
     if ( contactCount == 0 )
         return;
 
+    // Reset the contact set.
+    mEndContactSet->clear();
+
     // Iterate all contacts.
     for ( typeContactVector::iterator contactItr = mEndContacts.begin(); contactItr != mEndContacts.end(); ++contactItr )
     {
@@ -629,81 +675,209 @@ void Scene::dispatchEndContactCallbacks( void )
         if ( !pSceneObjectA->getCollisionCallback() && !pSceneObjectB->getCollisionCallback() )
             continue;
 
-        // Fetch shape index.
-        const S32 shapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
-        const S32 shapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
+        // Fetch contact (end contacts only report the shapes).
+        SceneContact contact;
+        contact.mSceneObjectA = pSceneObjectA->getId();
+        contact.mSceneObjectB = pSceneObjectB->getId();
+        contact.mShapeIndexA = pSceneObjectA->getCollisionShapeIndex( tickContact.mpFixtureA );
+        contact.mShapeIndexB = pSceneObjectB->getCollisionShapeIndex( tickContact.mpFixtureB );
 
         // Sanity!
-        AssertFatal( shapeIndexA >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-        AssertFatal( shapeIndexB >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
-
-        // Format objects.
-        char sceneObjectABuffer[16];
-        char sceneObjectBBuffer[16];
-        dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", pSceneObjectA->getId() );
-        dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", pSceneObjectB->getId() );
-
-        // Format miscellaneous information.
-        char miscInfoBuffer[32];
-        dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer), "%d %d", shapeIndexA, shapeIndexB );
-
-        // Does the scene handle the collision callback?
-        Namespace* pNamespace = getNamespace();
-        if ( pNamespace != NULL && pNamespace->lookup( StringTable->insert( "onSceneEndCollision" ) ) != NULL )
-        {
-            // Yes, so does the scene handle the collision callback?
-            Con::executef( this, 4, "onSceneEndCollision",
-                sceneObjectABuffer,
-                sceneObjectBBuffer,
-                miscInfoBuffer );
-        }
-        else
-        {
-            // No, so call it on its behaviors.
-            const char* args[5] = { "onSceneEndCollision", "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
-            callOnBehaviors( 5, args );
-        }
+        AssertFatal( contact.mShapeIndexA >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
+        AssertFatal( contact.mShapeIndexB >= 0, "Scene::dispatchEndContactCallbacks() - Cannot find shape index reported on physics proxy of a fixture." );
 
-        // Is object A allowed to collide with object B?
-        if (    (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
-                (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0 )
-        {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectA->isMethod("onEndCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectA, 3, "onEndCollision",
-                    sceneObjectBBuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onEndCollision", "", sceneObjectBBuffer, miscInfoBuffer };
-                pSceneObjectA->callOnBehaviors( 4, args );
-            }
-        }
+        // Add to the contact set if the scene callback is batched.
+        if ( mBatchCollisionCallbacks )
+            mEndContactSet->addContact( contact );
+
+        // Dispatch the contact callbacks.
+        dispatchContactCallbacks( contact, pSceneObjectA, pSceneObjectB, false );
+    }
+
+    // Dispatch the batched scene callback.
+    if ( mBatchCollisionCallbacks )
+        dispatchContactBatchCallback( mEndContactSet, false );
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchContactCallbacks( const SceneContact& contact, SceneObject* pSceneObjectA, SceneObject* pSceneObjectB, const bool beginContact )
+{
+    // Fetch the callbacks.
+    const ContactCallback sceneCallback = beginContact ? CONTACT_CALLBACK_SCENE_COLLISION : CONTACT_CALLBACK_SCENE_END_COLLISION;
+    const ContactCallback objectCallback = beginContact ? CONTACT_CALLBACK_COLLISION : CONTACT_CALLBACK_END_COLLISION;
+
+    // Does the scene handle the collision callback?
+    // NOTE:- Batched scene callbacks are dispatched once per tick.
+    const bool sceneHandled = !mBatchCollisionCallbacks && handlesContactCallback( this, sceneCallback );
+    const bool sceneBehaviors = !mBatchCollisionCallbacks && !sceneHandled && ( getBehaviorCount() > 0 || getComponentCount() > 0 );
+
+    // Is object A allowed to collide with object B and, if so, does it handle the collision callback?
+    const bool collideA =
+        (pSceneObjectA->mCollisionGroupMask & pSceneObjectB->mSceneGroupMask) != 0 &&
+        (pSceneObjectA->mCollisionLayerMask & pSceneObjectB->mSceneLayerMask) != 0;
+    const bool handledA = collideA && handlesContactCallback( pSceneObjectA, objectCallback );
+    const bool behaviorsA = collideA && !handledA && ( pSceneObjectA->getBehaviorCount() > 0 || pSceneObjectA->getComponentCount() > 0 );
+
+    // Is object B allowed to collide with object A and, if so, does it handle the collision callback?
+    const bool collideB =
+        (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
+        (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0;
+    const bool handledB = collideB && handlesContactCallback( pSceneObjectB, objectCallback );
+    const bool behaviorsB = collideB && !handledB && ( pSceneObjectB->getBehaviorCount() > 0 || pSceneObjectB->getComponentCount() > 0 );
+
+    // Finish if nothing will receive the contact.
+    // NOTE:- This avoids formatting the contact at all.
+    if ( !sceneHandled && !sceneBehaviors && !handledA && !behaviorsA && !handledB && !behaviorsB )
+        return;
 
-        // Is object B allowed to collide with object A?
-        if (    (pSceneObjectB->mCollisionGroupMask & pSceneObjectA->mSceneGroupMask) != 0 &&
-                (pSceneObjectB->mCollisionLayerMask & pSceneObjectA->mSceneLayerMask) != 0 )
+    // Format objects.
+    char sceneObjectABuffer[16];
+    char sceneObjectBBuffer[16];
+    dSprintf( sceneObjectABuffer, sizeof(sceneObjectABuffer), "%d", contact.mSceneObjectA );
+    dSprintf( sceneObjectBBuffer, sizeof(sceneObjectBBuffer), "%d", contact.mSceneObjectB );
+
+    // Format miscellaneous information.
+    char miscInfoBuffer[128];
+    if ( contact.mPointCount == 2 )
+    {
+        dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
+            "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+            contact.mShapeIndexA, contact.mShapeIndexB,
+            contact.mNormal.x, contact.mNormal.y,
+            contact.mPoints[0].x, contact.mPoints[0].y,
+            contact.mNormalImpulses[0],
+            contact.mTangentImpulses[0],
+            contact.mPoints[1].x, contact.mPoints[1].y,
+            contact.mNormalImpulses[1],
+            contact.mTangentImpulses[1] );
+    }
+    else if ( contact.mPointCount == 1 )
+    {
+        dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
+            "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+            contact.mShapeIndexA, contact.mShapeIndexB,
+            contact.mNormal.x, contact.mNormal.y,
+            contact.mPoints[0].x, contact.mPoints[0].y,
+            contact.mNormalImpulses[0],
+            contact.mTangentImpulses[0] );
+    }
+    else
+    {
+        dSprintf(miscInfoBuffer, sizeof(miscInfoBuffer),
+            "%d %d",
+            contact.mShapeIndexA, contact.mShapeIndexB );
+    }
+
+    // Fetch the callback names.
+    const char* pSceneCallbackName = contactCallbackNames[sceneCallback];
+    const char* pObjectCallbackName = contactCallbackNames[objectCallback];
+
+    if ( sceneHandled )
+    {
+        // Perform script callback on the Scene.
+        Con::executef( this, 4, pSceneCallbackName,
+            sceneObjectABuffer,
+            sceneObjectBBuffer,
+            miscInfoBuffer );
+    }
+    else if ( sceneBehaviors )
+    {
+        // Call it on its behaviors.
+        const char* args[5] = { pSceneCallbackName, "", sceneObjectABuffer, sceneObjectBBuffer, miscInfoBuffer };
+        callOnBehaviors( 5, args );
+    }
+
+    if ( handledA )
+    {
+        // Perform the script callback on object A.
+        Con::executef( pSceneObjectA, 3, pObjectCallbackName,
+            sceneObjectBBuffer,
+            miscInfoBuffer );
+    }
+    else if ( behaviorsA )
+    {
+        // Call it on its behaviors.
+        const char* args[4] = { pObjectCallbackName, "", sceneObjectBBuffer, miscInfoBuffer };
+        pSceneObjectA->callOnBehaviors( 4, args );
+    }
+
+    if ( handledB )
+    {
+        // Perform the script callback on object B.
+        Con::executef( pSceneObjectB, 3, pObjectCallbackName,
+            sceneObjectABuffer,
+            miscInfoBuffer );
+    }
+    else if ( behaviorsB )
+    {
+        // Call it on its behaviors.
+        const char* args[4] = { pObjectCallbackName, "", sceneObjectABuffer, miscInfoBuffer };
+        pSceneObjectB->callOnBehaviors( 4, args );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void Scene::dispatchContactBatchCallback( SceneContactSet* pContactSet, const bool beginContact )
+{
+    // Finish if no contacts were collected.
+    if ( pContactSet->getContactCount() == 0 )
+        return;
+
+    // Fetch the callback.
+    const ContactCallback batchCallback = beginContact ? CONTACT_CALLBACK_SCENE_COLLISION_BATCH : CONTACT_CALLBACK_SCENE_END_COLLISION_BATCH;
+    const char* pBatchCallbackName = contactCallbackNames[batchCallback];
+
+    // Does the scene handle the collision callback?
+    if ( handlesContactCallback( this, batchCallback ) )
+    {
+        // Yes, so perform script callback on the Scene.
+        Con::executef( this, 2, pBatchCallbackName, pContactSet->getIdString() );
+    }
+    else if ( getBehaviorCount() > 0 || getComponentCount() > 0 )
+    {
+        // No, so call it on its behaviors.
+        const char* args[3] = { pBatchCallbackName, "", pContactSet->getIdString() };
+        callOnBehaviors( 3, args );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::handlesContactCallback( SimObject* pSimObject, const ContactCallback callback )
+{
+    // Fetch namespace.
+    Namespace* pNamespace = pSimObject->getNamespace();
+
+    // Finish if no namespace.
+    if ( pNamespace == NULL )
+        return false;
+
+    // Flush the cache if the namespaces have changed since it was built.
+    if ( mContactCallbackSequence != Namespace::mCacheSequence )
+    {
+        mContactCallbackCache.clear();
+        mContactCallbackSequence = Namespace::mCacheSequence;
+    }
+
+    // Find the namespace callbacks.
+    typeContactCallbackHash::iterator callbackItr = mContactCallbackCache.find( pNamespace );
+
+    // Cache the namespace callbacks if not found.
+    if ( callbackItr == mContactCallbackCache.end() )
+    {
+        U32 callbackMask = 0;
+        for ( U32 n = 0; n < CONTACT_CALLBACK_COUNT; ++n )
         {
-            // Yes, so does it handle the collision callback?
-            if ( pSceneObjectB->isMethod("onEndCollision") )            
-            {
-                // Yes, so perform the script callback on it.
-                Con::executef( pSceneObjectB, 3, "onEndCollision",
-                    sceneObjectABuffer,
-                    miscInfoBuffer );
-            }
-            else
-            {
-                // No, so call it on its behaviors.
-                const char* args[4] = { "onEndCollision", "", sceneObjectABuffer, miscInfoBuffer };
-                pSceneObjectB->callOnBehaviors( 4, args );
-            }
+            if ( pNamespace->lookup( contactCallbackNames[n] ) != NULL )
+                callbackMask |= BIT(n);
         }
+
+        callbackItr = mContactCallbackCache.insert( pNamespace, callbackMask );
     }
+
+    return (callbackItr->value & BIT(callback)) != 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -735,6 +909,9 @@ void Scene::processTick( void )
     mDebugStats.particlesUsed = ParticleSystem::Instance->getActiveParticleCount();
     mDebugStats.particlesFree = mDebugStats.particlesAlloc - mDebugStats.particlesUsed;
 
+    // Set frame allocator stats.
+    FrameAllocator::getStats( mDebugStats.frameAllocatorStats );
+
     // Finish if scene is paused.
     if ( !getScenePause() )
     {
@@ -751,6 +928,10 @@ void Scene::processTick( void )
 
         // Clear ticked scene objects.
         mTickedSceneObjects.clear();
+        mTickedConcurrentSceneObjects.clear();
+
+        // Fetch whether thread-safe objects can be ticked concurrently.
+        const bool tickJobs = mTickJobs && ThreadPool::Instance != NULL;
 
         // Iterate scene objects.
         for( S32 n = 0; n < mSceneObjects.size(); ++n )
@@ -775,7 +956,16 @@ void Scene::processTick( void )
                 // Add to ticked objects if object is not being deleted and this is a "normal" scene or
                 // the object is marked as allowing editor ticks.
                 if ( !pSceneObject->isBeingDeleted() && (isNormalScene || pSceneObject->getIsEditorTickAllowed() )  )
+                {
                     mTickedSceneObjects.push_back( pSceneObject );
+
+                    // Add to concurrent ticked objects if possible.
+                    if ( tickJobs && pSceneObject->getTickThreadSafe() )
+                    {
+                        pSceneObject->setTickConcurrent( true );
+                        mTickedConcurrentSceneObjects.push_back( pSceneObject );
+                    }
+                }
             }
         }
 
@@ -783,20 +973,45 @@ void Scene::processTick( void )
         mDebugStats.objectsEnabled = objectsEnabled;
         mDebugStats.objectsVisible = objectsVisible;
         mDebugStats.objectsAwake   = objectsAwake;
+        mDebugStats.tickObjectsConcurrent = mTickedConcurrentSceneObjects.size();
 
         // Debug Status Reference.
         DebugStats* pDebugStats = &mDebugStats;
 
         // Fetch ticked scene object count.
         const S32 tickedSceneObjectCount = mTickedSceneObjects.size();
+        const U32 concurrentSceneObjectCount = mTickedConcurrentSceneObjects.size();
+
+        // Configure the tick job.
+        SceneTickJob tickJob;
+        tickJob.mpSceneObjects = mTickedConcurrentSceneObjects.address();
+        tickJob.mTotalTime = mSceneTime;
+        tickJob.mElapsedTime = Tickable::smTickSec;
+        tickJob.mpDebugStats = pDebugStats;
+
+        // Stage timer.
+        b2Timer stageTimer;
 
         // ****************************************************
         // Pre-integrate objects.
         // ****************************************************
 
+        // Pre-integrate concurrent objects.
+        if ( concurrentSceneObjectCount > 0 )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_PreIntegrateJobs);
+
+            ThreadPool::Instance->parallelFor( &scenePreIntegrateJob, &tickJob, concurrentSceneObjectCount, SCENE_TICK_JOB_BATCH_SIZE );
+        }
+
         // Iterate ticked scene objects.
         for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
         {
+            // Skip if already pre-integrated concurrently.
+            if ( mTickedSceneObjects[i]->getTickConcurrent() )
+                continue;
+
             // Debug Profiling.
             PROFILE_SCOPE(Scene_PreIntegrate);
 
@@ -804,6 +1019,8 @@ void Scene::processTick( void )
             mTickedSceneObjects[i]->preIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
+        mDebugStats.tickPreIntegrateTime = stageTimer.GetMilliseconds();
+
         // ****************************************************
         // Integrate controllers.
         // ****************************************************
@@ -845,6 +1062,9 @@ void Scene::processTick( void )
         // Only step the physics if a "normal" scene.
         if ( isNormalScene )
         {
+            // Run the physics stages on the thread pool if enabled.
+            mpWorld->SetParallelExecutor( mPhysicsJobs && ThreadPool::Instance != NULL ? &scenePhysicsExecutor : NULL );
+
             // Step the physics.
             mpWorld->Step( Tickable::smTickSec, mVelocityIterations, mPositionIterations );
         }
@@ -859,21 +1079,49 @@ void Scene::processTick( void )
         // Integrate objects.
         // ****************************************************
 
+        stageTimer.Reset();
+
+        // Integrate concurrent objects.
+        if ( concurrentSceneObjectCount > 0 )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_IntegrateObjectJobs);
+
+            ThreadPool::Instance->parallelFor( &sceneIntegrateJob, &tickJob, concurrentSceneObjectCount, SCENE_TICK_JOB_BATCH_SIZE );
+        }
+
         // Iterate ticked scene objects.
         for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
         {
+            // Fetch scene object.
+            SceneObject* pSceneObject = mTickedSceneObjects[i];
+
             // Debug Profiling.
             PROFILE_SCOPE(Scene_IntegrateObject);
 
+            // Was the object integrated concurrently?
+            if ( pSceneObject->getTickConcurrent() )
+            {
+                // Yes, so perform the deferred integration serially.
+                pSceneObject->setTickConcurrent( false );
+                pSceneObject->integrateDeferred( mSceneTime, Tickable::smTickSec, pDebugStats );
+                continue;
+            }
+
             // Integrate.
-            mTickedSceneObjects[i]->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
+            pSceneObject->integrateObject( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
+        mDebugStats.tickIntegrateTime = stageTimer.GetMilliseconds();
+
         // ****************************************************
         // Post-Integrate Stage.
         // ****************************************************
 
+        stageTimer.Reset();
+
         // Iterate ticked scene objects.
+        // NOTE: This stage stays serial as it only notifies components and performs script callbacks.
         for ( S32 i = 0; i < tickedSceneObjectCount; ++i )
         {
             // Debug Profiling.
@@ -883,6 +1131,8 @@ void Scene::processTick( void )
             mTickedSceneObjects[i]->postIntegrate( mSceneTime, Tickable::smTickSec, pDebugStats );
         }
 
+        mDebugStats.tickPostIntegrateTime = stageTimer.GetMilliseconds();
+
         // Scene update callback.
         if( mUpdateCallback )
         {
@@ -902,6 +1152,7 @@ void Scene::processTick( void )
 
         // Clear ticked scene objects.
         mTickedSceneObjects.clear();
+        mTickedConcurrentSceneObjects.clear();
     }
 
     // Update debug stat ranges.
@@ -953,9 +1204,12 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     pDebugStats->renderPicked                   = 0;
     pDebugStats->renderRequests                 = 0;
     pDebugStats->renderFallbacks                = 0;
+    pDebugStats->renderCachedLayers             = 0;
+    pDebugStats->renderCacheRebuilds            = 0;
     pDebugStats->batchTrianglesSubmitted        = 0;
     pDebugStats->batchDrawCallsStrict           = 0;
     pDebugStats->batchDrawCallsSorted           = 0;
+    pDebugStats->batchDrawCallsCached           = 0;
     pDebugStats->batchFlushes                   = 0;
     pDebugStats->batchBlendStateFlush           = 0;
     pDebugStats->batchColorStateFlush           = 0;
@@ -966,6 +1220,8 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     pDebugStats->batchLayerFlush                = 0;
     pDebugStats->batchNoBatchFlush              = 0;
     pDebugStats->batchAnonymousFlush            = 0;
+    pDebugStats->batchTexCoordRangeFlush        = 0;
+    pDebugStats->batchBytesUploaded             = 0;
 
     // Set batch renderer wireframe mode.
     mBatchRenderer.setWireframeMode( getDebugMask() & SCENE_DEBUG_WIREFRAME_RENDER );
@@ -983,11 +1239,90 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     glRotatef( mRadToDeg(pSceneRenderState->mRenderAngle), 0.0f, 0.0f, 1.0f );
     glTranslatef( -cameraPosition.x, -cameraPosition.y, 0.0f );
 
+    // Calculate the area cached around the view for static layers.
+    const b2Vec2 cacheMargin = mLayerStaticMargin * (cameraAABB.upperBound - cameraAABB.lowerBound);
+    b2AABB cacheAABB;
+    cacheAABB.lowerBound = cameraAABB.lowerBound - cacheMargin;
+    cacheAABB.upperBound = cameraAABB.upperBound + cacheMargin;
+
+    // Static layers are rebuilt using the cached area.
+    SceneRenderState cacheRenderState( *pSceneRenderState );
+    cacheRenderState.mRenderAABB = cacheAABB;
+    cacheRenderState.mRenderArea = RectF( cacheAABB.lowerBound.x, cacheAABB.lowerBound.y, cacheAABB.upperBound.x - cacheAABB.lowerBound.x, cacheAABB.upperBound.y - cacheAABB.lowerBound.y );
+
+    // Find the static layers that can render from their cache and those that need rebuilding.
+    // NOTE: Static layers are ignored when debug rendering objects as their overlays are not cached.
+    U32 cachedLayerMask = 0;
+    U32 rebuildLayerMask = 0;
+    const bool staticLayers = (getDebugMask() & ~(SCENE_DEBUG_METRICS | SCENE_DEBUG_JOINTS | SCENE_DEBUG_CONTROLLERS)) == 0;
+    for ( U32 layer = 0; layer < MAX_LAYERS_SUPPORTED; ++layer )
+    {
+        // Fetch layer render cache.
+        LayerRenderCache& layerRenderCache = mLayerRenderCaches[layer];
+
+        // Is the layer static?
+        if ( !mLayerStatic[layer] )
+        {
+            // No, so release any render cache.
+            if ( layerRenderCache.mValid )
+            {
+                layerRenderCache.mBatchCache.clear();
+                layerRenderCache.mValid = false;
+            }
+
+            continue;
+        }
+
+        // Skip if not using static layers or the layer is not being rendered.
+        if ( !staticLayers || (pSceneRenderState->mRenderLayerMask & BIT(layer)) == 0 )
+            continue;
+
+        // Has anything rendered in the layer changed since the cache was built?
+        const bool layerChanged =
+            !layerRenderCache.mValid ||
+            layerRenderCache.mCachedRevision != layerRenderCache.mRevision ||
+            layerRenderCache.mCachedGroupMask != pSceneRenderState->mRenderGroupMask;
+
+        // Render normally if the layer couldn't be cached and nothing has changed since.
+        if ( !layerChanged && !layerRenderCache.mCacheable )
+            continue;
+
+        // Can the layer render from its cache?
+        if ( !layerChanged && layerRenderCache.mBatchCache.isValid() && layerRenderCache.mCachedAABB.Contains( cameraAABB ) )
+        {
+            // Yes.
+            cachedLayerMask |= BIT(layer);
+        }
+        else
+        {
+            // No, so it needs rebuilding.
+            rebuildLayerMask |= BIT(layer);
+        }
+    }
+
+    // Are any static layers being rebuilt?
+    if ( rebuildLayerMask != 0 )
+    {
+        // Yes, so query the cached area for those layers.
+        mpWorldQuery->clearQuery();
+        WorldQueryFilter cacheQueryFilter( rebuildLayerMask, pSceneRenderState->mRenderGroupMask, true, true, false, false );
+        mpWorldQuery->setQueryFilter( cacheQueryFilter );
+        mpWorldQuery->aabbQueryAABB( cacheAABB );
+
+        // Keep the query results for when the layers are rendered.
+        for ( U32 layer = 0; layer < MAX_LAYERS_SUPPORTED; ++layer )
+        {
+            if ( rebuildLayerMask & BIT(layer) )
+                mLayerRenderCaches[layer].mQueryResults = mpWorldQuery->getLayeredQueryResults( layer );
+        }
+    }
+
     // Clear world query.
     mpWorldQuery->clearQuery();
 
     // Set filter.
-    WorldQueryFilter queryFilter( pSceneRenderState->mRenderLayerMask, pSceneRenderState->mRenderGroupMask, true, true, false, false );
+    // NOTE: Static layers rendering from or being rebuilt into their cache are not queried here.
+    WorldQueryFilter queryFilter( pSceneRenderState->mRenderLayerMask & ~(cachedLayerMask | rebuildLayerMask), pSceneRenderState->mRenderGroupMask, true, true, false, false );
     mpWorldQuery->setQueryFilter( queryFilter );
 
     // Query render AABB.
@@ -996,8 +1331,8 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
     // Debug Profiling.
     PROFILE_END();  //Scene_RenderSceneVisibleQuery
 
-    // Are there any query results?
-    if ( mpWorldQuery->getQueryResultsCount() > 0 )
+    // Are there any query results or static layers?
+    if ( mpWorldQuery->getQueryResultsCount() > 0 || (cachedLayerMask | rebuildLayerMask) != 0 )
     {
         // Debug Profiling.
         PROFILE_SCOPE(Scene_RenderSceneCompileRenderRequests);
@@ -1008,206 +1343,63 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
         // Yes so step through layers.
         for ( S32 layer = MAX_LAYERS_SUPPORTED-1; layer >= 0 ; layer-- )
         {
-            // Fetch layer.
-            typeWorldQueryResultVector& layerResults = mpWorldQuery->getLayeredQueryResults( layer );
-
-            // Fetch layer object count.
-            const U32 layerObjectCount = layerResults.size();
+            // Fetch layer render cache.
+            LayerRenderCache& layerRenderCache = mLayerRenderCaches[layer];
 
-            // Are there any objects to render in this layer?
-            if ( layerObjectCount > 0 )
+            // Is the layer rendering from its cache?
+            if ( cachedLayerMask & BIT(layer) )
             {
-                // Yes, so increase render picked.
-                pDebugStats->renderPicked += layerObjectCount;
-
-                // Iterate query results.
-                for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
-                {
-                    // Fetch scene object.
-                    SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
-
-                    // Skip if the object should not render.
-                    if ( !pSceneObject->shouldRender() )
-                        continue;
-
-                    // Can the scene object prepare a render?
-                    if ( pSceneObject->canPrepareRender() )
-                    {
-                        // Yes. so is it batch isolated.
-                        if ( pSceneObject->getBatchIsolated() )
-                        {
-                            // Yes, so create a default render request  on the primary queue.
-                            SceneRenderRequest* pIsolatedSceneRenderRequest = Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
-
-                            // Create a new isolated render queue.
-                            pIsolatedSceneRenderRequest->mpIsolatedRenderQueue = SceneRenderQueueFactory.createObject();
-
-                            // Prepare in the isolated queue.
-                            pSceneObject->scenePrepareRender( pSceneRenderState, pIsolatedSceneRenderRequest->mpIsolatedRenderQueue );
-
-                            // Increase render request count.
-                            pDebugStats->renderRequests += (U32)pIsolatedSceneRenderRequest->mpIsolatedRenderQueue->getRenderRequests().size();
+                // Yes, so render the cached batches.
+                mBatchRenderer.render( &layerRenderCache.mBatchCache );
 
-                            // Adjust for the extra private render request.
-                            pDebugStats->renderRequests -= 1;
-                        }
-                        else
-                        {
-                            // No, so prepare in primary queue.
-                            pSceneObject->scenePrepareRender( pSceneRenderState, pSceneRenderQueue );
-                        }
-                    }
-                    else
-                    {
-                        // No, so create a default render request for it.
-                        Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
-                    }
-                }
-
-                // Fetch render requests.
-                SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
-
-                // Fetch render request count.
-                const U32 renderRequestCount = (U32)sceneRenderRequests.size();
-
-                // Increase render request count.
-                pDebugStats->renderRequests += renderRequestCount;
-
-                // Do we have more than a single render request?
-                if ( renderRequestCount > 1 )
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(Scene_RenderSceneLayerSorting);
-
-                    // Yes, so fetch layer sort mode.
-                    SceneRenderQueue::RenderSort& mode = mLayerSortModes[layer];
-
-                    // Temporarily switch to normal sort if batch sort but batcher disabled.
-                    if ( !mBatchRenderer.getBatchEnabled() && mode == SceneRenderQueue::RENDER_SORT_BATCH )
-                        mode = SceneRenderQueue::RENDER_SORT_NEWEST;
-
-                    // Set render queue mode.
-                    pSceneRenderQueue->setSortMode( mode );
-
-                    // Sort the render requests.
-                    pSceneRenderQueue->sort();
-                }
-
-                // Iterate render requests.
-                for( SceneRenderQueue::typeRenderRequestVector::iterator renderRequestItr = sceneRenderRequests.begin(); renderRequestItr != sceneRenderRequests.end(); ++renderRequestItr )
-                {
-                     // Debug Profiling.
-                    PROFILE_SCOPE(Scene_RenderSceneRequests);
-
-                    // Fetch render request.
-                    SceneRenderRequest* pSceneRenderRequest = *renderRequestItr;
-
-                    // Fetch scene render object.
-                    SceneRenderObject* pSceneRenderObject = pSceneRenderRequest->mpSceneRenderObject;
-             
-                    // Flush if the object is not render batched and we're in strict order mode.
-                    if ( !pSceneRenderObject->isBatchRendered() && mBatchRenderer.getStrictOrderMode() )
-                    {
-                        mBatchRenderer.flush( pDebugStats->batchNoBatchFlush );
-                    }
-                    // Flush if the object is batch isolated.
-                    else if ( pSceneRenderObject->getBatchIsolated() )
-                    {
-                        mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
-                    }
+                // Stats.
+                pDebugStats->renderCachedLayers++;
 
-                    // Yes, so is the object batch rendered?
-                    if ( pSceneRenderObject->isBatchRendered() )
-                    {
-                        // Yes, so set the blend mode.
-                        mBatchRenderer.setBlendMode( pSceneRenderRequest );
+                continue;
+            }
 
-                        // Set the alpha test mode.
-                        mBatchRenderer.setAlphaTestMode( pSceneRenderRequest );
-                    }
+            // Is the layer being rebuilt into its cache?
+            const bool rebuildLayer = (rebuildLayerMask & BIT(layer)) != 0;
 
-                    // Set batch strict order mode.
-                    // NOTE:    We keep reasserting this because an object is free to change it during rendering.
-                    mBatchRenderer.setStrictOrderMode( pSceneRenderQueue->getStrictOrderMode() );
+            // Fetch layer.
+            typeWorldQueryResultVector& layerResults = rebuildLayer ? layerRenderCache.mQueryResults : mpWorldQuery->getLayeredQueryResults( layer );
 
-                    // Is the object batch isolated?
-                    if ( pSceneRenderObject->getBatchIsolated() )
-                    {
-                        // Yes, so fetch isolated render queue.
-                        SceneRenderQueue* pIsolatedRenderQueue = pSceneRenderRequest->mpIsolatedRenderQueue;
+            // Fetch the layer render state.
+            const SceneRenderState* pLayerRenderState = rebuildLayer ? &cacheRenderState : pSceneRenderState;
 
-                        // Sanity!
-                        AssertFatal( pIsolatedRenderQueue != NULL, "Cannot render batch isolated with an isolated render queue." );
+            // Fetch the layer revision before anything is rendered.
+            const U32 layerRevision = layerRenderCache.mRevision;
 
-                        // Sort the isolated render requests.
-                        pIsolatedRenderQueue->sort();
+            // Capture the layer if rebuilding it.
+            if ( rebuildLayer )
+                mBatchRenderer.beginCapture( &layerRenderCache.mBatchCache );
 
-                        // Fetch isolated render requests.
-                        SceneRenderQueue::typeRenderRequestVector& isolatedRenderRequests = pIsolatedRenderQueue->getRenderRequests();
+            // Render the layer.
+            const bool layerCacheable = sceneRenderLayer( layer, layerResults, pLayerRenderState, pSceneRenderState, pSceneRenderQueue );
 
-                        // Can the object render?
-                        if ( pSceneRenderObject->validRender() )
-                        {
-                            // Yes, so iterate isolated render requests.
-                            for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
-                            {
-                                pSceneRenderObject->sceneRender( pSceneRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
-                            }
-                        }
-                        else
-                        {
-                            // No, so iterate isolated render requests.
-                            for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
-                            {
-                                pSceneRenderObject->sceneRenderFallback( pSceneRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
-                            }
-
-                            // Increase render fallbacks.
-                            pDebugStats->renderFallbacks++;
-                        }
-
-                        // Flush isolated batch.
-                        mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
-                    }
-                    else
-                    {
-                        // No, so can the object render?
-                        if ( pSceneRenderObject->validRender() )
-                        {
-                            // Yes, so render object.
-                            pSceneRenderObject->sceneRender( pSceneRenderState, pSceneRenderRequest, &mBatchRenderer );
-                        }
-                        else
-                        {
-                            // No, so render using fallback.
-                            pSceneRenderObject->sceneRenderFallback( pSceneRenderState, pSceneRenderRequest, &mBatchRenderer );
-
-                            // Increase render fallbacks.
-                            pDebugStats->renderFallbacks++;
-                        }
-                    }
-                }
+            // Was the layer being rebuilt?
+            if ( rebuildLayer )
+            {
+                // Yes, so finish capturing the layer.
+                mBatchRenderer.endCapture();
 
-                // Flush.
-                // NOTE:    We cannot batch between layers as we adhere to a strict layer render order.
-                mBatchRenderer.flush( pDebugStats->batchLayerFlush );
+                // Update the layer render cache.
+                layerRenderCache.mValid = true;
+                layerRenderCache.mCacheable = layerCacheable;
+                layerRenderCache.mCachedRevision = layerRevision;
+                layerRenderCache.mCachedAABB = cacheAABB;
+                layerRenderCache.mCachedGroupMask = pSceneRenderState->mRenderGroupMask;
 
-                // Iterate query results.
-                for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(Scene_RenderObjectOverlays);
+                // Release the captured batches if they are incomplete.
+                if ( !layerCacheable )
+                    layerRenderCache.mBatchCache.clear();
 
-                    // Fetch scene object.
-                    SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+                // Clear the query results.
+                layerRenderCache.mQueryResults.clear();
 
-                    // Render object overlay.
-                    pSceneObject->sceneRenderOverlay( pSceneRenderState );
-                }
+                // Stats.
+                pDebugStats->renderCacheRebuilds++;
             }
-
-            // Reset render queue.
-            pSceneRenderQueue->resetState();
         }
 
         // Cache render queue..
@@ -1273,6 +1465,227 @@ void Scene::sceneRender( const SceneRenderState* pSceneRenderState )
 
 //-----------------------------------------------------------------------------
 
+bool Scene::sceneRenderLayer( const U32 layer, typeWorldQueryResultVector& layerResults, const SceneRenderState* pLayerRenderState, const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue )
+{
+    // Fetch debug stats.
+    DebugStats* pDebugStats = pSceneRenderState->mpDebugStats;
+
+    // Whether everything rendered in the layer could be captured.
+    bool layerCacheable = true;
+
+    // Fetch layer object count.
+    const U32 layerObjectCount = layerResults.size();
+
+    // Are there any objects to render in this layer?
+    if ( layerObjectCount > 0 )
+    {
+        // Yes, so increase render picked.
+        pDebugStats->renderPicked += layerObjectCount;
+
+        // Iterate query results.
+        for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+        {
+            // Fetch scene object.
+            SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+
+            // Skip if the object should not render.
+            if ( !pSceneObject->shouldRender() )
+                continue;
+
+            // The layer cannot be cached if the object cannot be captured.
+            if ( !pSceneObject->isBatchRendered() || !pSceneObject->getRenderCacheable() || pSceneObject->getDebugMask() != 0 )
+                layerCacheable = false;
+
+            // Can the scene object prepare a render?
+            if ( pSceneObject->canPrepareRender() )
+            {
+                // Yes. so is it batch isolated.
+                if ( pSceneObject->getBatchIsolated() )
+                {
+                    // Yes, so create a default render request  on the primary queue.
+                    SceneRenderRequest* pIsolatedSceneRenderRequest = Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
+
+                    // Create a new isolated render queue.
+                    pIsolatedSceneRenderRequest->mpIsolatedRenderQueue = SceneRenderQueueFactory.createObject();
+
+                    // Prepare in the isolated queue.
+                    pSceneObject->scenePrepareRender( pLayerRenderState, pIsolatedSceneRenderRequest->mpIsolatedRenderQueue );
+
+                    // Increase render request count.
+                    pDebugStats->renderRequests += (U32)pIsolatedSceneRenderRequest->mpIsolatedRenderQueue->getRenderRequests().size();
+
+                    // Adjust for the extra private render request.
+                    pDebugStats->renderRequests -= 1;
+                }
+                else
+                {
+                    // No, so prepare in primary queue.
+                    pSceneObject->scenePrepareRender( pLayerRenderState, pSceneRenderQueue );
+                }
+            }
+            else
+            {
+                // No, so create a default render request for it.
+                Scene::createDefaultRenderRequest( pSceneRenderQueue, pSceneObject );
+            }
+        }
+
+        // Fetch render requests.
+        SceneRenderQueue::typeRenderRequestVector& sceneRenderRequests = pSceneRenderQueue->getRenderRequests();
+
+        // Fetch render request count.
+        const U32 renderRequestCount = (U32)sceneRenderRequests.size();
+
+        // Increase render request count.
+        pDebugStats->renderRequests += renderRequestCount;
+
+        // Do we have more than a single render request?
+        if ( renderRequestCount > 1 )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_RenderSceneLayerSorting);
+
+            // Yes, so fetch layer sort mode.
+            SceneRenderQueue::RenderSort& mode = mLayerSortModes[layer];
+
+            // Temporarily switch to normal sort if batch sort but batcher disabled.
+            if ( !mBatchRenderer.getBatchEnabled() && mode == SceneRenderQueue::RENDER_SORT_BATCH )
+                mode = SceneRenderQueue::RENDER_SORT_NEWEST;
+
+            // Set render queue mode.
+            pSceneRenderQueue->setSortMode( mode );
+
+            // Sort the render requests.
+            pSceneRenderQueue->sort();
+        }
+
+        // Iterate render requests.
+        for( SceneRenderQueue::typeRenderRequestVector::iterator renderRequestItr = sceneRenderRequests.begin(); renderRequestItr != sceneRenderRequests.end(); ++renderRequestItr )
+        {
+             // Debug Profiling.
+            PROFILE_SCOPE(Scene_RenderSceneRequests);
+
+            // Fetch render request.
+            SceneRenderRequest* pSceneRenderRequest = *renderRequestItr;
+
+            // Fetch scene render object.
+            SceneRenderObject* pSceneRenderObject = pSceneRenderRequest->mpSceneRenderObject;
+     
+            // Flush if the object is not render batched and we're in strict order mode.
+            if ( !pSceneRenderObject->isBatchRendered() && mBatchRenderer.getStrictOrderMode() )
+            {
+                mBatchRenderer.flush( pDebugStats->batchNoBatchFlush );
+            }
+            // Flush if the object is batch isolated.
+            else if ( pSceneRenderObject->getBatchIsolated() )
+            {
+                mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
+            }
+
+            // Yes, so is the object batch rendered?
+            if ( pSceneRenderObject->isBatchRendered() )
+            {
+                // Yes, so set the blend mode.
+                mBatchRenderer.setBlendMode( pSceneRenderRequest );
+
+                // Set the alpha test mode.
+                mBatchRenderer.setAlphaTestMode( pSceneRenderRequest );
+            }
+
+            // Set batch strict order mode.
+            // NOTE:    We keep reasserting this because an object is free to change it during rendering.
+            mBatchRenderer.setStrictOrderMode( pSceneRenderQueue->getStrictOrderMode() );
+
+            // Is the object batch isolated?
+            if ( pSceneRenderObject->getBatchIsolated() )
+            {
+                // Yes, so fetch isolated render queue.
+                SceneRenderQueue* pIsolatedRenderQueue = pSceneRenderRequest->mpIsolatedRenderQueue;
+
+                // Sanity!
+                AssertFatal( pIsolatedRenderQueue != NULL, "Cannot render batch isolated with an isolated render queue." );
+
+                // Sort the isolated render requests.
+                pIsolatedRenderQueue->sort();
+
+                // Fetch isolated render requests.
+                SceneRenderQueue::typeRenderRequestVector& isolatedRenderRequests = pIsolatedRenderQueue->getRenderRequests();
+
+                // Can the object render?
+                if ( pSceneRenderObject->validRender() )
+                {
+                    // Yes, so iterate isolated render requests.
+                    for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
+                    {
+                        pSceneRenderObject->sceneRender( pLayerRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
+                    }
+                }
+                else
+                {
+                    // No, so iterate isolated render requests.
+                    for( SceneRenderQueue::typeRenderRequestVector::iterator isolatedRenderRequestItr = isolatedRenderRequests.begin(); isolatedRenderRequestItr != isolatedRenderRequests.end(); ++isolatedRenderRequestItr )
+                    {
+                        pSceneRenderObject->sceneRenderFallback( pLayerRenderState, *isolatedRenderRequestItr, &mBatchRenderer );
+                    }
+
+                    // Increase render fallbacks.
+                    pDebugStats->renderFallbacks++;
+
+                    // The layer cannot be cached with a fallback render.
+                    layerCacheable = false;
+                }
+
+                // Flush isolated batch.
+                mBatchRenderer.flush( pDebugStats->batchIsolatedFlush );
+            }
+            else
+            {
+                // No, so can the object render?
+                if ( pSceneRenderObject->validRender() )
+                {
+                    // Yes, so render object.
+                    pSceneRenderObject->sceneRender( pLayerRenderState, pSceneRenderRequest, &mBatchRenderer );
+                }
+                else
+                {
+                    // No, so render using fallback.
+                    pSceneRenderObject->sceneRenderFallback( pLayerRenderState, pSceneRenderRequest, &mBatchRenderer );
+
+                    // Increase render fallbacks.
+                    pDebugStats->renderFallbacks++;
+
+                    // The layer cannot be cached with a fallback render.
+                    layerCacheable = false;
+                }
+            }
+        }
+
+        // Flush.
+        // NOTE:    We cannot batch between layers as we adhere to a strict layer render order.
+        mBatchRenderer.flush( pDebugStats->batchLayerFlush );
+
+        // Iterate query results.
+        for( typeWorldQueryResultVector::iterator worldQueryItr = layerResults.begin(); worldQueryItr != layerResults.end(); ++worldQueryItr )
+        {
+            // Debug Profiling.
+            PROFILE_SCOPE(Scene_RenderObjectOverlays);
+
+            // Fetch scene object.
+            SceneObject* pSceneObject = worldQueryItr->mpSceneObject;
+
+            // Render object overlay.
+            pSceneObject->sceneRenderOverlay( pSceneRenderState );
+        }
+    }
+
+    // Reset render queue.
+    pSceneRenderQueue->resetState();
+
+    return layerCacheable;
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::clearScene( bool deleteObjects )
 {
     while( mSceneObjects.size() > 0 )
@@ -1338,6 +1751,9 @@ void Scene::addToScene( SceneObject* pSceneObject )
     // Register with the scene.
     pSceneObject->OnRegisterScene( this );
 
+    // Invalidate the layer render cache.
+    invalidateLayerRenderCache( pSceneObject->getSceneLayer() );
+
     // Perform callback only if properly added to the simulation.
     if ( pSceneObject->isProperlyAdded() )
     {
@@ -1380,6 +1796,9 @@ void Scene::removeFromScene( SceneObject* pSceneObject )
         (dynamic_cast<SceneWindow*>(mAttachedSceneWindows[i]))->removeFromInputEventPick(pSceneObject);
     }
 
+    // Invalidate the layer render cache.
+    invalidateLayerRenderCache( pSceneObject->getSceneLayer() );
+
     // Unregister from scene.
     pSceneObject->OnUnregisterScene( this );
 
@@ -3569,6 +3988,9 @@ void Scene::setLayerSortMode( const U32 layer, const SceneRenderQueue::RenderSor
     }
 
     mLayerSortModes[layer] = sortMode;
+
+    // Invalidate the layer render cache.
+    invalidateLayerRenderCache( layer );
 }
 
 //-----------------------------------------------------------------------------
@@ -3589,6 +4011,41 @@ SceneRenderQueue::RenderSort Scene::getLayerSortMode( const U32 layer )
 
 //-----------------------------------------------------------------------------
 
+void Scene::setLayerStatic( const U32 layer, const bool status )
+{
+    // Is the layer valid?
+    if ( layer >= MAX_LAYERS_SUPPORTED )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::setLayerStatic() - Layer '%d' is out of range.", layer );
+
+        return;
+    }
+
+    mLayerStatic[layer] = status;
+
+    // Invalidate the layer render cache.
+    invalidateLayerRenderCache( layer );
+}
+
+//-----------------------------------------------------------------------------
+
+bool Scene::getLayerStatic( const U32 layer )
+{
+    // Is the layer valid?
+    if ( layer >= MAX_LAYERS_SUPPORTED )
+    {
+        // No, so warn.
+        Con::warnf( "Scene::getLayerStatic() - Layer '%d' is out of range.", layer );
+
+        return false;
+    }
+
+    return mLayerStatic[layer];
+}
+
+//-----------------------------------------------------------------------------
+
 void Scene::attachSceneWindow( SceneWindow* pSceneWindow2D )
 {
     // Ignore if already attached.
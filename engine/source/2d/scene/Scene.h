@@ -31,6 +31,10 @@
 #include "2d/core/Vector2.h"
 #endif
 
+#ifndef _PLATFORM_INTRINSICS_H_
+#include "platform/platformIntrinsics.h"
+#endif
+
 #ifndef _NETOBJECT_H_
 #include "network/netObject.h"
 #endif
@@ -67,6 +71,10 @@
 #include "2d/scene/SceneRenderObject.h"
 #endif
 
+#ifndef _SCENE_CONTACT_SET_H_
+#include "2d/scene/SceneContactSet.h"
+#endif
+
 #ifndef _BEHAVIOR_COMPONENT_H_
 #include "component/behaviors/behaviorComponent.h"
 #endif
@@ -171,6 +179,7 @@ public:
     typedef Vector<tDeleteRequest>              typeDeleteVector;
     typedef Vector<TickContact>                 typeContactVector;
     typedef HashMap<b2Contact*, TickContact>    typeContactHash;
+    typedef HashMap<Namespace*, U32>            typeContactCallbackHash;
     typedef Vector<AssetPtr<AssetBase>*>        typeAssetPtrVector;
 
     /// Scene Debug Options.
@@ -222,6 +231,7 @@ private:
     /// Scene occupancy.
     typeSceneObjectVector       mSceneObjects;
     typeSceneObjectVector       mTickedSceneObjects;
+    typeSceneObjectVector       mTickedConcurrentSceneObjects;
 
     /// Joint access.
     typeJointHash               mJoints;
@@ -246,6 +256,40 @@ private:
     /// Layer sorting and draw order.
     SceneRenderQueue::RenderSort mLayerSortModes[MAX_LAYERS_SUPPORTED];
 
+    /// Static layer render caching.
+    struct LayerRenderCache
+    {
+        LayerRenderCache() :
+            mRevision( 0 ),
+            mCachedRevision( 0 ),
+            mCachedGroupMask( 0 ),
+            mValid( false ),
+            mCacheable( false )
+        {
+            mCachedAABB.lowerBound.SetZero();
+            mCachedAABB.upperBound.SetZero();
+        }
+
+        /// Incremented whenever anything rendered in the layer changes.
+        volatile U32                mRevision;
+
+        /// The revision, area and groups the cache was built with.
+        U32                         mCachedRevision;
+        b2AABB                      mCachedAABB;
+        U32                         mCachedGroupMask;
+        bool                        mValid;
+
+        /// Whether everything in the layer could be captured when it was built.
+        bool                        mCacheable;
+
+        BatchRenderCache            mBatchCache;
+        typeWorldQueryResultVector  mQueryResults;
+    };
+
+    bool                        mLayerStatic[MAX_LAYERS_SUPPORTED];
+    LayerRenderCache            mLayerRenderCaches[MAX_LAYERS_SUPPORTED];
+    F32                         mLayerStaticMargin;
+
     /// Batch rendering.
     BatchRender                 mBatchRenderer;
 
@@ -263,15 +307,42 @@ private:
     S32                         mIsEditorScene;
     bool                        mUpdateCallback;
     bool                        mRenderCallback;
+    bool                        mTickJobs;
+    bool                        mPhysicsJobs;
     typeContactHash             mBeginContacts;
     typeContactVector           mEndContacts;
     U32                         mSceneIndex;
 
+    /// Contact callbacks.
+    enum ContactCallback
+    {
+        CONTACT_CALLBACK_SCENE_COLLISION,
+        CONTACT_CALLBACK_SCENE_END_COLLISION,
+        CONTACT_CALLBACK_SCENE_COLLISION_BATCH,
+        CONTACT_CALLBACK_SCENE_END_COLLISION_BATCH,
+        CONTACT_CALLBACK_COLLISION,
+        CONTACT_CALLBACK_END_COLLISION,
+
+        CONTACT_CALLBACK_COUNT
+    };
+
+    bool                        mBatchCollisionCallbacks;
+    SimObjectPtr<SceneContactSet> mBeginContactSet;
+    SimObjectPtr<SceneContactSet> mEndContactSet;
+    typeContactCallbackHash     mContactCallbackCache;
+    U32                         mContactCallbackSequence;
+
 private:   
     /// Contacts.
     void                        forwardContacts( void );
     void                        dispatchBeginContactCallbacks( void );
     void                        dispatchEndContactCallbacks( void );
+    void                        dispatchContactCallbacks( const SceneContact& contact, SceneObject* pSceneObjectA, SceneObject* pSceneObjectB, const bool beginContact );
+    void                        dispatchContactBatchCallback( SceneContactSet* pContactSet, const bool beginContact );
+    bool                        handlesContactCallback( SimObject* pSimObject, const ContactCallback callback );
+
+    /// Rendering.
+    bool                        sceneRenderLayer( const U32 layer, typeWorldQueryResultVector& layerResults, const SceneRenderState* pLayerRenderState, const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue );
 
     /// Joint definition.
     struct CommonJointDefinition
@@ -636,6 +707,13 @@ public:
     void setLayerSortMode( const U32 layer, const SceneRenderQueue::RenderSort sortMode );
     SceneRenderQueue::RenderSort getLayerSortMode( const U32 layer );
 
+    /// Static layers.
+    void setLayerStatic( const U32 layer, const bool status );
+    bool getLayerStatic( const U32 layer );
+    inline void             setLayerStaticMargin( const F32 margin )    { mLayerStaticMargin = margin < 0.0f ? 0.0f : margin; }
+    inline F32              getLayerStaticMargin( void ) const          { return mLayerStaticMargin; }
+    inline void             invalidateLayerRenderCache( const U32 layer ) { dAtomicIncrement( mLayerRenderCaches[layer].mRevision ); }
+
     /// Window attachments.
     void                    attachSceneWindow( SceneWindow* pSceneWindow2D );
     void                    detachSceneWindow( SceneWindow* pSceneWindow2D );
@@ -656,6 +734,8 @@ public:
     /// Miscellaneous.
     inline void             setBatchingEnabled( const bool enabled )    { mBatchRenderer.setBatchEnabled( enabled ); }
     inline bool             getBatchingEnabled( void ) const            { return mBatchRenderer.getBatchEnabled(); }
+    inline void             setBatchVertexFormat( const BatchRender::VertexFormat vertexFormat ) { mBatchRenderer.setVertexFormat( vertexFormat ); }
+    inline BatchRender::VertexFormat getBatchVertexFormat( void ) const { return mBatchRenderer.getVertexFormat(); }
     inline bool             getIsEditorScene( void ) const              { return ((mIsEditorScene > 0) ? true : false); }
     inline void             setIsEditorScene( bool status )             { mIsEditorScene += (status ? 1 : -1); }
     static U32              getGlobalSceneCount( void );
@@ -664,6 +744,12 @@ public:
     inline bool             getUpdateCallback( void ) const             { return mUpdateCallback; }
     inline void             setRenderCallback( const bool callback )    { mRenderCallback = callback; }
     inline bool             getRenderCallback( void ) const             { return mRenderCallback; }
+    inline void             setTickJobs( const bool tickJobs )          { mTickJobs = tickJobs; }
+    inline bool             getTickJobs( void ) const                   { return mTickJobs; }
+    inline void             setPhysicsJobs( const bool physicsJobs )    { mPhysicsJobs = physicsJobs; }
+    inline bool             getPhysicsJobs( void ) const                { return mPhysicsJobs; }
+    inline void             setBatchCollisionCallbacks( const bool batch ) { mBatchCollisionCallbacks = batch; }
+    inline bool             getBatchCollisionCallbacks( void ) const    { return mBatchCollisionCallbacks; }
     static SceneRenderRequest* createDefaultRenderRequest( SceneRenderQueue* pSceneRenderQueue, SceneObject* pSceneObject  );
 
     /// Taml children.
@@ -689,9 +775,9 @@ protected:
     static bool writeVelocityIterations( void* obj, StringTableEntry pFieldName )   { return static_cast<Scene*>(obj)->getVelocityIterations() != 8; }
     static bool writePositionIterations( void* obj, StringTableEntry pFieldName )   { return static_cast<Scene*>(obj)->getPositionIterations() != 3; }
 
-    static bool writeLayerSortMode( void* obj, StringTableEntry pFieldName )
+    static U32 getLayerFieldIndex( StringTableEntry pFieldName )
     {
-        // Find the layer index portion of the layer sort mode field.
+        // Find the layer index portion of the layer field.
         const char* pLayerNumber = pFieldName;
         while( true )
         {
@@ -707,10 +793,16 @@ protected:
         };
 
         // Sanity!
-        AssertFatal( *pLayerNumber != 0, "Scene::writeLayerSortMode() - Could not find the layer index portion of the layer sort mode field." );
+        AssertFatal( *pLayerNumber != 0, "Scene::getLayerFieldIndex() - Could not find the layer index portion of the layer field." );
 
         // Fetch layer number.
-        const U32 layer = dAtoi(pLayerNumber);
+        return dAtoi(pLayerNumber);
+    }
+
+    static bool writeLayerSortMode( void* obj, StringTableEntry pFieldName )
+    {
+        // Fetch layer number.
+        const U32 layer = getLayerFieldIndex( pFieldName );
 
         // Just allow the write if an bad parse.
         if ( layer > MAX_LAYERS_SUPPORTED )
@@ -719,10 +811,29 @@ protected:
         return static_cast<Scene*>(obj)->getLayerSortMode( layer ) != SceneRenderQueue::RENDER_SORT_NEWEST;
     }
 
+    static bool writeLayerStatic( void* obj, StringTableEntry pFieldName )
+    {
+        // Fetch layer number.
+        const U32 layer = getLayerFieldIndex( pFieldName );
+
+        // Just allow the write if an bad parse.
+        if ( layer > MAX_LAYERS_SUPPORTED )
+            return true;
+
+        return static_cast<Scene*>(obj)->getLayerStatic( layer );
+    }
+
+    static bool writeLayerStaticMargin( void* obj, StringTableEntry pFieldName )   { return mNotEqual( static_cast<Scene*>(obj)->getLayerStaticMargin(), 0.5f ); }
+
     // Callbacks.
     static bool writeUpdateCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getUpdateCallback(); }
     static bool writeRenderCallback( void* obj, StringTableEntry pFieldName )       { return static_cast<Scene*>(obj)->getRenderCallback(); }
 
+    // Ticking.
+    static bool writeTickJobs( void* obj, StringTableEntry pFieldName )             { return static_cast<Scene*>(obj)->getTickJobs(); }
+    static bool writePhysicsJobs( void* obj, StringTableEntry pFieldName )          { return static_cast<Scene*>(obj)->getPhysicsJobs(); }
+    static bool writeBatchCollisionCallbacks( void* obj, StringTableEntry pFieldName ) { return static_cast<Scene*>(obj)->getBatchCollisionCallbacks(); }
+
 public:
     static SimObjectPtr<Scene> LoadingScene;
 };
@@ -0,0 +1,67 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_CONTACT_SET_H_
+#include "2d/scene/SceneContactSet.h"
+#endif
+
+#ifndef _CONSOLETYPES_H_
+#include "console/consoleTypes.h"
+#endif
+
+// Script bindings.
+#include "2d/scene/SceneContactSet_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+IMPLEMENT_CONOBJECT(SceneContactSet);
+
+//-----------------------------------------------------------------------------
+
+SceneContactSet::SceneContactSet()
+{
+    // Set Vector Associations.
+    VECTOR_SET_ASSOCIATION( mContacts );
+}
+
+//-----------------------------------------------------------------------------
+
+bool SceneContactSet::isValidContact( const U32 index, const U32 pointIndex ) const
+{
+    // Is the contact index valid?
+    if ( index >= (U32)mContacts.size() )
+    {
+        // No, so warn.
+        Con::warnf( "SceneContactSet::isValidContact() - Invalid contact index '%d'.", index );
+        return false;
+    }
+
+    // Is the point index valid?
+    if ( pointIndex >= b2_maxManifoldPoints )
+    {
+        // No, so warn.
+        Con::warnf( "SceneContactSet::isValidContact() - Invalid point index '%d'.", pointIndex );
+        return false;
+    }
+
+    return true;
+}
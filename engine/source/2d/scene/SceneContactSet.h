@@ -0,0 +1,93 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _SCENE_CONTACT_SET_H_
+#define _SCENE_CONTACT_SET_H_
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _VECTOR2_H_
+#include "2d/core/Vector2.h"
+#endif
+
+///-----------------------------------------------------------------------------
+
+struct SceneContact
+{
+    SceneContact()
+    {
+        mSceneObjectA = 0;
+        mSceneObjectB = 0;
+        mShapeIndexA = 0;
+        mShapeIndexB = 0;
+        mPointCount = 0;
+        mNormal.SetZero();
+        for ( U32 i = 0; i < b2_maxManifoldPoints; i++ )
+        {
+            mPoints[i].SetZero();
+            mNormalImpulses[i] = 0.0f;
+            mTangentImpulses[i] = 0.0f;
+        }
+    }
+
+    SimObjectId     mSceneObjectA;
+    SimObjectId     mSceneObjectB;
+    S32             mShapeIndexA;
+    S32             mShapeIndexB;
+    U32             mPointCount;
+    Vector2         mNormal;
+    Vector2         mPoints[b2_maxManifoldPoints];
+    F32             mNormalImpulses[b2_maxManifoldPoints];
+    F32             mTangentImpulses[b2_maxManifoldPoints];
+};
+
+///-----------------------------------------------------------------------------
+
+/// A typed set of contacts delivered to script in a single callback.
+/// Script reads the contact fields directly rather than parsing a formatted string per contact.
+class SceneContactSet : public SimObject
+{
+    typedef SimObject Parent;
+
+public:
+    typedef Vector<SceneContact> typeContactVector;
+
+private:
+    typeContactVector   mContacts;
+
+public:
+    SceneContactSet();
+    virtual ~SceneContactSet() {}
+
+    inline void clear( void )                                               { mContacts.clear(); }
+    inline void addContact( const SceneContact& contact )                   { mContacts.push_back( contact ); }
+    inline U32 getContactCount( void ) const                                { return mContacts.size(); }
+    inline const SceneContact& getContact( const U32 index ) const          { return mContacts[index]; }
+    bool isValidContact( const U32 index, const U32 pointIndex = 0 ) const;
+
+    /// Declare Console Object.
+    DECLARE_CONOBJECT( SceneContactSet );
+};
+
+#endif // _SCENE_CONTACT_SET_H_
@@ -0,0 +1,202 @@
+﻿//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+ConsoleMethodGroupBeginWithDocs(SceneContactSet, SimObject)
+
+/*! Gets the number of contacts in the set.
+    @return The number of contacts in the set.
+*/
+ConsoleMethodWithDocs(SceneContactSet, getContactCount, ConsoleInt, 2, 2, ())
+{
+    return object->getContactCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the first scene object in the contact.
+    @param contactIndex The contact index.
+    @return The first scene object in the contact or zero if the index is invalid.
+*/
+ConsoleMethodWithDocs(SceneContactSet, getSceneObjectA, ConsoleInt, 3, 3, (contactIndex))
+{
+    // Fetch contact index.
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    // Finish if the contact index is invalid.
+    if ( !object->isValidContact( contactIndex ) )
+        return 0;
+
+    return object->getContact( contactIndex ).mSceneObjectA;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the second scene object in the contact.
+    @param contactIndex The contact index.
+    @return The second scene object in the contact or zero if the index is invalid.
+*/
+ConsoleMethodWithDocs(SceneContactSet, getSceneObjectB, ConsoleInt, 3, 3, (contactIndex))
+{
+    // Fetch contact index.
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    // Finish if the contact index is invalid.
+    if ( !object->isValidContact( contactIndex ) )
+        return 0;
+
+    return object->getContact( contactIndex ).mSceneObjectB;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the collision shape index of the first scene object in the contact.
+    @param contactIndex The contact index.
+    @return The collision shape index or -1 if the index is invalid.
+*/
+ConsoleMethodWithDocs(SceneContactSet, getShapeIndexA, ConsoleInt, 3, 3, (contactIndex))
+{
+    // Fetch contact index.
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    // Finish if the contact index is invalid.
+    if ( !object->isValidContact( contactIndex ) )
+        return -1;
+
+    return object->getContact( contactIndex ).mShapeIndexA;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the collision shape index of the second scene object in the contact.
+    @param contactIndex The contact index.
+    @return The collision shape index or -1 if the index is invalid.
+*/
+ConsoleMethodWithDocs(SceneContactSet, getShapeIndexB, ConsoleInt, 3, 3, (contactIndex))
+{
+    // Fetch contact index.
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    // Finish if the contact index is invalid.
+    if ( !object->isValidContact( contactIndex ) )
+        return -1;
+
+    return object->getContact( contactIndex ).mShapeIndexB;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of contact points in the contact.
+    End contacts never have contact points.
+    @param contactIndex The contact index.
+    @return The number of contact points (0, 1 or 2).
+*/
+ConsoleMethodWithDocs(SceneContactSet, getPointCount, ConsoleInt, 3, 3, (contactIndex))
+{
+    // Fetch contact index.
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    // Finish if the contact index is invalid.
+    if ( !object->isValidContact( contactIndex ) )
+        return 0;
+
+    return object->getContact( contactIndex ).mPointCount;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the world normal of the contact.
+    @param contactIndex The contact index.
+    @return The world normal of the contact in the format "x y".
+*/
+ConsoleMethodWithDocs(SceneContactSet, getNormal, ConsoleString, 3, 3, (contactIndex))
+{
+    // Fetch contact index.
+    const U32 contactIndex = dAtoi(argv[2]);
+
+    // Finish if the contact index is invalid.
+    if ( !object->isValidContact( contactIndex ) )
+        return Vector2::getZero().scriptThis();
+
+    return object->getContact( contactIndex ).mNormal.scriptThis();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets a world contact point of the contact.
+    @param contactIndex The contact index.
+    @param pointIndex The contact point index (0 or 1).
+    @return The world contact point in the format "x y".
+*/
+ConsoleMethodWithDocs(SceneContactSet, getPoint, ConsoleString, 4, 4, (contactIndex, pointIndex))
+{
+    // Fetch contact and point index.
+    const U32 contactIndex = dAtoi(argv[2]);
+    const U32 pointIndex = dAtoi(argv[3]);
+
+    // Finish if the contact index is invalid.
+    if ( !object->isValidContact( contactIndex, pointIndex ) )
+        return Vector2::getZero().scriptThis();
+
+    return object->getContact( contactIndex ).mPoints[pointIndex].scriptThis();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the normal impulse at a contact point of the contact.
+    @param contactIndex The contact index.
+    @param pointIndex The contact point index (0 or 1).
+    @return The normal impulse at the contact point.
+*/
+ConsoleMethodWithDocs(SceneContactSet, getNormalImpulse, ConsoleFloat, 4, 4, (contactIndex, pointIndex))
+{
+    // Fetch contact and point index.
+    const U32 contactIndex = dAtoi(argv[2]);
+    const U32 pointIndex = dAtoi(argv[3]);
+
+    // Finish if the contact index is invalid.
+    if ( !object->isValidContact( contactIndex, pointIndex ) )
+        return 0.0f;
+
+    return object->getContact( contactIndex ).mNormalImpulses[pointIndex];
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the tangent impulse at a contact point of the contact.
+    @param contactIndex The contact index.
+    @param pointIndex The contact point index (0 or 1).
+    @return The tangent impulse at the contact point.
+*/
+ConsoleMethodWithDocs(SceneContactSet, getTangentImpulse, ConsoleFloat, 4, 4, (contactIndex, pointIndex))
+{
+    // Fetch contact and point index.
+    const U32 contactIndex = dAtoi(argv[2]);
+    const U32 pointIndex = dAtoi(argv[3]);
+
+    // Finish if the contact index is invalid.
+    if ( !object->isValidContact( contactIndex, pointIndex ) )
+        return 0.0f;
+
+    return object->getContact( contactIndex ).mTangentImpulses[pointIndex];
+}
+
+ConsoleMethodGroupEndWithDocs(SceneContactSet)
@@ -29,12 +29,10 @@
 
 //-----------------------------------------------------------------------------
 
-class SceneRenderRequest;
 class SceneRenderQueue;
 
 //-----------------------------------------------------------------------------
 
-extern FactoryCache<SceneRenderRequest> SceneRenderRequestFactory;
 extern FactoryCache<SceneRenderQueue> SceneRenderQueueFactory;
 
 #endif // _SCENE_RENDER_FACTORIES_H_
@@ -81,168 +81,247 @@ const char* SceneRenderQueue::getRenderSortDescription( const RenderSort& sortMo
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredNewFrontSort(const void* a, const void* b)
+inline U64 SceneRenderQueue::getSerialKey( const SceneRenderRequest* pSceneRenderRequest )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Use serial Id,
-    return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
-    
-//-----------------------------------------------------------------------------
-
-S32 QSORT_CALLBACK SceneRenderQueue::layeredOldFrontSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Use reverse serial Id,
-    return pSceneRenderRequestB->mSerialId - pSceneRenderRequestA->mSerialId;
+    // Flip the sign bit so the serial Id orders as unsigned.
+    return (U64)((U32)pSceneRenderRequest->mSerialId ^ 0x80000000);
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredDepthSort(const void* a, const void* b)
+inline U64 SceneRenderQueue::getFloatKey( const F32 value )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Treat negative zero as zero.
+    const F32 keyValue = value == 0.0f ? 0.0f : value;
 
-    // Fetch depths.
-    const F32 depthA = pSceneRenderRequestA->mDepth;
-    const F32 depthB = pSceneRenderRequestB->mDepth;
+    // Fetch the float bits.
+    U32 bits;
+    dMemcpy( &bits, &keyValue, sizeof(bits) );
 
-    return depthA < depthB ? 1 : depthA > depthB ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    // Flip all the bits of negative values and the sign bit of positive values so the float orders as unsigned.
+    return (U64)(bits ^ ((bits & 0x80000000) ? 0xFFFFFFFF : 0x80000000));
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseDepthSort(const void* a, const void* b)
+void SceneRenderQueue::sort( void )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Fetch depths.
-    const F32 depthA = pSceneRenderRequestA->mDepth;
-    const F32 depthB = pSceneRenderRequestB->mDepth;
+    // Finish if sorting is off.
+    if ( mSortMode == RENDER_SORT_OFF )
+        return;
 
-    return depthA < depthB ? -1 : depthA > depthB ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
-
-//-----------------------------------------------------------------------------
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneRenderQueue_Sort);
 
-S32 QSORT_CALLBACK SceneRenderQueue::layerBatchOrderSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Fetch render request count.
+    const U32 requestCount = (U32)mRenderRequests.size();
 
-    // Fetch scene render objects.
-    SceneRenderObject* pSceneRenderObjectA = pSceneRenderRequestA->mpSceneRenderObject;
-    SceneRenderObject* pSceneRenderObjectB = pSceneRenderRequestB->mpSceneRenderObject;
+    // Finish if nothing to sort.
+    if ( requestCount < 2 )
+        return;
 
-    // Fetch batch render isolation.
-    const bool renderIsolatedA = pSceneRenderObjectA->getBatchIsolated();
-    const bool renderIsolatedB = pSceneRenderObjectB->getBatchIsolated();
+    // Fetch the sort items.
+    mSortItems.setSize( requestCount );
+    SortItem* pSortItems = mSortItems.address();
+    SceneRenderRequest** ppSceneRenderRequests = mRenderRequests.address();
 
-    // A not render isolated?
-    if ( !renderIsolatedA )
+    // Pack the sort keys.
+    // NOTE: The upper 32-bits hold the sort value and the lower 32-bits the serial Id so equal
+    // sort values are ordered by age.
+    switch( mSortMode )
     {
-        // Use the serial Id if neither are render isolated.
-        if ( !renderIsolatedB )
-            return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-
-        // A not render isolated but B is.
-        return 1;
-    }
-
-    // B not render isolated?
-    if ( !renderIsolatedB )
+        case RENDER_SORT_NEWEST:
+            {
+                for ( U32 n = 0; n < requestCount; ++n )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[n];
+                    pSortItems[n].mKey = getSerialKey( pSceneRenderRequest );
+                    pSortItems[n].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                break;
+            }
+
+        case RENDER_SORT_OLDEST:
+            {
+                for ( U32 n = 0; n < requestCount; ++n )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[n];
+                    pSortItems[n].mKey = getSerialKey( pSceneRenderRequest ) ^ 0xFFFFFFFF;
+                    pSortItems[n].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                break;
+            }
+
+        case RENDER_SORT_BATCH:
+            {
+                // Batch isolated requests are sorted first.
+                for ( U32 n = 0; n < requestCount; ++n )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[n];
+                    const U64 batchKey = pSceneRenderRequest->mpSceneRenderObject->getBatchIsolated() ? 0 : 1;
+                    pSortItems[n].mKey = (batchKey << 32) | getSerialKey( pSceneRenderRequest );
+                    pSortItems[n].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+
+                // Batching means we don't need strict order.
+                mStrictOrderMode = false;
+                break;
+            }
+
+        case RENDER_SORT_GROUP:
+            {
+                // The render group address doesn't fit alongside the serial Id so sort by age first.
+                for ( U32 n = 0; n < requestCount; ++n )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[n];
+                    pSortItems[n].mKey = getSerialKey( pSceneRenderRequest );
+                    pSortItems[n].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                sortKeys();
+
+                // Sort by render group (address, arbitrary but static).
+                // NOTE: The sort is stable so requests within a render group stay ordered by age.
+                for ( U32 n = 0; n < requestCount; ++n )
+                {
+                    pSortItems[n].mKey = (U64)(size_t)pSortItems[n].mpSceneRenderRequest->mRenderGroup;
+                }
+                break;
+            }
+
+        case RENDER_SORT_XAXIS:
+        case RENDER_SORT_INVERSE_XAXIS:
+            {
+                // We sort lower x values before higher values unless inverted.
+                const U64 invertKey = mSortMode == RENDER_SORT_INVERSE_XAXIS ? 0xFFFFFFFF : 0;
+                for ( U32 n = 0; n < requestCount; ++n )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[n];
+                    const U64 sortKey = getFloatKey( pSceneRenderRequest->mWorldPosition.x + pSceneRenderRequest->mSortPoint.x ) ^ invertKey;
+                    pSortItems[n].mKey = (sortKey << 32) | getSerialKey( pSceneRenderRequest );
+                    pSortItems[n].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                break;
+            }
+
+        case RENDER_SORT_YAXIS:
+        case RENDER_SORT_INVERSE_YAXIS:
+            {
+                // We sort lower y values before higher values unless inverted.
+                const U64 invertKey = mSortMode == RENDER_SORT_INVERSE_YAXIS ? 0xFFFFFFFF : 0;
+                for ( U32 n = 0; n < requestCount; ++n )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[n];
+                    const U64 sortKey = getFloatKey( pSceneRenderRequest->mWorldPosition.y + pSceneRenderRequest->mSortPoint.y ) ^ invertKey;
+                    pSortItems[n].mKey = (sortKey << 32) | getSerialKey( pSceneRenderRequest );
+                    pSortItems[n].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                break;
+            }
+
+        case RENDER_SORT_ZAXIS:
+        case RENDER_SORT_INVERSE_ZAXIS:
+            {
+                // We sort higher depths before lower depths unless inverted.
+                const U64 invertKey = mSortMode == RENDER_SORT_ZAXIS ? 0xFFFFFFFF : 0;
+                for ( U32 n = 0; n < requestCount; ++n )
+                {
+                    SceneRenderRequest* pSceneRenderRequest = ppSceneRenderRequests[n];
+                    const U64 sortKey = getFloatKey( pSceneRenderRequest->mDepth ) ^ invertKey;
+                    pSortItems[n].mKey = (sortKey << 32) | getSerialKey( pSceneRenderRequest );
+                    pSortItems[n].mpSceneRenderRequest = pSceneRenderRequest;
+                }
+                break;
+            }
+
+        default:
+            return;
+    };
+
+    // Sort the keys.
+    sortKeys();
+
+    // Write the sorted render requests back.
+    for ( U32 n = 0; n < requestCount; ++n )
     {
-        // A is render isolated.
-        return -1;
+        ppSceneRenderRequests[n] = pSortItems[n].mpSceneRenderRequest;
     }
-
-    // A and B are render isolated so use serial Id,
-    return pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
-
-//-----------------------------------------------------------------------------
-
-S32 QSORT_CALLBACK SceneRenderQueue::layerGroupOrderSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    // Fetch the groups.
-    StringTableEntry renderGroupA = pSceneRenderRequestA->mRenderGroup;
-    StringTableEntry renderGroupB = pSceneRenderRequestB->mRenderGroup;
-
-    // Sort by render group (address, arbitrary but static) and use age if render groups are identical.
-    return renderGroupA == renderGroupB ? pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId : renderGroupA < renderGroupB ? -1 : 1;
-}
-
-//-----------------------------------------------------------------------------
-
-S32 QSORT_CALLBACK SceneRenderQueue::layeredXSortPointSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    const F32 x1 = pSceneRenderRequestA->mWorldPosition.x + pSceneRenderRequestA->mSortPoint.x;
-    const F32 x2 = pSceneRenderRequestB->mWorldPosition.x + pSceneRenderRequestB->mSortPoint.x;
-
-    // We sort lower x values before higher values.
-    return x1 < x2 ? -1 : x1 > x2 ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
 }
 
 //-----------------------------------------------------------------------------
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredYSortPointSort(const void* a, const void* b)
+void SceneRenderQueue::sortKeys( void )
 {
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    const F32 y1 = pSceneRenderRequestA->mWorldPosition.y + pSceneRenderRequestA->mSortPoint.y;
-    const F32 y2 = pSceneRenderRequestB->mWorldPosition.y + pSceneRenderRequestB->mSortPoint.y;
+    // Fetch the sort items.
+    const U32 itemCount = (U32)mSortItems.size();
+    SortItem* pSortItems = mSortItems.address();
 
-    // We sort lower y values before higher values.
-    return y1 < y2 ? -1 : y1 > y2 ? 1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
-
-//-----------------------------------------------------------------------------
-
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseXSortPointSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
-
-    const F32 x1 = pSceneRenderRequestA->mWorldPosition.x + pSceneRenderRequestA->mSortPoint.x;
-    const F32 x2 = pSceneRenderRequestB->mWorldPosition.x + pSceneRenderRequestB->mSortPoint.x;
-
-    // We sort higher x values before lower values.
-    return x1 < x2 ? 1 : x1 > x2 ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
-}
+    // Use an insertion sort for a few items.
+    if ( itemCount <= SCENE_RENDER_QUEUE_INSERTION_SORT_SIZE )
+    {
+        for ( U32 n = 1; n < itemCount; ++n )
+        {
+            const SortItem sortItem = pSortItems[n];
+            U32 index = n;
+            while ( index > 0 && pSortItems[index-1].mKey > sortItem.mKey )
+            {
+                pSortItems[index] = pSortItems[index-1];
+                --index;
+            }
+            pSortItems[index] = sortItem;
+        }
+        return;
+    }
 
-//-----------------------------------------------------------------------------
+    // Count the key bytes for all passes at once.
+    U32 histograms[8][256];
+    dMemset( histograms, 0, sizeof(histograms) );
+    for ( U32 n = 0; n < itemCount; ++n )
+    {
+        const U64 key = pSortItems[n].mKey;
+        for ( U32 pass = 0; pass < 8; ++pass )
+        {
+            histograms[pass][(key >> (pass * 8)) & 0xFF]++;
+        }
+    }
 
-S32 QSORT_CALLBACK SceneRenderQueue::layeredInverseYSortPointSort(const void* a, const void* b)
-{
-    // Fetch scene render requests.
-    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
-    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+    // Fetch the scratch items.
+    mSortScratch.setSize( itemCount );
+    SortItem* pSource = pSortItems;
+    SortItem* pDestination = mSortScratch.address();
 
-    const F32 y1 = pSceneRenderRequestA->mWorldPosition.y + pSceneRenderRequestA->mSortPoint.y;
-    const F32 y2 = pSceneRenderRequestB->mWorldPosition.y + pSceneRenderRequestB->mSortPoint.y;
+    // Sort each key byte from least to most significant.
+    // NOTE: Each pass is stable so the earlier passes are preserved.
+    for ( U32 pass = 0; pass < 8; ++pass )
+    {
+        U32* pHistogram = histograms[pass];
+        const U32 shift = pass * 8;
+
+        // Skip the pass if all the keys have the same byte.
+        if ( pHistogram[(pSource[0].mKey >> shift) & 0xFF] == itemCount )
+            continue;
+
+        // Convert the counts into offsets.
+        U32 offset = 0;
+        for ( U32 bucket = 0; bucket < 256; ++bucket )
+        {
+            const U32 count = pHistogram[bucket];
+            pHistogram[bucket] = offset;
+            offset += count;
+        }
+
+        // Scatter the items.
+        for ( U32 n = 0; n < itemCount; ++n )
+        {
+            pDestination[pHistogram[(pSource[n].mKey >> shift) & 0xFF]++] = pSource[n];
+        }
+
+        // Swap the source and destination.
+        SortItem* pSwap = pSource;
+        pSource = pDestination;
+        pDestination = pSwap;
+    }
 
-    // We sort higher y values before lower values.
-    return y1 < y2 ? 1 : y1 > y2 ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+    // Copy the sorted items back if they ended in the scratch items.
+    if ( pSource != pSortItems )
+        dMemcpy( pSortItems, pSource, itemCount * sizeof(SortItem) );
 }
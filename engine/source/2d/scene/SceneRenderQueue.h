@@ -23,6 +23,10 @@
 #ifndef _SCENE_RENDER_QUEUE_H_
 #define _SCENE_RENDER_QUEUE_H_
 
+#ifndef _SCENE_RENDER_FACTORIES_H_
+#include "2d/scene/SceneRenderFactories.h"
+#endif
+
 #ifndef _SCENE_RENDER_REQUEST_H_
 #include "2d/scene/SceneRenderRequest.h"
 #endif
@@ -32,6 +36,11 @@
 
 //-----------------------------------------------------------------------------
 
+#define SCENE_RENDER_QUEUE_BLOCK_SIZE           256
+#define SCENE_RENDER_QUEUE_INSERTION_SORT_SIZE  32
+
+//-----------------------------------------------------------------------------
+
 class SceneRenderQueue : public IFactoryObjectReset
 {
 public:
@@ -55,31 +64,50 @@ public:
         RENDER_SORT_INVERSE_ZAXIS,
     };
 
-private: 
+private:
+    /// A render request and its packed sort key.
+    struct SortItem
+    {
+        U64                 mKey;
+        SceneRenderRequest* mpSceneRenderRequest;
+    };
+
+    typedef Vector<SceneRenderRequest*> typeRequestBlockVector;
+    typedef Vector<SortItem> typeSortItemVector;
+
+    /// Render requests are stored by value in fixed-size blocks that are kept between resets.
+    typeRequestBlockVector  mRequestBlocks;
+    U32                     mRequestCount;
+
     typeRenderRequestVector mRenderRequests;
     RenderSort              mSortMode;
     bool                    mStrictOrderMode;
 
+    typeSortItemVector      mSortItems;
+    typeSortItemVector      mSortScratch;
+
 private:
-    static S32 QSORT_CALLBACK layeredNewFrontSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredOldFrontSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredDepthSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredInverseDepthSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layerBatchOrderSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layerGroupOrderSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredXSortPointSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredYSortPointSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredInverseXSortPointSort(const void* a, const void* b);
-    static S32 QSORT_CALLBACK layeredInverseYSortPointSort(const void* a, const void* b);
+    /// Sort the render requests by the packed key.
+    void sortKeys( void );
+
+    static U64 getSerialKey( const SceneRenderRequest* pSceneRenderRequest );
+    static U64 getFloatKey( const F32 value );
 
 public:
-    SceneRenderQueue()
+    SceneRenderQueue() : mRequestCount( 0 )
     {
         resetState();
     }
     virtual ~SceneRenderQueue()
     {
         resetState();
+
+        // Free the request blocks.
+        for( typeRequestBlockVector::iterator itr = mRequestBlocks.begin(); itr != mRequestBlocks.end(); ++itr )
+        {
+            delete [] (*itr);
+        }
+        mRequestBlocks.clear();
     }
 
     virtual void resetState( void )
@@ -87,12 +115,22 @@ public:
         // Debug Profiling.
         PROFILE_SCOPE(SceneRenderQueue_ResetState);
 
-        // Cache request.
+        // Release any isolated render queues.
         for( typeRenderRequestVector::iterator itr = mRenderRequests.begin(); itr != mRenderRequests.end(); ++itr )
         {
-            SceneRenderRequestFactory.cacheObject( *itr );
+            SceneRenderRequest* pSceneRenderRequest = *itr;
+
+            if ( pSceneRenderRequest->mpIsolatedRenderQueue != NULL )
+            {
+                SceneRenderQueueFactory.cacheObject( pSceneRenderRequest->mpIsolatedRenderQueue );
+                pSceneRenderRequest->mpIsolatedRenderQueue = NULL;
+            }
         }
+
+        // Rewind the request arena.
+        // NOTE: The blocks are kept so the next frame doesn't allocate.
         mRenderRequests.clear();
+        mRequestCount = 0;
 
         // Reset sort mode.
         mSortMode = RENDER_SORT_NEWEST;
@@ -103,11 +141,19 @@ public:
 
     inline SceneRenderRequest* createRenderRequest( void )
     {
-        // Debug Profiling.
-        PROFILE_SCOPE(SceneRenderQueue_CreateRenderRequest);
+        // Fetch the arena block.
+        const U32 blockIndex = mRequestCount / SCENE_RENDER_QUEUE_BLOCK_SIZE;
+
+        // Allocate a new block if the arena is full.
+        if ( blockIndex == (U32)mRequestBlocks.size() )
+            mRequestBlocks.push_back( new SceneRenderRequest[SCENE_RENDER_QUEUE_BLOCK_SIZE] );
+
+        // Fetch scene render request.
+        SceneRenderRequest* pSceneRenderRequest = mRequestBlocks[blockIndex] + (mRequestCount % SCENE_RENDER_QUEUE_BLOCK_SIZE);
+        mRequestCount++;
 
-        // Create scene render request.
-        SceneRenderRequest* pSceneRenderRequest = SceneRenderRequestFactory.createObject();
+        // Reset scene render request.
+        pSceneRenderRequest->resetState();
 
         // Queue render request.
         mRenderRequests.push_back( pSceneRenderRequest );
@@ -123,113 +169,7 @@ public:
     inline void setStrictOrderMode( const bool strictOrderMode ) { mStrictOrderMode = strictOrderMode; }
     inline bool getStrictOrderMode( void ) const { return mStrictOrderMode; }
 
-    void sort( void )
-    {
-        // Sort layer appropriately.
-        switch( mSortMode )
-        {
-            case RENDER_SORT_NEWEST:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortNewest);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredNewFrontSort );
-                    return;
-                }
-
-            case RENDER_SORT_OLDEST:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortOldest);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredOldFrontSort );
-                    return;
-                }
-
-            case RENDER_SORT_BATCH:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortBatch);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerBatchOrderSort );
-
-                    // Batching means we don't need strict order.
-                    mStrictOrderMode = false;
-                    return;
-                }
-
-            case RENDER_SORT_GROUP:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortGroup);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layerGroupOrderSort );
-                    return;
-                }
-
-            case RENDER_SORT_XAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortXAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredXSortPointSort);
-                    return;
-                }
-
-            case RENDER_SORT_YAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortYAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredYSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_ZAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortZAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredDepthSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_XAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseXAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseXSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_YAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseYAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseYSortPointSort );
-                    return;
-                }
-
-            case RENDER_SORT_INVERSE_ZAXIS:
-                {
-                    // Debug Profiling.
-                    PROFILE_SCOPE(SceneRenderQueue_SortInverseZAxis);
-
-                    dQsort( mRenderRequests.address(), mRenderRequests.size(), sizeof(SceneRenderRequest*), layeredInverseDepthSort );
-                    return;
-                }
-
-            case RENDER_SORT_OFF:
-                {
-                    return;
-                }
-
-            default:
-                break;
-        };
-    }
+    void sort( void );
 
     static RenderSort getRenderSortEnum(const char* label);
     static const char* getRenderSortDescription( const RenderSort& sortMode );
@@ -23,10 +23,6 @@
 #ifndef _SCENE_RENDER_REQUEST_H_
 #define _SCENE_RENDER_REQUEST_H_
 
-#ifndef _SCENE_RENDER_FACTORIES_H_
-#include "2d/scene/SceneRenderFactories.h"
-#endif
-
 #ifndef _VECTOR2_H_
 #include "2d/core/Vector2.h"
 #endif
@@ -35,9 +31,6 @@
 #include "graphics/color.h"
 #endif
 
-// Debug Profiling.
-#include "debug/profiler.h"
-
 //-----------------------------------------------------------------------------
 
 class SceneRenderObject;
@@ -45,7 +38,9 @@ class SceneRenderQueue;
 
 //-----------------------------------------------------------------------------
 
-class SceneRenderRequest : public IFactoryObjectReset
+/// NOTE: Render requests are stored by value in the arena of the render queue that created them
+/// so they must not be held beyond the render queue being reset.
+class SceneRenderRequest
 {
 public:
     SceneRenderRequest() : mpIsolatedRenderQueue(NULL)
@@ -86,11 +81,9 @@ public:
     }
 
     /// Reset request state.
-    virtual void resetState( void )
+    /// NOTE: Any isolated render queue is released by the render queue that owns the request.
+    inline void resetState( void )
     {
-        // Debug Profiling.
-        PROFILE_SCOPE(SceneRenderRequest_ResetState);
-
         mpSceneRenderObject = NULL;
         mWorldPosition.SetZero();
         mDepth = 0.0f;
@@ -109,11 +102,7 @@ public:
         mCustomDataKey1 = 0;
         mCustomDataKey2 = 0;
 
-        if ( mpIsolatedRenderQueue != NULL )
-        {
-            SceneRenderQueueFactory.cacheObject( mpIsolatedRenderQueue );
-            mpIsolatedRenderQueue = NULL;
-        }
+        mpIsolatedRenderQueue = NULL;
     }
 
 public:
@@ -3492,6 +3492,82 @@ ConsoleMethodWithDocs(Scene, getLayerSortMode, ConsoleString, 3, 3, (layer))
 
 //-----------------------------------------------------------------------------
 
+/*! Sets whether the specified layer is static or not.
+    A static layer caches its compiled render batches across frames and only rebuilds them when an object on the layer changes or the view moves outside the cached margin.
+    @param layer The layer to modify.
+    @param status Whether the layer is static or not.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setLayerStatic, ConsoleVoid, 4, 4, (layer, status))
+{
+    // Fetch the layer.
+    const U32 layer = dAtoi(argv[2]);
+
+    // Fetch the status.
+    const bool status = dAtob(argv[3]);
+
+    object->setLayerStatic( layer, status );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets whether the specified layer is static or not.
+    @param layer The layer to retrieve.
+    @return Whether the specified layer is static or not.
+*/
+ConsoleMethodWithDocs(Scene, getLayerStatic, ConsoleBool, 3, 3, (layer))
+{
+    // Fetch the layer.
+    const U32 layer = dAtoi(argv[2]);
+
+    return object->getLayerStatic( layer );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Sets the margin cached around the view for static layers.
+    @param margin The margin as a fraction of the view size (defaults to 0.5).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setLayerStaticMargin, ConsoleVoid, 3, 3, (margin))
+{
+    object->setLayerStaticMargin( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the margin cached around the view for static layers.
+    @return The margin as a fraction of the view size.
+*/
+ConsoleMethodWithDocs(Scene, getLayerStaticMargin, ConsoleFloat, 2, 2, ())
+{
+    return object->getLayerStaticMargin();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Forces the render cache for the specified static layer to be rebuilt.
+    Use this after changing object content that the cache cannot track such as editing sprites in a CompositeSprite.
+    @param layer The layer to invalidate.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, invalidateLayerRenderCache, ConsoleVoid, 3, 3, (layer))
+{
+    // Fetch the layer.
+    const U32 layer = dAtoi(argv[2]);
+
+    // Sanity!
+    if ( layer >= MAX_LAYERS_SUPPORTED )
+    {
+        Con::warnf( "Scene::invalidateLayerRenderCache() - Layer '%d' is out of range.", layer );
+        return;
+    }
+
+    object->invalidateLayerRenderCache( layer );
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Resets the debug statistics.
     @return No return value.
 */
@@ -3568,6 +3644,36 @@ ConsoleMethodWithDocs(Scene, getBatchingEnabled, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets the vertex format used by render batching.
+    @param vertexFormat The vertex format of either "Float", "PackedColor" or "Packed".
+    The packed formats use an RGBA8 color and "Packed" additionally uses normalized 16-bit texture coordinates which cannot repeat.
+    @return No return value.
+*/
+ConsoleMethodWithDocs(Scene, setBatchVertexFormat, ConsoleVoid, 3, 3, ( vertexFormat ))
+{
+    // Fetch vertex format.
+    const BatchRender::VertexFormat vertexFormat = BatchRender::getVertexFormatEnum( argv[2] );
+
+    // Finish if invalid.
+    if ( vertexFormat == BatchRender::VERTEX_FORMAT_INVALID )
+        return;
+
+    // Set the batch vertex format.
+    object->setBatchVertexFormat( vertexFormat );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the vertex format used by render batching.
+    @return The vertex format of either "Float", "PackedColor" or "Packed".
+*/
+ConsoleMethodWithDocs(Scene, getBatchVertexFormat, ConsoleString, 2, 2, ())
+{
+    return BatchRender::getVertexFormatDescription( object->getBatchVertexFormat() );
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets whether this is an editor scene.
     @return No return value.
 */
@@ -104,6 +104,8 @@ protected:
     static bool         writeBatchLayout( void* obj, StringTableEntry pFieldName )          { return static_cast<CompositeSprite*>(obj)->getBatchLayout() != CompositeSprite::NO_LAYOUT; }
     static bool         setBatchCulling(void* obj, const char* data)                        { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchCulling(dAtob(data)); return false; }
     static bool         writeBatchCulling( void* obj, StringTableEntry pFieldName )         { return !static_cast<CompositeSprite*>(obj)->getBatchCulling(); }
+    static bool         setBatchChunkSize(void* obj, const char* data)                      { STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, obj)->setBatchChunkSize(dAtof(data)); return false; }
+    static bool         writeBatchChunkSize( void* obj, StringTableEntry pFieldName )       { return static_cast<CompositeSprite*>(obj)->getBatchChunkSize() > 0.0f; }
 };
 
 #endif // _COMPOSITE_SPRITE_H_
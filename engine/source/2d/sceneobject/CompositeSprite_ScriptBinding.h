@@ -151,6 +151,39 @@ ConsoleMethodWithDocs(CompositeSprite, getBatchCulling, ConsoleBool, 2, 2, ())
 
 //-----------------------------------------------------------------------------
 
+/*! Sets the size of the square chunks the sprites are grouped into.
+    Chunks are culled as a whole and their geometry is built once then rendered until any sprite in them changes.
+    This is considerably faster for large static composites such as tile-maps.  Sprites within a chunk render in the order they were added and animated sprites prevent their chunk being cached.
+    @param chunkSize The chunk size in local units.  Zero turns off chunks (the default).
+    @return No return value.
+*/
+ConsoleMethodWithDocs(CompositeSprite, setBatchChunkSize, ConsoleVoid, 3, 3, (float chunkSize))
+{
+    STATIC_VOID_CAST_TO(CompositeSprite, SpriteBatch, object)->setBatchChunkSize( dAtof(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the size of the square chunks the sprites are grouped into.
+    @return The chunk size in local units or zero if chunks are not used.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchChunkSize, ConsoleFloat, 2, 2, ())
+{
+    return object->getBatchChunkSize();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of chunks the sprites are grouped into.
+    @return The number of chunks.
+*/
+ConsoleMethodWithDocs(CompositeSprite, getBatchChunkCount, ConsoleInt, 2, 2, ())
+{
+    return object->getBatchChunkCount();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Sets the batch render sort mode.
     The render sort mode is used when isolated batch mode is on.
     @return No return value.
@@ -28,42 +28,58 @@
 
 //------------------------------------------------------------------------------
 
-ParticleSystem::ParticleNode* ParticlePlayer::EmitterNode::createParticle( void )
+U32 ParticlePlayer::EmitterNode::createParticle( void )
 {
     // Sanity!
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::createParticle() - Cannot create a particle with a NULL owner." );
   
-    // Fetch a free node,
-    ParticleSystem::ParticleNode* pFreeParticleNode = ParticleSystem::Instance->createParticle();
+    // Create a particle.
+    const U32 particleIndex = mParticles.createParticle();
 
-    // Insert node into emitter chain.
-    pFreeParticleNode->mNextNode        = mParticleNodeHead.mNextNode;
-    pFreeParticleNode->mPreviousNode    = &mParticleNodeHead;
-    mParticleNodeHead.mNextNode         = pFreeParticleNode;
-    pFreeParticleNode->mNextNode->mPreviousNode = pFreeParticleNode;
+    // Configure the particle.
+    mOwner->configureParticle( this, particleIndex );
 
-    // Configure the node.
-    mOwner->configureParticle( this, pFreeParticleNode );
-
-    return pFreeParticleNode;
+    return particleIndex;
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::EmitterNode::freeParticle( ParticleSystem::ParticleNode* pParticleNode )
+U32 ParticlePlayer::EmitterNode::freeExpiredParticles( void )
 {
     // Sanity!
-    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeParticle() - Cannot free a particle with a NULL owner." );
+    AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeExpiredParticles() - Cannot free particles with a NULL owner." );
+
+    // Fetch the particle count.
+    const U32 particleCount = mParticles.getCount();
+
+    // Fetch the particle ages and lifetimes.
+    const F32* pAge = mParticles.getStream( ParticleSystem::ParticleStore::AGE );
+    const F32* pLifetime = mParticles.getStream( ParticleSystem::ParticleStore::LIFETIME );
+
+    // Fetch single-particle mode.
+    // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
+    const bool singleParticle = mpAssetEmitter->getSingleParticle();
+
+    // Compact the live particles.
+    // NOTE:-   Particles are kept in age order so that the oldest-in-front render order is maintained.
+    U32 liveCount = 0;
+    for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
+    {
+        // Skip if the particle has expired.
+        if ( ( !singleParticle && pAge[particleIndex] > pLifetime[particleIndex] ) || mIsZero( pLifetime[particleIndex] ) )
+            continue;
+
+        // Move the particle if a previous particle expired.
+        if ( liveCount != particleIndex )
+            mParticles.moveParticle( liveCount, particleIndex );
+
+        liveCount++;
+    }
 
-    // Deallocate the assets.
-    pParticleNode->mFrameProvider.deallocateAssets();
+    // Free the expired particles.
+    mParticles.freeParticles( liveCount );
 
-    // Remove the node from the emitter chain.
-    pParticleNode->mPreviousNode->mNextNode = pParticleNode->mNextNode;
-    pParticleNode->mNextNode->mPreviousNode = pParticleNode->mPreviousNode;
-   
-    // Free the node.
-    ParticleSystem::Instance->freeParticle( pParticleNode );
+    return liveCount;
 }
 
 //------------------------------------------------------------------------------
@@ -73,11 +89,8 @@ void ParticlePlayer::EmitterNode::freeAllParticles( void )
     // Sanity!
     AssertFatal( mOwner != NULL, "ParticlePlayer::EmitterNode::freeAllParticles() - Cannot free all particles with a NULL owner." );
 
-    // Free all the nodes,
-    while( mParticleNodeHead.mNextNode != &mParticleNodeHead )
-    {
-        freeParticle( mParticleNodeHead.mNextNode );
-    }
+    // Free all the particles.
+    mParticles.freeAllParticles();
 }
 
 //------------------------------------------------------------------------------
@@ -299,42 +312,25 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
             // Fetch the asset emitter.
             ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
-            // Fetch the first particle node.
-            ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
+            // Fetch the particles.
+            ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
 
-            // Fetch the particle node head.
-            ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
+            // Fetch the particle count.
+            U32 particleCount = particles.getCount();
 
-            // Process All particle nodes.
-            while ( pParticleNode != pParticleNodeHead )
-            {
-                // Update the particle age.
-                pParticleNode->mParticleAge += scaledTime;
+            // Update the particle ages.
+            F32* pAge = particles.getStream( ParticleSystem::ParticleStore::AGE );
+            for ( U32 particleIndex = 0; particleIndex < particleCount; ++particleIndex )
+                pAge[particleIndex] += scaledTime;
 
-                // Has the particle expired?
-                // NOTE:-   If we're in single-particle mode then the particle lives as long as the particle player does.
-                if (    ( !pParticleAssetEmitter->getSingleParticle() && pParticleNode->mParticleAge > pParticleNode->mParticleLifetime ) ||
-                        ( mIsZero(pParticleNode->mParticleLifetime) ) )
-                {
-                    // Yes, so fetch next particle before we kill it.
-                    pParticleNode = pParticleNode->mNextNode;
-
-                    // Kill the particle.
-                    // NOTE:-   Because we move to the next particle the particle to kill is now the previous!
-                    pEmitterNode->freeParticle( pParticleNode->mPreviousNode );
-                }
-                else
-                {
-                    // No, so integrate the particle.
-                    integrateParticle( pEmitterNode, pParticleNode, pParticleNode->mParticleAge / pParticleNode->mParticleLifetime, scaledTime );
+            // Free any expired particles.
+            particleCount = pEmitterNode->freeExpiredParticles();
 
-                    // Move to the next particle node.
-                    pParticleNode = pParticleNode->mNextNode;
+            // Integrate the remaining particles.
+            integrateParticles( pEmitterNode, 0, particleCount, scaledTime );
 
-                    // Only count particles when not in single-particle mode.
-                    activeParticleCount++;
-                }
-            };
+            // Count the active particles.
+            activeParticleCount += particleCount;
 
             // Skip generating new particles if the emitter is paused.
             if ( pEmitterNode->getPaused() )
@@ -344,10 +340,13 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
             if ( pParticleAssetEmitter->getSingleParticle() )
             {
                 // Yes, so do we have a single particle yet?
-                if ( pParticleNodeHead->mNextNode == pParticleNodeHead )
+                if ( particleCount == 0 )
                 {
                     // No, so generate a single particle.
                     pEmitterNode->createParticle();
+
+                    // Do a single particle integration to get things going.
+                    integrateParticles( pEmitterNode, 0, 1, 0.0f );
                 }
             }
             else
@@ -393,6 +392,9 @@ void ParticlePlayer::integrateObject( const F32 totalTime, const F32 elapsedTime
                     // Generate the required emission.
                     for ( U32 n = 0; n < emissionCount; n++ )
                         pEmitterNode->createParticle();
+
+                    // Do a single particle integration to get things going.
+                    integrateParticles( pEmitterNode, particleCount, particles.getCount(), 0.0f );
                 }
             }
         }
@@ -475,46 +477,8 @@ void ParticlePlayer::interpolateObject( const F32 timeDelta )
         // Fetch the emitter node.
         EmitterNode* pEmitterNode = *emitterItr;
 
-        // Fetch First Particle Node.
-        ParticleSystem::ParticleNode* pParticleNode = pEmitterNode->getFirstParticle();
-
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
-
-        // Fetch the asset emitter.
-        ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
-
-        // Fetch the local AABB..
-        const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
-        const Vector2& localAABB1 = pParticleAssetEmitter->getLocalPivotAABB1();
-        const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
-        const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
-
-        // Process All particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
-        {
-            // Interpolate the position.
-            pParticleNode->mRenderTickPosition = (timeDelta * pParticleNode->mPreTickPosition) + ((1.0f-timeDelta) * pParticleNode->mPostTickPosition);
-
-            // Set the transform.
-            pParticleNode->mTransform.p = pParticleNode->mRenderTickPosition;
-
-            // Fetch the render size.
-            const Vector2& renderSize = pParticleNode->mRenderSize;
-
-            // Calculate the scaled AABB.
-            Vector2 scaledAABB[4];
-            scaledAABB[0] = localAABB0 * renderSize;
-            scaledAABB[1] = localAABB1 * renderSize;
-            scaledAABB[2] = localAABB2 * renderSize;
-            scaledAABB[3] = localAABB3 * renderSize;
-
-            // Calculate the world OOBB..
-            CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
-
-            // Move to the next particle.
-            pParticleNode = pParticleNode->mNextNode;
-        }
+        // Calculate the interpolated particle OOBBs.
+        calculateParticleOOBBs( pEmitterNode, 0, pEmitterNode->getParticles().getCount(), timeDelta );
     }
 }
 
@@ -566,10 +530,26 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
         else
         {
             // No, so skip if no animation available.
-            if ( animationAsset.isNull() )
+            if ( animationAsset.isNull() || animationAsset->getImage().isNull() )
                 continue;
         }
 
+        // Fetch the image used by the emitter.
+        ImageAsset* pImageAsset = isStaticFrameProvider ? (ImageAsset*)imageAsset : (ImageAsset*)animationAsset->getImage();
+
+        // Fetch the frame texture.
+        TextureHandle& frameTexture = pImageAsset->getImageTexture();
+
+        // Fetch the frames.
+        // NOTE:-   Particles store an image frame when static or a validated animation frame index when animated.
+        const bool staticNamedFrame = isStaticFrameProvider && pParticleAssetEmitter->isUsingNamedImageFrame();
+        const bool animationNamedFrames = !isStaticFrameProvider && animationAsset->getNamedCellsMode();
+        const Vector<S32>* pAnimationFrames = isStaticFrameProvider ? NULL : &animationAsset->getValidatedAnimationFrames();
+        const Vector<StringTableEntry>* pAnimationNamedFrames = isStaticFrameProvider ? NULL : &animationAsset->getValidatedNamedAnimationFrames();
+
+        // Fetch the static named frame area which is the same for all particles.
+        const ImageAsset::FrameArea::TexelArea* pStaticNamedTexelArea = staticNamedFrame ? &pImageAsset->getImageFrameArea( pParticleAssetEmitter->getNamedImageFrame() ).mTexelArea : NULL;
+
         // Flush.
         pBatchRenderer->flush( getScene()->getDebugStats().batchIsolatedFlush );
 
@@ -616,29 +596,31 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
             }
         }
 
+        // Fetch the particles.
+        ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+        const U32 particleCount = particles.getCount();
+        const ColorF* pColors = particles.getColors();
+        const U32* pFrames = particles.getFrames();
+
         // Fetch the oldest-in-front flag.
+        // NOTE:-   Particles are stored oldest first so the oldest are rendered last when in front.
         const bool oldestInFront = pParticleAssetEmitter->getOldestInFront();
 
-        // Fetch the starting particle (using appropriate particle order).
-        ParticleSystem::ParticleNode* pParticleNode = oldestInFront ? pEmitterNode->getFirstParticle() : pEmitterNode->getLastParticle();
-
-        // Fetch the particle node head.
-        ParticleSystem::ParticleNode* pParticleNodeHead = pEmitterNode->getParticleNodeHead();
-
-        // Process all particle nodes.
-        while ( pParticleNode != pParticleNodeHead )
+        // Process all particles.
+        for ( U32 n = 0; n < particleCount; ++n )
         {
-            // Fetch the frame provider.
-            const ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
+            // Fetch the particle index (using appropriate particle order).
+            const U32 particleIndex = oldestInFront ? particleCount - 1 - n : n;
 
             // Fetch the frame area.
-            const ImageAsset::FrameArea::TexelArea& texelFrameArea = frameProvider.getProviderImageFrameArea().mTexelArea;
-
-            // Frame texture.
-            TextureHandle& frameTexture = frameProvider.getProviderTexture();
+            const ImageAsset::FrameArea::TexelArea& texelFrameArea =
+                staticNamedFrame ? *pStaticNamedTexelArea :
+                isStaticFrameProvider ? pImageAsset->getImageFrameArea( pFrames[particleIndex] ).mTexelArea :
+                animationNamedFrames ? pImageAsset->getImageFrameArea( (*pAnimationNamedFrames)[pFrames[particleIndex]] ).mTexelArea :
+                pImageAsset->getImageFrameArea( (U32)(*pAnimationFrames)[pFrames[particleIndex]] ).mTexelArea;
 
             // Fetch the particle render OOBB.
-            Vector2* renderOOBB = pParticleNode->mRenderOOBB;
+            Vector2* renderOOBB = particles.getRenderOOBB( particleIndex );
 
             // Fetch lower/upper texture coordinates.
             const Vector2& texLower = texelFrameArea.mTexelLower;
@@ -655,11 +637,8 @@ void ParticlePlayer::sceneRender( const SceneRenderState* pSceneRenderState, con
                 Vector2( texUpper.x, texLower.y ),
                 Vector2( texLower.x, texLower.y ),
                 frameTexture,
-                pParticleNode->mColor );
-
-            // Move to next Particle ( using appropriate sort-order ).
-            pParticleNode = oldestInFront ? pParticleNode->mNextNode : pParticleNode->mPreviousNode;
-        };
+                pColors[particleIndex] );
+        }
 
         // Flush.
         pBatchRenderer->flush( getScene()->getDebugStats().batchIsolatedFlush );
@@ -877,7 +856,7 @@ void ParticlePlayer::stop( const bool waitForParticles, const bool killEffect )
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode )
+void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex )
 {
     // Fetch the particle player age.
     const F32 particlePlayerAge = mAge;
@@ -885,15 +864,15 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Fetch the particle player position.
     const Vector2& particlePlayerPosition = getPosition();
 
-    // Default to not suppressing movement.
-    pParticleNode->mSuppressMovement = false;
-
     // Fetch particle asset.
     ParticleAsset* pParticleAsset = mParticleAsset;
 
     // Fetch the asset emitter.
     ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+    // Fetch the particles.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+
 
     // **********************************************************************************************************************
     // Calculate Particle Position.
@@ -907,17 +886,20 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     const Vector2& emitterSize = pParticleAssetEmitter->getEmitterSize() * getSizeScale();
     const F32 emitterAngle = mDegToRad(pParticleAssetEmitter->getEmitterAngle());
 
+    // Reset the particle position.
+    Vector2 particlePosition = Vector2::getZero();
+
     // Are we using Single Particle?
     if ( pParticleAssetEmitter->getSingleParticle() )
     {
         // Determine whether to use world-space or emitter-space.
         if ( attachPositionToEmitter )
         {
-            pParticleNode->mPosition = emitterOffset;
+            particlePosition = emitterOffset;
         }
         else
         {
-            pParticleNode->mPosition = particlePlayerPosition + emitterOffset;
+            particlePosition = particlePlayerPosition + emitterOffset;
         }
     }
     else
@@ -932,12 +914,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emitterOffset;
+                    particlePosition = emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emitterOffset + particlePlayerPosition;
+                    particlePosition = emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -952,14 +934,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), 0.0f );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -975,14 +957,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( CoreMath::mGetRandomF( -halfWidth, halfWidth ), CoreMath::mGetRandomF( -halfHeight, halfHeight ) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -1008,14 +990,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( radiusX * mCos(angle), radiusY * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -1030,14 +1012,14 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 Vector2 emissionPosition( emitterSize.x * 0.5f * mCos(angle), emitterSize.y * 0.5f * mSin(angle) );
 
                 // Transform particle position in emitter-space.
-                pParticleNode->mPosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
+                particlePosition = b2Mul( b2Rot(emitterAngle), emissionPosition ) + emitterOffset;
 
                 // Are we attaching the position to the emitter?
                 if ( !attachPositionToEmitter )
                 {
                     // No, so transform the particle into world-space here.
                     b2Transform xform( particlePlayerPosition, b2Rot( getAngle()) );
-                    pParticleNode->mPosition = b2Mul( xform, pParticleNode->mPosition );
+                    particlePosition = b2Mul( xform, particlePosition );
                 }
 
             } break;
@@ -1065,12 +1047,12 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
                 if ( attachPositionToEmitter )
                 {
                     // Yes, so transform the particle into emitter-space only.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset;
+                    particlePosition = emissionPosition + emitterOffset;
                 }
                 else
                 {
                     // No, so transform the particle into world-space here.
-                    pParticleNode->mPosition = emissionPosition + emitterOffset + particlePlayerPosition;
+                    particlePosition = emissionPosition + emitterOffset + particlePlayerPosition;
                 }
 
             } break;
@@ -1084,8 +1066,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Particle Lifetime.
     // **********************************************************************************************************************
 
-    pParticleNode->mParticleAge = 0.0f;
-    pParticleNode->mParticleLifetime = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getParticleLifeBaseField(),
+    const F32 particleLifetime = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getParticleLifeBaseField(),
                                                                                 pParticleAssetEmitter->getParticleLifeVariationField(),
                                                                                 pParticleAsset->getParticleLifeScaleField(),
                                                                                 particlePlayerAge );
@@ -1095,7 +1076,8 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Particle Size-X.
     // **********************************************************************************************************************
 
-    pParticleNode->mSize.x = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeXBaseField(),
+    Vector2 particleSize;
+    particleSize.x = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeXBaseField(),
                                                                     pParticleAssetEmitter->getSizeXVariationField(),
                                                                     pParticleAsset->getSizeXScaleField(),
                                                                     particlePlayerAge ) * getSizeScale();
@@ -1104,21 +1086,17 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     if ( pParticleAssetEmitter->getFixedAspect() )
     {
         // Yes, so simply copy Size-X.
-        pParticleNode->mSize.y = pParticleNode->mSize.x;
+        particleSize.y = particleSize.x;
     }
     else
     {
         // No, so calculate the particle Size-Y.
-        pParticleNode->mSize.y = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeYBaseField(),
+        particleSize.y = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getSizeYBaseField(),
                                                                         pParticleAssetEmitter->getSizeYVariationField(),
                                                                         pParticleAsset->getSizeYScaleField(),
                                                                         particlePlayerAge ) * getSizeScale();
     }
 
-    // Reset the render size.
-    pParticleNode->mRenderSize.Set(-1.0f, -1.0f);
-
-
     // **********************************************************************************************************************
     // Calculate Speed, Random Motion and Emission Angle.
     // **********************************************************************************************************************
@@ -1128,15 +1106,20 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     F32 emissionAngle = 0;
     F32 emissionArc = 0;
 
+    // Single-particles do not move.
+    F32 particleSpeed = 0.0f;
+    F32 particleRandomMotion = 0.0f;
+    Vector2 particleVelocity = Vector2::getZero();
+
     // Ignore if we're using a single-particle.
     if ( !pParticleAssetEmitter->getSingleParticle() )
     {
-        pParticleNode->mSpeed = ParticleAssetField::calculateFieldBVE(  pParticleAssetEmitter->getSpeedBaseField(),
+        particleSpeed = ParticleAssetField::calculateFieldBVE(  pParticleAssetEmitter->getSpeedBaseField(),
                                                                         pParticleAssetEmitter->getSpeedVariationField(),
                                                                         pParticleAsset->getSpeedScaleField(),
                                                                         particlePlayerAge ) * getForceScale();
 
-        pParticleNode->mRandomMotion = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getRandomMotionBaseField(),
+        particleRandomMotion = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getRandomMotionBaseField(),
                                                                                 pParticleAssetEmitter->getRandomMotionVariationField(),
                                                                                 pParticleAsset->getRandomMotionScaleField(),
                                                                                 particlePlayerAge ) * getForceScale();
@@ -1170,7 +1153,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
 
         // Calculate the particle velocity.
         const F32 emissionAngleRadians = mDegToRad( emissionAngle );
-        pParticleNode->mVelocity.Set( emissionForce * mCos( emissionAngleRadians ), emissionForce * mSin( emissionAngleRadians ) );
+        particleVelocity.Set( emissionForce * mCos( emissionAngleRadians ), emissionForce * mSin( emissionAngleRadians ) );
     }
 
 
@@ -1178,7 +1161,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Spin.
     // **********************************************************************************************************************
 
-    pParticleNode->mSpin = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getSpinBaseField(),
+    const F32 particleSpin = ParticleAssetField::calculateFieldBVE(   pParticleAssetEmitter->getSpinBaseField(),
                                                                     pParticleAssetEmitter->getSpinVariationField(),
                                                                     pParticleAsset->getSpinScaleField(),
                                                                     particlePlayerAge );
@@ -1188,7 +1171,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Fixed-Force.
     // **********************************************************************************************************************
 
-    pParticleNode->mFixedForce = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getFixedForceBaseField(),
+    const F32 particleFixedForce = ParticleAssetField::calculateFieldBVE( pParticleAssetEmitter->getFixedForceBaseField(),
                                                                         pParticleAssetEmitter->getFixedForceVariationField(),
                                                                         pParticleAsset->getFixedForceScaleField(),
                                                                         particlePlayerAge ) * getForceScale();
@@ -1198,6 +1181,9 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Calculate Orientation Angle.
     // **********************************************************************************************************************
 
+    // Reset the particle orientation.
+    F32 particleOrientationAngle = 0.0f;
+
     // Configure particle orientation.
     switch( pParticleAssetEmitter->getOrientationType() )
     {
@@ -1205,7 +1191,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::ALIGNED_ORIENTATION:
         {
             // Use the emission angle with fixed offset.
-            pParticleNode->mOrientationAngle = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
+            particleOrientationAngle = mFmod( emissionAngle - pParticleAssetEmitter->getAlignedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1213,7 +1199,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         case ParticleAssetEmitter::FIXED_ORIENTATION:
         {
             // Use a fixed angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
+            particleOrientationAngle = mFmod( pParticleAssetEmitter->getFixedAngleOffset(), 360.0f );
 
         } break;
 
@@ -1222,7 +1208,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         {
             // Used a random angle/arc.
             const F32 randomArc = pParticleAssetEmitter->getRandomArc() * 0.5f;
-            pParticleNode->mOrientationAngle = mFmod( CoreMath::mGetRandomF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
+            particleOrientationAngle = mFmod( CoreMath::mGetRandomF( pParticleAssetEmitter->getRandomAngleOffset() - randomArc, pParticleAssetEmitter->getRandomAngleOffset() + randomArc ), 360.0f );
 
         } break;
         
@@ -1242,7 +1228,7 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
 
     // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
+    particles.getColors()[particleIndex].set(  mClampF( redChannel.getFieldValue( 0.0f ), redChannel.getMinValue(), redChannel.getMaxValue() ),
                                 mClampF( greenChannel.getFieldValue( 0.0f ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
                                 mClampF( blueChannel.getFieldValue( 0.0f ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
                                 mClampF( alphaChannel.getFieldValue( 0.0f ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
@@ -1252,31 +1238,27 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
     // Image, Frame and Animation Controller.
     // **********************************************************************************************************************
 
-    // Fetch the image frame provider.
-    ImageFrameProviderCore& frameProvider = pParticleNode->mFrameProvider;
-
-    // Allocate assets to the particle.
-    frameProvider.allocateAssets( &(pParticleAssetEmitter->getImageAsset()), &(pParticleAssetEmitter->getAnimationAsset()) );
+    // Reset the frame and animation time.
+    U32 particleFrame = 0;
+    F32 particleAnimationTime = 0.0f;
 
     // Is the emitter in static mode?
     if ( pParticleAssetEmitter->isStaticFrameProvider() )
     {
-        // Yes, so is random image frame active?
+        // Yes, so fetch the frame count for the image asset.
+        const U32 frameCount = pParticleAssetEmitter->getImageAsset()->getFrameCount();
+
+        // Is random image frame active?
         if ( pParticleAssetEmitter->getRandomImageFrame() )
         {
-            // Yes, so fetch the frame count for the image asset.
-            const U32 frameCount = pParticleAssetEmitter->getImageAsset()->getFrameCount();
-
-            // Choose a random frame.
-            frameProvider.setImageFrame( (U32)CoreMath::mGetRandomI( 0, frameCount-1 ) );
+            // Yes, so choose a random frame.
+            particleFrame = (U32)CoreMath::mGetRandomI( 0, frameCount-1 );
         }
-        else
+        else if ( !pParticleAssetEmitter->isUsingNamedImageFrame() )
         {
-            // No, so set the emitter image frame.
-            if (pParticleAssetEmitter->isUsingNamedImageFrame())
-                frameProvider.setNamedImageFrame( pParticleAssetEmitter->getNamedImageFrame() );
-            else
-                frameProvider.setImageFrame( pParticleAssetEmitter->getImageFrame() );
+            // No, so use the emitter image frame.
+            // NOTE:-   Named image frames are resolved by the emitter when rendering.
+            particleFrame = pParticleAssetEmitter->getImageFrame() < frameCount ? pParticleAssetEmitter->getImageFrame() : 0;
         }
     }
     else
@@ -1284,116 +1266,209 @@ void ParticlePlayer::configureParticle( EmitterNode* pEmitterNode, ParticleSyste
         // No, so fetch the animation asset.
         const AssetPtr<AnimationAsset>& animationAsset = pParticleAssetEmitter->getAnimationAsset();
 
-        // Play it.
-        frameProvider.playAnimation( animationAsset );
+        // Random start?
+        if ( animationAsset->getRandomStart() )
+        {
+            // Yes, so calculate start time.
+            particleAnimationTime = CoreMath::mGetRandomF( 0.0f, animationAsset->getAnimationTime() * 0.999f );
+        }
     }
 
 
     // **********************************************************************************************************************
-    // Reset Tick Position.
+    // Store Particle.
     // **********************************************************************************************************************
-    pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition = pParticleNode->mRenderTickPosition = pParticleNode->mPosition;
-
-
-    // **********************************************************************************************************************
-    // Do a Single Particle Integration to get things going.
-    // **********************************************************************************************************************
-    integrateParticle( pEmitterNode, pParticleNode, 0.0f, 0.0f );
+    particles.getStream( ParticleSystem::ParticleStore::AGE )[particleIndex] = 0.0f;
+    particles.getStream( ParticleSystem::ParticleStore::LIFETIME )[particleIndex] = particleLifetime;
+    particles.getStream( ParticleSystem::ParticleStore::POSITION_X )[particleIndex] = particlePosition.x;
+    particles.getStream( ParticleSystem::ParticleStore::POSITION_Y )[particleIndex] = particlePosition.y;
+    particles.getStream( ParticleSystem::ParticleStore::PRE_TICK_POSITION_X )[particleIndex] = particlePosition.x;
+    particles.getStream( ParticleSystem::ParticleStore::PRE_TICK_POSITION_Y )[particleIndex] = particlePosition.y;
+    particles.getStream( ParticleSystem::ParticleStore::VELOCITY_X )[particleIndex] = particleVelocity.x;
+    particles.getStream( ParticleSystem::ParticleStore::VELOCITY_Y )[particleIndex] = particleVelocity.y;
+    particles.getStream( ParticleSystem::ParticleStore::ORIENTATION_ANGLE )[particleIndex] = particleOrientationAngle;
+    particles.getStream( ParticleSystem::ParticleStore::ANIMATION_TIME )[particleIndex] = particleAnimationTime;
+    particles.getStream( ParticleSystem::ParticleStore::SIZE_X )[particleIndex] = particleSize.x;
+    particles.getStream( ParticleSystem::ParticleStore::SIZE_Y )[particleIndex] = particleSize.y;
+    particles.getStream( ParticleSystem::ParticleStore::SPEED )[particleIndex] = particleSpeed;
+    particles.getStream( ParticleSystem::ParticleStore::SPIN )[particleIndex] = particleSpin;
+    particles.getStream( ParticleSystem::ParticleStore::FIXED_FORCE )[particleIndex] = particleFixedForce;
+    particles.getStream( ParticleSystem::ParticleStore::RANDOM_MOTION )[particleIndex] = particleRandomMotion;
+    particles.getFrames()[particleIndex] = particleFrame;
 }
 
 //------------------------------------------------------------------------------
 
-void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, F32 particleAge, F32 elapsedTime )
+void ParticlePlayer::integrateParticles( EmitterNode* pEmitterNode, const U32 startIndex, const U32 endIndex, const F32 elapsedTime )
 {
+    // Finish if there are no particles to integrate.
+    if ( startIndex >= endIndex )
+        return;
+
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticlePlayer_IntegrateParticles);
+
     // Fetch particle asset.
     ParticleAsset* pParticleAsset = mParticleAsset;
 
     // Fetch the asset emitter.
     ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
+    // Fetch the particles.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+
+    // Fetch the particle streams.
+    const F32* pAge             = particles.getStream( ParticleSystem::ParticleStore::AGE );
+    const F32* pLifetime        = particles.getStream( ParticleSystem::ParticleStore::LIFETIME );
+    F32* pPositionX             = particles.getStream( ParticleSystem::ParticleStore::POSITION_X );
+    F32* pPositionY             = particles.getStream( ParticleSystem::ParticleStore::POSITION_Y );
+    F32* pPreTickPositionX      = particles.getStream( ParticleSystem::ParticleStore::PRE_TICK_POSITION_X );
+    F32* pPreTickPositionY      = particles.getStream( ParticleSystem::ParticleStore::PRE_TICK_POSITION_Y );
+    F32* pVelocityX             = particles.getStream( ParticleSystem::ParticleStore::VELOCITY_X );
+    F32* pVelocityY             = particles.getStream( ParticleSystem::ParticleStore::VELOCITY_Y );
+    F32* pOrientationAngle      = particles.getStream( ParticleSystem::ParticleStore::ORIENTATION_ANGLE );
+    F32* pAnimationTime         = particles.getStream( ParticleSystem::ParticleStore::ANIMATION_TIME );
+    F32* pRenderSizeX           = particles.getStream( ParticleSystem::ParticleStore::RENDER_SIZE_X );
+    F32* pRenderSizeY           = particles.getStream( ParticleSystem::ParticleStore::RENDER_SIZE_Y );
+    F32* pRenderSpeed           = particles.getStream( ParticleSystem::ParticleStore::RENDER_SPEED );
+    F32* pRenderFixedForce      = particles.getStream( ParticleSystem::ParticleStore::RENDER_FIXED_FORCE );
+    F32* pRenderRandomMotion    = particles.getStream( ParticleSystem::ParticleStore::RENDER_RANDOM_MOTION );
+    const F32* pSizeX           = particles.getStream( ParticleSystem::ParticleStore::SIZE_X );
+    const F32* pSizeY           = particles.getStream( ParticleSystem::ParticleStore::SIZE_Y );
+    const F32* pSpeed           = particles.getStream( ParticleSystem::ParticleStore::SPEED );
+    const F32* pSpin            = particles.getStream( ParticleSystem::ParticleStore::SPIN );
+    const F32* pFixedForce      = particles.getStream( ParticleSystem::ParticleStore::FIXED_FORCE );
+    const F32* pRandomMotion    = particles.getStream( ParticleSystem::ParticleStore::RANDOM_MOTION );
+    ColorF* pColors             = particles.getColors();
+    U32* pFrames                = particles.getFrames();
+
+    // Fetch the emitter options.
+    const bool singleParticle = pParticleAssetEmitter->getSingleParticle();
+    const bool fixedAspect = pParticleAssetEmitter->getFixedAspect();
+    const bool keepAligned = pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION;
+
 
     // **********************************************************************************************************************
     // Copy Old Tick Position.
     // **********************************************************************************************************************
-    pParticleNode->mRenderTickPosition = pParticleNode->mPreTickPosition = pParticleNode->mPostTickPosition;
+    dMemcpy( pPreTickPositionX + startIndex, pPositionX + startIndex, sizeof(F32) * (endIndex - startIndex) );
+    dMemcpy( pPreTickPositionY + startIndex, pPositionY + startIndex, sizeof(F32) * (endIndex - startIndex) );
 
 
     // **********************************************************************************************************************
-    // Scale Size.
+    // Scale Life Fields.
     // **********************************************************************************************************************
 
-    // Scale Size-X.
-    pParticleNode->mRenderSize.x = mClampF( pParticleNode->mSize.x * pParticleAssetEmitter->getSizeXLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSizeXBaseField().getMaxValue());
+    // Fetch the life fields.
+    const ParticleAssetField& sizeXLifeField = pParticleAssetEmitter->getSizeXLifeField();
+    const ParticleAssetField& sizeYLifeField = pParticleAssetEmitter->getSizeYLifeField();
+    const ParticleAssetField& speedLifeField = pParticleAssetEmitter->getSpeedLifeField();
+    const ParticleAssetField& fixedForceLifeField = pParticleAssetEmitter->getFixedForceLifeField();
+    const ParticleAssetField& randomMotionLifeField = pParticleAssetEmitter->getRandomMotionLifeField();
+    const ParticleAssetField& spinLifeField = pParticleAssetEmitter->getSpinLifeField();
+
+    // Fetch the base field limits.
+    const F32 sizeXMin = pParticleAssetEmitter->getSizeXBaseField().getMinValue();
+    const F32 sizeXMax = pParticleAssetEmitter->getSizeXBaseField().getMaxValue();
+    const F32 sizeYMin = pParticleAssetEmitter->getSizeYBaseField().getMinValue();
+    const F32 sizeYMax = pParticleAssetEmitter->getSizeYBaseField().getMaxValue();
+    const F32 speedMin = pParticleAssetEmitter->getSpeedBaseField().getMinValue();
+    const F32 speedMax = pParticleAssetEmitter->getSpeedBaseField().getMaxValue();
+    const F32 fixedForceMin = pParticleAssetEmitter->getFixedForceBaseField().getMinValue();
+    const F32 fixedForceMax = pParticleAssetEmitter->getFixedForceBaseField().getMaxValue();
+    const F32 randomMotionMin = pParticleAssetEmitter->getRandomMotionBaseField().getMinValue();
+    const F32 randomMotionMax = pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue();
 
-    // Is the particle using a fixed aspect?
-    if ( pParticleAssetEmitter->getFixedAspect() )
-    {
-        // Yes, so simply copy Size-X.
-        pParticleNode->mRenderSize.y = pParticleNode->mRenderSize.x;
-    }
-    else
-    {
-        // No, so Scale Size-Y.
-        pParticleNode->mRenderSize.y = mClampF( pParticleNode->mSize.y * pParticleAssetEmitter->getSizeYLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getSizeYBaseField().getMaxValue() );
-    }
+    // Fetch the channels.
+    const ParticleAssetField& redChannel = pParticleAssetEmitter->getRedChannelLifeField();
+    const ParticleAssetField& greenChannel = pParticleAssetEmitter->getGreenChannelLifeField();
+    const ParticleAssetField& blueChannel = pParticleAssetEmitter->getBlueChannelLifeField();
+    const ParticleAssetField& alphaChannel = pParticleAssetEmitter->getAlphaChannelLifeField();
+    const F32 alphaChannelScale = pParticleAsset->getAlphaChannelScaleField().getFieldValue( 0.0f );
 
+    for ( U32 particleIndex = startIndex; particleIndex < endIndex; ++particleIndex )
+    {
+        // Calculate the particle age as a fraction of its lifetime.
+        const F32 particleAge = mIsZero( pAge[particleIndex] ) ? 0.0f : pAge[particleIndex] / pLifetime[particleIndex];
 
-    // **********************************************************************************************************************
-    // Scale Speed.
-    // **********************************************************************************************************************
-    pParticleNode->mRenderSpeed = mClampF(  pParticleNode->mSpeed * pParticleAssetEmitter->getSpeedLifeField().getFieldValue( particleAge ),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMinValue(),
-                                            pParticleAssetEmitter->getSpeedBaseField().getMaxValue() );
+        // Scale Size-X.
+        pRenderSizeX[particleIndex] = mClampF( pSizeX[particleIndex] * sizeXLifeField.getFieldValue( particleAge ), sizeXMin, sizeXMax );
 
+        // Scale Size-Y or simply copy Size-X if the particle is using a fixed aspect.
+        pRenderSizeY[particleIndex] = fixedAspect ? pRenderSizeX[particleIndex] : mClampF( pSizeY[particleIndex] * sizeYLifeField.getFieldValue( particleAge ), sizeYMin, sizeYMax );
 
-    // **********************************************************************************************************************
-    // Scale Fixed-Force.
-    // **********************************************************************************************************************
-    pParticleNode->mRenderFixedForce = mClampF( pParticleNode->mFixedForce * pParticleAssetEmitter->getFixedForceLifeField().getFieldValue( particleAge ),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMinValue(),
-                                                pParticleAssetEmitter->getFixedForceBaseField().getMaxValue() );
+        // Scale Speed.
+        pRenderSpeed[particleIndex] = mClampF( pSpeed[particleIndex] * speedLifeField.getFieldValue( particleAge ), speedMin, speedMax );
 
+        // Scale Fixed-Force.
+        pRenderFixedForce[particleIndex] = mClampF( pFixedForce[particleIndex] * fixedForceLifeField.getFieldValue( particleAge ), fixedForceMin, fixedForceMax );
 
-    // **********************************************************************************************************************
-    // Scale Random-Motion.
-    // **********************************************************************************************************************
-    pParticleNode->mRenderRandomMotion = mClampF(   pParticleNode->mRandomMotion * pParticleAssetEmitter->getRandomMotionLifeField().getFieldValue( particleAge ),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMinValue(),
-                                                    pParticleAssetEmitter->getRandomMotionBaseField().getMaxValue() );
+        // Scale Random-Motion.
+        pRenderRandomMotion[particleIndex] = mClampF( pRandomMotion[particleIndex] * randomMotionLifeField.getFieldValue( particleAge ), randomMotionMin, randomMotionMax );
 
+        // Calculate the color.
+        pColors[particleIndex].set( mClampF( redChannel.getFieldValue( particleAge ), redChannel.getMinValue(), redChannel.getMaxValue() ),
+                                    mClampF( greenChannel.getFieldValue( particleAge ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
+                                    mClampF( blueChannel.getFieldValue( particleAge ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
+                                    mClampF( alphaChannel.getFieldValue( particleAge ) * alphaChannelScale, alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
 
-    // **********************************************************************************************************************
-    // Calculate RGBA Components.
-    // **********************************************************************************************************************
+        // Skip spinning if aligning to motion.
+        if ( keepAligned )
+            continue;
 
-    // Fetch the channels.
-    const ParticleAssetField& redChannel = pParticleAssetEmitter->getRedChannelLifeField();
-    const ParticleAssetField& greenChannel = pParticleAssetEmitter->getGreenChannelLifeField();
-    const ParticleAssetField& blueChannel = pParticleAssetEmitter->getBlueChannelLifeField();
-    const ParticleAssetField& alphaChannel = pParticleAssetEmitter->getAlphaChannelLifeField();
-    const ParticleAssetField& alphaChannelScale = pParticleAsset->getAlphaChannelScaleField();
+        // Calculate the render spin.
+        const F32 renderSpin = pSpin[particleIndex] * spinLifeField.getFieldValue( particleAge );
 
-    // Calculate the color.
-    pParticleNode->mColor.set(  mClampF( redChannel.getFieldValue( particleAge ), redChannel.getMinValue(), redChannel.getMaxValue() ),
-                                mClampF( greenChannel.getFieldValue( particleAge ),greenChannel.getMinValue(), greenChannel.getMaxValue() ),
-                                mClampF( blueChannel.getFieldValue( particleAge ), blueChannel.getMinValue(),blueChannel.getMaxValue() ),
-                                mClampF( alphaChannel.getFieldValue( particleAge ) * alphaChannelScale.getFieldValue( 0.0f ), alphaChannel.getMinValue(), alphaChannel.getMaxValue() ) );
+        // Have we got some Spin?
+        if ( mNotZero(renderSpin) )
+        {
+            // Yes, so add into Orientation and clamp.
+            pOrientationAngle[particleIndex] = mFmod( pOrientationAngle[particleIndex] + renderSpin * elapsedTime, 360.0f );
+        }
+    }
 
 
     // **********************************************************************************************************************
-    // Integrate Particle.
+    // Integrate Animation.
     // **********************************************************************************************************************
 
-
     // Is the emitter in static mode?
     if ( !pParticleAssetEmitter->isStaticFrameProvider() )
     {
-        // No, so update animation.
-        pParticleNode->mFrameProvider.updateAnimation( elapsedTime );
+        // No, so fetch the animation asset.
+        const AssetPtr<AnimationAsset>& animationAsset = pParticleAssetEmitter->getAnimationAsset();
+
+        // Fetch the validated frame count.
+        const U32 frameCount = animationAsset->getNamedCellsMode() ? animationAsset->getValidatedNamedAnimationFrames().size() : animationAsset->getValidatedAnimationFrames().size();
+
+        // Integrate the animation if there are frames.
+        if ( frameCount > 0 )
+        {
+            // Calculate the animation times.
+            const F32 totalTime = animationAsset->getAnimationTime();
+            const F32 frameTime = totalTime / frameCount;
+            const U32 maxFrameIndex = frameCount - 1;
+
+            // Fetch whether the animation cycles and if not, the time it finishes at.
+            const bool animationCycle = animationAsset->getAnimationCycle();
+            const F32 finishedTime = totalTime - (frameTime * 0.5f);
+
+            for ( U32 particleIndex = startIndex; particleIndex < endIndex; ++particleIndex )
+            {
+                // Update the animation time.
+                F32 animationTime = pAnimationTime[particleIndex] + elapsedTime;
+
+                // Fix the animation at the end of the frames if it has finished.
+                if ( !animationCycle && animationTime >= totalTime )
+                    animationTime = finishedTime;
+
+                pAnimationTime[particleIndex] = animationTime;
+
+                // Calculate the current frame.
+                const U32 frameIndex = (U32)(mFmod( animationTime, totalTime ) / frameTime);
+                pFrames[particleIndex] = frameIndex < maxFrameIndex ? frameIndex : maxFrameIndex;
+            }
+        }
     }
 
 
@@ -1402,30 +1477,39 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
 
     // Calculate the velocity if not a single particle.
-    if ( !pParticleAssetEmitter->getSingleParticle() )
+    if ( !singleParticle )
     {
         // Calculate random motion (if we've got any).
-        if ( mNotZero( pParticleNode->mRenderRandomMotion ) )
+        for ( U32 particleIndex = startIndex; particleIndex < endIndex; ++particleIndex )
         {
+            // Skip if no random motion.
+            if ( mIsZero( pRenderRandomMotion[particleIndex] ) )
+                continue;
+
             // Fetch random motion.
-            const F32 randomMotion = pParticleNode->mRenderRandomMotion * 0.5f;
+            const F32 randomMotion = pRenderRandomMotion[particleIndex] * 0.5f;
 
             // Add time-integrated random motion into velocity.
-            pParticleNode->mVelocity += Vector2( CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime, CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime );
+            pVelocityX[particleIndex] += CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime;
+            pVelocityY[particleIndex] += CoreMath::mGetRandomF(-randomMotion, randomMotion) * elapsedTime;
         }
 
-        // Do we have any fixed force?
-        if ( mNotZero( pParticleNode->mRenderFixedForce ) )
+        // Time-integrate any fixed force into the velocity.
+        const Vector2 fixedForceDirection = pParticleAssetEmitter->getFixedForceDirection() * (getForceScale() * elapsedTime);
+        const F32 fixedForceX = fixedForceDirection.x;
+        const F32 fixedForceY = fixedForceDirection.y;
+        for ( U32 particleIndex = startIndex; particleIndex < endIndex; ++particleIndex )
         {
-            // Yes, so time-integrate a fixed force to the velocity.
-            pParticleNode->mVelocity += (pParticleAssetEmitter->getFixedForceDirection() * (pParticleNode->mRenderFixedForce * getForceScale()) * elapsedTime);
+            pVelocityX[particleIndex] += fixedForceX * pRenderFixedForce[particleIndex];
+            pVelocityY[particleIndex] += fixedForceY * pRenderFixedForce[particleIndex];
         }
 
-        // Are we suppressing movement?
-        if ( !pParticleNode->mSuppressMovement )
+        // Adjust particle position.
+        for ( U32 particleIndex = startIndex; particleIndex < endIndex; ++particleIndex )
         {
-            // No, so adjust particle position.
-            pParticleNode->mPosition += (pParticleNode->mVelocity * pParticleNode->mRenderSpeed * elapsedTime);
+            const F32 distance = pRenderSpeed[particleIndex] * elapsedTime;
+            pPositionX[particleIndex] += pVelocityX[particleIndex] * distance;
+            pPositionY[particleIndex] += pVelocityY[particleIndex] * distance;
         }
     }
 
@@ -1433,37 +1517,51 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     // **********************************************************************************************************************
     // Are we Aligning to motion?
     // **********************************************************************************************************************
-    if ( pParticleAssetEmitter->getKeepAligned() && pParticleAssetEmitter->getOrientationType() == ParticleAssetEmitter::ALIGNED_ORIENTATION )
+    if ( keepAligned )
     {
-        // Yes, so calculate last movement direction.
-        F32 movementAngle = mRadToDeg( mAtan( pParticleNode->mVelocity.x, pParticleNode->mVelocity.y ) );
+        // Fetch the aligned angle offset.
+        const F32 alignedAngleOffset = pParticleAssetEmitter->getAlignedAngleOffset();
 
-        // Adjust for negative ArcTan quadrants.
-        if ( movementAngle < 0.0f )
-            movementAngle += 360.0f;
+        for ( U32 particleIndex = startIndex; particleIndex < endIndex; ++particleIndex )
+        {
+            // Yes, so calculate last movement direction.
+            F32 movementAngle = mRadToDeg( mAtan( pVelocityX[particleIndex], pVelocityY[particleIndex] ) );
 
-        // Set new Orientation Angle.
-        pParticleNode->mOrientationAngle = movementAngle - pParticleAssetEmitter->getAlignedAngleOffset();
+            // Adjust for negative ArcTan quadrants.
+            if ( movementAngle < 0.0f )
+                movementAngle += 360.0f;
 
+            // Set new Orientation Angle.
+            pOrientationAngle[particleIndex] = movementAngle - alignedAngleOffset;
+        }
     }
-    else
-    {
-        // No, so calculate the render spin.
-        pParticleNode->mRenderSpin = pParticleNode->mSpin * pParticleAssetEmitter->getSpinLifeField().getFieldValue( particleAge );
 
-        // Have we got some Spin?
-        if ( mNotZero(pParticleNode->mRenderSpin) )
-        {
-            // Yes, so add into Orientation.
-            pParticleNode->mOrientationAngle += pParticleNode->mRenderSpin * elapsedTime;
+    // Calculate the particle OOBBs.
+    calculateParticleOOBBs( pEmitterNode, startIndex, endIndex, 0.0f );
+}
 
-            // Clamp the orientation angle.
-            pParticleNode->mOrientationAngle = mFmod( pParticleNode->mOrientationAngle, 360.0f );
-        }
-    }
+//------------------------------------------------------------------------------
+
+void ParticlePlayer::calculateParticleOOBBs( EmitterNode* pEmitterNode, const U32 startIndex, const U32 endIndex, const F32 timeDelta )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(ParticlePlayer_CalculateParticleOOBBs);
+
+    // Fetch the asset emitter.
+    ParticleAssetEmitter* pParticleAssetEmitter = pEmitterNode->getAssetEmitter();
 
-    // Calculate the transform.
-    pParticleNode->mTransform.Set( pParticleNode->mPosition, mDegToRad(pParticleNode->mOrientationAngle) );
+    // Fetch the particles.
+    ParticleSystem::ParticleStore& particles = pEmitterNode->getParticles();
+
+    // Fetch the particle streams.
+    const F32* pPositionX           = particles.getStream( ParticleSystem::ParticleStore::POSITION_X );
+    const F32* pPositionY           = particles.getStream( ParticleSystem::ParticleStore::POSITION_Y );
+    const F32* pPreTickPositionX    = particles.getStream( ParticleSystem::ParticleStore::PRE_TICK_POSITION_X );
+    const F32* pPreTickPositionY    = particles.getStream( ParticleSystem::ParticleStore::PRE_TICK_POSITION_Y );
+    const F32* pOrientationAngle    = particles.getStream( ParticleSystem::ParticleStore::ORIENTATION_ANGLE );
+    const F32* pRenderSizeX         = particles.getStream( ParticleSystem::ParticleStore::RENDER_SIZE_X );
+    const F32* pRenderSizeY         = particles.getStream( ParticleSystem::ParticleStore::RENDER_SIZE_Y );
+    Vector2* pRenderOOBBs           = particles.getRenderOOBBs();
 
     // Fetch the local AABB..
     const Vector2& localAABB0 = pParticleAssetEmitter->getLocalPivotAABB0();
@@ -1471,24 +1569,38 @@ void ParticlePlayer::integrateParticle( EmitterNode* pEmitterNode, ParticleSyste
     const Vector2& localAABB2 = pParticleAssetEmitter->getLocalPivotAABB2();
     const Vector2& localAABB3 = pParticleAssetEmitter->getLocalPivotAABB3();
 
-    // Fetch the render size.
-    const Vector2& renderSize = pParticleNode->mRenderSize;
-
-    // Calculate the scaled AABB.
-    Vector2 scaledAABB[4];
-    scaledAABB[0] = localAABB0 * renderSize;
-    scaledAABB[1] = localAABB1 * renderSize;
-    scaledAABB[2] = localAABB2 * renderSize;
-    scaledAABB[3] = localAABB3 * renderSize;
-
-    // Calculate the world OOBB..
-    CoreMath::mCalculateOOBB( scaledAABB, pParticleNode->mTransform, pParticleNode->mRenderOOBB );
-
+    // Calculate the interpolation weights.
+    const F32 preTickWeight = timeDelta;
+    const F32 postTickWeight = 1.0f - timeDelta;
 
-    // **********************************************************************************************************************
-    // Set Post Tick Position.
-    // **********************************************************************************************************************
-    pParticleNode->mPostTickPosition = pParticleNode->mPosition;
+    for ( U32 particleIndex = startIndex; particleIndex < endIndex; ++particleIndex )
+    {
+        // Interpolate the position.
+        const F32 positionX = (preTickWeight * pPreTickPositionX[particleIndex]) + (postTickWeight * pPositionX[particleIndex]);
+        const F32 positionY = (preTickWeight * pPreTickPositionY[particleIndex]) + (postTickWeight * pPositionY[particleIndex]);
+
+        // Calculate the rotation.
+        const F32 angle = mDegToRad( pOrientationAngle[particleIndex] );
+        const F32 cosAngle = mCos( angle );
+        const F32 sinAngle = mSin( angle );
+
+        // Fetch the render size.
+        const F32 renderSizeX = pRenderSizeX[particleIndex];
+        const F32 renderSizeY = pRenderSizeY[particleIndex];
+
+        // Calculate the scaled AABB.
+        const F32 x0 = localAABB0.x * renderSizeX, y0 = localAABB0.y * renderSizeY;
+        const F32 x1 = localAABB1.x * renderSizeX, y1 = localAABB1.y * renderSizeY;
+        const F32 x2 = localAABB2.x * renderSizeX, y2 = localAABB2.y * renderSizeY;
+        const F32 x3 = localAABB3.x * renderSizeX, y3 = localAABB3.y * renderSizeY;
+
+        // Calculate the world OOBB..
+        Vector2* pRenderOOBB = pRenderOOBBs + (particleIndex * 4);
+        pRenderOOBB[0].Set( (cosAngle * x0) - (sinAngle * y0) + positionX, (sinAngle * x0) + (cosAngle * y0) + positionY );
+        pRenderOOBB[1].Set( (cosAngle * x1) - (sinAngle * y1) + positionX, (sinAngle * x1) + (cosAngle * y1) + positionY );
+        pRenderOOBB[2].Set( (cosAngle * x2) - (sinAngle * y2) + positionX, (sinAngle * x2) + (cosAngle * y2) + positionY );
+        pRenderOOBB[3].Set( (cosAngle * x3) - (sinAngle * y3) + positionX, (sinAngle * x3) + (cosAngle * y3) + positionY );
+    }
 }
 
 //-----------------------------------------------------------------------------
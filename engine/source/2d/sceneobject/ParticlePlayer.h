@@ -51,7 +51,7 @@ private:
     private:
         ParticlePlayer*                 mOwner;
         ParticleAssetEmitter*           mpAssetEmitter;
-        ParticleSystem::ParticleNode    mParticleNodeHead;
+        ParticleSystem::ParticleStore   mParticles;
         F32                             mTimeSinceLastGeneration;
         bool                            mPaused;
         bool                            mVisible;
@@ -77,9 +77,6 @@ private:
 
             // Reset time since last generation.
             mTimeSinceLastGeneration = 0.0f;
-
-            // Reset the node head.
-            mParticleNodeHead.mNextNode = mParticleNodeHead.mPreviousNode = &mParticleNodeHead;
         }
 
         ~EmitterNode()
@@ -90,11 +87,8 @@ private:
         inline ParticlePlayer* getOwner( void ) const { return mOwner; }
         inline ParticleAssetEmitter* getAssetEmitter( void ) const { return mpAssetEmitter; }
 
-        inline bool getActiveParticles( void ) const { return mParticleNodeHead.mNextNode != &mParticleNodeHead; }
-
-        inline ParticleSystem::ParticleNode* getFirstParticle( void ) const { return mParticleNodeHead.mNextNode; }
-        inline ParticleSystem::ParticleNode* getLastParticle( void ) const { return mParticleNodeHead.mPreviousNode; }
-        inline ParticleSystem::ParticleNode* getParticleNodeHead( void ) { return &mParticleNodeHead; }
+        inline bool getActiveParticles( void ) const { return mParticles.getCount() > 0; }
+        inline ParticleSystem::ParticleStore& getParticles( void ) { return mParticles; }
 
         inline void setTimeSinceLastGeneration( const F32 timeSinceLastGeneration ) { mTimeSinceLastGeneration = timeSinceLastGeneration; }
         inline F32 getTimeSinceLastGeneration( void ) const { return mTimeSinceLastGeneration; }
@@ -105,9 +99,9 @@ private:
         inline void setVisible( const bool visible ) { mVisible = visible; }
         inline bool getVisible( void ) const { return mVisible; }
 
-        ParticleSystem::ParticleNode* createParticle( void );
-        void freeParticle( ParticleSystem::ParticleNode* pParticleNode );
-        void freeAllParticles( void );        
+        U32 createParticle( void );
+        U32 freeExpiredParticles( void );
+        void freeAllParticles( void );
     };
 
     typedef Vector<EmitterNode*> typeEmitterVector;
@@ -145,6 +139,7 @@ public:
 
     virtual bool validRender( void ) const { return mParticleAsset.notNull() && mParticleAsset->isAssetValid(); }
     virtual bool shouldRender( void ) const { return true; }
+    virtual bool getRenderCacheable( void ) const { return false; }
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
     virtual void sceneRenderOverlay( const SceneRenderState* sceneRenderState );
 
@@ -192,8 +187,9 @@ protected:
     virtual void onAssetRefreshed( AssetPtrBase* pAssetPtrBase );
 
     /// Particle Creation/Integration.
-    void configureParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode );
-    void integrateParticle( EmitterNode* pEmitterNode, ParticleSystem::ParticleNode* pParticleNode, const F32 particleAge, const F32 elapsedTime );
+    void configureParticle( EmitterNode* pEmitterNode, const U32 particleIndex );
+    void integrateParticles( EmitterNode* pEmitterNode, const U32 startIndex, const U32 endIndex, const F32 elapsedTime );
+    void calculateParticleOOBBs( EmitterNode* pEmitterNode, const U32 startIndex, const U32 endIndex, const F32 timeDelta );
 
     /// Persistence.
     virtual void onTamlAddParent( SimObject* pParentObject );
@@ -127,6 +127,9 @@ SceneObject::SceneObject() :
     mRenderPosition( 0.0f, 0.0f ),
     mRenderAngle( 0.0f ),
     mSpatialDirty( true ),
+    mTickConcurrent( false ),
+    mTickProxyDirty( false ),
+    mTickDisplacement( 0.0f, 0.0f ),
     mTargetPosition( 0.0f, 0.0f ),
     mLastCheckedPosition( 0.0f, 0.0f ),
     mTargetPositionActive( false ),
@@ -383,6 +386,17 @@ void SceneObject::onDestroyNotify( SceneObject* pSceneObject )
 
 //-----------------------------------------------------------------------------
 
+void SceneObject::onStaticModified( const char* slotName, const char* newValue )
+{
+    // Call parent.
+    Parent::onStaticModified( slotName, newValue );
+
+    // Any field may change how the object renders.
+    invalidateRenderCache();
+}
+
+//-----------------------------------------------------------------------------
+
 void SceneObject::OnRegisterScene( Scene* pScene )
 {
     // Sanity!
@@ -548,6 +562,9 @@ void SceneObject::resetTickSpatials( const bool resize )
 
     // Flag spatial changed.
     mSpatialDirty = true;
+
+    // Invalidate the render cache.
+    invalidateRenderCache();
 }
 
 //-----------------------------------------------------------------------------
@@ -600,14 +617,45 @@ void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, D
         CoreMath::mCalculateAABB( getLocalSizedOOBB(), getTransform(), &mCurrentAABB );
 
         // Calculate tick AABB.
-        b2AABB tickAABB;
-        tickAABB.Combine( mPreTickAABB, mCurrentAABB );
+        mTickAABB.Combine( mPreTickAABB, mCurrentAABB );
 
         // Calculate tick displacement.
-        b2Vec2 tickDisplacement = position - mPreTickPosition;
-            
-        // Update world proxy.
-        mpScene->getWorldQuery()->update( this, tickAABB, tickDisplacement );
+        mTickDisplacement = position - mPreTickPosition;
+
+        // Flag the world proxy as needing an update.
+        mTickProxyDirty = true;
+
+        // Invalidate the render cache.
+        invalidateRenderCache();
+    }
+
+	// Update the BlendColor.
+	if ( mFadeActive )
+	{
+		updateBlendColor( elapsedTime );
+	}
+
+    // Finish if ticking concurrently as the scene will call the deferred stage itself.
+    if ( mTickConcurrent )
+        return;
+
+    // Integrate deferred.
+    integrateDeferred( totalTime, elapsedTime, pDebugStats );
+}
+
+//-----------------------------------------------------------------------------
+
+void SceneObject::integrateDeferred( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(SceneObject_IntegrateDeferred);
+
+    // Is the world proxy dirty?
+    if ( mTickProxyDirty )
+    {
+        // Yes, so update world proxy.
+        mpScene->getWorldQuery()->update( this, mTickAABB, mTickDisplacement );
+        mTickProxyDirty = false;
 
         //have we arrived at the target position?
         if (mTargetPositionActive)
@@ -634,12 +682,6 @@ void SceneObject::integrateObject( const F32 totalTime, const F32 elapsedTime, D
         // Yes, so calculate camera mount.
         mpAttachedCamera->calculateCameraMount( elapsedTime );
     }
-
-	// Update the BlendColor.
-	if ( mFadeActive )
-	{
-		updateBlendColor( elapsedTime );
-	}
 }
 
 //-----------------------------------------------------------------------------
@@ -888,6 +930,9 @@ void SceneObject::setEnabled( const bool enabled )
     {
         mpBody->SetActive( enabled );
     }
+
+    // Invalidate the render cache.
+    invalidateRenderCache();
 }
 
 //-----------------------------------------------------------------------------
@@ -946,11 +991,17 @@ void SceneObject::setSceneLayer( const U32 sceneLayer )
         return;
     }
 
+    // Invalidate the render cache of the current layer.
+    invalidateRenderCache();
+
     // Set Layer.
     mSceneLayer = sceneLayer;
 
     // Set Layer Mask.
     mSceneLayerMask = BIT( mSceneLayer );
+
+    // Invalidate the render cache of the new layer.
+    invalidateRenderCache();
 }
 
 //-----------------------------------------------------------------------------
@@ -1177,6 +1228,9 @@ void SceneObject::setSceneGroup( const U32 sceneGroup )
 
     // Set Group Mask.
     mSceneGroupMask = BIT( mSceneGroup );
+
+    // Invalidate the render cache.
+    invalidateRenderCache();
 }
 
 //-----------------------------------------------------------------------------
@@ -4256,6 +4310,9 @@ void SceneObject::updateBlendColor(const F32 elapsedTime)
 	mBlendColor.green = processEffect(mBlendColor.green, mTargetColor.green, mDeltaGreen * elapsedTime);
 	mBlendColor.blue = processEffect(mBlendColor.blue, mTargetColor.blue, mDeltaBlue * elapsedTime);
 	mBlendColor.alpha = processEffect(mBlendColor.alpha, mTargetColor.alpha, mDeltaAlpha * elapsedTime);
+
+	// Invalidate the render cache.
+	invalidateRenderCache();
 }
 
 //-----------------------------------------------------------------------------
@@ -163,6 +163,10 @@ protected:
     Vector2                 mRenderPosition;
     F32                     mRenderAngle;
     bool                    mSpatialDirty;
+    bool                    mTickConcurrent;
+    bool                    mTickProxyDirty;
+    b2AABB                  mTickAABB;
+    b2Vec2                  mTickDisplacement;
     Vector2                 mLastCheckedPosition;
     Vector2                 mTargetPosition;
     bool                    mTargetPositionActive;
@@ -276,6 +280,7 @@ public:
     virtual bool            onAdd();
     virtual void            onRemove();
     virtual void            onDestroyNotify( SceneObject* pSceneObject );
+    virtual void            onStaticModified( const char* slotName, const char* newValue = NULL );
     static void             initPersistFields();
 
     /// Integration.
@@ -285,13 +290,29 @@ public:
     virtual void            interpolateObject( const F32 timeDelta );
     inline bool             getIsEditorTickAllowed( void ) const { return mEditorTickAllowed; }
 
+    /// Concurrent integration.
+    /// Objects returning true here may have their pre-integrate and integrate stages called on a worker thread
+    /// when the scene has tick jobs enabled.  Those stages must then only modify the object itself with anything
+    /// else such as script callbacks being left to "integrateDeferred" which is called serially afterwards.
+    virtual bool            getTickThreadSafe( void ) const { return false; }
+    virtual void            integrateDeferred( const F32 totalTime, const F32 elapsedTime, DebugStats* pDebugStats );
+    inline void             setTickConcurrent( const bool concurrent ) { mTickConcurrent = concurrent; }
+    inline bool             getTickConcurrent( void ) const { return mTickConcurrent; }
+
     /// Render batching.
-    inline void             setBatchIsolated( const bool batchIsolated ) { mBatchIsolated = batchIsolated; }
+    inline void             setBatchIsolated( const bool batchIsolated ) { mBatchIsolated = batchIsolated; invalidateRenderCache(); }
     virtual bool            getBatchIsolated( void ) { return mBatchIsolated; }
     virtual bool            isBatchRendered( void ) { return true; }
     virtual bool            validRender( void ) const { return true; }
     virtual bool            shouldRender( void ) const { return false; }
 
+    /// Static layer render caching.
+    /// Objects whose appearance changes without any notification (such as particles) should return false here
+    /// so static layers containing them are not cached.  Other changes should call "invalidateRenderCache".
+    /// Objects that change GL state directly whilst rendering (such as clipping) must also return false as that cannot be captured.
+    virtual bool            getRenderCacheable( void ) const { return true; }
+    inline void             invalidateRenderCache( void )               { if ( mpScene ) mpScene->invalidateLayerRenderCache( mSceneLayer ); }
+
     
     /// Render Output.
     virtual bool            canPrepareRender( void ) const { return false; }
@@ -322,7 +343,7 @@ public:
     inline U32              getSceneLayerMask( void ) const             { return mSceneLayerMask; }
 
     /// Scene Layer depth.
-    inline void             setSceneLayerDepth( const F32 order )       { mSceneLayerDepth = order; };
+    inline void             setSceneLayerDepth( const F32 order )       { mSceneLayerDepth = order; invalidateRenderCache(); };
     inline F32              getSceneLayerDepth( void ) const            { return mSceneLayerDepth; }
     bool                    setSceneLayerDepthFront( void );
     bool                    setSceneLayerDepthBack( void );
@@ -519,29 +540,29 @@ public:
     Vector2                 getEdgeCollisionShapeAdjacentEnd( const U32 shapeIndex ) const;
 
     /// Render visibility.
-    inline void             setVisible( const bool status )             { mVisible = status; }
+    inline void             setVisible( const bool status )             { mVisible = status; invalidateRenderCache(); }
     inline bool             getVisible(void) const                      { return mVisible; }
 
     /// Render blending.
-    inline void             setBlendMode( const bool blendMode )        { mBlendMode = blendMode; }
+    inline void             setBlendMode( const bool blendMode )        { mBlendMode = blendMode; invalidateRenderCache(); }
     inline bool             getBlendMode( void ) const                  { return mBlendMode; }
-    inline void             setSrcBlendFactor( const S32 blendFactor )  { mSrcBlendFactor = blendFactor; }
+    inline void             setSrcBlendFactor( const S32 blendFactor )  { mSrcBlendFactor = blendFactor; invalidateRenderCache(); }
     inline S32              getSrcBlendFactor( void ) const             { return mSrcBlendFactor; }
-    inline void             setDstBlendFactor( const S32 blendFactor )  { mDstBlendFactor = blendFactor; }
+    inline void             setDstBlendFactor( const S32 blendFactor )  { mDstBlendFactor = blendFactor; invalidateRenderCache(); }
     inline S32              getDstBlendFactor( void ) const             { return mDstBlendFactor; }
-    inline void             setBlendColor( const ColorF& blendColor )   { mBlendColor = blendColor; }
+    inline void             setBlendColor( const ColorF& blendColor )   { mBlendColor = blendColor; invalidateRenderCache(); }
     inline const ColorF&    getBlendColor( void ) const                 { return mBlendColor; }
-    inline void             setBlendAlpha( const F32 alpha )            { mBlendColor.alpha = alpha; }
+    inline void             setBlendAlpha( const F32 alpha )            { mBlendColor.alpha = alpha; invalidateRenderCache(); }
     inline F32              getBlendAlpha( void ) const                 { return mBlendColor.alpha; }
-    inline void             setAlphaTest( const F32 alpha )             { mAlphaTest = alpha; }
+    inline void             setAlphaTest( const F32 alpha )             { mAlphaTest = alpha; invalidateRenderCache(); }
     inline F32              getAlphaTest( void ) const                  { return mAlphaTest; }
     void                    setBlendOptions( void );
     static                  void resetBlendOptions( void );
 
     /// Render sorting.
-    inline void             setSortPoint( const Vector2& pt )           { mSortPoint = pt; }
+    inline void             setSortPoint( const Vector2& pt )           { mSortPoint = pt; invalidateRenderCache(); }
     inline const Vector2&   getSortPoint(void) const                    { return mSortPoint; }
-    inline void             setRenderGroup( const char* pRenderGroup )  { mRenderGroup = StringTable->insert(pRenderGroup); }
+    inline void             setRenderGroup( const char* pRenderGroup )  { mRenderGroup = StringTable->insert(pRenderGroup); invalidateRenderCache(); }
     inline StringTableEntry getRenderGroup( void ) const                { return mRenderGroup; }
 
     /// Input events.
@@ -558,8 +579,8 @@ public:
     inline bool             getSleepingCallback( void ) const           { return mSleepingCallback; }
 
     /// Debug mode.
-    inline void             setDebugOn( const U32 debugMask )           { mDebugMask |= debugMask; }
-    inline void             setDebugOff( const U32 debugMask )          { mDebugMask &= ~debugMask; }
+    inline void             setDebugOn( const U32 debugMask )           { mDebugMask |= debugMask; invalidateRenderCache(); }
+    inline void             setDebugOff( const U32 debugMask )          { mDebugMask &= ~debugMask; invalidateRenderCache(); }
     inline U32              getDebugMask( void ) const                  { return mDebugMask; }
 
     /// Camera mounting.
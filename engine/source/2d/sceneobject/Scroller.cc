@@ -313,6 +313,24 @@ void Scroller::sceneRender( const SceneRenderState* pSceneRenderState, const Sce
     const S32 wholeRegionX = (S32)mCeil( mRepeatX );
     const S32 wholeRegionY = (S32)mCeil( mRepeatY );
 
+    // Fetch the range of whole regions to render.
+    S32 firstRegionX = 0;
+    S32 firstRegionY = 0;
+    S32 lastRegionX = wholeRegionX;
+    S32 lastRegionY = wholeRegionY;
+
+    // Is the scroller axis-aligned?
+    if ( mIsEqual( renderOOBB0.y, renderOOBB1.y ) && regionWidth > 0.0f && regionHeight > 0.0f )
+    {
+        // Yes, so only render the whole regions within the render area.
+        // NOTE:- Anything outside the render area would be clipped anyway.
+        const b2AABB& renderAABB = pSceneRenderState->mRenderAABB;
+        firstRegionX = getMax( (S32)mFloor( (renderAABB.lowerBound.x - renderOOBB0.x) / regionWidth ), 0 );
+        firstRegionY = getMax( (S32)mFloor( (renderAABB.lowerBound.y - renderOOBB0.y) / regionHeight ), 0 );
+        lastRegionX = getMin( (S32)mCeil( (renderAABB.upperBound.x - renderOOBB0.x) / regionWidth ), wholeRegionX );
+        lastRegionY = getMin( (S32)mCeil( (renderAABB.upperBound.y - renderOOBB0.y) / regionHeight ), wholeRegionY );
+    }
+
     // Flush any existing batches.
     pBatchRenderer->flush();
 
@@ -326,8 +344,13 @@ void Scroller::sceneRender( const SceneRenderState* pSceneRenderState, const Sce
     GLdouble bottom[4] = {0, 1, 0, -renderOOBB0.y};
 
     //This is to prevent some android devices from throwing opengl errors. For instance the tegra 3 only supports 1
-    int maxClip = 4;
-    glGetIntegerv(GL_MAX_CLIP_PLANES, &maxClip);
+    // NOTE:- This never changes so it's only fetched once rather than stalling on it every render.
+    static int maxClip = -1;
+    if ( maxClip < 0 )
+    {
+        maxClip = 4;
+        glGetIntegerv(GL_MAX_CLIP_PLANES, &maxClip);
+    }
 
     glClipPlane(GL_CLIP_PLANE0, left);
 
@@ -349,17 +372,17 @@ void Scroller::sceneRender( const SceneRenderState* pSceneRenderState, const Sce
 #endif
 
     // Render repeat Y.
-    for ( S32 repeatIndexY = 0; repeatIndexY < wholeRegionY; ++repeatIndexY )
+    for ( S32 repeatIndexY = firstRegionY; repeatIndexY < lastRegionY; ++repeatIndexY )
     {
         // Set base split region.
         ScrollSplitRegion splitRegion = baseSplitRegion;
 
         // Move vertex if appropriate.
-        if ( repeatIndexY > 0 )
-            splitRegion.addVertexOffset( 0.0f, regionHeight * repeatIndexY );
+        if ( repeatIndexY > 0 || firstRegionX > 0 )
+            splitRegion.addVertexOffset( regionWidth * firstRegionX, regionHeight * repeatIndexY );
 
         // Render repeat X.
-        for ( S32 repeatIndexX = 0; repeatIndexX < wholeRegionX; ++repeatIndexX )
+        for ( S32 repeatIndexX = firstRegionX; repeatIndexX < lastRegionX; ++repeatIndexX )
         {
             // Split in X only?
             if ( isSplitRenderFrameX && !isSplitRenderFrameY )
@@ -336,7 +336,7 @@ void SkeletonObject::generateComposition( void )
 {
     // Clear existing visualization
     clearSprites();
-    mSkeletonSprites.clear();
+    mSlotSprites.clear();
     
     // Finish if skeleton asset isn't available.
     if ( mSkeletonAsset.isNull() )
@@ -376,12 +376,34 @@ void SkeletonObject::generateComposition( void )
         rootBone->x = mSkeletonOffset.x;
         rootBone->y = mSkeletonOffset.y;
     }
+    
+    // Get the ImageAsset used by the sprites
+    StringTableEntry assetId = (*mSkeletonAsset).mImageAsset.getAssetId();
+    
+    // Create a persistent sprite for each slot.
+    // NOTE: The sprites are created in slot order so they render in slot order.
+    mSlotSprites.setSize( mSkeleton->slotCount );
+    for (int i = 0; i < mSkeleton->slotCount; ++i)
+    {
+        SlotSprite& slotSprite = mSlotSprites[i];
+        slotSprite.mpSprite = SpriteBatch::createSprite();
+        slotSprite.mpSprite->setImage(assetId);
+        slotSprite.mpSprite->setDepth(mSceneLayerDepth);
+        slotSprite.mpSprite->setSrcBlendFactor(mSrcBlendFactor);
+        slotSprite.mpSprite->setDstBlendFactor(mDstBlendFactor);
+        slotSprite.mpSprite->setVisible(false);
+        slotSprite.mpAttachment = NULL;
+    }
 }
 
 //-----------------------------------------------------------------------------
 
 void SkeletonObject::updateComposition( const F32 time )
 {
+    // Finish if the composition hasn't been generated.
+    if (!mSkeleton || mSlotSprites.size() != mSkeleton->slotCount)
+        return;
+    
     // Update position/orientation/state of visualization
     float delta = (time - mLastFrameTime) * mTimeScale;
     mLastFrameTime = time;
@@ -397,9 +419,15 @@ void SkeletonObject::updateComposition( const F32 time )
     spSkeleton_updateWorldTransform(mSkeleton);
     
     // Get the ImageAsset used by the sprites
-    StringTableEntry assetId = (*mSkeletonAsset).mImageAsset.getAssetId();
+    ImageAsset* pImageAsset = (*mSkeletonAsset).mImageAsset;
     
-    clearSprites();
+    mSkeleton->r = mBlendColor.red;
+    mSkeleton->g = mBlendColor.green;
+    mSkeleton->b = mBlendColor.blue;
+    mSkeleton->a = mBlendColor.alpha;
+    
+    mSkeleton->flipX = getFlipX();
+    mSkeleton->flipY = getFlipY();
     
     Vector2 vertices[4];
     
@@ -409,23 +437,46 @@ void SkeletonObject::updateComposition( const F32 time )
         spSlot* slot = mSkeleton->slots[i];
         spAttachment* attachment = slot->attachment;
         
+        // Fetch the slot sprite.
+        SlotSprite& slotSprite = mSlotSprites[i];
+        SpriteBatchItem* pSprite = slotSprite.mpSprite;
+        
+        // Hide the slot sprite if there's nothing to render.
         if (!attachment || attachment->type != ATTACHMENT_REGION)
+        {
+            if (pSprite->getVisible())
+                pSprite->setVisible(false);
+            
             continue;
+        }
         
-        spRegionAttachment* regionAttachment = (spRegionAttachment*)attachment;
-        spRegionAttachment_computeWorldVertices(regionAttachment, slot->skeleton->x, slot->skeleton->y, slot->bone, vertexPositions);
+        // Resolve the attachment frame only when the attachment (or skin) changes.
+        if (attachment != slotSprite.mpAttachment)
+        {
+            slotSprite.mpAttachment = attachment;
+            
+            const S32 frameIndex = pImageAsset != NULL ? pImageAsset->getNamedFrameIndex(attachment->name) : -1;
+            
+            if (frameIndex >= 0)
+                pSprite->setImageFrame((U32)frameIndex);
+            else
+                pSprite->setNamedImageFrame(attachment->name);
+        }
         
-        SpriteBatchItem* pSprite = SpriteBatch::createSprite();
-
-        pSprite->setDepth(mSceneLayerDepth);
+        if (!pSprite->getVisible())
+            pSprite->setVisible(true);
         
-        pSprite->setSrcBlendFactor(mSrcBlendFactor);
-        pSprite->setDstBlendFactor(mDstBlendFactor);
+        if (pSprite->getDepth() != mSceneLayerDepth)
+            pSprite->setDepth(mSceneLayerDepth);
         
-        mSkeleton->r = mBlendColor.red;
-        mSkeleton->g = mBlendColor.green;
-        mSkeleton->b = mBlendColor.blue;
-        mSkeleton->a = mBlendColor.alpha;
+        if (pSprite->getSrcBlendFactor() != (GLenum)mSrcBlendFactor || pSprite->getDstBlendFactor() != (GLenum)mDstBlendFactor)
+        {
+            pSprite->setSrcBlendFactor(mSrcBlendFactor);
+            pSprite->setDstBlendFactor(mDstBlendFactor);
+        }
+        
+        spRegionAttachment* regionAttachment = (spRegionAttachment*)attachment;
+        spRegionAttachment_computeWorldVertices(regionAttachment, slot->skeleton->x, slot->skeleton->y, slot->bone, vertexPositions);
         
         F32 alpha = mSkeleton->a * slot->a;
         pSprite->setBlendColor(ColorF(
@@ -435,9 +486,6 @@ void SkeletonObject::updateComposition( const F32 time )
             alpha
         ));
         
-        mSkeleton->flipX = getFlipX();
-        mSkeleton->flipY = getFlipY();
-        
         vertices[0].x = vertexPositions[VERTEX_X1];
         vertices[0].y = vertexPositions[VERTEX_Y1];
         vertices[1].x = vertexPositions[VERTEX_X4];
@@ -447,9 +495,6 @@ void SkeletonObject::updateComposition( const F32 time )
         vertices[3].x = vertexPositions[VERTEX_X2];
         vertices[3].y = vertexPositions[VERTEX_Y2];
         pSprite->setExplicitVertices(vertices);
-        
-        pSprite->setImage(assetId);
-        pSprite->setNamedImageFrame(attachment->name);
     }
     
     if (mLastFrameTime >= mTotalAnimationTime)
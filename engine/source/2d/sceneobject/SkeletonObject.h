@@ -43,8 +43,15 @@ protected:
     typedef SceneObject Parent;
     
 private:
-    typedef Vector<SpriteBatchItem*> typeSkeletonSpritesVector;
-    typeSkeletonSpritesVector   mSkeletonSprites;
+    /// The persistent sprite bound to a skeleton slot.
+    struct SlotSprite
+    {
+        SpriteBatchItem*    mpSprite;
+        spAttachment*       mpAttachment;
+    };
+
+    typedef Vector<SlotSprite> typeSlotSpriteVector;
+    typeSlotSpriteVector        mSlotSprites;
     
     AssetPtr<SkeletonAsset>     mSkeletonAsset;
     spSkeleton*                 mSkeleton;
@@ -85,6 +92,7 @@ public:
     virtual bool canPrepareRender( void ) const { return true; }
     virtual bool validRender( void ) const { return mSkeletonAsset.notNull(); }
     virtual bool shouldRender( void ) const { return true; }
+    virtual bool getRenderCacheable( void ) const { return false; }
     virtual void scenePrepareRender( const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue );
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
     
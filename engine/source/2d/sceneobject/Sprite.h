@@ -54,6 +54,9 @@ public:
 
     virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer );
 
+    /// Growing resizes the collision shapes so only tick concurrently when not growing.
+    virtual bool getTickThreadSafe( void ) const        { return !mGrowActive; }
+
     /// Declare Console Object.
     DECLARE_CONOBJECT( Sprite );
 
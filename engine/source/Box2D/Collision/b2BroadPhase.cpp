@@ -31,10 +31,19 @@ b2BroadPhase::b2BroadPhase()
 	m_moveCapacity = 16;
 	m_moveCount = 0;
 	m_moveBuffer = (int32*)b2Alloc(m_moveCapacity * sizeof(int32));
+
+	m_threadPairBuffers = NULL;
+	m_threadPairBufferCount = 0;
 }
 
 b2BroadPhase::~b2BroadPhase()
 {
+	for (int32 i = 0; i < m_threadPairBufferCount; ++i)
+	{
+		b2Free(m_threadPairBuffers[i].pairs);
+	}
+	b2Free(m_threadPairBuffers);
+
 	b2Free(m_moveBuffer);
 	b2Free(m_pairBuffer);
 }
@@ -119,3 +128,129 @@ bool b2BroadPhase::QueryCallback(int32 proxyId)
 
 	return true;
 }
+
+// This is called from b2DynamicTree::Query when we are gathering pairs in parallel.
+bool b2PairBuffer::QueryCallback(int32 proxyId)
+{
+	// A proxy cannot form a pair with itself.
+	if (proxyId == queryProxyId)
+	{
+		return true;
+	}
+
+	// Grow the pair buffer as needed.
+	if (count == capacity)
+	{
+		b2Pair* oldPairs = pairs;
+		capacity *= 2;
+		pairs = (b2Pair*)b2Alloc(capacity * sizeof(b2Pair));
+		memcpy(pairs, oldPairs, count * sizeof(b2Pair));
+		b2Free(oldPairs);
+	}
+
+	pairs[count].proxyIdA = b2Min(proxyId, queryProxyId);
+	pairs[count].proxyIdB = b2Max(proxyId, queryProxyId);
+	++count;
+
+	return true;
+}
+
+void b2BroadPhase::FindPairs(b2ParallelExecutor* executor)
+{
+	// Reset pair buffer
+	m_pairCount = 0;
+
+	if (executor != NULL && executor->GetThreadCount() > 1)
+	{
+		// Create a pair buffer for each thread.
+		int32 threadCount = executor->GetThreadCount();
+		if (m_threadPairBufferCount < threadCount)
+		{
+			b2PairBuffer* oldBuffers = m_threadPairBuffers;
+			m_threadPairBuffers = (b2PairBuffer*)b2Alloc(threadCount * sizeof(b2PairBuffer));
+			memcpy(m_threadPairBuffers, oldBuffers, m_threadPairBufferCount * sizeof(b2PairBuffer));
+			b2Free(oldBuffers);
+
+			for (int32 i = m_threadPairBufferCount; i < threadCount; ++i)
+			{
+				m_threadPairBuffers[i].capacity = 16;
+				m_threadPairBuffers[i].pairs = (b2Pair*)b2Alloc(m_threadPairBuffers[i].capacity * sizeof(b2Pair));
+			}
+			m_threadPairBufferCount = threadCount;
+		}
+
+		for (int32 i = 0; i < threadCount; ++i)
+		{
+			m_threadPairBuffers[i].count = 0;
+		}
+
+		// Perform tree queries for all moving proxies.
+		executor->ParallelFor(&b2BroadPhase::QueryTask, this, m_moveCount, b2_pairQueryBatchSize);
+
+		// Gather the pairs. They are sorted before being reported so the order they are
+		// gathered in does not matter.
+		int32 pairCount = 0;
+		for (int32 i = 0; i < threadCount; ++i)
+		{
+			pairCount += m_threadPairBuffers[i].count;
+		}
+
+		if (m_pairCapacity < pairCount)
+		{
+			b2Free(m_pairBuffer);
+			while (m_pairCapacity < pairCount)
+			{
+				m_pairCapacity *= 2;
+			}
+			m_pairBuffer = (b2Pair*)b2Alloc(m_pairCapacity * sizeof(b2Pair));
+		}
+
+		for (int32 i = 0; i < threadCount; ++i)
+		{
+			memcpy(m_pairBuffer + m_pairCount, m_threadPairBuffers[i].pairs, m_threadPairBuffers[i].count * sizeof(b2Pair));
+			m_pairCount += m_threadPairBuffers[i].count;
+		}
+	}
+	else
+	{
+		// Perform tree queries for all moving proxies.
+		for (int32 i = 0; i < m_moveCount; ++i)
+		{
+			m_queryProxyId = m_moveBuffer[i];
+			if (m_queryProxyId == e_nullProxy)
+			{
+				continue;
+			}
+
+			// We have to query the tree with the fat AABB so that
+			// we don't fail to create a pair that may touch later.
+			const b2AABB& fatAABB = m_tree.GetFatAABB(m_queryProxyId);
+
+			// Query tree, create pairs and add them pair buffer.
+			m_tree.Query(this, fatAABB);
+		}
+	}
+
+	// Reset move buffer
+	m_moveCount = 0;
+}
+
+// Query the tree for a batch of moved proxies using the pair buffer of the thread.
+void b2BroadPhase::QueryTask(void* context, int32 startIndex, int32 endIndex, int32 threadIndex)
+{
+	b2BroadPhase* broadPhase = (b2BroadPhase*)context;
+	b2Assert(0 <= threadIndex && threadIndex < broadPhase->m_threadPairBufferCount);
+	b2PairBuffer* pairBuffer = broadPhase->m_threadPairBuffers + threadIndex;
+
+	for (int32 i = startIndex; i < endIndex; ++i)
+	{
+		pairBuffer->queryProxyId = broadPhase->m_moveBuffer[i];
+		if (pairBuffer->queryProxyId == e_nullProxy)
+		{
+			continue;
+		}
+
+		const b2AABB& fatAABB = broadPhase->m_tree.GetFatAABB(pairBuffer->queryProxyId);
+		broadPhase->m_tree.Query(pairBuffer, fatAABB);
+	}
+}
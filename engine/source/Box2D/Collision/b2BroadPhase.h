@@ -30,6 +30,17 @@ struct b2Pair
 	int32 proxyIdB;
 };
 
+/// A growable pair buffer used by one thread when finding pairs in parallel.
+struct b2PairBuffer
+{
+	bool QueryCallback(int32 proxyId);
+
+	b2Pair* pairs;
+	int32 count;
+	int32 capacity;
+	int32 queryProxyId;
+};
+
 /// The broad-phase is used for computing pairs and performing volume queries and ray casts.
 /// This broad-phase does not persist pairs. Instead, this reports potentially new pairs.
 /// It is up to the client to consume the new pairs and to track subsequent overlap.
@@ -75,6 +86,15 @@ public:
 	template <typename T>
 	void UpdatePairs(T* callback);
 
+	/// Find the pairs for the moved proxies without reporting them. This is the first half
+	/// of UpdatePairs. The tree queries are run in parallel if an executor is provided and
+	/// the pairs found are the same either way.
+	void FindPairs(b2ParallelExecutor* executor);
+
+	/// Report the pairs found by FindPairs. This is the second half of UpdatePairs.
+	template <typename T>
+	void ReportPairs(T* callback);
+
 	/// Query an AABB for overlapping proxies. The callback class
 	/// is called for each proxy that overlaps the supplied AABB.
 	template <typename T>
@@ -113,6 +133,8 @@ private:
 
 	bool QueryCallback(int32 proxyId);
 
+	static void QueryTask(void* context, int32 startIndex, int32 endIndex, int32 threadIndex);
+
 	b2DynamicTree m_tree;
 
 	int32 m_proxyCount;
@@ -126,6 +148,9 @@ private:
 	int32 m_pairCount;
 
 	int32 m_queryProxyId;
+
+	b2PairBuffer* m_threadPairBuffers;
+	int32 m_threadPairBufferCount;
 };
 
 /// This is used to sort pairs.
@@ -184,29 +209,13 @@ inline float32 b2BroadPhase::GetTreeQuality() const
 template <typename T>
 void b2BroadPhase::UpdatePairs(T* callback)
 {
-	// Reset pair buffer
-	m_pairCount = 0;
-
-	// Perform tree queries for all moving proxies.
-	for (int32 i = 0; i < m_moveCount; ++i)
-	{
-		m_queryProxyId = m_moveBuffer[i];
-		if (m_queryProxyId == e_nullProxy)
-		{
-			continue;
-		}
-
-		// We have to query the tree with the fat AABB so that
-		// we don't fail to create a pair that may touch later.
-		const b2AABB& fatAABB = m_tree.GetFatAABB(m_queryProxyId);
-
-		// Query tree, create pairs and add them pair buffer.
-		m_tree.Query(this, fatAABB);
-	}
-
-	// Reset move buffer
-	m_moveCount = 0;
+	FindPairs(NULL);
+	ReportPairs(callback);
+}
 
+template <typename T>
+void b2BroadPhase::ReportPairs(T* callback)
+{
 	// Sort the pair buffer to expose duplicates.
 	std::sort(m_pairBuffer, m_pairBuffer + m_pairCount, b2PairLessThan);
 
@@ -124,6 +124,14 @@ typedef double float64;
 /// A body cannot sleep if its angular velocity is above this tolerance.
 #define b2_angularSleepTolerance	(2.0f / 180.0f * b2_pi)
 
+// Parallel
+
+/// The number of moved proxies queried per parallel broad-phase task batch.
+#define b2_pairQueryBatchSize		32
+
+/// The number of contacts updated per parallel narrow-phase task batch.
+#define b2_contactUpdateBatchSize	64
+
 // Memory Allocation
 
 /// Implement this function to use your own memory allocator.
@@ -135,6 +143,28 @@ void b2Free(void* mem);
 /// Logging function.
 void b2Log(const char* string, ...);
 
+// Threading
+
+/// Implement this class to let the world run parts of a time step on multiple threads.
+/// The executor is owned by you and must remain in scope.
+/// See b2World::SetParallelExecutor
+class b2ParallelExecutor
+{
+public:
+	/// Processes the items in the range [startIndex, endIndex) on the thread "threadIndex".
+	typedef void (*b2ParallelTask)(void* context, int32 startIndex, int32 endIndex, int32 threadIndex);
+
+	virtual ~b2ParallelExecutor() {}
+
+	/// Get the number of threads that may run tasks, including the calling thread.
+	virtual int32 GetThreadCount() const = 0;
+
+	/// Run the task over the items [0, count) in batches of "batchSize" items and block until
+	/// they are all complete. The calling thread must be thread index zero and any other
+	/// threads must use the indices [1, GetThreadCount()).
+	virtual void ParallelFor(b2ParallelTask task, void* context, int32 count, int32 batchSize) = 0;
+};
+
 /// Version numbering scheme.
 /// See http://en.wikipedia.org/wiki/Software_versioning
 struct b2Version
@@ -189,6 +189,11 @@ protected:
 
 	void Update(b2ContactListener* listener);
 
+	// Update splits into these so the manifolds can be updated in parallel. UpdateManifold
+	// only changes the contact and returns whether it was touching before the update.
+	bool UpdateManifold(b2Manifold* oldManifold);
+	void ReportUpdate(b2ContactListener* listener, const b2Manifold* oldManifold, bool wasTouching);
+
 	static b2ContactRegister s_registers[b2Shape::e_typeCount][b2Shape::e_typeCount];
 	static bool s_initialized;
 
@@ -21,10 +21,27 @@
 #include <Box2D/Dynamics/b2Fixture.h>
 #include <Box2D/Dynamics/b2WorldCallbacks.h>
 #include <Box2D/Dynamics/Contacts/b2Contact.h>
+#include <Box2D/Common/b2Timer.h>
 
 b2ContactFilter b2_defaultFilter;
 b2ContactListener b2_defaultListener;
 
+// A contact visited by b2ContactManager::CollideParallel, in contact list order.
+struct b2ContactUpdate
+{
+	enum Action
+	{
+		e_destroy,
+		e_update,
+		e_inactive
+	};
+
+	b2Contact* contact;
+	b2Manifold oldManifold;
+	int32 action;
+	bool wasTouching;
+};
+
 b2ContactManager::b2ContactManager()
 {
 	m_contactList = NULL;
@@ -32,6 +49,19 @@ b2ContactManager::b2ContactManager()
 	m_contactFilter = &b2_defaultFilter;
 	m_contactListener = &b2_defaultListener;
 	m_allocator = NULL;
+
+	m_parallelExecutor = NULL;
+	m_narrowphaseTime = 0.0f;
+	m_pairQueryTime = 0.0f;
+	m_addPairsTime = 0.0f;
+
+	m_contactUpdates = NULL;
+	m_contactUpdateCapacity = 0;
+}
+
+b2ContactManager::~b2ContactManager()
+{
+	b2Free(m_contactUpdates);
 }
 
 void b2ContactManager::Destroy(b2Contact* c)
@@ -104,6 +134,14 @@ void b2ContactManager::Destroy(b2Contact* c)
 // contact list.
 void b2ContactManager::Collide()
 {
+	if (m_parallelExecutor != NULL && m_parallelExecutor->GetThreadCount() > 1)
+	{
+		CollideParallel();
+		return;
+	}
+
+	b2Timer timer;
+
 	// Update awake contacts.
 	b2Contact* c = m_contactList;
 	while (c)
@@ -167,11 +205,157 @@ void b2ContactManager::Collide()
 		c->Update(m_contactListener);
 		c = c->GetNext();
 	}
+
+	// The contacts are updated as they are visited.
+	m_narrowphaseTime += timer.GetMilliseconds();
+}
+
+// This is Collide with the contact manifolds updated in parallel. The contacts are first
+// visited in list order to find the ones to destroy or update, the manifolds are then updated
+// in parallel and finally the contacts are visited again in list order to destroy them, wake
+// their bodies and call the listener. This gives exactly the same results and callbacks as
+// Collide.
+void b2ContactManager::CollideParallel()
+{
+	// Grow the update buffer as needed.
+	if (m_contactUpdateCapacity < m_contactCount)
+	{
+		b2Free(m_contactUpdates);
+		m_contactUpdateCapacity = b2Max(m_contactCount, 2 * m_contactUpdateCapacity);
+		m_contactUpdates = (b2ContactUpdate*)b2Alloc(m_contactUpdateCapacity * sizeof(b2ContactUpdate));
+	}
+
+	// Find the contacts to destroy or update.
+	int32 updateCount = 0;
+	for (b2Contact* c = m_contactList; c; c = c->GetNext())
+	{
+		b2Assert(updateCount < m_contactUpdateCapacity);
+		b2ContactUpdate* update = m_contactUpdates + updateCount++;
+		update->contact = c;
+
+		b2Fixture* fixtureA = c->GetFixtureA();
+		b2Fixture* fixtureB = c->GetFixtureB();
+		b2Body* bodyA = fixtureA->GetBody();
+		b2Body* bodyB = fixtureB->GetBody();
+
+		// Is this contact flagged for filtering?
+		if (c->m_flags & b2Contact::e_filterFlag)
+		{
+			// Should these bodies collide?
+			if (bodyB->ShouldCollide(bodyA) == false)
+			{
+				update->action = b2ContactUpdate::e_destroy;
+				continue;
+			}
+
+			// Check user filtering.
+			if (m_contactFilter && m_contactFilter->ShouldCollide(fixtureA, fixtureB) == false)
+			{
+				update->action = b2ContactUpdate::e_destroy;
+				continue;
+			}
+
+			// Clear the filtering flag.
+			c->m_flags &= ~b2Contact::e_filterFlag;
+		}
+
+		bool activeA = bodyA->IsAwake() && bodyA->m_type != b2_staticBody;
+		bool activeB = bodyB->IsAwake() && bodyB->m_type != b2_staticBody;
+
+		// At least one body must be awake and it must be dynamic or kinematic.
+		// The bodies may still be woken by an earlier contact so check again later.
+		if (activeA == false && activeB == false)
+		{
+			update->action = b2ContactUpdate::e_inactive;
+			continue;
+		}
+
+		int32 proxyIdA = fixtureA->m_proxies[c->GetChildIndexA()].proxyId;
+		int32 proxyIdB = fixtureB->m_proxies[c->GetChildIndexB()].proxyId;
+		bool overlap = m_broadPhase.TestOverlap(proxyIdA, proxyIdB);
+
+		// Here we destroy contacts that cease to overlap in the broad-phase.
+		update->action = overlap ? b2ContactUpdate::e_update : b2ContactUpdate::e_destroy;
+	}
+
+	// Update the manifolds.
+	b2Timer timer;
+	m_parallelExecutor->ParallelFor(&b2ContactManager::UpdateContactsTask, this, updateCount, b2_contactUpdateBatchSize);
+	m_narrowphaseTime += timer.GetMilliseconds();
+
+	// Finish the contacts in list order.
+	for (int32 i = 0; i < updateCount; ++i)
+	{
+		b2ContactUpdate* update = m_contactUpdates + i;
+		b2Contact* c = update->contact;
+
+		if (update->action == b2ContactUpdate::e_destroy)
+		{
+			Destroy(c);
+			continue;
+		}
+
+		if (update->action == b2ContactUpdate::e_update)
+		{
+			c->ReportUpdate(m_contactListener, &update->oldManifold, update->wasTouching);
+			continue;
+		}
+
+		b2Fixture* fixtureA = c->GetFixtureA();
+		b2Fixture* fixtureB = c->GetFixtureB();
+		b2Body* bodyA = fixtureA->GetBody();
+		b2Body* bodyB = fixtureB->GetBody();
+
+		bool activeA = bodyA->IsAwake() && bodyA->m_type != b2_staticBody;
+		bool activeB = bodyB->IsAwake() && bodyB->m_type != b2_staticBody;
+
+		// At least one body must be awake and it must be dynamic or kinematic.
+		if (activeA == false && activeB == false)
+		{
+			continue;
+		}
+
+		int32 proxyIdA = fixtureA->m_proxies[c->GetChildIndexA()].proxyId;
+		int32 proxyIdB = fixtureB->m_proxies[c->GetChildIndexB()].proxyId;
+		bool overlap = m_broadPhase.TestOverlap(proxyIdA, proxyIdB);
+
+		// Here we destroy contacts that cease to overlap in the broad-phase.
+		if (overlap == false)
+		{
+			Destroy(c);
+			continue;
+		}
+
+		// The contact persists.
+		c->Update(m_contactListener);
+	}
+}
+
+// Update the manifolds for a batch of contacts.
+void b2ContactManager::UpdateContactsTask(void* context, int32 startIndex, int32 endIndex, int32 threadIndex)
+{
+	B2_NOT_USED(threadIndex);
+
+	b2ContactUpdate* contactUpdates = ((b2ContactManager*)context)->m_contactUpdates;
+	for (int32 i = startIndex; i < endIndex; ++i)
+	{
+		b2ContactUpdate* update = contactUpdates + i;
+		if (update->action == b2ContactUpdate::e_update)
+		{
+			update->wasTouching = update->contact->UpdateManifold(&update->oldManifold);
+		}
+	}
 }
 
 void b2ContactManager::FindNewContacts()
 {
-	m_broadPhase.UpdatePairs(this);
+	b2Timer timer;
+	m_broadPhase.FindPairs(m_parallelExecutor);
+	m_pairQueryTime += timer.GetMilliseconds();
+
+	timer.Reset();
+	m_broadPhase.ReportPairs(this);
+	m_addPairsTime += timer.GetMilliseconds();
 }
 
 void b2ContactManager::AddPair(void* proxyUserDataA, void* proxyUserDataB)
@@ -25,12 +25,14 @@ class b2Contact;
 class b2ContactFilter;
 class b2ContactListener;
 class b2BlockAllocator;
+struct b2ContactUpdate;
 
 // Delegate of b2World.
 class b2ContactManager
 {
 public:
 	b2ContactManager();
+	~b2ContactManager();
 
 	// Broad-phase callback.
 	void AddPair(void* proxyUserDataA, void* proxyUserDataB);
@@ -47,6 +49,21 @@ public:
 	b2ContactFilter* m_contactFilter;
 	b2ContactListener* m_contactListener;
 	b2BlockAllocator* m_allocator;
+
+	// Contact updates and broad-phase queries run in parallel when this is set.
+	b2ParallelExecutor* m_parallelExecutor;
+
+	// Stage timings accumulated until reset by the world.
+	float32 m_narrowphaseTime;
+	float32 m_pairQueryTime;
+	float32 m_addPairsTime;
+
+private:
+	void CollideParallel();
+	static void UpdateContactsTask(void* context, int32 startIndex, int32 endIndex, int32 threadIndex);
+
+	b2ContactUpdate* m_contactUpdates;
+	int32 m_contactUpdateCapacity;
 };
 
 #endif
@@ -161,6 +161,7 @@ b2Island::b2Island(
 
 	m_allocator = allocator;
 	m_listener = listener;
+	m_impulses = NULL;
 
 	m_bodies = (b2Body**)m_allocator->Allocate(bodyCapacity * sizeof(b2Body*));
 	m_contacts = (b2Contact**)m_allocator->Allocate(contactCapacity	 * sizeof(b2Contact*));
@@ -515,6 +516,25 @@ void b2Island::SolveTOI(const b2TimeStep& subStep, int32 toiIndexA, int32 toiInd
 
 void b2Island::Report(const b2ContactVelocityConstraint* constraints)
 {
+	if (m_impulses != NULL)
+	{
+		// Store the impulses so they can be reported later.
+		for (int32 i = 0; i < m_contactCount; ++i)
+		{
+			const b2ContactVelocityConstraint* vc = constraints + i;
+
+			b2ContactImpulse& impulse = m_impulses[i];
+			impulse.count = vc->pointCount;
+			for (int32 j = 0; j < b2_maxManifoldPoints; ++j)
+			{
+				impulse.normalImpulses[j] = j < vc->pointCount ? vc->points[j].normalImpulse : 0.0f;
+				impulse.tangentImpulses[j] = j < vc->pointCount ? vc->points[j].tangentImpulse : 0.0f;
+			}
+		}
+
+		return;
+	}
+
 	if (m_listener == NULL)
 	{
 		return;
@@ -32,6 +32,9 @@ struct b2Profile
 	float32 solvePosition;
 	float32 broadphase;
 	float32 solveTOI;
+	float32 narrowphase;	// contact manifold updates
+	float32 pairQuery;		// broad-phase tree queries for moved proxies
+	float32 addPairs;		// contact creation for new broad-phase pairs
 };
 
 /// This is an internal structure.
@@ -39,6 +39,10 @@ b2World::b2World(const b2Vec2& gravity)
 	m_destructionListener = NULL;
 	m_debugDraw = NULL;
 
+	m_parallelExecutor = NULL;
+	m_threadStackAllocators = NULL;
+	m_threadStackAllocatorCount = 0;
+
 	m_bodyList = NULL;
 	m_jointList = NULL;
 
@@ -82,6 +86,8 @@ b2World::~b2World()
 
 		b = bNext;
 	}
+
+	DestroyThreadStackAllocators();
 }
 
 void b2World::SetDestructionListener(b2DestructionListener* listener)
@@ -104,6 +110,25 @@ void b2World::SetDebugDraw(b2Draw* debugDraw)
 	m_debugDraw = debugDraw;
 }
 
+void b2World::SetParallelExecutor(b2ParallelExecutor* executor)
+{
+	b2Assert(IsLocked() == false);
+	m_parallelExecutor = executor;
+	m_contactManager.m_parallelExecutor = executor;
+}
+
+void b2World::DestroyThreadStackAllocators()
+{
+	for (int32 i = 0; i < m_threadStackAllocatorCount; ++i)
+	{
+		m_threadStackAllocators[i].~b2StackAllocator();
+	}
+
+	b2Free(m_threadStackAllocators);
+	m_threadStackAllocators = NULL;
+	m_threadStackAllocatorCount = 0;
+}
+
 b2Body* b2World::CreateBody(const b2BodyDef* def)
 {
 	b2Assert(IsLocked() == false);
@@ -382,6 +407,105 @@ void b2World::SetAllowSleeping(bool flag)
 	}
 }
 
+// Add the seed and everything connected to it to the island using a depth first search
+// (DFS) on the constraint graph. The stack must be able to hold every body.
+void b2World::BuildIsland(b2Body* seed, b2Body** stack, b2Island* island)
+{
+	int32 stackSize = m_bodyCount;
+	int32 stackCount = 0;
+	stack[stackCount++] = seed;
+	seed->m_flags |= b2Body::e_islandFlag;
+
+	while (stackCount > 0)
+	{
+		// Grab the next body off the stack and add it to the island.
+		b2Body* b = stack[--stackCount];
+		b2Assert(b->IsActive() == true);
+		island->Add(b);
+
+		// Make sure the body is awake.
+		b->SetAwake(true);
+
+		// To keep islands as small as possible, we don't
+		// propagate islands across static bodies.
+		if (b->GetType() == b2_staticBody)
+		{
+			continue;
+		}
+
+		// Search all contacts connected to this body.
+		for (b2ContactEdge* ce = b->m_contactList; ce; ce = ce->next)
+		{
+			b2Contact* contact = ce->contact;
+
+			// Has this contact already been added to an island?
+			if (contact->m_flags & b2Contact::e_islandFlag)
+			{
+				continue;
+			}
+
+			// Is this contact solid and touching?
+			if (contact->IsEnabled() == false ||
+				contact->IsTouching() == false)
+			{
+				continue;
+			}
+
+			// Skip sensors.
+			bool sensorA = contact->m_fixtureA->m_isSensor;
+			bool sensorB = contact->m_fixtureB->m_isSensor;
+			if (sensorA || sensorB)
+			{
+				continue;
+			}
+
+			island->Add(contact);
+			contact->m_flags |= b2Contact::e_islandFlag;
+
+			b2Body* other = ce->other;
+
+			// Was the other body already added to this island?
+			if (other->m_flags & b2Body::e_islandFlag)
+			{
+				continue;
+			}
+
+			b2Assert(stackCount < stackSize);
+			stack[stackCount++] = other;
+			other->m_flags |= b2Body::e_islandFlag;
+		}
+
+		// Search all joints connect to this body.
+		for (b2JointEdge* je = b->m_jointList; je; je = je->next)
+		{
+			if (je->joint->m_islandFlag == true)
+			{
+				continue;
+			}
+
+			b2Body* other = je->other;
+
+			// Don't simulate joints connected to inactive bodies.
+			if (other->IsActive() == false)
+			{
+				continue;
+			}
+
+			island->Add(je->joint);
+			je->joint->m_islandFlag = true;
+
+			if (other->m_flags & b2Body::e_islandFlag)
+			{
+				continue;
+			}
+
+			b2Assert(stackCount < stackSize);
+			stack[stackCount++] = other;
+			other->m_flags |= b2Body::e_islandFlag;
+		}
+	}
+}
+
 // Find islands, integrate and solve constraints, solve position constraints
 void b2World::Solve(const b2TimeStep& step)
 {
@@ -413,6 +537,133 @@ void b2World::Solve(const b2TimeStep& step)
 	// Build and simulate all awake islands.
 	int32 stackSize = m_bodyCount;
 	b2Body** stack = (b2Body**)m_stackAllocator.Allocate(stackSize * sizeof(b2Body*));
+	if (m_parallelExecutor != NULL && m_parallelExecutor->GetThreadCount() > 1)
+	{
+		SolveParallel(step, &island, stack);
+	}
+	else
+	{
+		for (b2Body* seed = m_bodyList; seed; seed = seed->m_next)
+		{
+			if (seed->m_flags & b2Body::e_islandFlag)
+			{
+				continue;
+			}
+
+			if (seed->IsAwake() == false || seed->IsActive() == false)
+			{
+				continue;
+			}
+
+			// The seed can be dynamic or kinematic.
+			if (seed->GetType() == b2_staticBody)
+			{
+				continue;
+			}
+
+			// Reset island and stack.
+			island.Clear();
+			BuildIsland(seed, stack, &island);
+
+			b2Profile profile;
+			island.Solve(&profile, step, m_gravity, m_allowSleep);
+			m_profile.solveInit += profile.solveInit;
+			m_profile.solveVelocity += profile.solveVelocity;
+			m_profile.solvePosition += profile.solvePosition;
+
+			// Post solve cleanup.
+			for (int32 i = 0; i < island.m_bodyCount; ++i)
+			{
+				// Allow static bodies to participate in other islands.
+				b2Body* b = island.m_bodies[i];
+				if (b->GetType() == b2_staticBody)
+				{
+					b->m_flags &= ~b2Body::e_islandFlag;
+				}
+			}
+		}
+	}
+
+	m_stackAllocator.Free(stack);
+
+	{
+		b2Timer timer;
+		// Synchronize fixtures, check for out of range bodies.
+		for (b2Body* b = m_bodyList; b; b = b->GetNext())
+		{
+			// If a body was not in an island then it did not move.
+			if ((b->m_flags & b2Body::e_islandFlag) == 0)
+			{
+				continue;
+			}
+
+			if (b->GetType() == b2_staticBody)
+			{
+				continue;
+			}
+
+			// Update fixtures (for broad-phase).
+			b->SynchronizeFixtures();
+		}
+
+		// Look for new contacts.
+		m_contactManager.FindNewContacts();
+		m_profile.broadphase = timer.GetMilliseconds();
+	}
+}
+
+// An island found by b2World::SolveParallel. Static bodies are kept apart from
+// the island's own bodies because other islands may use them too.
+struct b2ParallelIsland
+{
+	b2Body** bodies;
+	b2Body** staticBodies;
+	b2Contact** contacts;
+	b2Joint** joints;
+	b2ContactImpulse* impulses;
+	int32 bodyCount;
+	int32 staticBodyCount;
+	int32 contactCount;
+	int32 jointCount;
+};
+
+// The islands being solved by b2World::SolveIslandTask.
+struct b2ParallelSolveContext
+{
+	b2World* world;
+	const b2TimeStep* step;
+	b2ParallelIsland* islands;
+	b2Profile* threadProfiles;
+	int32 stateCount;
+};
+
+// Find all the awake islands and then solve them concurrently with the parallel executor.
+// Static bodies may be shared between islands so each one is given a single state index
+// after the largest island's own bodies and every island solves with its own copy of their
+// state. Nothing else is shared so each island is solved exactly as it is serially.
+void b2World::SolveParallel(const b2TimeStep& step, b2Island* island, b2Body** stack)
+{
+	b2ContactListener* listener = m_contactManager.m_contactListener;
+	int32 contactCapacity = m_contactManager.m_contactCount;
+
+	// A static body can only be reached through one of the island's contacts or joints.
+	int32 staticCapacity = contactCapacity + m_jointCount;
+
+	b2ParallelIsland* islands = (b2ParallelIsland*)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2ParallelIsland));
+	b2Body** bodies = (b2Body**)m_stackAllocator.Allocate(m_bodyCount * sizeof(b2Body*));
+	b2Body** staticBodies = (b2Body**)m_stackAllocator.Allocate(staticCapacity * sizeof(b2Body*));
+	b2Contact** contacts = (b2Contact**)m_stackAllocator.Allocate(contactCapacity * sizeof(b2Contact*));
+	b2Joint** joints = (b2Joint**)m_stackAllocator.Allocate(m_jointCount * sizeof(b2Joint*));
+	b2ContactImpulse* impulses = (b2ContactImpulse*)m_stackAllocator.Allocate(listener != NULL ? contactCapacity * sizeof(b2ContactImpulse) : 0);
+
+	int32 islandCount = 0;
+	int32 bodyCount = 0;
+	int32 staticBodyCount = 0;
+	int32 contactCount = 0;
+	int32 jointCount = 0;
+	int32 maxIslandBodyCount = 0;
+
+	// Build the islands in the same order as the serial solve.
 	for (b2Body* seed = m_bodyList; seed; seed = seed->m_next)
 	{
 		if (seed->m_flags & b2Body::e_islandFlag)
@@ -431,145 +682,182 @@ void b2World::Solve(const b2TimeStep& step)
 			continue;
 		}
 
-		// Reset island and stack.
-		island.Clear();
-		int32 stackCount = 0;
-		stack[stackCount++] = seed;
-		seed->m_flags |= b2Body::e_islandFlag;
-
-		// Perform a depth first search (DFS) on the constraint graph.
-		while (stackCount > 0)
+		island->Clear();
+		BuildIsland(seed, stack, island);
+
+		b2ParallelIsland* parallelIsland = islands + islandCount++;
+		parallelIsland->bodies = bodies + bodyCount;
+		parallelIsland->staticBodies = staticBodies + staticBodyCount;
+		parallelIsland->contacts = contacts + contactCount;
+		parallelIsland->joints = joints + jointCount;
+		parallelIsland->impulses = listener != NULL ? impulses + contactCount : NULL;
+		parallelIsland->bodyCount = 0;
+		parallelIsland->staticBodyCount = 0;
+		parallelIsland->contactCount = island->m_contactCount;
+		parallelIsland->jointCount = island->m_jointCount;
+
+		for (int32 i = 0; i < island->m_bodyCount; ++i)
 		{
-			// Grab the next body off the stack and add it to the island.
-			b2Body* b = stack[--stackCount];
-			b2Assert(b->IsActive() == true);
-			island.Add(b);
-
-			// Make sure the body is awake.
-			b->SetAwake(true);
-
-			// To keep islands as small as possible, we don't
-			// propagate islands across static bodies.
+			b2Body* b = island->m_bodies[i];
 			if (b->GetType() == b2_staticBody)
 			{
-				continue;
-			}
+				// Allow static bodies to participate in other islands.
+				b->m_flags &= ~b2Body::e_islandFlag;
 
-			// Search all contacts connected to this body.
-			for (b2ContactEdge* ce = b->m_contactList; ce; ce = ce->next)
+				b2Assert(staticBodyCount < staticCapacity);
+				parallelIsland->staticBodies[parallelIsland->staticBodyCount++] = b;
+				++staticBodyCount;
+			}
+			else
 			{
-				b2Contact* contact = ce->contact;
-
-				// Has this contact already been added to an island?
-				if (contact->m_flags & b2Contact::e_islandFlag)
-				{
-					continue;
-				}
-
-				// Is this contact solid and touching?
-				if (contact->IsEnabled() == false ||
-					contact->IsTouching() == false)
-				{
-					continue;
-				}
-
-				// Skip sensors.
-				bool sensorA = contact->m_fixtureA->m_isSensor;
-				bool sensorB = contact->m_fixtureB->m_isSensor;
-				if (sensorA || sensorB)
-				{
-					continue;
-				}
+				parallelIsland->bodies[parallelIsland->bodyCount++] = b;
+				++bodyCount;
+			}
+		}
 
-				island.Add(contact);
-				contact->m_flags |= b2Contact::e_islandFlag;
+		memcpy(parallelIsland->contacts, island->m_contacts, parallelIsland->contactCount * sizeof(b2Contact*));
+		memcpy(parallelIsland->joints, island->m_joints, parallelIsland->jointCount * sizeof(b2Joint*));
+		contactCount += parallelIsland->contactCount;
+		jointCount += parallelIsland->jointCount;
 
-				b2Body* other = ce->other;
+		maxIslandBodyCount = b2Max(maxIslandBodyCount, parallelIsland->bodyCount);
+	}
 
-				// Was the other body already added to this island?
-				if (other->m_flags & b2Body::e_islandFlag)
-				{
-					continue;
-				}
+	// Give each static body a single state index. The island flag marks the ones already done.
+	int32 stateCount = maxIslandBodyCount;
+	for (int32 i = 0; i < staticBodyCount; ++i)
+	{
+		b2Body* b = staticBodies[i];
+		if ((b->m_flags & b2Body::e_islandFlag) == 0)
+		{
+			b->m_flags |= b2Body::e_islandFlag;
+			b->m_islandIndex = stateCount++;
+		}
+	}
 
-				b2Assert(stackCount < stackSize);
-				stack[stackCount++] = other;
-				other->m_flags |= b2Body::e_islandFlag;
-			}
+	// Create a stack allocator for each thread other than the calling one.
+	int32 threadCount = m_parallelExecutor->GetThreadCount();
+	if (m_threadStackAllocatorCount < threadCount - 1)
+	{
+		DestroyThreadStackAllocators();
 
-			// Search all joints connect to this body.
-			for (b2JointEdge* je = b->m_jointList; je; je = je->next)
-			{
-				if (je->joint->m_islandFlag == true)
-				{
-					continue;
-				}
+		m_threadStackAllocators = (b2StackAllocator*)b2Alloc((threadCount - 1) * sizeof(b2StackAllocator));
+		for (int32 i = 0; i < threadCount - 1; ++i)
+		{
+			new (m_threadStackAllocators + i) b2StackAllocator();
+		}
+		m_threadStackAllocatorCount = threadCount - 1;
+	}
 
-				b2Body* other = je->other;
+	b2Profile* threadProfiles = (b2Profile*)m_stackAllocator.Allocate(threadCount * sizeof(b2Profile));
+	memset(threadProfiles, 0, threadCount * sizeof(b2Profile));
 
-				// Don't simulate joints connected to inactive bodies.
-				if (other->IsActive() == false)
-				{
-					continue;
-				}
+	// Solve the islands.
+	b2ParallelSolveContext context;
+	context.world = this;
+	context.step = &step;
+	context.islands = islands;
+	context.threadProfiles = threadProfiles;
+	context.stateCount = stateCount;
+	m_parallelExecutor->ParallelFor(&b2World::SolveIslandTask, &context, islandCount, 1);
 
-				island.Add(je->joint);
-				je->joint->m_islandFlag = true;
+	for (int32 i = 0; i < threadCount; ++i)
+	{
+		m_profile.solveInit += threadProfiles[i].solveInit;
+		m_profile.solveVelocity += threadProfiles[i].solveVelocity;
+		m_profile.solvePosition += threadProfiles[i].solvePosition;
+	}
 
-				if (other->m_flags & b2Body::e_islandFlag)
-				{
-					continue;
-				}
+	m_stackAllocator.Free(threadProfiles);
 
-				b2Assert(stackCount < stackSize);
-				stack[stackCount++] = other;
-				other->m_flags |= b2Body::e_islandFlag;
-			}
+	// Finish the islands in order on the calling thread.
+	for (int32 i = 0; i < islandCount; ++i)
+	{
+		b2ParallelIsland* parallelIsland = islands + i;
+
+		// An island's bodies only go to sleep together. The serial solve wakes a
+		// static body when BuildIsland adds it to an island and puts it to sleep
+		// with that island, so a static body shared by several islands takes the
+		// sleep state of the last of them. BuildIsland has already woken it here.
+		bool awake = parallelIsland->bodies[0]->IsAwake();
+		for (int32 j = 0; j < parallelIsland->staticBodyCount; ++j)
+		{
+			b2Body* b = parallelIsland->staticBodies[j];
+			b->SetAwake(awake);
+			b->m_flags &= ~b2Body::e_islandFlag;
 		}
 
-		b2Profile profile;
-		island.Solve(&profile, step, m_gravity, m_allowSleep);
-		m_profile.solveInit += profile.solveInit;
-		m_profile.solveVelocity += profile.solveVelocity;
-		m_profile.solvePosition += profile.solvePosition;
-
-		// Post solve cleanup.
-		for (int32 i = 0; i < island.m_bodyCount; ++i)
+		// Report the buffered impulses.
+		if (listener != NULL)
 		{
-			// Allow static bodies to participate in other islands.
-			b2Body* b = island.m_bodies[i];
-			if (b->GetType() == b2_staticBody)
+			for (int32 j = 0; j < parallelIsland->contactCount; ++j)
 			{
-				b->m_flags &= ~b2Body::e_islandFlag;
+				listener->PostSolve(parallelIsland->contacts[j], parallelIsland->impulses + j);
 			}
 		}
 	}
 
-	m_stackAllocator.Free(stack);
+	m_stackAllocator.Free(impulses);
+	m_stackAllocator.Free(joints);
+	m_stackAllocator.Free(contacts);
+	m_stackAllocator.Free(staticBodies);
+	m_stackAllocator.Free(bodies);
+	m_stackAllocator.Free(islands);
+}
+
+// Solve a batch of the islands found by b2World::SolveParallel.
+void b2World::SolveIslandTask(void* context, int32 startIndex, int32 endIndex, int32 threadIndex)
+{
+	b2ParallelSolveContext* solveContext = (b2ParallelSolveContext*)context;
+	b2World* world = solveContext->world;
+	b2Assert(0 <= threadIndex && threadIndex <= world->m_threadStackAllocatorCount);
 
+	// The calling thread uses the world stack allocator.
+	b2StackAllocator* allocator = threadIndex == 0 ? &world->m_stackAllocator : world->m_threadStackAllocators + (threadIndex - 1);
+	b2Profile* threadProfile = solveContext->threadProfiles + threadIndex;
+
+	for (int32 i = startIndex; i < endIndex; ++i)
 	{
-		b2Timer timer;
-		// Synchronize fixtures, check for out of range bodies.
-		for (b2Body* b = m_bodyList; b; b = b->GetNext())
-		{
-			// If a body was not in an island then it did not move.
-			if ((b->m_flags & b2Body::e_islandFlag) == 0)
-			{
-				continue;
-			}
+		const b2ParallelIsland* parallelIsland = solveContext->islands + i;
 
-			if (b->GetType() == b2_staticBody)
-			{
-				continue;
-			}
+		// The island state holds its own bodies followed by the static bodies.
+		b2Island island(solveContext->stateCount,
+						parallelIsland->contactCount,
+						parallelIsland->jointCount,
+						allocator,
+						NULL);
+		island.m_impulses = parallelIsland->impulses;
 
-			// Update fixtures (for broad-phase).
-			b->SynchronizeFixtures();
+		for (int32 j = 0; j < parallelIsland->bodyCount; ++j)
+		{
+			island.Add(parallelIsland->bodies[j]);
+		}
+		for (int32 j = 0; j < parallelIsland->contactCount; ++j)
+		{
+			island.Add(parallelIsland->contacts[j]);
+		}
+		for (int32 j = 0; j < parallelIsland->jointCount; ++j)
+		{
+			island.Add(parallelIsland->joints[j]);
 		}
 
-		// Look for new contacts.
-		m_contactManager.FindNewContacts();
-		m_profile.broadphase = timer.GetMilliseconds();
+		// Copy the state of the static bodies used by the island. The solver
+		// never moves them so they are not copied back.
+		for (int32 j = 0; j < parallelIsland->staticBodyCount; ++j)
+		{
+			const b2Body* b = parallelIsland->staticBodies[j];
+			int32 index = b->m_islandIndex;
+			island.m_positions[index].c = b->m_sweep.c;
+			island.m_positions[index].a = b->m_sweep.a;
+			island.m_velocities[index].v = b->m_linearVelocity;
+			island.m_velocities[index].w = b->m_angularVelocity;
+		}
+
+		b2Profile profile;
+		island.Solve(&profile, *solveContext->step, world->m_gravity, world->m_allowSleep);
+		threadProfile->solveInit += profile.solveInit;
+		threadProfile->solveVelocity += profile.solveVelocity;
+		threadProfile->solvePosition += profile.solvePosition;
 	}
 }
 
@@ -898,6 +1186,10 @@ void b2World::Step(float32 dt, int32 velocityIterations, int32 positionIteration
 {
 	b2Timer stepTimer;
 
+	m_contactManager.m_narrowphaseTime = 0.0f;
+	m_contactManager.m_pairQueryTime = 0.0f;
+	m_contactManager.m_addPairsTime = 0.0f;
+
 	// If new fixtures were added, we need to find the new contacts.
 	if (m_flags & e_newFixture)
 	{
@@ -959,6 +1251,9 @@ void b2World::Step(float32 dt, int32 velocityIterations, int32 positionIteration
 
 	m_flags &= ~e_locked;
 
+	m_profile.narrowphase = m_contactManager.m_narrowphaseTime;
+	m_profile.pairQuery = m_contactManager.m_pairQueryTime;
+	m_profile.addPairs = m_contactManager.m_addPairsTime;
 	m_profile.step = stepTimer.GetMilliseconds();
 }
 
@@ -33,6 +33,7 @@ struct b2JointDef;
 class b2Body;
 class b2Draw;
 class b2Fixture;
+class b2Island;
 class b2Joint;
 
 /// The world class manages all physics entities, dynamic simulation,
@@ -66,6 +67,16 @@ public:
 	/// by you and must remain in scope.
 	void SetDebugDraw(b2Draw* debugDraw);
 
+	/// Register an executor used to solve independent islands, update contact manifolds
+	/// and query the broad-phase in parallel. Pass NULL to do everything serially on the
+	/// calling thread. The results are exactly the same as the serial ones and all the
+	/// listener callbacks are still made on the calling thread in the serial order, except
+	/// that PostSolve callbacks are made once all the islands are solved.
+	void SetParallelExecutor(b2ParallelExecutor* executor);
+
+	/// Get the executor used to solve islands in parallel.
+	b2ParallelExecutor* GetParallelExecutor() const { return m_parallelExecutor; }
+
 	/// Create a rigid body given a definition. No reference to the definition
 	/// is retained.
 	/// @warning This function is locked during callbacks.
@@ -225,8 +236,13 @@ private:
 	friend class b2Controller;
 
 	void Solve(const b2TimeStep& step);
+	void SolveParallel(const b2TimeStep& step, b2Island* island, b2Body** stack);
 	void SolveTOI(const b2TimeStep& step);
 
+	void BuildIsland(b2Body* seed, b2Body** stack, b2Island* island);
+	static void SolveIslandTask(void* context, int32 startIndex, int32 endIndex, int32 threadIndex);
+	void DestroyThreadStackAllocators();
+
 	void DrawJoint(b2Joint* joint);
 	void DrawShape(b2Fixture* shape, const b2Transform& xf, const b2Color& color);
 
@@ -249,6 +265,11 @@ private:
 	b2DestructionListener* m_destructionListener;
 	b2Draw* m_debugDraw;
 
+	// Islands are solved in parallel with a stack allocator for each thread other than the calling one.
+	b2ParallelExecutor* m_parallelExecutor;
+	b2StackAllocator* m_threadStackAllocators;
+	int32 m_threadStackAllocatorCount;
+
 	// This is used to compute the time step ratio to
 	// support a variable time step.
 	float32 m_inv_dt0;
@@ -0,0 +1,272 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "assets/assetAsyncLoader.h"
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+#ifndef _FRAMEALLOCATOR_H_
+#include "memory/frameAllocator.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+void AssetAsyncLoader::WorkerThread::run( void* arg )
+{
+    mpAsyncLoader->processRequests();
+
+    // Release the frame allocator arena for reuse.
+    FrameAllocator::releaseThreadArena();
+}
+
+//-----------------------------------------------------------------------------
+
+AssetAsyncLoader::AssetAsyncLoader() :
+    mWakeSemaphore( 0 ),
+    mShutdown( false )
+{
+    VECTOR_SET_ASSOCIATION( mWorkers );
+    VECTOR_SET_ASSOCIATION( mWorkerQueue );
+}
+
+//-----------------------------------------------------------------------------
+
+AssetAsyncLoader::~AssetAsyncLoader()
+{
+    // Stop the workers.
+    stop();
+}
+
+//-----------------------------------------------------------------------------
+
+U32 AssetAsyncLoader::getDefaultWorkerCount( void )
+{
+    // Use the same workers as the thread pool would, up to our maximum.
+    return getMin( ThreadPool::getDefaultWorkerCount(), (U32)MaxWorkerCount );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetAsyncLoader::start( const U32 workerCount )
+{
+    // Stop any existing workers.
+    stop();
+
+    // Start the workers.
+    const U32 newWorkerCount = getMin( workerCount, (U32)MaxWorkerCount );
+    for ( U32 n = 0; n < newWorkerCount; ++n )
+    {
+        WorkerThread* pWorker = new WorkerThread( this );
+        mWorkers.push_back( pWorker );
+        pWorker->start();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetAsyncLoader::stop( void )
+{
+    // Finish if no workers.
+    if ( mWorkers.size() == 0 )
+        return;
+
+    // Wake all the workers with the shutdown flag set.
+    mShutdown = true;
+    for ( U32 n = 0; n < getWorkerCount(); ++n )
+        mWakeSemaphore.release();
+
+    // Wait for the workers to finish.
+    for ( U32 n = 0; n < getWorkerCount(); ++n )
+    {
+        mWorkers[n]->join();
+        delete mWorkers[n];
+    }
+
+    mWorkers.clear();
+    mShutdown = false;
+
+    // Any requests still queued are prefetched without any files.
+    mMutex.lock();
+    for ( U32 n = 0; n < (U32)mWorkerQueue.size(); ++n )
+        mWorkerQueue[n]->mState = AssetAsyncRequest::Prefetched;
+    mWorkerQueue.clear();
+    mMutex.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetAsyncLoader::queueRequest( AssetAsyncRequest* pRequest )
+{
+    // Sanity!
+    AssertFatal( pRequest != NULL, "AssetAsyncLoader::queueRequest() - Cannot queue a NULL request." );
+    AssertFatal( pRequest->mPrefetchFiles.size() == pRequest->mPrefetchBitmaps.size(), "AssetAsyncLoader::queueRequest() - Prefetch bitmaps must be sized to the prefetch files." );
+
+    // Is there anything to prefetch?
+    if ( mWorkers.size() == 0 || pRequest->mPrefetchFiles.size() == 0 )
+    {
+        // No, so the request is ready immediately.
+        pRequest->mState = AssetAsyncRequest::Prefetched;
+        return;
+    }
+
+    // Queue the request.
+    mMutex.lock();
+    pRequest->mState = AssetAsyncRequest::Queued;
+    mWorkerQueue.push_back( pRequest );
+    mMutex.unlock();
+
+    // Wake a worker.
+    mWakeSemaphore.release();
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetAsyncLoader::dequeueRequest( AssetAsyncRequest* pRequest )
+{
+    mMutex.lock();
+
+    // Remove the request if no worker has started it.
+    bool dequeued = pRequest->mState == AssetAsyncRequest::Prefetched;
+    for ( U32 n = 0; n < (U32)mWorkerQueue.size(); ++n )
+    {
+        if ( mWorkerQueue[n] == pRequest )
+        {
+            mWorkerQueue.erase( n );
+            dequeued = true;
+            break;
+        }
+    }
+
+    mMutex.unlock();
+
+    // The request is still being prefetched if it was not dequeued.
+    return dequeued;
+}
+
+//-----------------------------------------------------------------------------
+
+AssetAsyncRequest::RequestState AssetAsyncLoader::getRequestState( AssetAsyncRequest* pRequest )
+{
+    mMutex.lock();
+    const AssetAsyncRequest::RequestState requestState = pRequest->mState;
+    mMutex.unlock();
+
+    return requestState;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetAsyncLoader::canPrefetchFile( StringTableEntry looseFile )
+{
+    // Fetch the extension.
+    const char* pExtension = dStrrchr( looseFile, '.' );
+
+    // Finish if no extension.
+    if ( pExtension == NULL )
+        return false;
+
+#ifndef USE_APPLE_OPTIMIZED_PNGS
+    // PNG images.
+    if ( dStricmp( pExtension, ".png" ) == 0 )
+        return true;
+#endif
+
+    // JPEG images.
+    return dStricmp( pExtension, ".jpg" ) == 0 || dStricmp( pExtension, ".jpeg" ) == 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetAsyncLoader::processRequests( void )
+{
+    while( true )
+    {
+        // Wait for a request.
+        mWakeSemaphore.acquire();
+
+        // Finish if shutting down.
+        if ( mShutdown )
+            return;
+
+        // Fetch the next request.
+        mMutex.lock();
+
+        // Finish if the request was dequeued.
+        if ( mWorkerQueue.size() == 0 )
+        {
+            mMutex.unlock();
+            continue;
+        }
+
+        AssetAsyncRequest* pRequest = mWorkerQueue.front();
+        mWorkerQueue.pop_front();
+        pRequest->mState = AssetAsyncRequest::Prefetching;
+        mMutex.unlock();
+
+        // Decode the files.
+        // NOTE:- The files and bitmaps are not touched by the main thread until prefetched.
+        for ( U32 n = 0; n < (U32)pRequest->mPrefetchFiles.size(); ++n )
+        {
+            pRequest->mPrefetchBitmaps[n] = decodeBitmap( pRequest->mPrefetchFiles[n] );
+        }
+
+        // Decoding must release its frame allocations.
+        FrameAllocator::endThreadFrame();
+
+        // Flag as prefetched.
+        mMutex.lock();
+        pRequest->mState = AssetAsyncRequest::Prefetched;
+        mMutex.unlock();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+GBitmap* AssetAsyncLoader::decodeBitmap( StringTableEntry bitmapFile )
+{
+    // Open the file.
+    FileStream stream;
+    if ( !stream.open( bitmapFile, FileStream::Read ) )
+        return NULL;
+
+    // Decode the bitmap.
+    const char* pExtension = dStrrchr( bitmapFile, '.' );
+    ResourceInstance* pBitmap = NULL;
+    if ( dStricmp( pExtension, ".png" ) == 0 )
+        pBitmap = constructBitmapPNG( stream );
+    else
+        pBitmap = constructBitmapJPEG( stream );
+
+    stream.close();
+
+    return (GBitmap*)pBitmap;
+}
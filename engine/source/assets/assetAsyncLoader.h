@@ -0,0 +1,141 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ASSET_ASYNC_LOADER_H_
+#define _ASSET_ASYNC_LOADER_H_
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+class GBitmap;
+
+//-----------------------------------------------------------------------------
+
+/// An asynchronous asset acquisition request.
+struct AssetAsyncRequest
+{
+    enum RequestState
+    {
+        /// Waiting for a worker.
+        Queued,
+
+        /// Files are being decoded by a worker.
+        Prefetching,
+
+        /// Ready to be acquired on the main thread.
+        Prefetched,
+    };
+
+    AssetAsyncRequest() :
+        mRequestId( 0 ),
+        mAssetId( StringTable->EmptyString ),
+        mCallbackObjectId( 0 ),
+        mState( Queued ),
+        mCancelled( false )
+    {
+    }
+
+    U32                         mRequestId;
+    StringTableEntry            mAssetId;
+    SimObjectId                 mCallbackObjectId;
+    RequestState                mState;
+    bool                        mCancelled;
+
+    /// Files decoded by a worker and their decoded bitmaps (NULL if decoding failed).
+    Vector<StringTableEntry>    mPrefetchFiles;
+    Vector<GBitmap*>            mPrefetchBitmaps;
+};
+
+//-----------------------------------------------------------------------------
+
+/// Decodes the files used by asynchronous asset acquisitions on worker threads.
+///
+/// Requests are queued from the main thread and are prefetched by the workers in order.
+/// Only files that can safely be decoded away from the main thread are prefetched (PNG
+/// and JPEG images).  Reading the asset itself, registering its objects and uploading
+/// its textures still happens on the main thread when the request is acquired however
+/// this then uses the prefetched bitmaps rather than reading and decoding the files.
+///
+/// The request state is guarded by the loader so "getRequestState()" must be used
+/// to check it from the main thread.
+class AssetAsyncLoader
+{
+public:
+    /// The maximum number of worker threads.
+    enum { MaxWorkerCount = 4 };
+
+private:
+    class WorkerThread : public Thread
+    {
+    public:
+        WorkerThread( AssetAsyncLoader* pAsyncLoader ) :
+            Thread( 0, 0, false ),
+            mpAsyncLoader( pAsyncLoader )
+        {
+        }
+
+        virtual void run( void* arg = 0 );
+
+    private:
+        AssetAsyncLoader*   mpAsyncLoader;
+    };
+
+    Vector<WorkerThread*>       mWorkers;
+    Vector<AssetAsyncRequest*>  mWorkerQueue;
+    Mutex                       mMutex;
+    Semaphore                   mWakeSemaphore;
+    volatile bool               mShutdown;
+
+    void                        processRequests( void );
+    static GBitmap*             decodeBitmap( StringTableEntry bitmapFile );
+
+public:
+    AssetAsyncLoader();
+    ~AssetAsyncLoader();
+
+    /// Worker control.
+    void                        start( const U32 workerCount );
+    void                        stop( void );
+    inline U32                  getWorkerCount( void ) const                { return (U32)mWorkers.size(); }
+    static U32                  getDefaultWorkerCount( void );
+
+    /// Requests.
+    void                        queueRequest( AssetAsyncRequest* pRequest );
+
+    /// Removes a request that no worker has started.  Returns false if a worker is still prefetching it.
+    bool                        dequeueRequest( AssetAsyncRequest* pRequest );
+    AssetAsyncRequest::RequestState getRequestState( AssetAsyncRequest* pRequest );
+    static bool                 canPrefetchFile( StringTableEntry looseFile );
+};
+
+#endif // _ASSET_ASYNC_LOADER_H_
@@ -0,0 +1,248 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "assets/assetDeclarationCache.h"
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+// Debug Profiling.
+#include "debug/profiler.h"
+
+//-----------------------------------------------------------------------------
+
+#define ASSET_DECLARATION_CACHE_SIGNATURE       "AssetDeclarationCache"
+#define ASSET_DECLARATION_CACHE_VERSION         1
+#define ASSET_DECLARATION_CACHE_MAX_STRING      4095
+
+//-----------------------------------------------------------------------------
+
+static StringTableEntry readCacheString( Stream& stream )
+{
+    char stringBuffer[ASSET_DECLARATION_CACHE_MAX_STRING+1];
+    stream.readLongString( ASSET_DECLARATION_CACHE_MAX_STRING, stringBuffer );
+    return stream.getStatus() == Stream::Ok ? StringTable->insert( stringBuffer ) : StringTable->EmptyString;
+}
+
+//-----------------------------------------------------------------------------
+
+static void readCacheStrings( Stream& stream, Vector<StringTableEntry>& strings )
+{
+    U32 stringCount = 0;
+    stream.read( &stringCount );
+    for ( U32 index = 0; index < stringCount && stream.getStatus() == Stream::Ok; ++index )
+    {
+        strings.push_back( readCacheString( stream ) );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void writeCacheStrings( Stream& stream, const Vector<StringTableEntry>& strings )
+{
+    stream.write( (U32)strings.size() );
+    for ( Vector<StringTableEntry>::const_iterator itr = strings.begin(); itr != strings.end(); ++itr )
+    {
+        stream.writeLongString( ASSET_DECLARATION_CACHE_MAX_STRING, *itr );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetDeclarationCache::load( const char* pCacheFile )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetDeclarationCache_Load);
+
+    // Sanity!
+    AssertFatal( pCacheFile != NULL, "Cannot load asset declaration cache from a NULL file." );
+
+    // Clear any existing declarations.
+    clear();
+
+    FileStream stream;
+
+    // Finish if the cache doesn't exist yet.
+    if ( !Platform::isFile( pCacheFile ) || !stream.open( pCacheFile, FileStream::Read ) )
+        return false;
+
+    // Read the signature and version.
+    StringTableEntry signature = stream.readSTString();
+    U32 versionId = 0;
+    stream.read( &versionId );
+
+    // Is the cache valid?
+    if ( signature != StringTable->insert( ASSET_DECLARATION_CACHE_SIGNATURE ) || versionId != ASSET_DECLARATION_CACHE_VERSION )
+    {
+        // No, so warn.
+        Con::warnf( "Asset Manager: Ignoring asset declaration cache '%s' as it is not a supported version.", pCacheFile );
+        return false;
+    }
+
+    // Read declaration count.
+    U32 declarationCount = 0;
+    stream.read( &declarationCount );
+
+    // Read declarations.
+    for ( U32 index = 0; index < declarationCount && stream.getStatus() == Stream::Ok; ++index )
+    {
+        AssetDeclaration* pDeclaration = new AssetDeclaration();
+        pDeclaration->mAssetFile = readCacheString( stream );
+        stream.read( &pDeclaration->mFileSize );
+        stream.read( sizeof(pDeclaration->mModifyTime), &pDeclaration->mModifyTime );
+        pDeclaration->mAssetType = readCacheString( stream );
+        pDeclaration->mAssetName = readCacheString( stream );
+        pDeclaration->mAssetDescription = readCacheString( stream );
+        pDeclaration->mAssetCategory = readCacheString( stream );
+        stream.read( &pDeclaration->mAssetAutoUnload );
+        stream.read( &pDeclaration->mAssetInternal );
+        readCacheStrings( stream, pDeclaration->mAssetDependencies );
+        readCacheStrings( stream, pDeclaration->mAssetLooseFiles );
+
+        // Was the declaration read?
+        if ( stream.getStatus() != Stream::Ok )
+        {
+            // No, so warn.
+            Con::warnf( "Asset Manager: Ignoring asset declaration cache '%s' as it is corrupt.", pCacheFile );
+            delete pDeclaration;
+            clear();
+            return false;
+        }
+
+        // Store the declaration.
+        typeDeclarationHash::iterator declarationItr = mDeclarations.find( pDeclaration->mAssetFile );
+        if ( declarationItr != mDeclarations.end() )
+        {
+            delete declarationItr->value;
+            mDeclarations.erase( declarationItr );
+        }
+        mDeclarations.insert( pDeclaration->mAssetFile, pDeclaration );
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetDeclarationCache::save( const char* pCacheFile )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetDeclarationCache_Save);
+
+    // Sanity!
+    AssertFatal( pCacheFile != NULL, "Cannot save asset declaration cache to a NULL file." );
+
+    FileStream stream;
+
+    // Open the cache for write.
+    if ( !stream.open( pCacheFile, FileStream::Write ) )
+    {
+        // Warn.
+        Con::warnf( "Asset Manager: Could not open asset declaration cache '%s' for write.", pCacheFile );
+        return false;
+    }
+
+    // Write the signature and version.
+    stream.writeString( ASSET_DECLARATION_CACHE_SIGNATURE );
+    stream.write( (U32)ASSET_DECLARATION_CACHE_VERSION );
+
+    // Write declaration count.
+    stream.write( (U32)mDeclarations.size() );
+
+    // Write declarations.
+    for ( typeDeclarationHash::iterator declarationItr = mDeclarations.begin(); declarationItr != mDeclarations.end(); ++declarationItr )
+    {
+        const AssetDeclaration* pDeclaration = declarationItr->value;
+        stream.writeLongString( ASSET_DECLARATION_CACHE_MAX_STRING, pDeclaration->mAssetFile );
+        stream.write( pDeclaration->mFileSize );
+        stream.write( sizeof(pDeclaration->mModifyTime), &pDeclaration->mModifyTime );
+        stream.writeLongString( ASSET_DECLARATION_CACHE_MAX_STRING, pDeclaration->mAssetType );
+        stream.writeLongString( ASSET_DECLARATION_CACHE_MAX_STRING, pDeclaration->mAssetName );
+        stream.writeLongString( ASSET_DECLARATION_CACHE_MAX_STRING, pDeclaration->mAssetDescription );
+        stream.writeLongString( ASSET_DECLARATION_CACHE_MAX_STRING, pDeclaration->mAssetCategory );
+        stream.write( pDeclaration->mAssetAutoUnload );
+        stream.write( pDeclaration->mAssetInternal );
+        writeCacheStrings( stream, pDeclaration->mAssetDependencies );
+        writeCacheStrings( stream, pDeclaration->mAssetLooseFiles );
+    }
+
+    stream.close();
+
+    // Flag as clean.
+    mDirty = false;
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetDeclarationCache::clear( void )
+{
+    // Delete the declarations.
+    for ( typeDeclarationHash::iterator declarationItr = mDeclarations.begin(); declarationItr != mDeclarations.end(); ++declarationItr )
+    {
+        delete declarationItr->value;
+    }
+
+    mDeclarations.clear();
+    mDirty = false;
+}
+
+//-----------------------------------------------------------------------------
+
+const AssetDeclaration* AssetDeclarationCache::findDeclaration( StringTableEntry assetFile, const U32 fileSize, const FileTime& modifyTime ) const
+{
+    // Find the declaration.
+    typeDeclarationHash::const_iterator declarationItr = mDeclarations.find( assetFile );
+
+    // Finish if not found.
+    if ( declarationItr == mDeclarations.end() )
+        return NULL;
+
+    // Fetch declaration.
+    const AssetDeclaration* pDeclaration = declarationItr->value;
+
+    // Only use the declaration if the asset file is unchanged.
+    return pDeclaration->mFileSize == fileSize && Platform::compareFileTimes( pDeclaration->mModifyTime, modifyTime ) == 0 ? pDeclaration : NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetDeclarationCache::storeDeclaration( const AssetDeclaration& declaration )
+{
+    // Find any existing declaration.
+    typeDeclarationHash::iterator declarationItr = mDeclarations.find( declaration.mAssetFile );
+
+    // Update the existing declaration or add a new one.
+    if ( declarationItr != mDeclarations.end() )
+        *declarationItr->value = declaration;
+    else
+        mDeclarations.insert( declaration.mAssetFile, new AssetDeclaration( declaration ) );
+
+    // Flag as dirty.
+    mDirty = true;
+}
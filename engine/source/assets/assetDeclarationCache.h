@@ -0,0 +1,104 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _ASSET_DECLARATION_CACHE_H_
+#define _ASSET_DECLARATION_CACHE_H_
+
+#ifndef _STRINGTABLE_H_
+#include "string/stringTable.h"
+#endif
+
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// An asset declaration parsed from an asset file along with the state of the file when it was parsed.
+struct AssetDeclaration
+{
+    AssetDeclaration() { reset(); }
+
+    void reset( void )
+    {
+        mAssetFile = StringTable->EmptyString;
+        mFileSize = 0;
+        dMemset( &mModifyTime, 0, sizeof(mModifyTime) );
+        mAssetType = StringTable->EmptyString;
+        mAssetName = StringTable->EmptyString;
+        mAssetDescription = StringTable->EmptyString;
+        mAssetCategory = StringTable->EmptyString;
+        mAssetAutoUnload = true;
+        mAssetInternal = false;
+        mAssetDependencies.clear();
+        mAssetLooseFiles.clear();
+    }
+
+    StringTableEntry            mAssetFile;
+    U32                         mFileSize;
+    FileTime                    mModifyTime;
+    StringTableEntry            mAssetType;
+    StringTableEntry            mAssetName;
+    StringTableEntry            mAssetDescription;
+    StringTableEntry            mAssetCategory;
+    bool                        mAssetAutoUnload;
+    bool                        mAssetInternal;
+    Vector<StringTableEntry>    mAssetDependencies;
+    Vector<StringTableEntry>    mAssetLooseFiles;
+};
+
+//-----------------------------------------------------------------------------
+
+/// A persistent cache of asset declarations keyed by the asset file size and modification time.
+///
+/// Declarations found in the cache do not need their asset file parsing again.  The cache
+/// is only read whilst scanning so it can safely be searched from multiple threads however
+/// it must only be modified from the main thread.
+class AssetDeclarationCache
+{
+private:
+    typedef HashMap<StringTableEntry, AssetDeclaration*> typeDeclarationHash;
+
+    typeDeclarationHash     mDeclarations;
+    bool                    mDirty;
+
+public:
+    AssetDeclarationCache() : mDirty( false ) {}
+    ~AssetDeclarationCache() { clear(); }
+
+    /// Persistence.
+    bool                    load( const char* pCacheFile );
+    bool                    save( const char* pCacheFile );
+    void                    clear( void );
+    inline bool             isDirty( void ) const                       { return mDirty; }
+    inline U32              getDeclarationCount( void ) const           { return (U32)mDeclarations.size(); }
+
+    /// Returns the declaration for the asset file if it has not changed since it was stored, NULL otherwise.
+    const AssetDeclaration* findDeclaration( StringTableEntry assetFile, const U32 fileSize, const FileTime& modifyTime ) const;
+    void                    storeDeclaration( const AssetDeclaration& declaration );
+};
+
+#endif // _ASSET_DECLARATION_CACHE_H_
@@ -54,6 +54,18 @@
 #include "console/consoleTypes.h"
 #endif
 
+#ifndef _ASSET_ASYNC_LOADER_H_
+#include "assets/assetAsyncLoader.h"
+#endif
+
+#ifndef _TEXTURE_MANAGER_H_
+#include "graphics/TextureManager.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
 // Script bindings.
 #include "assetManager_ScriptBinding.h"
 
@@ -67,17 +79,217 @@ AssetManager AssetDatabase;
 
 //-----------------------------------------------------------------------------
 
+// Platform directory walks and file reads are only known to be safe away from the main thread on these platforms.
+#if defined(TORQUE_OS_WIN32) || defined(TORQUE_OS_OSX) || defined(TORQUE_OS_LINUX) || defined(TORQUE_OS_IOS)
+#define ASSET_MANAGER_PARALLEL_SCAN
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A location scanned for declared assets.
+struct DeclaredAssetsScanLocation
+{
+    DeclaredAssetsScanLocation() :
+        mExtension( StringTable->EmptyString ),
+        mRecurse( false ),
+        mValid( false )
+    {
+        mPath[0] = 0;
+    }
+
+    char                        mPath[1024];
+    StringTableEntry            mExtension;
+    bool                        mRecurse;
+    bool                        mValid;
+    Vector<Platform::FileInfo>  mFiles;
+};
+
+//-----------------------------------------------------------------------------
+
+/// An asset file found whilst scanning for declared assets.
+struct DeclaredAssetsScanFile
+{
+    DeclaredAssetsScanFile() :
+        mParsed( false ),
+        mCached( false )
+    {
+    }
+
+    AssetDeclaration            mDeclaration;
+    bool                        mParsed;
+    bool                        mCached;
+};
+
+//-----------------------------------------------------------------------------
+
+struct DeclaredAssetsScanJob
+{
+    Vector<DeclaredAssetsScanLocation>* mpLocations;
+    Vector<DeclaredAssetsScanFile>*     mpFiles;
+    const AssetDeclarationCache*        mpDeclarationCache;
+    Taml*                               mpTaml;
+};
+
+//-----------------------------------------------------------------------------
+
+static void runDeclaredAssetsScanJob( ThreadPool::JobFunction pJobFunction, DeclaredAssetsScanJob* pScanJob, const U32 itemCount )
+{
+#ifdef ASSET_MANAGER_PARALLEL_SCAN
+    // Use the thread pool if available.
+    if ( ThreadPool::Instance != NULL )
+    {
+        ThreadPool::Instance->parallelFor( pJobFunction, pScanJob, itemCount, 1 );
+        return;
+    }
+#endif
+
+    // Process everything on this thread.
+    pJobFunction( pScanJob, 0, itemCount, 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK declaredAssetsFileSort( const void* a, const void* b )
+{
+    const Platform::FileInfo* pFileInfoA = (const Platform::FileInfo*)a;
+    const Platform::FileInfo* pFileInfoB = (const Platform::FileInfo*)b;
+
+    const S32 pathOrder = dStrcmp( pFileInfoA->pFullPath, pFileInfoB->pFullPath );
+    return pathOrder != 0 ? pathOrder : dStrcmp( pFileInfoA->pFileName, pFileInfoB->pFileName );
+}
+
+//-----------------------------------------------------------------------------
+
+static void declaredAssetsWalkJob( void* pContext, const U32 startIndex, const U32 endIndex, const U32 threadIndex )
+{
+    // Fetch scan job.
+    DeclaredAssetsScanJob* pScanJob = (DeclaredAssetsScanJob*)pContext;
+
+    for ( U32 index = startIndex; index < endIndex; ++index )
+    {
+        // Fetch location.
+        DeclaredAssetsScanLocation& location = (*pScanJob->mpLocations)[index];
+
+        // Skip if not valid.
+        if ( !location.mValid )
+            continue;
+
+        // Find files.
+        Vector<Platform::FileInfo> files;
+        if ( !Platform::dumpPath( location.mPath, files, location.mRecurse ? -1 : 0 ) )
+        {
+            location.mValid = false;
+            continue;
+        }
+
+        // Fetch extension length.
+        const U32 extensionLength = dStrlen( location.mExtension );
+
+        // Keep files with the extension.
+        for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
+        {
+            // Find filename length.
+            const U32 filenameLength = dStrlen( fileItr->pFileName );
+
+            // Skip if extension is longer than filename.
+            if ( extensionLength > filenameLength )
+                continue;
+
+            // Skip if extension not found.
+            if ( dStricmp( fileItr->pFileName + filenameLength - extensionLength, location.mExtension ) != 0 )
+                continue;
+
+            location.mFiles.push_back( *fileItr );
+        }
+
+        // Sort the files so they are always added in the same order.
+        dQsort( location.mFiles.address(), location.mFiles.size(), sizeof(Platform::FileInfo), declaredAssetsFileSort );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void declaredAssetsParseJob( void* pContext, const U32 startIndex, const U32 endIndex, const U32 threadIndex )
+{
+    // Fetch scan job.
+    DeclaredAssetsScanJob* pScanJob = (DeclaredAssetsScanJob*)pContext;
+
+    TamlAssetDeclaredVisitor assetDeclaredVisitor;
+
+    for ( U32 index = startIndex; index < endIndex; ++index )
+    {
+        // Fetch file.
+        DeclaredAssetsScanFile& scanFile = (*pScanJob->mpFiles)[index];
+        AssetDeclaration& declaration = scanFile.mDeclaration;
+
+        // Fetch the modification time.
+        FileTime modifyTime;
+        dMemset( &modifyTime, 0, sizeof(modifyTime) );
+        Platform::getFileTimes( declaration.mAssetFile, NULL, &modifyTime );
+
+        // Is the declaration cached?
+        const AssetDeclaration* pCachedDeclaration = pScanJob->mpDeclarationCache != NULL ? pScanJob->mpDeclarationCache->findDeclaration( declaration.mAssetFile, declaration.mFileSize, modifyTime ) : NULL;
+        if ( pCachedDeclaration != NULL )
+        {
+            // Yes, so use it.
+            declaration = *pCachedDeclaration;
+            scanFile.mParsed = true;
+            scanFile.mCached = true;
+            continue;
+        }
+
+        // Clear declared assets.
+        assetDeclaredVisitor.clear();
+
+        // Parse the filename.
+        // NOTE:- Parsing does not modify the Taml object so it can be shared.
+        if ( !pScanJob->mpTaml->parse( declaration.mAssetFile, assetDeclaredVisitor ) )
+            continue;
+
+        // Fetch asset definition.
+        const AssetDefinition& foundAssetDefinition = assetDeclaredVisitor.getAssetDefinition();
+
+        // Store the declaration.
+        declaration.mModifyTime = modifyTime;
+        declaration.mAssetType = foundAssetDefinition.mAssetType;
+        declaration.mAssetName = foundAssetDefinition.mAssetName;
+        declaration.mAssetDescription = foundAssetDefinition.mAssetDescription;
+        declaration.mAssetCategory = foundAssetDefinition.mAssetCategory;
+        declaration.mAssetAutoUnload = foundAssetDefinition.mAssetAutoUnload;
+        declaration.mAssetInternal = foundAssetDefinition.mAssetInternal;
+        declaration.mAssetDependencies = assetDeclaredVisitor.getAssetDependencies();
+        declaration.mAssetLooseFiles = assetDeclaredVisitor.getAssetLooseFiles();
+        scanFile.mParsed = true;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 AssetManager::AssetManager() :
+    mpAsyncLoader( NULL ),
+    mAsyncRequestIdSource( 0 ),
+    mAsyncAcquireBudget( 4.0f ),
+    mAsyncBatchCount( 0 ),
+    mAsyncRequestedCount( 0 ),
+    mAsyncAcquiredCount( 0 ),
+    mAsyncFailedCount( 0 ),
+    mAsyncPrefetchedFileCount( 0 ),
+    mDeclarationCacheEnabled( true ),
+    mDeclarationCacheLoaded( false ),
+    mDeclarationCacheFile( StringTable->EmptyString ),
+    mDeclarationParsedCount( 0 ),
+    mDeclarationCachedCount( 0 ),
+    mEchoInfo( false ),
+    mIgnoreAutoUnload( false ),
     mLoadedInternalAssetsCount( 0 ),
     mLoadedExternalAssetsCount( 0 ),
     mLoadedPrivateAssetsCount( 0 ),
+    mAcquiredReferenceCount( 0 ),
     mMaxLoadedInternalAssetsCount( 0 ),
     mMaxLoadedExternalAssetsCount( 0 ),
-    mMaxLoadedPrivateAssetsCount( 0 ),
-    mAcquiredReferenceCount( 0 ),
-    mEchoInfo( false ),
-    mIgnoreAutoUnload( false )
+    mMaxLoadedPrivateAssetsCount( 0 )
 {
+    VECTOR_SET_ASSOCIATION( mAsyncRequests );
 }
 
 //-----------------------------------------------------------------------------
@@ -95,6 +307,12 @@ bool AssetManager::onAdd()
 
 void AssetManager::onRemove()
 {
+    // Clear any asynchronous acquisitions.
+    clearAsyncRequests();
+
+    // Save any new asset declarations.
+    saveDeclarationCache();
+
     // Do we have an asset tags manifest?
     if ( !mAssetTagsManifest.isNull() )
     {
@@ -115,6 +333,9 @@ void AssetManager::initPersistFields()
 
     addField( "EchoInfo", TypeBool, Offset(mEchoInfo, AssetManager), "Whether the asset manager echos extra information to the console or not." );
     addField( "IgnoreAutoUnload", TypeBool, Offset(mIgnoreAutoUnload, AssetManager), "Whether the asset manager should ignore unloading of auto-unload assets or not." );
+    addField( "AsyncAcquireBudget", TypeF32, Offset(mAsyncAcquireBudget, AssetManager), "The time (in milliseconds) spent each frame acquiring asynchronously acquired assets.  At least one asset is always acquired each frame." );
+    addField( "DeclarationCache", TypeBool, Offset(mDeclarationCacheEnabled, AssetManager), "Whether asset declarations are cached on disk so unchanged asset files are not parsed again or not." );
+    addField( "DeclarationCacheFile", TypeString, Offset(mDeclarationCacheFile, AssetManager), "The file used to cache asset declarations.  If empty then a file in the preferences path is used." );
 }
 
 //-----------------------------------------------------------------------------
@@ -162,6 +383,9 @@ bool AssetManager::addModuleDeclaredAssets( ModuleDefinition* pModuleDefinition
     // Debug Profiling.
     PROFILE_SCOPE(AssetManager_AddDeclaredAssets);
 
+    // Memory Tracking.
+    Memory::TagScope memoryTagScope( "Assets" );
+
     // Sanity!
     AssertFatal( pModuleDefinition != NULL, "Cannot add declared assets using a NULL module definition" );
 
@@ -174,6 +398,7 @@ bool AssetManager::addModuleDeclaredAssets( ModuleDefinition* pModuleDefinition
     }
 
     // Iterate the module definition children.
+    Vector<DeclaredAssetsScanLocation> locations;
     for( SimSet::iterator itr = pModuleDefinition->begin(); itr != pModuleDefinition->end(); ++itr )
     {
         // Fetch the declared assets.
@@ -184,16 +409,29 @@ bool AssetManager::addModuleDeclaredAssets( ModuleDefinition* pModuleDefinition
             continue;
 
         // Expand asset manifest location.
-        char filePathBuffer[1024];
-        dSprintf( filePathBuffer, sizeof(filePathBuffer), "%s/%s", pModuleDefinition->getModulePath(), pDeclaredAssets->getPath() );
+        locations.increment();
+        DeclaredAssetsScanLocation& location = locations.last();
+        dSprintf( location.mPath, sizeof(location.mPath), "%s/%s", pModuleDefinition->getModulePath(), pDeclaredAssets->getPath() );
+        location.mExtension = StringTable->insert( pDeclaredAssets->getExtension() );
+        location.mRecurse = pDeclaredAssets->getRecurse();
+    }
 
-        // Scan declared assets at location.
-        if ( !scanDeclaredAssets( filePathBuffer, pDeclaredAssets->getExtension(), pDeclaredAssets->getRecurse(), pModuleDefinition ) )
-        {
-            // Warn.
-            Con::warnf( "AssetManager::addModuleDeclaredAssets() - Could not scan for declared assets at location '%s' with extension '%s'.", filePathBuffer, pDeclaredAssets->getExtension() );
-        }
-    }  
+    // Finish if there are no declared assets locations.
+    if ( locations.size() == 0 )
+        return true;
+
+    // Scan all the declared assets locations together.
+    scanDeclaredAssetLocations( locations, pModuleDefinition );
+
+    for ( Vector<DeclaredAssetsScanLocation>::iterator locationItr = locations.begin(); locationItr != locations.end(); ++locationItr )
+    {
+        // Skip if the location was scanned.
+        if ( locationItr->mValid )
+            continue;
+
+        // Warn.
+        Con::warnf( "AssetManager::addModuleDeclaredAssets() - Could not scan for declared assets at location '%s' with extension '%s'.", locationItr->mPath, locationItr->mExtension );
+    }
 
     return true;
 }
@@ -961,6 +1199,184 @@ bool AssetManager::releaseAsset( const char* pAssetId )
 
 //-----------------------------------------------------------------------------
 
+U32 AssetManager::acquireAssetAsync( const char* pAssetId, SimObject* pCallbackObject )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_AcquireAssetAsync);
+
+    // Sanity!
+    AssertFatal( pAssetId != NULL, "Cannot acquire NULL asset Id." );
+
+    // Find asset.
+    AssetDefinition* pAssetDefinition = findAsset( pAssetId );
+
+    // Did we find the asset?
+    if ( pAssetDefinition == NULL )
+    {
+        // No, so warn.
+        Con::warnf( "Asset Manager: Failed to asynchronously acquire asset Id '%s' as it does not exist.", pAssetId );
+        return 0;
+    }
+
+    // Create the asynchronous loader if required.
+    if ( mpAsyncLoader == NULL )
+    {
+        mpAsyncLoader = new AssetAsyncLoader();
+        mpAsyncLoader->start( AssetAsyncLoader::getDefaultWorkerCount() );
+    }
+
+    // Start a new batch if nothing is pending.
+    if ( mAsyncRequests.size() == 0 )
+        mAsyncBatchCount = 0;
+
+    // Create the request.
+    AssetAsyncRequest* pRequest = new AssetAsyncRequest();
+    pRequest->mRequestId = ++mAsyncRequestIdSource;
+    pRequest->mAssetId = pAssetDefinition->mAssetId;
+    pRequest->mCallbackObjectId = pCallbackObject != NULL ? pCallbackObject->getId() : 0;
+
+    // Gather the files to prefetch for the asset and its dependencies.
+    Vector<StringTableEntry> visitedAssets;
+    gatherAsyncPrefetchFiles( pAssetDefinition->mAssetId, pRequest->mPrefetchFiles, visitedAssets );
+    pRequest->mPrefetchBitmaps.setSize( pRequest->mPrefetchFiles.size() );
+    for ( U32 n = 0; n < (U32)pRequest->mPrefetchBitmaps.size(); ++n )
+        pRequest->mPrefetchBitmaps[n] = NULL;
+
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printf( "Asset Manager: Queued asynchronous acquisition '%d' of asset Id '%s' with '%d' file(s) to prefetch.",
+            pRequest->mRequestId, pRequest->mAssetId, pRequest->mPrefetchFiles.size() );
+    }
+
+    // Queue the request.
+    mAsyncRequests.push_back( pRequest );
+    mAsyncRequestedCount++;
+    mAsyncBatchCount++;
+    mpAsyncLoader->queueRequest( pRequest );
+
+    // Process requests every frame.
+    setProcessTicks( true );
+
+    return pRequest->mRequestId;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::cancelAsyncAcquire( const U32 requestId )
+{
+    // Find the request.
+    for ( U32 n = 0; n < (U32)mAsyncRequests.size(); ++n )
+    {
+        AssetAsyncRequest* pRequest = mAsyncRequests[n];
+
+        if ( pRequest->mRequestId != requestId || pRequest->mCancelled )
+            continue;
+
+        // Flag as cancelled.  It will be removed once no worker is prefetching it.
+        pRequest->mCancelled = true;
+        return true;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+bool AssetManager::isAsyncAcquirePending( const U32 requestId ) const
+{
+    // Find the request.
+    for ( U32 n = 0; n < (U32)mAsyncRequests.size(); ++n )
+    {
+        const AssetAsyncRequest* pRequest = mAsyncRequests[n];
+
+        if ( pRequest->mRequestId == requestId )
+            return !pRequest->mCancelled;
+    }
+
+    return false;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::processAsyncAcquires( const F32 timeBudget )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ProcessAsyncAcquires);
+
+    // Fetch the start time.
+    const U32 startTime = Platform::getRealMilliseconds();
+    U32 acquiredCount = 0;
+
+    // Process requests in the order they were made.
+    while( mAsyncRequests.size() > 0 )
+    {
+        // Fetch the oldest request.
+        AssetAsyncRequest* pRequest = mAsyncRequests.front();
+
+        // Is the request cancelled?
+        if ( pRequest->mCancelled )
+        {
+            // Yes, so finish if a worker is still prefetching it.
+            if ( !mpAsyncLoader->dequeueRequest( pRequest ) )
+                break;
+
+            // Remove the request.
+            mAsyncRequests.pop_front();
+            deleteAsyncRequest( pRequest );
+            continue;
+        }
+
+        // Finish if the request is not prefetched.
+        if ( mpAsyncLoader->getRequestState( pRequest ) != AssetAsyncRequest::Prefetched )
+            break;
+
+        // Finish if we've used our time budget.
+        // NOTE:- We always acquire at least a single asset so progress is guaranteed.
+        if ( acquiredCount > 0 && (F32)(Platform::getRealMilliseconds() - startTime) >= timeBudget )
+            break;
+
+        // Remove and complete the request.
+        mAsyncRequests.pop_front();
+        completeAsyncRequest( pRequest );
+        deleteAsyncRequest( pRequest );
+        acquiredCount++;
+    }
+
+    // Stop processing if there are no more requests.
+    if ( mAsyncRequests.size() == 0 )
+        setProcessTicks( false );
+}
+
+//-----------------------------------------------------------------------------
+
+F32 AssetManager::getAsyncAcquireProgress( void ) const
+{
+    // Finish if nothing was requested.
+    if ( mAsyncBatchCount == 0 )
+        return 1.0f;
+
+    return (F32)(mAsyncBatchCount - getAsyncAcquirePendingCount()) / (F32)mAsyncBatchCount;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::dumpAsyncAcquireMetrics( void ) const
+{
+    Con::printSeparator();
+    Con::printf( "Asset Manager: Asynchronous acquisition metrics:" );
+    Con::printf( "> Workers: %d", mpAsyncLoader != NULL ? mpAsyncLoader->getWorkerCount() : 0 );
+    Con::printf( "> Requested: %d", mAsyncRequestedCount );
+    Con::printf( "> Pending: %d", getAsyncAcquirePendingCount() );
+    Con::printf( "> Acquired: %d", mAsyncAcquiredCount );
+    Con::printf( "> Failed: %d", mAsyncFailedCount );
+    Con::printf( "> Prefetched files: %d", mAsyncPrefetchedFileCount );
+    Con::printf( "> Progress: %0.1f%%", getAsyncAcquireProgress() * 100.0f );
+    Con::printSeparator();
+}
+
+//-----------------------------------------------------------------------------
+
 void AssetManager::purgeAssets( void )
 {
     // Debug Profiling.
@@ -2308,204 +2724,296 @@ S32 AssetManager::findAssetLooseFile( AssetQuery* pAssetQuery, const char* pLoos
 
 bool AssetManager::scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition )
 {
-    // Debug Profiling.
-    PROFILE_SCOPE(AssetManager_ScanDeclaredAssets);
-
     // Sanity!
     AssertFatal( pPath != NULL, "Cannot scan declared assets with NULL path." );
     AssertFatal( pExtension != NULL, "Cannot scan declared assets with NULL extension." );
 
-    // Expand path location.
-    char pathBuffer[1024];
-    Con::expandPath( pathBuffer, sizeof(pathBuffer), pPath );
+    // Scan the single location.
+    Vector<DeclaredAssetsScanLocation> locations;
+    locations.increment();
+    DeclaredAssetsScanLocation& location = locations.last();
+    dStrncpy( location.mPath, pPath, sizeof(location.mPath) - 1 );
+    location.mPath[sizeof(location.mPath) - 1] = 0;
+    location.mExtension = StringTable->insert( pExtension );
+    location.mRecurse = recurse;
 
-    // Find files.
-    Vector<Platform::FileInfo> files;
-    if ( !Platform::dumpPath( pathBuffer, files, recurse ? -1 : 0 ) )
-    {
-        // Failed so warn.
-        Con::warnf( "Asset Manager: Failed to scan declared assets in directory '%s'.", pathBuffer );
-        return false;
-    }
+    scanDeclaredAssetLocations( locations, pModuleDefinition );
+
+    return locations[0].mValid;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::scanDeclaredAssetLocations( Vector<DeclaredAssetsScanLocation>& locations, ModuleDefinition* pModuleDefinition )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_ScanDeclaredAssets);
+
+    // Sanity!
+    AssertFatal( pModuleDefinition != NULL, "Cannot scan declared assets using a NULL module definition" );
 
-    // Is the asset file-path located within the specified module?
-    if ( !Con::isBasePath( pathBuffer, pModuleDefinition->getModulePath() ) )
+    // Validate the locations.
+    for ( U32 index = 0; index < (U32)locations.size(); ++index )
     {
-        // No, so warn.
-        Con::warnf( "Asset Manager: Could not add declared asset file '%s' as file does not exist with module path '%s'",
-            pathBuffer,
-            pModuleDefinition->getModulePath() );
-        return false;
+        // Fetch location.
+        DeclaredAssetsScanLocation& location = locations[index];
+
+        // Expand path location.
+        char pathBuffer[1024];
+        Con::expandPath( pathBuffer, sizeof(pathBuffer), location.mPath );
+        dStrcpy( location.mPath, pathBuffer );
+
+        // Is the path located within the specified module?
+        location.mValid = Con::isBasePath( location.mPath, pModuleDefinition->getModulePath() );
+        if ( !location.mValid )
+        {
+            // No, so warn.
+            Con::warnf( "Asset Manager: Could not add declared asset file '%s' as file does not exist with module path '%s'",
+                location.mPath,
+                pModuleDefinition->getModulePath() );
+        }
     }
 
-    // Info.
-    if ( mEchoInfo )
+    // Fetch the declaration cache.
+    if ( mDeclarationCacheEnabled && !mDeclarationCacheLoaded )
     {
-        Con::printSeparator();
-        Con::printf( "Asset Manager: Scanning for declared assets in path '%s' for files with extension '%s'...", pathBuffer, pExtension );
+        mDeclarationCache.load( getDeclarationCacheFile() );
+        mDeclarationCacheLoaded = true;
     }
 
-    // Fetch extension length.
-    const U32 extensionLength = dStrlen( pExtension );
-
-    // Fetch module assets.
-    ModuleDefinition::typeModuleAssetsVector& moduleAssets = pModuleDefinition->getModuleAssets();
+    DeclaredAssetsScanJob scanJob;
+    scanJob.mpLocations = &locations;
+    scanJob.mpFiles = NULL;
+    scanJob.mpDeclarationCache = mDeclarationCacheEnabled ? &mDeclarationCache : NULL;
+    scanJob.mpTaml = &mTaml;
 
-    TamlAssetDeclaredVisitor assetDeclaredVisitor;
+    // Walk the locations.
+    runDeclaredAssetsScanJob( &declaredAssetsWalkJob, &scanJob, (U32)locations.size() );
 
-    // Iterate files.
-    for ( Vector<Platform::FileInfo>::iterator fileItr = files.begin(); fileItr != files.end(); ++fileItr )
+    // Gather the files in location order.
+    Vector<DeclaredAssetsScanFile> files;
+    for ( U32 index = 0; index < (U32)locations.size(); ++index )
     {
-        // Fetch file info.
-        Platform::FileInfo& fileInfo = *fileItr;
-
-        // Fetch filename.
-        const char* pFilename = fileInfo.pFileName;
-
-        // Find filename length.
-        const U32 filenameLength = dStrlen( pFilename );
+        // Fetch location.
+        DeclaredAssetsScanLocation& location = locations[index];
 
-        // Skip if extension is longer than filename.
-        if ( extensionLength > filenameLength )
+        // Skip if not valid.
+        if ( !location.mValid )
             continue;
 
-        // Skip if extension not found.
-        if ( dStricmp( pFilename + filenameLength - extensionLength, pExtension ) != 0 )
-            continue;
+        for ( Vector<Platform::FileInfo>::iterator fileItr = location.mFiles.begin(); fileItr != location.mFiles.end(); ++fileItr )
+        {
+            // Format full file-path.
+            char assetFileBuffer[1024];
+            dSprintf( assetFileBuffer, sizeof(assetFileBuffer), "%s/%s", fileItr->pFullPath, fileItr->pFileName );
+
+            files.increment();
+            DeclaredAssetsScanFile& scanFile = files.last();
+            scanFile.mDeclaration.mAssetFile = StringTable->insert( assetFileBuffer );
+            scanFile.mDeclaration.mFileSize = fileItr->fileSize;
+        }
+    }
 
-        // Clear declared assets.
-        assetDeclaredVisitor.clear();
+    // Parse the files.
+    scanJob.mpFiles = &files;
+    runDeclaredAssetsScanJob( &declaredAssetsParseJob, &scanJob, (U32)files.size() );
 
-        // Format full file-path.
-        char assetFileBuffer[1024];
-        dSprintf( assetFileBuffer, sizeof(assetFileBuffer), "%s/%s", fileInfo.pFullPath, fileInfo.pFileName );
+    // Add the declarations in location order.
+    U32 fileIndex = 0;
+    for ( U32 index = 0; index < (U32)locations.size(); ++index )
+    {
+        // Fetch location.
+        DeclaredAssetsScanLocation& location = locations[index];
 
-        // Parse the filename.
-        if ( !mTaml.parse( assetFileBuffer, assetDeclaredVisitor ) )
+        // Is the location valid?
+        if ( !location.mValid )
         {
-            // Warn.
-            Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", assetFileBuffer );
+            // No, so warn.
+            Con::warnf( "Asset Manager: Failed to scan declared assets in directory '%s'.", location.mPath );
             continue;
         }
 
-        // Fetch asset definition.
-        AssetDefinition& foundAssetDefinition = assetDeclaredVisitor.getAssetDefinition();
-
-        // Did we get an asset name?
-        if ( foundAssetDefinition.mAssetName == StringTable->EmptyString )
+        // Info.
+        if ( mEchoInfo )
         {
-            // No, so warn.
-            Con::warnf( "Asset Manager: Parsed file '%s' but did not encounter an asset.", assetFileBuffer );
-            continue;
+            Con::printSeparator();
+            Con::printf( "Asset Manager: Scanning for declared assets in path '%s' for files with extension '%s'...", location.mPath, location.mExtension );
         }
 
-        // Set module definition.
-        foundAssetDefinition.mpModuleDefinition = pModuleDefinition;
+        for ( U32 locationFileIndex = 0; locationFileIndex < (U32)location.mFiles.size(); ++locationFileIndex, ++fileIndex )
+        {
+            // Fetch file.
+            DeclaredAssetsScanFile& scanFile = files[fileIndex];
 
-        // Format asset Id.
-        char assetIdBuffer[1024];
-        dSprintf(assetIdBuffer, sizeof(assetIdBuffer), "%s%s%s",
-            pModuleDefinition->getModuleId(),
-            ASSET_SCOPE_TOKEN,
-            foundAssetDefinition.mAssetName );
+            // Was the file parsed?
+            if ( !scanFile.mParsed )
+            {
+                // No, so warn.
+                Con::warnf( "Asset Manager: Failed to parse file containing asset declaration: '%s'.", scanFile.mDeclaration.mAssetFile );
+                continue;
+            }
 
-        // Set asset Id.
-        foundAssetDefinition.mAssetId = StringTable->insert( assetIdBuffer );
+            // Update the declaration cache.
+            if ( scanFile.mCached )
+            {
+                mDeclarationCachedCount++;
+            }
+            else
+            {
+                mDeclarationParsedCount++;
 
-        // Does this asset already exist?
-        if ( mDeclaredAssets.contains( foundAssetDefinition.mAssetId ) )
-        {
-            // Yes, so warn.
-            Con::warnf( "Asset Manager: Encountered asset Id '%s' in asset file '%s' but it conflicts with existing asset Id in asset file '%s'.",
-                foundAssetDefinition.mAssetId,
-                foundAssetDefinition.mAssetBaseFilePath,
-                mDeclaredAssets.find( foundAssetDefinition.mAssetId )->value->mAssetBaseFilePath );
+                if ( mDeclarationCacheEnabled )
+                    mDeclarationCache.storeDeclaration( scanFile.mDeclaration );
+            }
 
-            continue;
+            // Add the declaration.
+            addScannedAssetDeclaration( scanFile.mDeclaration, pModuleDefinition );
         }
 
-        // Create new asset definition.
-        AssetDefinition* pAssetDefinition = new AssetDefinition( foundAssetDefinition );
-
-        // Store in declared assets.
-        mDeclaredAssets.insert( pAssetDefinition->mAssetId, pAssetDefinition );
-
-        // Store in module assets.
-        moduleAssets.push_back( pAssetDefinition );
-        
         // Info.
         if ( mEchoInfo )
         {
             Con::printSeparator();
-            Con::printf( "Asset Manager: Adding Asset Id '%s' of type '%s' in asset file '%s'.",
-                pAssetDefinition->mAssetId,
-                pAssetDefinition->mAssetType,
-                pAssetDefinition->mAssetBaseFilePath );
+            Con::printf( "Asset Manager: ... Finished scanning for declared assets in path '%s' for files with extension '%s'.", location.mPath, location.mExtension );
+            Con::printSeparator();
+            Con::printBlankLine();
         }
+    }
+}
 
-        // Fetch asset Id.
-        StringTableEntry assetId = pAssetDefinition->mAssetId;
+//-----------------------------------------------------------------------------
 
-        // Fetch asset dependencies.
-        TamlAssetDeclaredVisitor::typeAssetIdVector& assetDependencies = assetDeclaredVisitor.getAssetDependencies();
+void AssetManager::addScannedAssetDeclaration( const AssetDeclaration& declaration, ModuleDefinition* pModuleDefinition )
+{
+    // Did we get an asset name?
+    if ( declaration.mAssetName == StringTable->EmptyString )
+    {
+        // No, so warn.
+        Con::warnf( "Asset Manager: Parsed file '%s' but did not encounter an asset.", declaration.mAssetFile );
+        return;
+    }
 
-        // Are there any asset dependencies?
-        if ( assetDependencies.size() > 0 )
-        {
-            // Yes, so iterate dependencies.
-            for( TamlAssetDeclaredVisitor::typeAssetIdVector::iterator assetDependencyItr = assetDependencies.begin(); assetDependencyItr != assetDependencies.end(); ++assetDependencyItr )
-            {
-                // Fetch asset Ids.
-                StringTableEntry dependencyAssetId = *assetDependencyItr;
+    // Fetch module assets.
+    ModuleDefinition::typeModuleAssetsVector& moduleAssets = pModuleDefinition->getModuleAssets();
 
-                // Insert depends-on.
-                mAssetDependsOn.insertEqual( assetId, dependencyAssetId );
+    // Format asset Id.
+    char assetIdBuffer[1024];
+    dSprintf(assetIdBuffer, sizeof(assetIdBuffer), "%s%s%s",
+        pModuleDefinition->getModuleId(),
+        ASSET_SCOPE_TOKEN,
+        declaration.mAssetName );
 
-                // Insert is-depended-on.
-                mAssetIsDependedOn.insertEqual( dependencyAssetId, assetId );
+    // Fetch asset Id.
+    StringTableEntry assetId = StringTable->insert( assetIdBuffer );
 
-                // Info.
-                if ( mEchoInfo )
-                {
-                    Con::printf( "Asset Manager: Asset Id '%s' has dependency of Asset Id '%s'", assetId, dependencyAssetId );
-                }
-            }
-        }
+    // Does this asset already exist?
+    if ( mDeclaredAssets.contains( assetId ) )
+    {
+        // Yes, so warn.
+        Con::warnf( "Asset Manager: Encountered asset Id '%s' in asset file '%s' but it conflicts with existing asset Id in asset file '%s'.",
+            assetId,
+            declaration.mAssetFile,
+            mDeclaredAssets.find( assetId )->value->mAssetBaseFilePath );
+
+        return;
+    }
+
+    // Create new asset definition.
+    AssetDefinition* pAssetDefinition = new AssetDefinition();
+    pAssetDefinition->mpModuleDefinition = pModuleDefinition;
+    pAssetDefinition->mAssetBaseFilePath = declaration.mAssetFile;
+    pAssetDefinition->mAssetId = assetId;
+    pAssetDefinition->mAssetName = declaration.mAssetName;
+    pAssetDefinition->mAssetDescription = declaration.mAssetDescription;
+    pAssetDefinition->mAssetCategory = declaration.mAssetCategory;
+    pAssetDefinition->mAssetAutoUnload = declaration.mAssetAutoUnload;
+    pAssetDefinition->mAssetInternal = declaration.mAssetInternal;
+    pAssetDefinition->mAssetType = declaration.mAssetType;
 
-        // Fetch asset loose files.
-        TamlAssetDeclaredVisitor::typeLooseFileVector& assetLooseFiles = assetDeclaredVisitor.getAssetLooseFiles();
+    // Store in declared assets.
+    mDeclaredAssets.insert( pAssetDefinition->mAssetId, pAssetDefinition );
 
-        // Are there any loose files?
-        if ( assetLooseFiles.size() > 0 )
+    // Store in module assets.
+    moduleAssets.push_back( pAssetDefinition );
+    
+    // Info.
+    if ( mEchoInfo )
+    {
+        Con::printSeparator();
+        Con::printf( "Asset Manager: Adding Asset Id '%s' of type '%s' in asset file '%s'.",
+            pAssetDefinition->mAssetId,
+            pAssetDefinition->mAssetType,
+            pAssetDefinition->mAssetBaseFilePath );
+    }
+
+    // Iterate dependencies.
+    for( Vector<StringTableEntry>::const_iterator assetDependencyItr = declaration.mAssetDependencies.begin(); assetDependencyItr != declaration.mAssetDependencies.end(); ++assetDependencyItr )
+    {
+        // Fetch asset Ids.
+        StringTableEntry dependencyAssetId = *assetDependencyItr;
+
+        // Insert depends-on.
+        mAssetDependsOn.insertEqual( assetId, dependencyAssetId );
+
+        // Insert is-depended-on.
+        mAssetIsDependedOn.insertEqual( dependencyAssetId, assetId );
+
+        // Info.
+        if ( mEchoInfo )
         {
-            // Yes, so iterate loose files.
-            for( TamlAssetDeclaredVisitor::typeLooseFileVector::iterator assetLooseFileItr = assetLooseFiles.begin(); assetLooseFileItr != assetLooseFiles.end(); ++assetLooseFileItr )
-            {
-                // Fetch loose file.
-                StringTableEntry looseFile = *assetLooseFileItr;
+            Con::printf( "Asset Manager: Asset Id '%s' has dependency of Asset Id '%s'", assetId, dependencyAssetId );
+        }
+    }
 
-                // Info.
-                if ( mEchoInfo )
-                {
-                    Con::printf( "Asset Manager: Asset Id '%s' has loose file '%s'.", assetId, looseFile );
-                }
+    // Iterate loose files.
+    for( Vector<StringTableEntry>::const_iterator assetLooseFileItr = declaration.mAssetLooseFiles.begin(); assetLooseFileItr != declaration.mAssetLooseFiles.end(); ++assetLooseFileItr )
+    {
+        // Fetch loose file.
+        StringTableEntry looseFile = *assetLooseFileItr;
 
-                // Store loose file.
-                pAssetDefinition->mAssetLooseFiles.push_back( looseFile );
-            }
+        // Info.
+        if ( mEchoInfo )
+        {
+            Con::printf( "Asset Manager: Asset Id '%s' has loose file '%s'.", assetId, looseFile );
         }
+
+        // Store loose file.
+        pAssetDefinition->mAssetLooseFiles.push_back( looseFile );
     }
+}
 
-    // Info.
-    if ( mEchoInfo )
+//-----------------------------------------------------------------------------
+
+StringTableEntry AssetManager::getDeclarationCacheFile( void )
+{
+    // Use the specified cache file if set.
+    if ( mDeclarationCacheFile != StringTable->EmptyString )
     {
-        Con::printSeparator();
-        Con::printf( "Asset Manager: ... Finished scanning for declared assets in path '%s' for files with extension '%s'.", pathBuffer, pExtension );
-        Con::printSeparator();
-        Con::printBlankLine();
+        char cacheFileBuffer[1024];
+        Con::expandPath( cacheFileBuffer, sizeof(cacheFileBuffer), mDeclarationCacheFile );
+        return StringTable->insert( cacheFileBuffer );
     }
 
-    return true;
+    // Use the preferences path.
+    return Platform::getPrefsPath( "assetDeclarations.cache" );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::saveDeclarationCache( void )
+{
+    // Finish if there's nothing new to save.
+    if ( !mDeclarationCacheEnabled || !mDeclarationCache.isDirty() )
+        return;
+
+    // Fetch the cache file.
+    StringTableEntry cacheFile = getDeclarationCacheFile();
+
+    // Ensure the cache path exists.
+    Platform::createPath( cacheFile );
+
+    // Save the cache.
+    mDeclarationCache.save( cacheFile );
 }
 
 //-----------------------------------------------------------------------------
@@ -2962,6 +3470,160 @@ void AssetManager::unloadAsset( AssetDefinition* pAssetDefinition )
 
 //-----------------------------------------------------------------------------
 
+void AssetManager::gatherAsyncPrefetchFiles( StringTableEntry assetId, Vector<StringTableEntry>& prefetchFiles, Vector<StringTableEntry>& visitedAssets )
+{
+    // Finish if the asset has already been visited.
+    if ( visitedAssets.contains( assetId ) )
+        return;
+
+    visitedAssets.push_back( assetId );
+
+    // Find asset.
+    AssetDefinition* pAssetDefinition = findAsset( assetId );
+
+    // Finish if the asset does not exist or is already loaded.
+    if ( pAssetDefinition == NULL || pAssetDefinition->mpAssetBase != NULL )
+        return;
+
+    // Add any loose files that can be prefetched.
+    for ( U32 n = 0; n < (U32)pAssetDefinition->mAssetLooseFiles.size(); ++n )
+    {
+        StringTableEntry looseFile = pAssetDefinition->mAssetLooseFiles[n];
+
+        if ( AssetAsyncLoader::canPrefetchFile( looseFile ) && !prefetchFiles.contains( looseFile ) )
+            prefetchFiles.push_back( looseFile );
+    }
+
+    // Find any asset dependencies.
+    typeAssetDependsOnHash::iterator assetDependenciesItr = mAssetDependsOn.find( assetId );
+
+    // Iterate all dependencies.
+    while( assetDependenciesItr != mAssetDependsOn.end() && assetDependenciesItr->key == assetId )
+    {
+        gatherAsyncPrefetchFiles( assetDependenciesItr->value, prefetchFiles, visitedAssets );
+        assetDependenciesItr++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::completeAsyncRequest( AssetAsyncRequest* pRequest )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(AssetManager_CompleteAsyncRequest);
+
+    // Hand the prefetched bitmaps to the texture manager.
+    for ( U32 n = 0; n < (U32)pRequest->mPrefetchFiles.size(); ++n )
+    {
+        GBitmap* pBitmap = pRequest->mPrefetchBitmaps[n];
+
+        if ( pBitmap == NULL )
+            continue;
+
+        TextureManager::addPreloadedBitmap( pRequest->mPrefetchFiles[n], pBitmap );
+        pRequest->mPrefetchBitmaps[n] = NULL;
+        mAsyncPrefetchedFileCount++;
+    }
+
+    // Acquire the asset.
+    AssetBase* pAssetBase = acquireAsset<AssetBase>( pRequest->mAssetId );
+
+    // Purge any prefetched bitmaps that were not used.
+    for ( U32 n = 0; n < (U32)pRequest->mPrefetchFiles.size(); ++n )
+    {
+        TextureManager::purgePreloadedBitmap( pRequest->mPrefetchFiles[n] );
+    }
+
+    // Update the metrics.
+    if ( pAssetBase != NULL )
+        mAsyncAcquiredCount++;
+    else
+        mAsyncFailedCount++;
+
+    // Finish if there's no callback object.
+    if ( pRequest->mCallbackObjectId == 0 )
+        return;
+
+    // Find the callback object.
+    SimObject* pCallbackObject = Sim::findObject( pRequest->mCallbackObjectId );
+
+    // Did we find the callback object?
+    if ( pCallbackObject == NULL )
+    {
+        // No, so release the asset as nothing can own it.
+        if ( pAssetBase != NULL )
+            releaseAsset( pRequest->mAssetId );
+
+        return;
+    }
+
+    // Notify the callback object.
+    if ( pCallbackObject->isMethod( "onAssetAcquired" ) )
+    {
+        char requestIdBuffer[16];
+        dSprintf( requestIdBuffer, sizeof(requestIdBuffer), "%d", pRequest->mRequestId );
+        Con::executef( pCallbackObject, 4, "onAssetAcquired", requestIdBuffer, pRequest->mAssetId, pAssetBase != NULL ? pAssetBase->getIdString() : StringTable->EmptyString );
+    }
+    else if ( pAssetBase != NULL )
+    {
+        // No callback so release the asset as nothing can own it.
+        releaseAsset( pRequest->mAssetId );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::deleteAsyncRequest( AssetAsyncRequest* pRequest )
+{
+    // Delete any bitmaps that were not used.
+    for ( U32 n = 0; n < (U32)pRequest->mPrefetchBitmaps.size(); ++n )
+    {
+        delete pRequest->mPrefetchBitmaps[n];
+    }
+
+    delete pRequest;
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::clearAsyncRequests( void )
+{
+    // Finish if no asynchronous loader.
+    if ( mpAsyncLoader == NULL )
+        return;
+
+    // Stop the workers.
+    mpAsyncLoader->stop();
+
+    // Delete all the requests.
+    for ( U32 n = 0; n < (U32)mAsyncRequests.size(); ++n )
+    {
+        deleteAsyncRequest( mAsyncRequests[n] );
+    }
+    mAsyncRequests.clear();
+
+    // Delete the asynchronous loader.
+    delete mpAsyncLoader;
+    mpAsyncLoader = NULL;
+
+    // Stop processing.
+    setProcessTicks( false );
+}
+
+//-----------------------------------------------------------------------------
+
+void AssetManager::advanceTime( F32 timeDelta )
+{
+    // Process any asynchronous acquisitions.
+    processAsyncAcquires( mAsyncAcquireBudget );
+
+    // Save any new asset declarations.
+    // NOTE:- This is deferred to here so all the modules loaded in a frame are saved together.
+    saveDeclarationCache();
+}
+
+//-----------------------------------------------------------------------------
+
 void AssetManager::onModulePreLoad( ModuleDefinition* pModuleDefinition )
 {
     // Debug Profiling.
@@ -55,10 +55,18 @@
 #include "assets/assetQuery.h"
 #endif
 
+#ifndef _ASSET_DECLARATION_CACHE_H_
+#include "assets/assetDeclarationCache.h"
+#endif
+
 #ifndef _ASSET_FIELD_TYPES_H_
 #include "assets/assetFieldTypes.h"
 #endif
 
+#ifndef _TICKABLE_H_
+#include "platform/Tickable.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -66,10 +74,13 @@
 
 class AssetPtrCallback;
 class AssetPtrBase;
+class AssetAsyncLoader;
+struct AssetAsyncRequest;
+struct DeclaredAssetsScanLocation;
 
 //-----------------------------------------------------------------------------
 
-class AssetManager : public SimObject, public ModuleCallbacks
+class AssetManager : public SimObject, public ModuleCallbacks, public virtual Tickable
 {
 private:
     typedef SimObject Parent;
@@ -81,6 +92,7 @@ private:
     typedef HashTable<typeAssetId, typeAssetId> typeAssetDependsOnHash;
     typedef HashTable<typeAssetId, typeAssetId> typeAssetIsDependedOnHash;
     typedef HashMap<AssetPtrBase*, AssetPtrCallback*> typeAssetPtrRefreshHash;
+    typedef Vector<AssetAsyncRequest*> typeAsyncRequestVector;
 
     /// Declared assets.
     typeDeclaredAssetsHash              mDeclaredAssets;
@@ -99,6 +111,25 @@ private:
     /// Asset pointer refresh notifications.
     typeAssetPtrRefreshHash             mAssetPtrRefreshNotifications;
 
+    /// Asynchronous asset acquisition.
+    AssetAsyncLoader*                   mpAsyncLoader;
+    typeAsyncRequestVector              mAsyncRequests;
+    U32                                 mAsyncRequestIdSource;
+    F32                                 mAsyncAcquireBudget;
+    U32                                 mAsyncBatchCount;
+    U32                                 mAsyncRequestedCount;
+    U32                                 mAsyncAcquiredCount;
+    U32                                 mAsyncFailedCount;
+    U32                                 mAsyncPrefetchedFileCount;
+
+    /// Declared asset scanning.
+    AssetDeclarationCache               mDeclarationCache;
+    bool                                mDeclarationCacheEnabled;
+    bool                                mDeclarationCacheLoaded;
+    StringTableEntry                    mDeclarationCacheFile;
+    U32                                 mDeclarationParsedCount;
+    U32                                 mDeclarationCachedCount;
+
     /// Miscellaneous.
     bool                                mEchoInfo;
     bool                                mIgnoreAutoUnload;
@@ -153,6 +184,9 @@ public:
         // Sanity!
         AssertFatal( pAssetId != NULL, "Cannot acquire NULL asset Id." );
 
+        // Memory Tracking.
+        Memory::TagScope memoryTagScope( "Assets" );
+
         // Is this an empty asset Id?
         if ( *pAssetId == 0 )
         {
@@ -322,6 +356,19 @@ public:
     bool releaseAsset( const char* pAssetId );
     void purgeAssets( void );
 
+    /// Asynchronous asset acquisition.
+    /// The asset is acquired on the main thread over subsequent frames with its image files decoded on worker threads beforehand.
+    /// A successfully acquired asset must be released using 'releaseAsset' as with 'acquireAsset'.
+    U32 acquireAssetAsync( const char* pAssetId, SimObject* pCallbackObject = NULL );
+    bool cancelAsyncAcquire( const U32 requestId );
+    bool isAsyncAcquirePending( const U32 requestId ) const;
+    void processAsyncAcquires( const F32 timeBudget );
+    F32 getAsyncAcquireProgress( void ) const;
+    inline U32 getAsyncAcquirePendingCount( void ) const { return (U32)mAsyncRequests.size(); }
+    inline U32 getAsyncAcquiredCount( void ) const { return mAsyncAcquiredCount; }
+    inline U32 getAsyncAcquireFailedCount( void ) const { return mAsyncFailedCount; }
+    void dumpAsyncAcquireMetrics( void ) const;
+
     /// Asset deletion.
     bool deleteAsset( const char* pAssetId, const bool deleteLooseFiles, const bool deleteDependencies );
 
@@ -346,6 +393,8 @@ public:
     inline U32 getMaxLoadedInternalAssetCount( void ) const { return mMaxLoadedInternalAssetsCount; }
     inline U32 getMaxLoadedExternalAssetCount( void ) const { return mMaxLoadedExternalAssetsCount; }
     inline U32 getMaxLoadedPrivateAssetCount( void ) const { return mMaxLoadedPrivateAssetsCount; }
+    inline U32 getDeclarationParsedCount( void ) const { return mDeclarationParsedCount; }
+    inline U32 getDeclarationCachedCount( void ) const { return mDeclarationCachedCount; }
     void dumpDeclaredAssets( void ) const;
 
     /// Total acquired asset references.
@@ -372,6 +421,10 @@ public:
 
 private:
     bool scanDeclaredAssets( const char* pPath, const char* pExtension, const bool recurse, ModuleDefinition* pModuleDefinition );
+    void scanDeclaredAssetLocations( Vector<DeclaredAssetsScanLocation>& locations, ModuleDefinition* pModuleDefinition );
+    void addScannedAssetDeclaration( const AssetDeclaration& declaration, ModuleDefinition* pModuleDefinition );
+    StringTableEntry getDeclarationCacheFile( void );
+    void saveDeclarationCache( void );
     bool scanReferencedAssets( const char* pPath, const char* pExtension, const bool recurse );
     AssetDefinition* findAsset( const char* pAssetId );
     void addReferencedAsset( StringTableEntry assetId, StringTableEntry referenceFilePath );
@@ -381,6 +434,15 @@ private:
     void removeAssetDependencies( const char* pAssetId );
     void removeAssetLooseFiles( const char* pAssetId );
     void unloadAsset( AssetDefinition* pAssetDefinition );
+    void gatherAsyncPrefetchFiles( StringTableEntry assetId, Vector<StringTableEntry>& prefetchFiles, Vector<StringTableEntry>& visitedAssets );
+    void completeAsyncRequest( AssetAsyncRequest* pRequest );
+    void deleteAsyncRequest( AssetAsyncRequest* pRequest );
+    void clearAsyncRequests( void );
+
+    /// Tickable.
+    virtual void interpolateTick( F32 delta ) {}
+    virtual void processTick( void ) {}
+    virtual void advanceTime( F32 timeDelta );
 
     /// Module callbacks.
     virtual void onModulePreLoad( ModuleDefinition* pModuleDefinition );
@@ -369,6 +369,89 @@ ConsoleMethodWithDocs( AssetManager, releaseAsset, ConsoleBool, 3, 3, (assetId))
 
 //-----------------------------------------------------------------------------
 
+/*! Asynchronously acquire the specified asset Id.
+    The asset is acquired over subsequent frames with its image files decoded in the background.
+    When acquired, the callback object (if specified) is called with 'onAssetAcquired(requestId, assetId, asset)' where the asset is empty if the acquisition failed.
+    You must release a successfully acquired asset once you're finish with it using 'releaseAsset'.
+    If the callback object is deleted before the asset is acquired then the asset is released automatically.
+    @param assetId The selected asset Id.
+    @param callbackObject The object to receive the acquired callback (optional).
+    @return The request Id or zero if the request failed.
+*/
+ConsoleMethodWithDocs( AssetManager, acquireAssetAsync, ConsoleInt, 3, 4, (assetId, [callbackObject]))
+{
+    // Fetch the callback object.
+    SimObject* pCallbackObject = NULL;
+    if ( argc >= 4 && *argv[3] != 0 )
+    {
+        pCallbackObject = Sim::findObject( argv[3] );
+
+        // Did we find the callback object?
+        if ( pCallbackObject == NULL )
+        {
+            // No, so warn.
+            Con::warnf( "AssetManager::acquireAssetAsync() - Could not find the callback object '%s'.", argv[3] );
+            return 0;
+        }
+    }
+
+    return object->acquireAssetAsync( argv[2], pCallbackObject );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Cancel the specified asynchronous acquisition.
+    @param requestId The request Id returned by 'acquireAssetAsync'.
+    @return Whether the request was pending and has been cancelled or not.
+*/
+ConsoleMethodWithDocs( AssetManager, cancelAsyncAcquire, ConsoleBool, 3, 3, (requestId))
+{
+    return object->cancelAsyncAcquire( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Check whether the specified asynchronous acquisition is still pending.
+    @param requestId The request Id returned by 'acquireAssetAsync'.
+    @return Whether the request is still pending or not.
+*/
+ConsoleMethodWithDocs( AssetManager, isAsyncAcquirePending, ConsoleBool, 3, 3, (requestId))
+{
+    return object->isAsyncAcquirePending( dAtoi(argv[2]) );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of pending asynchronous acquisitions.
+    @return The number of pending asynchronous acquisitions.
+*/
+ConsoleMethodWithDocs( AssetManager, getAsyncAcquirePendingCount, ConsoleInt, 2, 2, ())
+{
+    return object->getAsyncAcquirePendingCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the progress of the asynchronous acquisitions requested since there were last none pending.
+    @return The progress in the range [0,1].
+*/
+ConsoleMethodWithDocs( AssetManager, getAsyncAcquireProgress, ConsoleFloat, 2, 2, ())
+{
+    return object->getAsyncAcquireProgress();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Dumps the asynchronous acquisition metrics.
+    @return No return value.
+*/
+ConsoleMethodWithDocs( AssetManager, dumpAsyncAcquireMetrics, ConsoleVoid, 2, 2, ())
+{
+    object->dumpAsyncAcquireMetrics();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Purge all assets that are not referenced even if they are set to not auto-unload.
     Assets can be in this state because they are either set to not auto-unload or the asset manager has/is disabling auto-unload.
     @return No return value.
@@ -941,6 +1024,26 @@ ConsoleMethodWithDocs( AssetManager, getMaxLoadedExternalAssetCount, ConsoleBool
 
 //-----------------------------------------------------------------------------
 
+/*! Gets the number of asset declarations that were parsed from asset files.
+    @return Returns the number of asset declarations that were parsed from asset files.
+*/
+ConsoleMethodWithDocs( AssetManager, getDeclarationParsedCount, ConsoleInt, 2, 2, ())
+{
+    return object->getDeclarationParsedCount();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of asset declarations that were found in the declaration cache without parsing asset files.
+    @return Returns the number of asset declarations that were found in the declaration cache.
+*/
+ConsoleMethodWithDocs( AssetManager, getDeclarationCachedCount, ConsoleInt, 2, 2, ())
+{
+    return object->getDeclarationCachedCount();
+}
+
+//-----------------------------------------------------------------------------
+
 /*! Dumps a breakdown of all declared assets.
     @return No return value.
 */
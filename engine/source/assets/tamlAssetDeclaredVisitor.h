@@ -138,14 +138,17 @@ public:
         if ( propertyWordCount != 2 )
             return true;
 
+        // NOTE:- Units are fetched into a local buffer as declarations may be parsed on worker threads.
+        char unitBuffer[4096];
+
         // Fetch the asset signature.
-        StringTableEntry assetSignature = StringTable->insert( StringUnit::getUnit( pPropertyValue, 0, ASSET_ASSIGNMENT_TOKEN ) );
+        StringTableEntry assetSignature = StringTable->insert( StringUnit::getUnit( pPropertyValue, 0, ASSET_ASSIGNMENT_TOKEN, unitBuffer, sizeof(unitBuffer) ) );
 
         // Is this an asset Id signature?
         if ( assetSignature == assetLooseIdSignature )
         {
             // Yes, so get asset Id.
-            typeAssetId assetId = StringTable->insert( StringUnit::getUnit( pPropertyValue, 1, ASSET_ASSIGNMENT_TOKEN ) );
+            typeAssetId assetId = StringTable->insert( StringUnit::getUnit( pPropertyValue, 1, ASSET_ASSIGNMENT_TOKEN, unitBuffer, sizeof(unitBuffer) ) );
 
             // Finish if the dependency is itself!
             if ( mAssetDefinition.mAssetId == assetId )
@@ -166,7 +169,7 @@ public:
         else if ( assetSignature == assetLooseFileSignature )
         {
             // Yes, so get loose-file reference.
-            const char* pAssetLooseFile = StringUnit::getUnit( pPropertyValue, 1, ASSET_ASSIGNMENT_TOKEN );
+            const char* pAssetLooseFile = StringUnit::getUnit( pPropertyValue, 1, ASSET_ASSIGNMENT_TOKEN, unitBuffer, sizeof(unitBuffer) );
 
             // Fetch asset path only.
             char assetBasePathBuffer[1024];
@@ -76,6 +76,62 @@ CodeBlock::~CodeBlock()
 
 //-------------------------------------------------------------------------
 
+Namespace::Entry* CodeBlock::lookupCallSite(U32 callTypeIp, Namespace* ns, StringTableEntry fnName)
+{
+   // Fetch the call site slot.
+   U32 slot = code[callTypeIp] >> CallSiteShift;
+
+   if ( slot != 0 )
+   {
+      // Use the cached entry if it's still valid.
+      const CallSiteCache& cache = mCallSiteCaches[slot-1];
+      if ( cache.mNamespace == ns && cache.mCacheSequence == Namespace::mCacheSequence )
+         return cache.mEntry;
+   }
+
+   Namespace::Entry* pEntry = ns->lookup(fnName);
+
+   // Don't cache failed lookups; they're reported at the call site.
+   if ( pEntry == NULL )
+      return NULL;
+
+   if ( slot == 0 )
+   {
+      // Assign a slot to the call site.
+      mCallSiteCaches.increment();
+      slot = mCallSiteCaches.size();
+      code[callTypeIp] = (code[callTypeIp] & CallTypeMask) | (slot << CallSiteShift);
+   }
+
+   // Update the cache.
+   CallSiteCache& cache = mCallSiteCaches[slot-1];
+   cache.mNamespace = ns;
+   cache.mEntry = pEntry;
+   cache.mCacheSequence = Namespace::mCacheSequence;
+
+   return pEntry;
+}
+
+//-------------------------------------------------------------------------
+
+Namespace::Entry* CodeBlock::lookupFunctionCallSite(U32 callTypeIp, StringTableEntry fnNamespace, StringTableEntry fnName)
+{
+   // Fetch the call site slot.
+   const U32 slot = code[callTypeIp] >> CallSiteShift;
+
+   // The namespace is fixed for a function call site so skip finding it if the cache is valid.
+   if ( slot != 0 )
+   {
+      const CallSiteCache& cache = mCallSiteCaches[slot-1];
+      if ( cache.mCacheSequence == Namespace::mCacheSequence )
+         return cache.mEntry;
+   }
+
+   return lookupCallSite( callTypeIp, Namespace::find(fnNamespace), fnName );
+}
+
+//-------------------------------------------------------------------------
+
 StringTableEntry CodeBlock::getCurrentCodeBlockName()
 {
    if (CodeBlock::getCurrentBlock())
@@ -477,6 +533,8 @@ bool CodeBlock::read(StringTableEntry fileName, Stream &st)
 
 bool CodeBlock::compile(const char *codeFileName, StringTableEntry fileName, const char *script)
 {
+   Memory::TagScope memoryTagScope("Compiler");
+
    gSyntaxError = false;
 
    consoleAllocReset();
@@ -26,6 +26,10 @@
 #include "console/compiler.h"
 #include "console/consoleParser.h"
 
+#ifndef _CONSOLE_NAMESPACE_H
+#include "console/consoleNamespace.h"
+#endif
+
 class Stream;
 
 
@@ -82,6 +86,41 @@ public:
    CodeBlock *nextFile;
    StringTableEntry mRoot;
 
+   /// Inline cache for a single OP_CALLFUNC call site.
+   ///
+   /// A call site is assigned a slot the first time it executes; the slot index
+   /// (plus one) is stored above the call type in the instruction's call type word.
+   /// A slot is only valid whilst its sequence matches Namespace::mCacheSequence
+   /// which changes whenever functions are defined, packages are (de)activated
+   /// or classes are linked.
+   struct CallSiteCache
+   {
+      Namespace*        mNamespace;
+      Namespace::Entry* mEntry;
+      U32               mCacheSequence;
+   };
+
+   enum
+   {
+      CallTypeMask = 0xFF,
+      CallSiteShift = 8,
+   };
+
+   Vector<CallSiteCache> mCallSiteCaches;
+
+   /// Fetch the namespace entry for a call site, resolving and caching it if required.
+   /// @param callTypeIp The instruction offset of the call site's call type word.
+   /// @param ns The namespace to look the function up in (the cache key).
+   /// @param fnName The function name.
+   Namespace::Entry* lookupCallSite(U32 callTypeIp, Namespace* ns, StringTableEntry fnName);
+
+   /// Fetch the namespace entry for a function call site, only finding the namespace
+   /// if the call site cache is invalid.
+   /// @param callTypeIp The instruction offset of the call site's call type word.
+   /// @param fnNamespace The namespace name or NULL for the global namespace.
+   /// @param fnName The function name.
+   Namespace::Entry* lookupFunctionCallSite(U32 callTypeIp, StringTableEntry fnNamespace, StringTableEntry fnName);
+
 
    void addToCodeList();
    void removeFromCodeList();
@@ -143,9 +182,11 @@ public:
    /// -1 a new frame is created. If the index is out of range the
    /// top stack frame is used.
    /// @param packageName The code package name or null.
+   /// @param argValues Optional typed arguments matching argv.  Typed arguments
+   /// that have not been formatted are assigned without going through a string.
    const char *exec(U32 offset, const char *fnName, Namespace *ns, U32 argc, 
       const char **argv, bool noCalls, StringTableEntry packageName, 
-      S32 setFrame = -1);
+      S32 setFrame = -1, ConsoleValue *argValues = NULL);
 };
 
 #endif
@@ -447,7 +447,7 @@ static void setFieldComponent( SimObject* object, StringTableEntry field, const
     }
 }
 
-const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNamespace, U32 argc, const char **argv, bool noCalls, StringTableEntry packageName, S32 setFrame)
+const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNamespace, U32 argc, const char **argv, bool noCalls, StringTableEntry packageName, S32 setFrame, ConsoleValue *argValues)
 {
 #ifdef TORQUE_DEBUG
    U32 stackStart = STR.mStartStackSize;
@@ -503,6 +503,29 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
       {
          StringTableEntry var = CodeToSTE(code, ip + (2 + 6 + 1) + (i * 2));
          gEvalState.setCurVarNameCreate(var);
+
+         if(argValues && argValues[i+1].isNumeric())
+         {
+            // NOTE:- Only integral values are assigned directly as the dictionary stores
+            // floats at a lower precision than they are formatted with.
+            const ConsoleValue& argValue = argValues[i+1];
+            if(argValue.getType() == ConsoleValue::TypeInt)
+            {
+               gEvalState.setIntVariable(argValue.getIntValue());
+               continue;
+            }
+
+            const F64 floatValue = argValue.getFloatValue();
+            if(mFabsD(floatValue) < 1e9 && (F64)(S32)floatValue == floatValue)
+            {
+               gEvalState.setIntVariable((S32)floatValue);
+               continue;
+            }
+
+            gEvalState.setStringVariable(argValues[i+1].getStringValue());
+            continue;
+         }
+
          gEvalState.setStringVariable(argv[i+1]);
       }
       ip = ip + (fnArgc * 2) + (2 + 6 + 1);
@@ -562,6 +585,7 @@ const char *CodeBlock::exec(U32 ip, const char *functionName, Namespace *thisNam
 
    U32 callArgc;
    const char **callArgv;
+   ConsoleValue *callArgValues;
 
    static char curFieldArray[256];
    static char prevFieldArray[256];
@@ -1419,9 +1443,9 @@ breakContinue:
             fnNamespace = CodeToSTE(code, ip+2);
             fnName      = CodeToSTE(code, ip);
 
-            // Try to look it up.
-            ns = Namespace::find(fnNamespace);
-            nsEntry = ns->lookup(fnName);
+            // Try to look it up.  The call site caches the entry until the
+            // namespaces change (package activation, function definition etc).
+            nsEntry = lookupFunctionCallSite(ip+4, fnNamespace, fnName);
             if(!nsEntry)
             {
                ip+= 5;
@@ -1432,14 +1456,7 @@ breakContinue:
                STR.popFrame();
                break;
             }
-            // Now, rewrite our code a bit (ie, avoid future lookups) and fall
-            // through to OP_CALLFUNC
-#ifdef TORQUE_64
-            *((U64*)(code+ip+2)) = ((U64)nsEntry);
-#else
-            code[ip+2] = ((U32)nsEntry);
-#endif
-            code[ip-1] = OP_CALLFUNC;
+            // Fall through to OP_CALLFUNC with the entry resolved.
 
          case OP_CALLFUNC:
          {
@@ -1458,28 +1475,25 @@ breakContinue:
                gEvalState.stack.last()->ip = ip - 1;
             }
 
-            U32 callType = code[ip+4];
+            const U32 callTypeIp = ip+4;
+            U32 callType = code[callTypeIp] & CallTypeMask;
 
             ip += 5;
-            STR.getArgcArgv(fnName, &callArgc, &callArgv);
+            STR.getArgcArgvValues(fnName, &callArgc, &callArgv, &callArgValues);
 
             if(callType == FuncCallExprNode::FunctionCall) 
             {
-#ifdef TORQUE_64
-               nsEntry = ((Namespace::Entry *) *((U64*)(code+ip-3)));
-#else
-               nsEntry = ((Namespace::Entry *) *(code+ip-3));
-#endif
+               // The entry was resolved by OP_CALLFUNC_RESOLVE.
                ns = NULL;
             }
             else if(callType == FuncCallExprNode::MethodCall)
             {
                saveObject = gEvalState.thisObject;
-               gEvalState.thisObject = Sim::findObject(callArgv[1]);
+               gEvalState.thisObject = Sim::findObject(callArgValues[1].getStringValue());
                if(!gEvalState.thisObject)
                {
                   gEvalState.thisObject = 0;
-                  Con::warnf(ConsoleLogEntry::General,"%s: Unable to find object: '%s' attempting to call function '%s'", getFileLine(ip-6), callArgv[1], fnName);
+                  Con::warnf(ConsoleLogEntry::General,"%s: Unable to find object: '%s' attempting to call function '%s'", getFileLine(ip-6), callArgValues[1].getStringValue(), fnName);
                   
                   STR.popFrame(); // [neo, 5/7/2007 - #2974]
 				  STR.setStringValue("");
@@ -1492,12 +1506,15 @@ breakContinue:
                {
                   DynamicConsoleMethodComponent *pComponent = dynamic_cast<DynamicConsoleMethodComponent*>( gEvalState.thisObject );
                   if( pComponent )
+                  {
+                     STR.formatArgs();
                      pComponent->callMethodArgList( callArgc, callArgv, false );
+                  }
                }
                
                ns = gEvalState.thisObject->getNamespace();
                if(ns)
-                  nsEntry = ns->lookup(fnName);
+                  nsEntry = lookupCallSite(callTypeIp, ns, fnName);
                else
                   nsEntry = NULL;
             }
@@ -1507,7 +1524,7 @@ breakContinue:
                {
                   ns = thisNamespace->mParent;
                   if(ns)
-                     nsEntry = ns->lookup(fnName);
+                     nsEntry = lookupCallSite(callTypeIp, ns, fnName);
                   else
                      nsEntry = NULL;
                }
@@ -1553,7 +1570,13 @@ breakContinue:
             {
                const char *ret = "";
                if(nsEntry->mFunctionOffset)
-                  ret = nsEntry->mCode->exec(nsEntry->mFunctionOffset, fnName, nsEntry->mNamespace, callArgc, callArgv, false, nsEntry->mPackage);
+               {
+                  // Tracing requires the argument strings.
+                  if(gEvalState.traceOn)
+                     STR.formatArgs();
+
+                  ret = nsEntry->mCode->exec(nsEntry->mFunctionOffset, fnName, nsEntry->mNamespace, callArgc, callArgv, false, nsEntry->mPackage, -1, callArgValues);
+               }
                
                STR.popFrame();
                STR.setStringValue(ret);
@@ -1569,6 +1592,10 @@ breakContinue:
                }
                else
                {
+                  // Only value callbacks accept typed arguments.
+                  if(nsEntry->mType != Namespace::Entry::ValueCallbackType)
+                     STR.formatArgs();
+
                   switch(nsEntry->mType)
                   {
                      case Namespace::Entry::StringCallbackType:
@@ -1655,6 +1682,44 @@ breakContinue:
                            STR.setIntValue(result);
                         break;
                      }
+                     case Namespace::Entry::ValueCallbackType:
+                     {
+                        // Copy the arguments as the callback may re-enter the interpreter.
+                        ConsoleValue argValues[StringStack::MaxArgs];
+                        for(U32 i = 0; i < callArgc; i++)
+                           argValues[i] = callArgValues[i];
+
+                        ConsoleValue result = nsEntry->cb.mValueCallbackFunc(gEvalState.thisObject, callArgc, argValues);
+                        STR.popFrame();
+                        if(result.isString())
+                        {
+                           const char *ret = result.getStringValue();
+                           if(ret != STR.getStringValue())
+                              STR.setStringValue(ret);
+                           else
+                              STR.setLen(dStrlen(ret));
+                           break;
+                        }
+                        if(code[ip] == OP_STR_TO_UINT)
+                        {
+                           ip++;
+                           intStack[++UINT] = result.getIntValue();
+                           break;
+                        }
+                        else if(code[ip] == OP_STR_TO_FLT)
+                        {
+                           ip++;
+                           floatStack[++FLT] = result.getFloatValue();
+                           break;
+                        }
+                        else if(code[ip] == OP_STR_TO_NONE)
+                           ip++;
+                        else if(result.getType() == ConsoleValue::TypeInt)
+                           STR.setIntValue(result.getIntValue());
+                        else
+                           STR.setFloatValue(result.getFloatValue());
+                        break;
+                     }
                   }
                }
             }
@@ -99,7 +99,7 @@ void ConsoleConstructor::init(const char *cName, const char *fName, const char *
    funcName = fName;
    usage = usg;
    className = cName;
-   sc = 0; fc = 0; vc = 0; bc = 0; ic = 0;
+   sc = 0; fc = 0; vc = 0; bc = 0; ic = 0; valc = 0;
    group = false;
    next = first;
    ns = false;
@@ -120,6 +120,8 @@ void ConsoleConstructor::setup()
          Con::addCommand(walk->className, walk->funcName, walk->vc, walk->usage, walk->mina, walk->maxa);
       else if(walk->bc)
          Con::addCommand(walk->className, walk->funcName, walk->bc, walk->usage, walk->mina, walk->maxa);
+      else if(walk->valc)
+         Con::addCommand(walk->className, walk->funcName, walk->valc, walk->usage, walk->mina, walk->maxa);
       else if(walk->group)
          Con::markCommandGroup(walk->className, walk->funcName, walk->usage);
       else if(walk->overload)
@@ -165,6 +167,12 @@ ConsoleConstructor::ConsoleConstructor(const char *className, const char *funcNa
    bc = bfunc;
 }
 
+ConsoleConstructor::ConsoleConstructor(const char *className, const char *funcName, ValueCallback valfunc, const char *usage, S32 minArgs, S32 maxArgs)
+{
+   init(className, funcName, usage, minArgs, maxArgs);
+   valc = valfunc;
+}
+
 ConsoleConstructor::ConsoleConstructor(const char* className, const char* groupName, const char* aUsage)
 {
    init(className, groupName, usage, -1, -2);
@@ -887,6 +895,12 @@ void addCommand(const char *nsName, const char *name,BoolCallback cb, const char
    ns->addCommand(StringTable->insert(name), cb, usage, minArgs, maxArgs);
 }
 
+void addCommand(const char *nsName, const char *name,ValueCallback cb, const char *usage, S32 minArgs, S32 maxArgs)
+{
+   Namespace *ns = lookupNamespace(nsName);
+   ns->addCommand(StringTable->insert(name), cb, usage, minArgs, maxArgs);
+}
+
 void markCommandGroup(const char * nsName, const char *name, const char* usage)
 {
    Namespace *ns = lookupNamespace(nsName);
@@ -934,6 +948,11 @@ void addCommand(const char *name,BoolCallback cb,const char *usage, S32 minArgs,
    Namespace::global()->addCommand(StringTable->insert(name), cb, usage, minArgs, maxArgs);
 }
 
+void addCommand(const char *name,ValueCallback cb,const char *usage, S32 minArgs, S32 maxArgs)
+{
+   Namespace::global()->addCommand(StringTable->insert(name), cb, usage, minArgs, maxArgs);
+}
+
 const char *evaluate(const char* string, bool echo, const char *fileName)
 {
    if (echo)
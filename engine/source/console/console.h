@@ -29,6 +29,9 @@
 #ifndef _BITSET_H_
 #include "collection/bitSet.h"
 #endif
+#ifndef _CONSOLE_VALUE_H_
+#include "console/consoleValue.h"
+#endif
 #include <stdarg.h>
 
 class SimObject;
@@ -139,6 +142,8 @@ typedef const char *StringTableEntry;
 /// function exposed to the scripting language. StringCallback,
 /// IntCallback, FloatCallback, VoidCallback, and BoolCallback all
 /// represent exposed script functions returning different types.
+/// ValueCallback represents an exposed script function that receives
+/// and returns typed console values rather than strings.
 ///
 /// ConsumerCallback is used with the function Con::addConsumer; functions
 /// registered with Con::addConsumer are called whenever something is outputted
@@ -156,6 +161,7 @@ typedef S32             (*IntCallback)(SimObject *obj, S32 argc, const char *arg
 typedef F32           (*FloatCallback)(SimObject *obj, S32 argc, const char *argv[]);
 typedef void           (*VoidCallback)(SimObject *obj, S32 argc, const char *argv[]); // We have it return a value so things don't break..
 typedef bool           (*BoolCallback)(SimObject *obj, S32 argc, const char *argv[]);
+typedef ConsoleValue   (*ValueCallback)(SimObject *obj, S32 argc, ConsoleValue argv[]);
 
 typedef void (*ConsumerCallback)(ConsoleLogEntry::Level level, const char *consoleLine);
 /// @}
@@ -438,6 +444,7 @@ namespace Con
    void addCommand(const char *name, FloatCallback  cb,  const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char *, StringCallback, const char *, S32, S32)
    void addCommand(const char *name, VoidCallback   cb,   const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char *, StringCallback, const char *, S32, S32)
    void addCommand(const char *name, BoolCallback   cb,   const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char *, StringCallback, const char *, S32, S32)
+   void addCommand(const char *name, ValueCallback  cb,  const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char *, StringCallback, const char *, S32, S32)
    /// @}
 
    /// @name Namespace Function Registration
@@ -457,6 +464,7 @@ namespace Con
    void addCommand(const char *nameSpace, const char *name,FloatCallback cb,  const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
    void addCommand(const char *nameSpace, const char *name,VoidCallback cb,   const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
    void addCommand(const char *nameSpace, const char *name,BoolCallback cb,   const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
+   void addCommand(const char *nameSpace, const char *name,ValueCallback cb,  const char *usage, S32 minArgs, S32 maxArgs); ///< @copydoc addCommand(const char*, const char *, StringCallback, const char *, S32, S32)
    /// @}
 
    /// @name Special Purpose Registration
@@ -664,6 +672,7 @@ public:
    FloatCallback fc;    ///< A function/method that returns a float.
    VoidCallback vc;     ///< A function/method that returns nothing.
    BoolCallback bc;     ///< A function/method that returns a bool.
+   ValueCallback valc;  ///< A function/method that receives and returns typed values.
    bool group;          ///< Indicates that this is a group marker.
    bool overload;       ///< Indicates that this is an overload marker.
    bool ns;             ///< Indicates that this is a namespace marker.
@@ -751,6 +760,7 @@ public:
    ConsoleConstructor(const char *className, const char *funcName, FloatCallback  ffunc, const char* usage,  S32 minArgs, S32 maxArgs);
    ConsoleConstructor(const char *className, const char *funcName, VoidCallback   vfunc, const char* usage,  S32 minArgs, S32 maxArgs);
    ConsoleConstructor(const char *className, const char *funcName, BoolCallback   bfunc, const char* usage,  S32 minArgs, S32 maxArgs);
+   ConsoleConstructor(const char *className, const char *funcName, ValueCallback  valfunc, const char* usage, S32 minArgs, S32 maxArgs);
    /// @}
 
    /// @name Magic Console Constructors
@@ -816,6 +826,11 @@ public:
 	  static ConsoleConstructor g##name##obj(NULL,#name,c##name,#argString,minArgs,maxArgs);      \
       static returnType c##name(SimObject *, S32 argc, const char **argv)
 
+#  define ConsoleValueFunctionWithDocs(name,minArgs,maxArgs,argString)                    \
+      static ConsoleValue c##name(SimObject *, S32, ConsoleValue *argv);                    \
+      static ConsoleConstructor g##name##obj(NULL,#name,c##name,#argString,minArgs,maxArgs); \
+      static ConsoleValue c##name(SimObject *, S32 argc, ConsoleValue *argv)
+
 #  define ConsoleFunctionGroupEnd(groupName) \
       static ConsoleConstructor gConsoleFunctionGroup##groupName##__GroupEnd(NULL,#groupName,NULL);
 
@@ -849,6 +864,15 @@ public:
 	  static ConsoleConstructor className##name##obj(#className,#name,c##className##name##caster,#argString,minArgs,maxArgs); \
       static inline returnType c##className##name(className *object, S32 argc, const char **argv)
 
+#  define ConsoleValueMethodWithDocs(className,name,minArgs,maxArgs,argString)                                        \
+      static inline ConsoleValue c##className##name(className *, S32, ConsoleValue *argv);                            \
+      static ConsoleValue c##className##name##caster(SimObject *object, S32 argc, ConsoleValue *argv) {               \
+         AssertFatal( dynamic_cast<className*>( object ), "Object passed to " #name " is not a " #className "!" );    \
+         return c##className##name(static_cast<className*>(object),argc,argv);                                        \
+      };                                                                                                              \
+      static ConsoleConstructor className##name##obj(#className,#name,c##className##name##caster,#argString,minArgs,maxArgs); \
+      static inline ConsoleValue c##className##name(className *object, S32 argc, ConsoleValue *argv)
+
 #  define ConsoleStaticMethod(className,name,returnType,minArgs,maxArgs,usage1)                       \
       static inline returnType c##className##name(S32, const char **);                                \
       static returnType c##className##name##caster(SimObject *object, S32 argc, const char **argv) {  \
@@ -906,6 +930,20 @@ public:
          className##name##obj(#className,#name,c##className##name##caster,"",minArgs,maxArgs);        \
       static inline returnType c##className##name(S32 argc, const char **argv)
 
+#  define ConsoleValueFunctionWithDocs(name,minArgs,maxArgs,argString)              \
+      static ConsoleValue c##name(SimObject *, S32, ConsoleValue *);                \
+      static ConsoleConstructor g##name##obj(NULL,#name,c##name,"",minArgs,maxArgs);\
+      static ConsoleValue c##name(SimObject *, S32 argc, ConsoleValue *argv)
+
+#  define ConsoleValueMethodWithDocs(className,name,minArgs,maxArgs,argString)                        \
+      static inline ConsoleValue c##className##name(className *, S32, ConsoleValue *argv);            \
+      static ConsoleValue c##className##name##caster(SimObject *object, S32 argc, ConsoleValue *argv) { \
+         return c##className##name(static_cast<className*>(object),argc,argv);                        \
+      };                                                                                              \
+      static ConsoleConstructor                                                                       \
+         className##name##obj(#className,#name,c##className##name##caster,"",minArgs,maxArgs);        \
+      static inline ConsoleValue c##className##name(className *object, S32 argc, ConsoleValue *argv)
+
 
 #endif
 
@@ -74,7 +74,8 @@ public:
             IntCallbackType,
             FloatCallbackType,
             VoidCallbackType,
-            BoolCallbackType
+            BoolCallbackType,
+            ValueCallbackType
         };
 
         Namespace *mNamespace;
@@ -94,6 +95,7 @@ public:
             VoidCallback mVoidCallbackFunc;
             FloatCallback mFloatCallbackFunc;
             BoolCallback mBoolCallbackFunc;
+            ValueCallback mValueCallbackFunc;
             const char* mGroupName;
         } cb;
         Entry();
@@ -117,6 +119,7 @@ public:
     void addCommand(StringTableEntry name,FloatCallback, const char *usage, S32 minArgs, S32 maxArgs);
     void addCommand(StringTableEntry name,VoidCallback, const char *usage, S32 minArgs, S32 maxArgs);
     void addCommand(StringTableEntry name,BoolCallback, const char *usage, S32 minArgs, S32 maxArgs);
+    void addCommand(StringTableEntry name,ValueCallback, const char *usage, S32 minArgs, S32 maxArgs);
 
     void addOverload(const char *name, const char* altUsage);
 
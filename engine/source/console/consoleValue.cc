@@ -0,0 +1,66 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "console/consoleValue.h"
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+const char* ConsoleValue::getStringValue( void )
+{
+    // Finish if the value is a string or has already been formatted.
+    if ( mStringValue != NULL )
+        return mStringValue;
+
+    // Fetch the format buffer.
+    char* pBuffer = mFormatBuffer != NULL ? mFormatBuffer : Con::getReturnBuffer( FormatBufferSize );
+
+    // Format the value.
+    format( pBuffer );
+    mStringValue = pBuffer;
+
+    return mStringValue;
+}
+
+//-----------------------------------------------------------------------------
+
+void ConsoleValue::format( char* pBuffer ) const
+{
+    switch( mType )
+    {
+        case TypeInt:
+            dSprintf( pBuffer, FormatBufferSize, "%d", mIntValue );
+            break;
+
+        case TypeFloat:
+            dSprintf( pBuffer, FormatBufferSize, "%.9g", mFloatValue );
+            break;
+
+        default:
+            dStrncpy( pBuffer, mStringValue, FormatBufferSize );
+            pBuffer[FormatBufferSize-1] = 0;
+            break;
+    }
+}
@@ -0,0 +1,123 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#ifndef _CONSOLE_VALUE_H_
+#define _CONSOLE_VALUE_H_
+
+#ifndef _PLATFORM_H_
+#include "platform/platform.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A tagged console value.
+///
+/// The console VM keeps numeric values typed as they pass between instructions
+/// and into function calls, only formatting them as a string when a string is
+/// actually required.  Value callbacks (see ConsoleValueFunctionWithDocs and
+/// ConsoleValueMethodWithDocs) receive their arguments as console values.
+class ConsoleValue
+{
+public:
+    enum Type
+    {
+        TypeString,
+        TypeInt,
+        TypeFloat
+    };
+
+    enum
+    {
+        /// The buffer size required to format a numeric value.
+        FormatBufferSize = 32
+    };
+
+private:
+    Type        mType;
+    S32         mIntValue;
+    F64         mFloatValue;
+    const char* mStringValue;
+    char*       mFormatBuffer;
+
+public:
+    ConsoleValue() : mType(TypeString), mIntValue(0), mFloatValue(0.0), mStringValue(""), mFormatBuffer(NULL) {}
+
+    static inline ConsoleValue makeString( const char* pValue )     { ConsoleValue value; value.setStringValue( pValue ); return value; }
+    static inline ConsoleValue makeInt( const S32 intValue )        { ConsoleValue value; value.setIntValue( intValue ); return value; }
+    static inline ConsoleValue makeFloat( const F64 floatValue )    { ConsoleValue value; value.setFloatValue( floatValue ); return value; }
+    static inline ConsoleValue makeBool( const bool boolValue )     { ConsoleValue value; value.setIntValue( boolValue ? 1 : 0 ); return value; }
+
+    inline Type getType( void ) const                               { return mType; }
+    inline bool isString( void ) const                              { return mType == TypeString; }
+    inline bool isNumeric( void ) const                             { return mType != TypeString; }
+
+    inline void setStringValue( const char* pValue )                { mType = TypeString; mStringValue = pValue ? pValue : ""; }
+    inline void setIntValue( const S32 intValue )                   { mType = TypeInt; mIntValue = intValue; mStringValue = NULL; }
+    inline void setFloatValue( const F64 floatValue )               { mType = TypeFloat; mFloatValue = floatValue; mStringValue = NULL; }
+
+    /// Set the buffer a numeric value is formatted into when its string is requested.
+    /// The buffer must be at least FormatBufferSize bytes.  If no buffer is set then
+    /// the console return buffer is used.
+    inline void setFormatBuffer( char* pBuffer )                    { mFormatBuffer = pBuffer; }
+
+    inline S32 getIntValue( void ) const
+    {
+        if ( mType == TypeInt )
+            return mIntValue;
+
+        if ( mType == TypeFloat )
+            return (S32)mFloatValue;
+
+        return dAtoi( mStringValue );
+    }
+
+    inline F64 getFloatValue( void ) const
+    {
+        if ( mType == TypeFloat )
+            return mFloatValue;
+
+        if ( mType == TypeInt )
+            return (F64)mIntValue;
+
+        return dAtof( mStringValue );
+    }
+
+    inline bool getBoolValue( void ) const
+    {
+        if ( mType == TypeInt )
+            return mIntValue != 0;
+
+        if ( mType == TypeFloat )
+            return mFloatValue != 0.0;
+
+        return dAtob( mStringValue );
+    }
+
+    /// Get the value as a string, formatting a numeric value if it has not already been formatted.
+    const char* getStringValue( void );
+
+    /// Format a numeric value into the specified buffer (of at least FormatBufferSize bytes).
+    /// This formats identically to the string stack.
+    void format( char* pBuffer ) const;
+};
+
+#endif // _CONSOLE_VALUE_H_
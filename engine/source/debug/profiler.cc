@@ -29,6 +29,15 @@
 #include "collection/vector.h"
 #include "io/fileStream.h"
 #include "platform/threads/thread.h"
+#include "platform/platformIntrinsics.h"
+
+#if defined(TORQUE_OS_WIN32)
+#include <windows.h>
+#elif defined(TORQUE_OS_MAC) || defined(TORQUE_OS_IOS)
+#include <mach/mach_time.h>
+#else
+#include <time.h>
+#endif
 
 #include "profiler_ScriptBinding.h"
 
@@ -36,9 +45,7 @@
 ProfilerRootData *ProfilerRootData::sRootList = NULL;
 Profiler *gProfiler = NULL;
 
-#ifdef TORQUE_MULTITHREAD
 ThreadIdent gMainThread = 0;
-#endif
 
 #if defined(TORQUE_SUPPORTS_VC_INLINE_X86_ASM)
 // platform specific get hires times...
@@ -158,6 +165,30 @@ U32 endHighResolutionTimer(U32 time[2])
 
 #endif
 
+// Fetch a monotonic capture timestamp in microseconds.
+static U64 getCaptureTime()
+{
+#if defined(TORQUE_OS_WIN32)
+   static LARGE_INTEGER frequency = { 0 };
+   if(frequency.QuadPart == 0)
+      QueryPerformanceFrequency(&frequency);
+
+   LARGE_INTEGER counter;
+   QueryPerformanceCounter(&counter);
+   return (U64)((counter.QuadPart / frequency.QuadPart) * 1000000 + ((counter.QuadPart % frequency.QuadPart) * 1000000) / frequency.QuadPart);
+#elif defined(TORQUE_OS_MAC) || defined(TORQUE_OS_IOS)
+   static mach_timebase_info_data_t timebase = { 0, 0 };
+   if(timebase.denom == 0)
+      mach_timebase_info(&timebase);
+
+   return (mach_absolute_time() * timebase.numer / timebase.denom) / 1000;
+#else
+   struct timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (U64)now.tv_sec * 1000000 + (U64)(now.tv_nsec / 1000);
+#endif
+}
+
 Profiler::Profiler()
 {
    mMaxStackDepth = MaxStackDepth;
@@ -192,15 +223,27 @@ Profiler::Profiler()
    mDumpToFile      = false;
    mDumpFileName[0] = '\0';
 
-#ifdef TORQUE_MULTITHREAD
+   mCaptureEvents = NULL;
+   mCaptureWriteIndex = 0;
+   mCaptureFrameCount = 0;
+   mCaptureFrames = DefaultCaptureFrames;
+   mCaptureFrameStartTime = 0;
+   mCaptureLastFrameTime = 0.0f;
+   mCaptureFrameTimeThreshold = 0.0f;
+   mCaptureEnabled = false;
+   mCaptureDumpPending = false;
+   mCaptureFileName[0] = '\0';
+   mCaptureThresholdFileName[0] = '\0';
+
    gMainThread = ThreadManager::getCurrentThreadId();
-#endif
 }
 
 Profiler::~Profiler()
 {
    reset();
    free(mRootProfilerData);
+   mCaptureEnabled = false;
+   free(mCaptureEvents);
    gProfiler = NULL;
 }
 
@@ -276,13 +319,23 @@ void Profiler::validate()
 
 void Profiler::hashPush(ProfilerRootData *root)
 {
-#ifdef TORQUE_MULTITHREAD
-   // Ignore non-main-thread profiler activity.
+   // Ignore non-main-thread profiler activity such as thread pool workers.
    if(! ThreadManager::isCurrentThread(gMainThread) )
+   {
+      // Worker activity is still captured.
+      if(mCaptureEnabled)
+         recordCaptureEvent(root);
       return;
-#endif
+   }
 
    mStackDepth++;
+   if(mCaptureEnabled)
+   {
+      if(mStackDepth == 1)
+         beginCaptureFrame();
+      recordCaptureEvent(root);
+   }
+
    AssertFatal(mStackDepth <= (S32)mMaxStackDepth,
                   "Stack overflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
    if(!mEnabled)
@@ -372,11 +425,17 @@ void Profiler::dumpToFile(const char* fileName)
 
 void Profiler::hashPop()
 {
-#ifdef TORQUE_MULTITHREAD
-   // Ignore non-main-thread profiler activity.
+   // Ignore non-main-thread profiler activity such as thread pool workers.
    if(! ThreadManager::isCurrentThread(gMainThread) )
+   {
+      // Worker activity is still captured.
+      if(mCaptureEnabled)
+         recordCaptureEvent(NULL);
       return;
-#endif
+   }
+
+   if(mCaptureEnabled)
+      recordCaptureEvent(NULL);
 
    mStackDepth--;
    AssertFatal(mStackDepth >= 0, "Stack underflow in profiler.  You may have mismatched PROFILE_START and PROFILE_ENDs");
@@ -397,6 +456,9 @@ void Profiler::hashPop()
    }
    if(mStackDepth == 0)
    {
+      if(mCaptureEnabled)
+         endCaptureFrame();
+
       // apply the next enable...
       if(mDumpToConsole || mDumpToFile)
       {
@@ -589,6 +651,236 @@ void Profiler::dump()
     
 }
 
+void Profiler::enableCapture(bool enabled, U32 frameCount)
+{
+   if(enabled)
+   {
+      // The event buffer is never released while running as other threads may be recording into it.
+      if(!mCaptureEvents)
+      {
+         mCaptureEvents = (ProfilerCaptureEvent *) malloc(sizeof(ProfilerCaptureEvent) * CaptureEventCount);
+         for(U32 i = 0; i < CaptureEventCount; i++)
+            mCaptureEvents[i].mSequence = (U32)-1;
+      }
+
+      if(frameCount < 1)
+         frameCount = 1;
+      else if(frameCount > MaxCaptureFrames)
+         frameCount = MaxCaptureFrames;
+
+      mCaptureFrames = frameCount;
+      mCaptureFrameCount = 0;
+
+      // Start capturing with the next frame.
+      mCaptureFrameStartTime = 0;
+
+      Con::printf("Profiler capture is on (%d frames).", mCaptureFrames);
+   }
+   else
+   {
+      Con::printf("Profiler capture is off.");
+   }
+
+   mCaptureEnabled = enabled;
+}
+
+void Profiler::dumpCaptureToFile(const char *fileName)
+{
+   AssertFatal(dStrlen(fileName) < DumpFileNameLength, "Error, capture filename too long");
+   if(!mCaptureEnabled)
+   {
+      Con::warnf("Profiler::dumpCaptureToFile() - Capture is not enabled.");
+      return;
+   }
+
+   dStrcpy(mCaptureFileName, fileName);
+   mCaptureDumpPending = true;
+}
+
+void Profiler::captureOnFrameTime(F32 threshold, const char *fileName)
+{
+   AssertFatal(dStrlen(fileName) < DumpFileNameLength, "Error, capture filename too long");
+   if(threshold <= 0.0f)
+   {
+      mCaptureFrameTimeThreshold = 0.0f;
+      mCaptureThresholdFileName[0] = '\0';
+      Con::printf("Profiler frame-time capture is disarmed.");
+      return;
+   }
+
+   if(fileName[0] == '\0')
+   {
+      Con::warnf("Profiler::captureOnFrameTime() - A capture filename is required.");
+      return;
+   }
+
+   // Capturing is needed for the trigger.
+   if(!mCaptureEnabled)
+      enableCapture(true, mCaptureFrames);
+
+   dStrcpy(mCaptureThresholdFileName, fileName);
+   mCaptureFrameTimeThreshold = threshold;
+   Con::printf("Profiler frame-time capture is armed (%.2fms).", threshold);
+}
+
+void Profiler::recordCaptureEvent(ProfilerRootData *root)
+{
+   const U32 sequence = dFetchAndAdd(mCaptureWriteIndex, 1);
+   ProfilerCaptureEvent &event = mCaptureEvents[sequence & (CaptureEventCount - 1)];
+
+   // NOTE:- The sequence is written last so that an event being overwritten during a dump is (mostly) spotted and skipped.
+   event.mSequence = (U32)-1;
+   event.mRoot = root;
+   event.mThreadId = ThreadManager::getCurrentThreadId();
+   event.mTime = getCaptureTime();
+   event.mSequence = sequence;
+}
+
+void Profiler::beginCaptureFrame()
+{
+   mCaptureFrameStartIndex[mCaptureFrameCount % MaxCaptureFrames] = mCaptureWriteIndex;
+   mCaptureFrameCount++;
+   mCaptureFrameStartTime = getCaptureTime();
+}
+
+void Profiler::endCaptureFrame()
+{
+   // Ignore the frame that capture was enabled in.
+   if(mCaptureFrameStartTime == 0)
+      return;
+
+   mCaptureLastFrameTime = (F32)(getCaptureTime() - mCaptureFrameStartTime) / 1000.0f;
+
+   // Dump on a frame-time threshold?
+   if(mCaptureFrameTimeThreshold > 0.0f && mCaptureLastFrameTime >= mCaptureFrameTimeThreshold)
+   {
+      Con::printf("Profiler frame-time capture triggered (%.2fms >= %.2fms).", mCaptureLastFrameTime, mCaptureFrameTimeThreshold);
+
+      // Triggers once only.
+      mCaptureFrameTimeThreshold = 0.0f;
+      writeCapture(mCaptureThresholdFileName);
+   }
+
+   if(mCaptureDumpPending)
+   {
+      mCaptureDumpPending = false;
+      writeCapture(mCaptureFileName);
+   }
+}
+
+bool Profiler::writeCapture(const char *fileName)
+{
+   // Fetch the captured range.
+   const U32 captureFrames = mCaptureFrameCount < mCaptureFrames ? mCaptureFrameCount : mCaptureFrames;
+   const U32 firstFrame = mCaptureFrameCount - captureFrames;
+   const U32 endIndex = mCaptureWriteIndex;
+   U32 startIndex = mCaptureFrameStartIndex[firstFrame % MaxCaptureFrames];
+
+   // Clamp to the events still in the buffer.
+   if(endIndex - startIndex > CaptureEventCount)
+   {
+      Con::warnf("Profiler::writeCapture() - %d events were overwritten, increase the capture buffer or capture fewer frames.", (endIndex - startIndex) - CaptureEventCount);
+      startIndex = endIndex - CaptureEventCount;
+   }
+
+   FileStream fws;
+   if(!fws.open(fileName, FileStream::Write))
+   {
+      Con::warnf("Profiler::writeCapture() - Cannot write capture to '%s'.", fileName);
+      return false;
+   }
+
+   // Fetch the time origin.
+   // NOTE: Other threads can record events with earlier times than the first event in the buffer.
+   U64 baseTime = mCaptureEvents[startIndex & (CaptureEventCount - 1)].mTime;
+   for(U32 index = startIndex; index != endIndex; index++)
+   {
+      const ProfilerCaptureEvent &event = mCaptureEvents[index & (CaptureEventCount - 1)];
+      if(event.mSequence == index && event.mTime < baseTime)
+         baseTime = event.mTime;
+   }
+
+   // Threads seen, the first being the main thread.
+   Vector<ThreadIdent> threads;
+   Vector<S32> threadDepths;
+   threads.push_back(gMainThread);
+   threadDepths.push_back(0);
+
+   char buffer[1024];
+   dStrcpy(buffer, "{\"traceEvents\":[\n");
+   fws.write(dStrlen(buffer), buffer);
+
+   U32 frame = firstFrame;
+   U32 eventCount = 0;
+   for(U32 index = startIndex; index != endIndex; index++)
+   {
+      const ProfilerCaptureEvent &event = mCaptureEvents[index & (CaptureEventCount - 1)];
+
+      // Skip events overwritten during the dump.
+      if(event.mSequence != index)
+         continue;
+
+      // Clamp to the origin as events can still be recorded during the dump.
+      const U32 time = event.mTime > baseTime ? (U32)(event.mTime - baseTime) : 0;
+
+      // Mark frame starts.
+      while(frame < mCaptureFrameCount && (S32)(index - mCaptureFrameStartIndex[frame % MaxCaptureFrames]) >= 0)
+      {
+         dSprintf(buffer, sizeof(buffer), "%s{\"name\":\"Frame %d\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%u,\"pid\":0,\"tid\":1}", eventCount ? ",\n" : "", frame, time);
+         fws.write(dStrlen(buffer), buffer);
+         eventCount++;
+         frame++;
+      }
+
+      // Find the thread.
+      U32 thread;
+      for(thread = 0; thread < (U32)threads.size(); thread++)
+      {
+         if(ThreadManager::compare(threads[thread], event.mThreadId))
+            break;
+      }
+      if(thread == (U32)threads.size())
+      {
+         threads.push_back(event.mThreadId);
+         threadDepths.push_back(0);
+      }
+
+      if(event.mRoot)
+      {
+         threadDepths[thread]++;
+         dSprintf(buffer, sizeof(buffer), "%s{\"name\":\"%s\",\"ph\":\"B\",\"ts\":%u,\"pid\":0,\"tid\":%d}", eventCount ? ",\n" : "", event.mRoot->mName, time, thread + 1);
+      }
+      else
+      {
+         // Skip ends whose begin is no longer captured.
+         if(threadDepths[thread] == 0)
+            continue;
+
+         threadDepths[thread]--;
+         dSprintf(buffer, sizeof(buffer), "%s{\"ph\":\"E\",\"ts\":%u,\"pid\":0,\"tid\":%d}", eventCount ? ",\n" : "", time, thread + 1);
+      }
+      fws.write(dStrlen(buffer), buffer);
+      eventCount++;
+   }
+
+   // Name the threads.
+   for(U32 thread = 0; thread < (U32)threads.size(); thread++)
+   {
+      if(thread == 0)
+         dSprintf(buffer, sizeof(buffer), "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":1,\"args\":{\"name\":\"Main\"}}", eventCount ? ",\n" : "");
+      else
+         dSprintf(buffer, sizeof(buffer), ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":0,\"tid\":%d,\"args\":{\"name\":\"Worker %d\"}}", thread + 1, thread);
+      fws.write(dStrlen(buffer), buffer);
+   }
+
+   dStrcpy(buffer, "\n]}\n");
+   fws.write(dStrlen(buffer), buffer);
+   fws.close();
+
+   Con::printf("Profiler capture of %d frames (%d events) written to '%s'.", captureFrames, eventCount, fileName);
+   return true;
+}
+
 void Profiler::enableMarker(const char *marker, bool enable)
 {
    reset();
@@ -27,8 +27,13 @@
 
 #ifdef TORQUE_ENABLE_PROFILER
 
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
 struct ProfilerData;
 struct ProfilerRootData;
+struct ProfilerCaptureEvent;
 /// The Profiler is used to see how long a specific chunk of code takes to execute.
 /// All values outputted by the profiler are percentages of the time that it takes
 /// to run entire main loop.
@@ -41,8 +46,15 @@ struct ProfilerRootData;
 /// profilerDump();                                         //dumps all profiler data to the console
 /// profilerDumpToFile(string filename);                    //dumps all profiler data to a given file
 /// profilerMarkerEnable((string markerName, bool enable);  //enables or disables a given profile tag
+/// profilerCaptureEnable(bool enable, [int frameCount]);   //enables or disables capturing events for the last frames
+/// profilerCaptureDump(string filename);                   //dumps the captured events to a Chrome trace file
+/// profilerCaptureOnFrameTime(float ms, string filename);  //dumps the captured events when a frame takes longer than the threshold
 /// @endcode
 ///
+/// Event capture is independent of the profile totals.  When enabled, every PROFILE_START/PROFILE_END
+/// (from any thread) records a timestamped begin/end event into a ring buffer that holds the last few frames.
+/// The captured events are written in the Chrome trace format which can be viewed with "chrome://tracing".
+///
 /// The C++ code side of the profiler uses pairs of PROFILE_START() and PROFILE_END().
 ///
 /// When using these macros, make sure there is a PROFILE_END() for every PROFILE_START
@@ -69,7 +81,10 @@ class Profiler
 {
    enum {
       MaxStackDepth = 256,
-      DumpFileNameLength = 256
+      DumpFileNameLength = 256,
+      CaptureEventCount = 1 << 18,
+      MaxCaptureFrames = 1024,
+      DefaultCaptureFrames = 60
    };
    U32 mCurrentHash;
 
@@ -84,8 +99,27 @@ class Profiler
    bool mDumpToConsole;
    bool mDumpToFile;
    char mDumpFileName[DumpFileNameLength];
+
+   /// Event capture.
+   ProfilerCaptureEvent *mCaptureEvents;
+   volatile U32 mCaptureWriteIndex;
+   U32 mCaptureFrameStartIndex[MaxCaptureFrames];
+   U32 mCaptureFrameCount;
+   U32 mCaptureFrames;
+   U64 mCaptureFrameStartTime;
+   F32 mCaptureLastFrameTime;
+   F32 mCaptureFrameTimeThreshold;
+   bool mCaptureEnabled;
+   bool mCaptureDumpPending;
+   char mCaptureFileName[DumpFileNameLength];
+   char mCaptureThresholdFileName[DumpFileNameLength];
+
    void dump();
    void validate();
+   void recordCaptureEvent(ProfilerRootData *root);
+   void beginCaptureFrame();
+   void endCaptureFrame();
+   bool writeCapture(const char *fileName);
 public:
    Profiler();
    ~Profiler();
@@ -105,6 +139,19 @@ public:
    void hashPop();
    /// Enable a profiler marker
    void enableMarker(const char *marker, bool enabled);
+   /// Enable event capture for the last frames
+   /// @param frameCount number of frames to keep
+   void enableCapture(bool enabled, U32 frameCount = DefaultCaptureFrames);
+   inline bool isCaptureEnabled() const { return mCaptureEnabled; }
+   /// Dumps the captured events to a Chrome trace file at the end of the frame
+   /// @param fileName filename to dump the events to
+   void dumpCaptureToFile(const char *fileName);
+   /// Dumps the captured events to a Chrome trace file at the end of the first frame that takes at least the threshold
+   /// @param threshold frame time threshold in milliseconds (zero to disarm)
+   /// @param fileName filename to dump the events to
+   void captureOnFrameTime(F32 threshold, const char *fileName);
+   /// Time of the last captured frame in milliseconds
+   inline F32 getCaptureLastFrameTime() const { return mCaptureLastFrameTime; }
 };
 
 extern Profiler *gProfiler;
@@ -148,6 +195,14 @@ struct ProfilerData
    F64 mSubTime;
 };
 
+struct ProfilerCaptureEvent
+{
+   ProfilerRootData *mRoot; ///< root for a begin event, NULL for an end event.
+   ThreadIdent mThreadId;
+   U64 mTime; ///< microseconds.
+   U32 mSequence; ///< capture write index, used to spot overwritten events.
+};
+
 #undef PROFILE_START
 #define PROFILE_START(name) \
 static ProfilerRootData pdata##name##obj (#name); \
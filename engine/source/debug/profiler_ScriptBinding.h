@@ -77,6 +77,48 @@ ConsoleFunctionWithDocs(profilerReset, ConsoleVoid, 1, 1, ())
       gProfiler->reset();
 }
 
+/*! Enables (or disables) capturing profiler events for the last frames.
+    Captured events include their begin/end times and thread and can be dumped in the Chrome trace format.
+    @param enable Whether to capture events or not.
+    @param frameCount The number of frames to keep (defaults to 60, max 1024).
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(profilerCaptureEnable, ConsoleVoid, 2, 3, (bool enable, [int frameCount]))
+{
+   if(gProfiler)
+      gProfiler->enableCapture(dAtob(argv[1]), argc > 2 ? dAtoi(argv[2]) : 60);
+}
+
+/*! Dumps the captured profiler events to a Chrome trace file at the end of the current frame.
+    @param filename The file to write the Chrome trace to.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(profilerCaptureDump, ConsoleVoid, 2, 2, (string filename))
+{
+   if(gProfiler)
+      gProfiler->dumpCaptureToFile(argv[1]);
+}
+
+/*! Dumps the captured profiler events to a Chrome trace file at the end of the first frame taking at least the specified time.
+    Capture is enabled if it is not already.  The trigger fires once and must be re-armed to capture again.
+    @param milliseconds The frame-time threshold in milliseconds.  Zero disarms the trigger.
+    @param filename The file to write the Chrome trace to.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(profilerCaptureOnFrameTime, ConsoleVoid, 2, 3, (float milliseconds, [string filename]))
+{
+   if(gProfiler)
+      gProfiler->captureOnFrameTime(dAtof(argv[1]), argc > 2 ? argv[2] : "");
+}
+
+/*! Gets the time of the last captured frame.
+    @return The time of the last captured frame in milliseconds.
+*/
+ConsoleFunctionWithDocs(profilerCaptureGetLastFrameTime, ConsoleFloat, 1, 1, ())
+{
+   return gProfiler ? gProfiler->getCaptureLastFrameTime() : 0.0f;
+}
+
 ConsoleFunctionGroupEnd( Profiler );
 
 /*! @} */ // group ProfilerFunctions
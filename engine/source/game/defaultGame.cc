@@ -81,6 +81,10 @@
 #include "2d/core/ParticleSystem.h"
 #endif
 
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
 #ifdef TORQUE_OS_IOS
 #include "platformiOS/iOSProfiler.h"
 #endif
@@ -129,12 +133,12 @@ bool initializeLibraries()
 #if defined(TORQUE_OS_IOS) || defined(TORQUE_OS_ANDROID) || defined(TORQUE_OS_EMSCRIPTEN)
    //3MB default is way too big for iPhone!!!
 #ifdef	TORQUE_SHIPPING
-    FrameAllocator::init(256 * 1024);	//256KB for now... but let's test and see!
+    FrameAllocator::init(256 * 1024, 256 * 1024);	//256KB for now... but let's test and see!
 #else
-    FrameAllocator::init(512 * 1024);	//512KB for now... but let's test and see!
+    FrameAllocator::init(512 * 1024, 256 * 1024);	//512KB for now... but let's test and see!
 #endif	//TORQUE_SHIPPING
 #else
-    FrameAllocator::init(3 << 20);      // 3 meg frame allocator buffer
+    FrameAllocator::init(3 << 20, 1 << 20);      // 3 meg frame allocator buffer, 1 meg for each other thread using it
 #endif	//TORQUE_OS_IOS
 
     TextureManager::create();
@@ -164,6 +168,9 @@ bool initializeLibraries()
 
     // Initialize the particle system.
     ParticleSystem::Init();
+
+    // Initialize the thread pool.
+    ThreadPool::init();
     
 #if defined(TORQUE_OS_IOS) && defined(_USE_STORE_KIT)
     storeInit();
@@ -183,6 +190,9 @@ void shutdownLibraries()
     TelnetDebugger::destroy();
     TelnetConsole::destroy();
 
+    // Destroy the thread pool.
+    ThreadPool::destroy();
+
     Sim::shutdown();
     Platform::shutdown();
 
@@ -482,6 +492,7 @@ void DefaultGame::mainLoop( void )
          PROFILE_START(GameProcessEvents);
     Game->processEvents(); // process all non-sim posted events.
          PROFILE_END();
+    FrameAllocator::endFrame(); // all frame allocations must be released by now.
          PROFILE_END();
     
 #ifdef TORQUE_OS_IOS_PROFILE
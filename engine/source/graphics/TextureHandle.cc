@@ -93,6 +93,13 @@ void TextureHandle::refresh( void )
 
 //-----------------------------------------------------------------------------
 
+void TextureHandle::refresh( const RectI& area )
+{
+    TextureManager::refresh( object, area );
+}
+
+//-----------------------------------------------------------------------------
+
 const char* TextureHandle::getTextureKey( void ) const
 {
     return (object ? object->mTextureKey : NULL);
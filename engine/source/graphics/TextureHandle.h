@@ -105,6 +105,8 @@ class TextureObject;
 ///
 /// Also note the operator TextureObject*, as you can actually cast
 /// a TextureHandle to a TextureObject* if necessary.
+class RectI;
+
 class TextureHandle
 {    
 public:
@@ -168,6 +170,8 @@ public:
 
     void refresh( void );
 
+    void refresh( const RectI& area );
+
     operator TextureObject*() { return object; }
     inline bool NotNull( void ) const { return object != NULL; }
     inline bool IsNull( void ) const { return object == NULL; }
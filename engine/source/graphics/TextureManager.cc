@@ -49,6 +49,13 @@ S32 TextureManager::mBitmapResidentSize = 0;
 S32 TextureManager::mTextureResidentSize = 0;
 S32 TextureManager::mTextureResidentWasteSize = 0;
 S32 TextureManager::mTextureResidentCount = 0;
+TextureManager::typePreloadedBitmapHash TextureManager::mPreloadedBitmaps;
+TextureManager::typeTextureUploadVector TextureManager::mTextureUploads;
+S32 TextureManager::mTextureUploadBudget = 2 * 1024 * 1024;
+S32 TextureManager::mTextureUploadRemaining = TextureManager::mTextureUploadBudget;
+S32 TextureManager::mTexturePendingSize = 0;
+S32 TextureManager::mTextureUploadedSize = 0;
+U32 TextureManager::mTextureNameGeneration = 0;
 
 //---------------------------------------------------------------------------------------------------------------------
 
@@ -155,6 +162,7 @@ void TextureManager::create()
     Con::addVariable("$pref::OpenGL::force16BitTexture", TypeBool, &TextureManager::mForce16BitTexture);
     Con::addVariable("$pref::OpenGL::allowTextureCompression", TypeBool, &TextureManager::mAllowTextureCompression);
     Con::addVariable("$pref::OpenGL::disableTextureSubImageUpdates", TypeBool, &TextureManager::mDisableTextureSubImageUpdates);
+    Con::addVariable("$pref::OpenGL::textureUploadBudget", TypeS32, &TextureManager::mTextureUploadBudget);
 
     // Flag as alive.
     mManagerState = Alive;
@@ -169,7 +177,12 @@ void TextureManager::destroy()
     // Destroy the texture dictionary.
     TextureDictionary::destroy();
 
+    // Purge any preloaded bitmaps.
+    purgePreloadedBitmaps();
+
     // Reset state.
+    mTexturePendingSize = 0;
+    mTextureUploadedSize = 0;
     mBitmapResidentSize = 0;
     mTextureResidentSize = 0;
     mTextureResidentWasteSize = 0;
@@ -196,6 +209,14 @@ void TextureManager::killManager()
 
     Vector<GLuint> deleteNames(4096);
 
+    // Delete any pending uploads.
+    for( typeTextureUploadVector::iterator uploadItr = mTextureUploads.begin(); uploadItr != mTextureUploads.end(); ++uploadItr )
+    {
+        deleteNames.push_back( uploadItr->mGLTextureName );
+        uploadItr->mGLTextureName = 0;
+    }
+    cancelTextureUploads();
+
     TextureObject* probe = TextureDictionary::TextureObjectChain;
     while (probe) 
     {
@@ -352,9 +373,14 @@ GBitmap* TextureManager::createPowerOfTwoBitmap(GBitmap* pBitmap)
 
 void TextureManager::freeTexture( TextureObject* pTextureObject )
 {
+    // Cancel any pending upload.
+    if ( pTextureObject->mUploadPending )
+        cancelTextureUpload( pTextureObject );
+
     if((mDGLRender || mManagerState == Resurrecting) && pTextureObject->mGLTextureName)
     {
         glDeleteTextures(1, (const GLuint*)&pTextureObject->mGLTextureName);
+        mTextureNameGeneration++;
 
         // Adjust metrics.
         mTextureResidentCount--;
@@ -596,6 +622,35 @@ void TextureManager::refresh( TextureObject* pTextureObject )
 
     // Fetch bitmaps.
     GBitmap* pSourceBitmap = pTextureObject->mpBitmap;
+
+    // Upload in strips if possible.
+    if ( canUploadInStrips( pTextureObject ) )
+    {
+        const S32 uploadSize = pTextureObject->mTextureWidth * pTextureObject->mTextureHeight * pSourceBitmap->bytesPerPixel;
+
+        // Queue the upload if it cannot be completed within the frame budget.
+        if ( pTextureObject->mHandleType == TextureHandle::BitmapTexture &&
+            mManagerState == Alive &&
+            mTextureUploadBudget > 0 &&
+            ( mTextureUploads.size() > 0 || uploadSize > mTextureUploadRemaining ) )
+        {
+            queueTextureUpload( pTextureObject );
+            return;
+        }
+
+        // Upload immediately.
+        // NOTE:- Strips are uploaded directly from the bitmap so no power-of-two copy is required.
+        glBindTexture( GL_TEXTURE_2D, pTextureObject->mGLTextureName );
+        allocateTexture( pSourceBitmap, pTextureObject->mTextureWidth, pTextureObject->mTextureHeight );
+        uploadTextureRows( pSourceBitmap, pTextureObject->mTextureWidth, pTextureObject->mTextureHeight, 0, pTextureObject->mTextureHeight );
+        applyTextureParameters( pTextureObject );
+
+        // Adjust metrics.
+        mTextureUploadRemaining = getMax( mTextureUploadRemaining - uploadSize, 0 );
+        mTextureUploadedSize += uploadSize;
+        return;
+    }
+
     GBitmap* pNewBitmap = createPowerOfTwoBitmap(pSourceBitmap);
    
     U8 *bits = (U8*)pNewBitmap->getBits();
@@ -683,6 +738,71 @@ void TextureManager::refresh( TextureObject* pTextureObject )
             bits);
     }
 
+    applyTextureParameters( pTextureObject );
+
+    if(pNewBitmap != pSourceBitmap)
+    {
+        delete pNewBitmap;
+    }
+   
+    if (lumBits)
+        delete[] lumBits;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::refresh( TextureObject* pTextureObject, const RectI& area )
+{
+    // Finish if refresh not appropriate.
+    if (!(mDGLRender || mManagerState == Resurrecting))
+        return;
+
+    // Sanity!
+    AssertISV( pTextureObject->mGLTextureName != 0, "Refreshing texture but no texture created." );
+    AssertISV( pTextureObject->mpBitmap != 0, "Refreshing texture but no bitmap available." );
+
+    // Refresh the whole texture if the area cannot be updated alone.
+    if ( !canUploadInStrips( pTextureObject ) )
+    {
+        refresh( pTextureObject );
+        return;
+    }
+
+    // Fetch bitmap.
+    GBitmap* pBitmap = pTextureObject->mpBitmap;
+
+    // Clip the area to the bitmap.
+    RectI updateArea( area );
+    if ( !updateArea.intersect( RectI( 0, 0, pBitmap->getWidth(), pBitmap->getHeight() ) ) )
+        return;
+
+    // Fetch source/dest formats.
+    U32 sourceFormat, destFormat, byteFormat, texelSize;
+    getSourceDestByteFormat( pBitmap, &sourceFormat, &destFormat, &byteFormat, &texelSize );
+
+    // Bind texture.
+    glBindTexture( GL_TEXTURE_2D, pTextureObject->mGLTextureName );
+
+    // Bitmap rows are tightly packed.
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+
+    // Upload the area a row at a time as the row length cannot be specified on all platforms.
+    for ( S32 row = updateArea.point.y; row < updateArea.point.y + updateArea.extent.y; ++row )
+    {
+        glTexSubImage2D( GL_TEXTURE_2D, 0, updateArea.point.x, row, updateArea.extent.x, 1, sourceFormat, byteFormat, pBitmap->getAddress( updateArea.point.x, row ) );
+    }
+
+    // Restore the default alignment.
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::applyTextureParameters( TextureObject* pTextureObject )
+{
+    // Bind texture.
+    glBindTexture( GL_TEXTURE_2D, pTextureObject->mGLTextureName );
+
     const GLuint filter = pTextureObject->getFilter();
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filter);
@@ -695,14 +815,302 @@ void TextureManager::refresh( TextureObject* pTextureObject )
 
     glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, glClamp );
     glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, glClamp );
+}
 
-    if(pNewBitmap != pSourceBitmap)
+//--------------------------------------------------------------------------------------------------------------------
+
+bool TextureManager::canUploadInStrips( TextureObject* pTextureObject )
+{
+    // Strips require sub-image updates.
+    if ( mDisableTextureSubImageUpdates )
+        return false;
+
+    // Fetch bitmap.
+    const GBitmap* pBitmap = pTextureObject->mpBitmap;
+
+    // 16-bit conversion requires a full copy of the bitmap.
+    if ( pBitmap->mForce16Bit )
+        return false;
+
+    // Only uncompressed colour formats are uploaded in strips.
+    const GBitmap::BitmapFormat format = pBitmap->getFormat();
+    return format == GBitmap::RGB || format == GBitmap::RGBA;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::allocateTexture( GBitmap* pBitmap, const U32 textureWidth, const U32 textureHeight )
+{
+    // Fetch source/dest formats.
+    U32 sourceFormat, destFormat, byteFormat, texelSize;
+    getSourceDestByteFormat( pBitmap, &sourceFormat, &destFormat, &byteFormat, &texelSize );
+
+    // Allocate the texture without any contents.
+    glTexImage2D( GL_TEXTURE_2D, 0, destFormat, textureWidth, textureHeight, 0, sourceFormat, byteFormat, NULL );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::uploadTextureRows( GBitmap* pBitmap, const U32 textureWidth, const U32 textureHeight, const U32 startRow, const U32 rowCount )
+{
+    // Fetch source/dest formats.
+    U32 sourceFormat, destFormat, byteFormat, texelSize;
+    getSourceDestByteFormat( pBitmap, &sourceFormat, &destFormat, &byteFormat, &texelSize );
+
+    const U32 bitmapWidth = pBitmap->getWidth();
+    const U32 bitmapHeight = pBitmap->getHeight();
+    const U32 bytesPerPixel = pBitmap->bytesPerPixel;
+    const U32 endRow = getMin( startRow + rowCount, textureHeight );
+
+    // Bitmap rows are tightly packed.
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+
+    // Upload the bitmap rows.
+    if ( startRow < bitmapHeight )
     {
-        delete pNewBitmap;
+        const U32 bitmapEndRow = getMin( endRow, bitmapHeight );
+        const U32 bitmapRowCount = bitmapEndRow - startRow;
+
+        glTexSubImage2D( GL_TEXTURE_2D, 0, 0, startRow, bitmapWidth, bitmapRowCount, sourceFormat, byteFormat, pBitmap->getAddress( 0, startRow ) );
+
+        // Pad the power-of-two width by repeating the last pixel of each row.
+        if ( textureWidth > bitmapWidth )
+        {
+            const U32 padWidth = textureWidth - bitmapWidth;
+            Vector<U8> padBuffer;
+            padBuffer.setSize( padWidth * bitmapRowCount * bytesPerPixel );
+            U8* pDest = padBuffer.address();
+
+            for ( U32 row = startRow; row < bitmapEndRow; ++row )
+            {
+                const U8* pLastPixel = pBitmap->getAddress( bitmapWidth-1, row );
+                for ( U32 n = 0; n < padWidth; ++n )
+                {
+                    dMemcpy( pDest, pLastPixel, bytesPerPixel );
+                    pDest += bytesPerPixel;
+                }
+            }
+
+            glTexSubImage2D( GL_TEXTURE_2D, 0, bitmapWidth, startRow, padWidth, bitmapRowCount, sourceFormat, byteFormat, padBuffer.address() );
+        }
+    }
+
+    // Pad the power-of-two height by repeating the last bitmap row.
+    if ( endRow > bitmapHeight )
+    {
+        Vector<U8> rowBuffer;
+        rowBuffer.setSize( textureWidth * bytesPerPixel );
+        U8* pDest = rowBuffer.address();
+        dMemcpy( pDest, pBitmap->getAddress( 0, bitmapHeight-1 ), bitmapWidth * bytesPerPixel );
+        pDest += bitmapWidth * bytesPerPixel;
+
+        const U8* pLastPixel = pBitmap->getAddress( bitmapWidth-1, bitmapHeight-1 );
+        for ( U32 n = bitmapWidth; n < textureWidth; ++n )
+        {
+            dMemcpy( pDest, pLastPixel, bytesPerPixel );
+            pDest += bytesPerPixel;
+        }
+
+        for ( U32 row = getMax( startRow, bitmapHeight ); row < endRow; ++row )
+        {
+            glTexSubImage2D( GL_TEXTURE_2D, 0, 0, row, textureWidth, 1, sourceFormat, byteFormat, rowBuffer.address() );
+        }
+    }
+
+    // Restore the default alignment.
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+GBitmap* TextureManager::createPlaceholderBitmap( const GBitmap* pBitmap, const U32 textureWidth, const U32 textureHeight )
+{
+    const U32 bitmapWidth = pBitmap->getWidth();
+    const U32 bitmapHeight = pBitmap->getHeight();
+    const U32 bytesPerPixel = pBitmap->bytesPerPixel;
+
+    // Calculate the placeholder size.
+    // NOTE:- The placeholder covers the whole power-of-two texture so texture coordinates are unchanged.
+    const U32 placeholderWidth = getMin( textureWidth, (U32)TexturePlaceholderDimension );
+    const U32 placeholderHeight = getMin( textureHeight, (U32)TexturePlaceholderDimension );
+    const U32 blockWidth = textureWidth / placeholderWidth;
+    const U32 blockHeight = textureHeight / placeholderHeight;
+
+    // Sample at most 4x4 texels per block.
+    const U32 sampleStepX = getMax( blockWidth / 4, (U32)1 );
+    const U32 sampleStepY = getMax( blockHeight / 4, (U32)1 );
+
+    GBitmap* pPlaceholder = new GBitmap( placeholderWidth, placeholderHeight, false, pBitmap->getFormat() );
+
+    for ( U32 y = 0; y < placeholderHeight; ++y )
+    {
+        for ( U32 x = 0; x < placeholderWidth; ++x )
+        {
+            U32 totals[4] = { 0, 0, 0, 0 };
+            U32 sampleCount = 0;
+
+            // Average the block, clamping to the bitmap as the power-of-two padding does.
+            for ( U32 sampleY = y * blockHeight; sampleY < (y+1) * blockHeight; sampleY += sampleStepY )
+            {
+                for ( U32 sampleX = x * blockWidth; sampleX < (x+1) * blockWidth; sampleX += sampleStepX )
+                {
+                    const U8* pSample = pBitmap->getAddress( getMin( sampleX, bitmapWidth-1 ), getMin( sampleY, bitmapHeight-1 ) );
+                    for ( U32 n = 0; n < bytesPerPixel; ++n )
+                        totals[n] += pSample[n];
+
+                    sampleCount++;
+                }
+            }
+
+            U8* pDest = pPlaceholder->getAddress( x, y );
+            for ( U32 n = 0; n < bytesPerPixel; ++n )
+                pDest[n] = (U8)(totals[n] / sampleCount);
+        }
+    }
+
+    return pPlaceholder;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::queueTextureUpload( TextureObject* pTextureObject )
+{
+    // Sanity!
+    AssertFatal( !pTextureObject->mUploadPending, "TextureManager::queueTextureUpload() - Texture upload is already pending." );
+
+    // Fetch bitmap.
+    GBitmap* pBitmap = pTextureObject->mpBitmap;
+    const U32 textureWidth = pTextureObject->mTextureWidth;
+    const U32 textureHeight = pTextureObject->mTextureHeight;
+
+    // Fetch source/dest formats.
+    U32 sourceFormat, destFormat, byteFormat, texelSize;
+    getSourceDestByteFormat( pBitmap, &sourceFormat, &destFormat, &byteFormat, &texelSize );
+
+    // Show a low-resolution placeholder until the upload completes.
+    GBitmap* pPlaceholder = createPlaceholderBitmap( pBitmap, textureWidth, textureHeight );
+    glBindTexture( GL_TEXTURE_2D, pTextureObject->mGLTextureName );
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+    glTexImage2D( GL_TEXTURE_2D, 0, destFormat, pPlaceholder->getWidth(), pPlaceholder->getHeight(), 0, sourceFormat, byteFormat, pPlaceholder->getBits() );
+    glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+    applyTextureParameters( pTextureObject );
+    delete pPlaceholder;
+
+    // Allocate the texture being uploaded.
+    TextureUpload upload;
+    upload.mpTextureObject = pTextureObject;
+    upload.mpBitmap = pBitmap;
+    upload.mUploadedRows = 0;
+    glGenTextures( 1, &upload.mGLTextureName );
+    glBindTexture( GL_TEXTURE_2D, upload.mGLTextureName );
+    allocateTexture( pBitmap, textureWidth, textureHeight );
+    mTextureUploads.push_back( upload );
+
+    // Take ownership of the bitmap.
+    pTextureObject->mpBitmap = NULL;
+    pTextureObject->mUploadPending = true;
+
+    // Adjust metrics.
+    mTexturePendingSize += textureWidth * textureHeight * pBitmap->bytesPerPixel;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::cancelTextureUpload( TextureObject* pTextureObject )
+{
+    for ( U32 index = 0; index < (U32)mTextureUploads.size(); ++index )
+    {
+        TextureUpload& upload = mTextureUploads[index];
+
+        // Skip if not the texture.
+        if ( upload.mpTextureObject != pTextureObject )
+            continue;
+
+        // Delete the texture being uploaded.
+        if ( upload.mGLTextureName != 0 && (mDGLRender || mManagerState == Resurrecting) )
+            glDeleteTextures( 1, &upload.mGLTextureName );
+
+        // Adjust metrics.
+        mTexturePendingSize -= (pTextureObject->mTextureHeight - upload.mUploadedRows) * pTextureObject->mTextureWidth * upload.mpBitmap->bytesPerPixel;
+
+        delete upload.mpBitmap;
+        mTextureUploads.erase( index );
+        break;
+    }
+
+    pTextureObject->mUploadPending = false;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::cancelTextureUploads( void )
+{
+    while( mTextureUploads.size() > 0 )
+    {
+        cancelTextureUpload( mTextureUploads.front().mpTextureObject );
+    }
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::processTextureUploads( void )
+{
+    // Reset the frame budget.
+    mTextureUploadRemaining = mTextureUploadBudget > 0 ? mTextureUploadBudget : S32_MAX;
+
+    // Finish if not rendering.
+    if ( !mDGLRender || mManagerState != Alive )
+        return;
+
+    bool uploadedRows = false;
+
+    while( mTextureUploads.size() > 0 )
+    {
+        TextureUpload& upload = mTextureUploads.front();
+        TextureObject* pTextureObject = upload.mpTextureObject;
+        const U32 textureWidth = pTextureObject->mTextureWidth;
+        const U32 textureHeight = pTextureObject->mTextureHeight;
+        const S32 rowSize = textureWidth * upload.mpBitmap->bytesPerPixel;
+
+        // Calculate the rows within the budget.
+        // NOTE:- At least one row is uploaded per frame so progress is always made.
+        U32 rowCount = getMin( (U32)(mTextureUploadRemaining / rowSize), textureHeight - upload.mUploadedRows );
+        if ( rowCount == 0 )
+        {
+            if ( uploadedRows )
+                break;
+
+            rowCount = 1;
+        }
+
+        // Upload the strip.
+        glBindTexture( GL_TEXTURE_2D, upload.mGLTextureName );
+        uploadTextureRows( upload.mpBitmap, textureWidth, textureHeight, upload.mUploadedRows, rowCount );
+        upload.mUploadedRows += rowCount;
+        uploadedRows = true;
+
+        // Adjust metrics.
+        const S32 uploadSize = rowCount * rowSize;
+        mTextureUploadRemaining = getMax( mTextureUploadRemaining - uploadSize, 0 );
+        mTexturePendingSize -= uploadSize;
+        mTextureUploadedSize += uploadSize;
+
+        // Finish if the texture is still incomplete.
+        if ( upload.mUploadedRows < textureHeight )
+            break;
+
+        // Replace the placeholder with the uploaded texture.
+        // NOTE:- The placeholder stays in its own name until now so it is shown intact whilst uploading.
+        // Changing the name means anything holding the placeholder name (e.g. batch render caches) is now stale.
+        glDeleteTextures( 1, &pTextureObject->mGLTextureName );
+        pTextureObject->mGLTextureName = upload.mGLTextureName;
+        mTextureNameGeneration++;
+        pTextureObject->mUploadPending = false;
+        applyTextureParameters( pTextureObject );
+
+        delete upload.mpBitmap;
+        mTextureUploads.pop_front();
     }
-   
-    if (lumBits)
-        delete[] lumBits;
 }
 
 //--------------------------------------------------------------------------------------------------------------------
@@ -776,6 +1184,9 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
     // Sanity!
     AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
 
+    // Memory Tracking.
+    Memory::TagScope memoryTagScope( "Textures" );
+
     TextureObject* pTextureObject = NULL;
 
     // Fetch texture key.
@@ -788,6 +1199,10 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
 
     if( pTextureObject )
     {
+        // Cancel any pending upload.
+        if ( pTextureObject->mUploadPending )
+            cancelTextureUpload( pTextureObject );
+
         // Remove bitmap if we have a different existing one.
         if ( pTextureObject->mpBitmap != NULL && pTextureObject->mpBitmap != pNewBitmap)
         {
@@ -804,6 +1219,7 @@ TextureObject* TextureManager::registerTexture(const char* pTextureKey, GBitmap*
         {
             glDeleteTextures(1, (const GLuint*)&pTextureObject->mGLTextureName);
             pTextureObject->mGLTextureName = 0;
+            mTextureNameGeneration++;
 
             // Adjust metrics.
             mTextureResidentCount--;
@@ -860,6 +1276,9 @@ TextureObject *TextureManager::loadTexture(const char* pTextureKey, TextureHandl
     // Sanity!
     AssertISV( type != TextureHandle::InvalidTexture, "Invalid texture type." );
 
+    // Memory Tracking.
+    Memory::TagScope memoryTagScope( "Textures" );
+
     // Finish if texture key is invalid.
     if( pTextureKey == NULL || *pTextureKey == 0)
         return NULL;
@@ -925,7 +1344,11 @@ GBitmap *TextureManager::loadBitmap( const char* pTextureKey, bool recurse, bool
 #endif
         dStrcpy(fileNameBuffer + len, extArray[i]);
 
-        bmp = (GBitmap*)ResourceManager->loadInstance(fileNameBuffer);
+        // Use a preloaded bitmap if available.
+        bmp = takePreloadedBitmap(fileNameBuffer);
+
+        if ( bmp == NULL )
+            bmp = (GBitmap*)ResourceManager->loadInstance(fileNameBuffer);
 
         if ( bmp != NULL && (bmp->getWidth() > MaximumProductSupportedTextureWidth || bmp->getHeight() > MaximumProductSupportedTextureHeight) )
         {
@@ -940,6 +1363,72 @@ GBitmap *TextureManager::loadBitmap( const char* pTextureKey, bool recurse, bool
 
 //--------------------------------------------------------------------------------------------------------------------
 
+GBitmap* TextureManager::takePreloadedBitmap( const char* pBitmapFile )
+{
+    // Finish if there are no preloaded bitmaps.
+    if ( mPreloadedBitmaps.size() == 0 )
+        return NULL;
+
+    // Finish if the bitmap file is not known.
+    StringTableEntry bitmapFile = StringTable->lookup( pBitmapFile );
+    if ( bitmapFile == NULL )
+        return NULL;
+
+    // Find the preloaded bitmap.
+    typePreloadedBitmapHash::iterator bitmapItr = mPreloadedBitmaps.find( bitmapFile );
+    if ( bitmapItr == mPreloadedBitmaps.end() )
+        return NULL;
+
+    // Take ownership of the bitmap.
+    GBitmap* pBitmap = bitmapItr->value;
+    mPreloadedBitmaps.erase( bitmapFile );
+
+    return pBitmap;
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::addPreloadedBitmap( StringTableEntry bitmapFile, GBitmap* pBitmap )
+{
+    // Sanity!
+    AssertFatal( Con::isMainThread(), "TextureManager::addPreloadedBitmap() - Preloaded bitmaps can only be added on the main thread." );
+    AssertFatal( pBitmap != NULL, "TextureManager::addPreloadedBitmap() - Cannot add a NULL bitmap." );
+
+    // Replace any existing preloaded bitmap.
+    purgePreloadedBitmap( bitmapFile );
+
+    mPreloadedBitmaps.insert( bitmapFile, pBitmap );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::purgePreloadedBitmap( StringTableEntry bitmapFile )
+{
+    // Find the preloaded bitmap.
+    typePreloadedBitmapHash::iterator bitmapItr = mPreloadedBitmaps.find( bitmapFile );
+    if ( bitmapItr == mPreloadedBitmaps.end() )
+        return;
+
+    // Delete the unused bitmap.
+    delete bitmapItr->value;
+    mPreloadedBitmaps.erase( bitmapFile );
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
+void TextureManager::purgePreloadedBitmaps( void )
+{
+    // Delete all unused bitmaps.
+    for( typePreloadedBitmapHash::iterator bitmapItr = mPreloadedBitmaps.begin(); bitmapItr != mPreloadedBitmaps.end(); ++bitmapItr )
+    {
+        delete bitmapItr->value;
+    }
+
+    mPreloadedBitmaps.clear();
+}
+
+//--------------------------------------------------------------------------------------------------------------------
+
 void TextureManager::dumpMetrics( void )
 {
     S32 textureResidentCount = 0;
@@ -966,22 +1455,32 @@ void TextureManager::dumpMetrics( void )
         textureResidentWasteSize += pProbe->mTextureResidentWasteSize;
 
         // Info.
-        Con::printf( "BitmapArea: (%d-%d), BitmapMemory: %d, TextureArea: (%d-%d), TextureMemory: %d, TextureMemoryWaste=%d, Refs=%d, Resident=%s, Name=%s",
+        Con::printf( "BitmapArea: (%d-%d), BitmapMemory: %d, TextureArea: (%d-%d), TextureMemory: %d, TextureMemoryWaste=%d, Refs=%d, Resident=%s, Pending=%s, Name=%s",
             pProbe->mBitmapWidth,pProbe->mBitmapHeight, pProbe->mBitmapResidentSize,
             pProbe->mTextureWidth, pProbe->mTextureHeight, pProbe->mTextureResidentSize, pProbe->mTextureResidentWasteSize,
             pProbe->mRefCount,
             isTextureResident == 0 ? "NO" : "YES",
+            pProbe->mUploadPending ? "YES" : "NO",
             pProbe->mTextureKey );
 
         pProbe = pProbe->next;
     }
 
+    // Calculate pending metrics.
+    S32 texturePendingSize = 0;
+    for( typeTextureUploadVector::iterator uploadItr = mTextureUploads.begin(); uploadItr != mTextureUploads.end(); ++uploadItr )
+    {
+        const TextureObject* pTextureObject = uploadItr->mpTextureObject;
+        texturePendingSize += (pTextureObject->mTextureHeight - uploadItr->mUploadedRows) * pTextureObject->mTextureWidth * uploadItr->mpBitmap->bytesPerPixel;
+    }
+
     // Validate metrics.
     const bool textureCountSame = textureResidentCount == mTextureResidentCount;
     const bool textureSizeSame = textureResidentSize == mTextureResidentSize;
     const bool textureWasteSizeSame = textureResidentWasteSize == mTextureResidentWasteSize;
     const bool bitmapSizeSame = bitmapResidentSize == mBitmapResidentSize;
-    const bool allMetricsValid = textureCountSame && textureSizeSame && textureWasteSizeSame && bitmapSizeSame;
+    const bool texturePendingSizeSame = texturePendingSize == mTexturePendingSize;
+    const bool allMetricsValid = textureCountSame && textureSizeSame && textureWasteSizeSame && bitmapSizeSame && texturePendingSizeSame;
 
     // Error if metrics are invalid.
     if ( !allMetricsValid )
@@ -995,6 +1494,11 @@ void TextureManager::dumpMetrics( void )
         mTextureResidentWasteSize,
         mBitmapResidentSize,
         getResidentFraction() );
+    Con::printf( "TexturePendingCount: %d, TexturePendingSize: %d, TextureUploadedSize: %d, TextureUploadBudget: %d",
+        mTextureUploads.size(),
+        mTexturePendingSize,
+        mTextureUploadedSize,
+        mTextureUploadBudget );
 
     Con::printBlankLine();
     Con::printSeparator();
@@ -40,11 +40,22 @@
 #include "graphics/TextureDictionary.h"
 #endif
 
+#ifndef _HASHTABLE_H
+#include "collection/hashTable.h"
+#endif
+
+#ifndef _MRECT_H_
+#include "math/mRect.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 #define MaximumProductSupportedTextureWidth 2048
 #define MaximumProductSupportedTextureHeight MaximumProductSupportedTextureWidth
 
+/// The maximum dimension of the placeholder shown while a texture upload is pending.
+#define TexturePlaceholderDimension 32
+
 class TextureManager
 {
    friend class TextureHandle;
@@ -81,6 +92,28 @@ private:
     static bool mAllowTextureCompression;
     static bool mDisableTextureSubImageUpdates;
 
+    /// Bitmaps decoded ahead of their texture being loaded.
+    typedef HashMap<StringTableEntry, GBitmap*> typePreloadedBitmapHash;
+    static typePreloadedBitmapHash mPreloadedBitmaps;
+
+    /// A texture being uploaded in strips over several frames.
+    struct TextureUpload
+    {
+        TextureObject*  mpTextureObject;
+        GBitmap*        mpBitmap;
+        GLuint          mGLTextureName;
+        U32             mUploadedRows;
+    };
+    typedef Vector<TextureUpload> typeTextureUploadVector;
+    static typeTextureUploadVector mTextureUploads;
+    static S32 mTextureUploadBudget;
+    static S32 mTextureUploadRemaining;
+    static S32 mTexturePendingSize;
+    static S32 mTextureUploadedSize;
+
+    /// Incremented whenever a texture name is deleted.
+    static U32 mTextureNameGeneration;
+
 public:
     static bool mDGLRender;
     static GLenum mTextureCompressionHint;
@@ -98,6 +131,16 @@ public:
     static S32 getTextureResidentSize( void ) { return mTextureResidentSize; }
     static S32 getTextureResidentWasteSize( void ) { return mTextureResidentWasteSize; }
     static S32 getTextureResidentCount( void ) { return mTextureResidentCount; }
+    static S32 getTexturePendingSize( void ) { return mTexturePendingSize; }
+    static S32 getTexturePendingCount( void ) { return mTextureUploads.size(); }
+
+    /// Gets the texture name generation.
+    /// This changes whenever a texture name is deleted so anything holding texture names can tell they may be stale.
+    static U32 getTextureNameGeneration( void ) { return mTextureNameGeneration; }
+
+    /// Texture uploads.
+    /// Uploads pending textures within the per-frame upload budget.  This must be called once per frame before rendering.
+    static void processTextureUploads( void );
 
     static U32  registerEventCallback(TextureEventCallback, void *userData);
     static void unregisterEventCallback(const U32 callbackKey);
@@ -106,6 +149,16 @@ public:
 
     static void dumpMetrics( void );
 
+    /// Preloaded bitmaps.
+    /// A preloaded bitmap is used instead of loading the bitmap file when its texture is next loaded.
+    /// These must only be called on the main thread.
+    static void addPreloadedBitmap( StringTableEntry bitmapFile, GBitmap* pBitmap );
+    static void purgePreloadedBitmap( StringTableEntry bitmapFile );
+    static void purgePreloadedBitmaps( void );
+
+    /// Load a bitmap, searching the supported extensions.  The caller owns the returned bitmap.
+    static GBitmap* loadBitmap(const char *textureName, bool recurse = true, bool nocompression = false);
+
 private:
     static void postTextureEvent(const TextureEventCode eventCode);
 
@@ -114,8 +167,18 @@ private:
     static TextureObject* loadTexture(const char *textureName, TextureHandle::TextureHandleType type, bool clampToEdge, bool checkOnly = false, bool force16Bit = false );
     static void freeTexture( TextureObject* pTextureObject );
     static void refresh(TextureObject* pTextureObject);
-
-    static GBitmap* loadBitmap(const char *textureName, bool recurse = true, bool nocompression = false);
+    static void refresh( TextureObject* pTextureObject, const RectI& area );
+    static void applyTextureParameters( TextureObject* pTextureObject );
+
+    static bool canUploadInStrips( TextureObject* pTextureObject );
+    static void queueTextureUpload( TextureObject* pTextureObject );
+    static void cancelTextureUpload( TextureObject* pTextureObject );
+    static void cancelTextureUploads( void );
+    static void allocateTexture( GBitmap* pBitmap, const U32 textureWidth, const U32 textureHeight );
+    static void uploadTextureRows( GBitmap* pBitmap, const U32 textureWidth, const U32 textureHeight, const U32 startRow, const U32 rowCount );
+    static GBitmap* createPlaceholderBitmap( const GBitmap* pBitmap, const U32 textureWidth, const U32 textureHeight );
+
+    static GBitmap* takePreloadedBitmap( const char* pBitmapFile );
     static GBitmap* createPowerOfTwoBitmap( GBitmap* pBitmap );
     static U16* create16BitBitmap( GBitmap *pDL, U8 *in_source8, GBitmap::BitmapFormat alpha_info, GLint *GLformat, GLint *GLdata_type, U32 width, U32 height );
     static void getSourceDestByteFormat(GBitmap *pBitmap, U32 *sourceFormat, U32 *destFormat, U32 *byteFormat, U32* texelSize);
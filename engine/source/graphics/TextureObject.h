@@ -71,6 +71,7 @@ private:
     U32                 mBitmapHeight;
     GLuint              mFilter;
     bool                mClamp;
+    bool                mUploadPending;
 
     TextureHandle::TextureHandleType mHandleType;
 
@@ -90,6 +91,7 @@ public:
         mBitmapHeight( 0 ),
         mFilter( GL_NEAREST ),
         mClamp( false ),
+        mUploadPending( false ),
         mHandleType( TextureHandle::InvalidTexture )
     {
     }
@@ -103,6 +105,7 @@ public:
     inline U32 getBitmapHeight( void ) { return mBitmapHeight; }
     inline GLuint getFilter( void ) { return mFilter; }
     inline bool getClamp( void ) { return mClamp; }
+    inline bool getUploadPending( void ) const { return mUploadPending; }
     
     inline S32 getTextureResidentSize( void ) const { return mTextureResidentSize; }
     inline S32 getBitmapResidentSize( void ) const { return mBitmapResidentSize; }
@@ -46,40 +46,38 @@ bool sgForcePalletedPNGsTo16Bit= false;
 // Our chunk signatures...
 
 static const U32 csgMaxRowPointers = (1 << GBitmap::c_maxMipLevels) - 1; ///< 2^11 = 2048, 12 mip levels (see c_maxMipLievels)
-static png_bytep sRowPointers[csgMaxRowPointers];
 
-//-------------------------------------- Instead of using the user_ptr,
-//                                        we use a global pointer, we
-//                                        need to ensure that only one thread
-//                                        at once may be using the variable.
-//                                       NOTE: Removed mutex for g_varAccess.
-//                                        may have to re-thread safe this.
-static Stream* sg_pStream = NULL;
+//-------------------------------------- The stream is passed as the io_ptr so
+//                                        that PNGs can be read on any thread.
+//                                        Each thread has its own frame
+//                                        allocator arena.
 
 //-------------------------------------- Replacement I/O for standard LIBPng
 //                                        functions.  we don't wanna use
 //                                        FILE*'s...
-static void pngReadDataFn(png_structp  /*png_ptr*/,
+static void pngReadDataFn(png_structp  png_ptr,
                           png_bytep   data,
                           png_size_t  length)
 {
-   AssertFatal(sg_pStream != NULL, "No stream?");
+   Stream* pStream = (Stream*)png_get_io_ptr(png_ptr);
+   AssertFatal(pStream != NULL, "No stream?");
 
    bool success;
-   success = sg_pStream->read((U32)length, data);
+   success = pStream->read((U32)length, data);
     
    AssertFatal(success, "PNG read catastrophic error!");
 }
 
 
 //--------------------------------------
-static void pngWriteDataFn(png_structp /*png_ptr*/,
+static void pngWriteDataFn(png_structp png_ptr,
                            png_bytep   data,
                            png_size_t  length)
 {
-   AssertFatal(sg_pStream != NULL, "No stream?");
+   Stream* pStream = (Stream*)png_get_io_ptr(png_ptr);
+   AssertFatal(pStream != NULL, "No stream?");
 
-   sg_pStream->write((U32)length, data);
+   pStream->write((U32)length, data);
 }
 
 
@@ -136,6 +134,8 @@ bool GBitmap::readPNG(Stream& io_rStream)
       return false;
    }
 
+   // Preferences may only be read on the main thread.
+   const bool mainThread = Con::isMainThread();
    U32 prevWaterMark = FrameAllocator::getWaterMark();
 
 #if defined(PNG_USER_MEM_SUPPORTED)
@@ -177,8 +177,7 @@ bool GBitmap::readPNG(Stream& io_rStream)
       return false;
    }
 
-   sg_pStream = &io_rStream;
-   png_set_read_fn(png_ptr, NULL, pngReadDataFn);
+   png_set_read_fn(png_ptr, &io_rStream, pngReadDataFn);
 
    // Read off the info on the image.
    png_set_sig_bytes(png_ptr, cs_headerBytesChecked);
@@ -271,7 +270,8 @@ bool GBitmap::readPNG(Stream& io_rStream)
 
    // Set up the row pointers...
    AssertISV(height <= csgMaxRowPointers, "Error, cannot load pngs taller than 2048 pixels!");
-   png_bytep* rowPointers = sRowPointers;
+   // NOTE:- These come from the frame allocator so they are released with everything else libpng allocated.
+   png_bytep* rowPointers = (png_bytep*)FrameAllocator::alloc(sizeof(png_bytep) * height);
    U8* pBase = (U8*)getBits();
    for (U32 i = 0; i < height; i++)
       rowPointers[i] = pBase + (i * rowBytes);
@@ -285,8 +285,6 @@ bool GBitmap::readPNG(Stream& io_rStream)
    png_read_end(png_ptr, NULL);
    png_destroy_read_struct(&png_ptr, &info_ptr, &end_info);
 
-   sg_pStream = NULL;
-
    // Ok, the image is read in, now we need to finish up the initialization,
    //  which means: setting up the detailing members, init'ing the palette
    //  key, etc...
@@ -297,8 +295,10 @@ bool GBitmap::readPNG(Stream& io_rStream)
 
     //
    //-Mat if all palleted images are to be converted, set mForce16bit
+   //     (the preference is only read on the main thread)
    if( color_type == PNG_COLOR_TYPE_PALETTE ) {
-       sgForcePalletedPNGsTo16Bit = dAtob( Con::getVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit") );
+       if( mainThread )
+           sgForcePalletedPNGsTo16Bit = dAtob( Con::getVariable("$pref::iPhone::ForcePalletedPNGsTo16Bit") );
        if( sgForcePalletedPNGsTo16Bit ) {
            mForce16Bit = true;
        }
@@ -348,8 +348,7 @@ bool GBitmap::_writePNG(Stream&   stream,
       return false;
    }
 
-   sg_pStream = &stream;
-   png_set_write_fn(png_ptr, NULL, pngWriteDataFn, pngFlushDataFn);
+   png_set_write_fn(png_ptr, &stream, pngWriteDataFn, pngFlushDataFn);
 
    // Set the compression level, image filters, and compression strategy...
    png_set_compression_strategy( png_ptr, strategy );
@@ -1202,6 +1202,9 @@ void GuiCanvas::renderFrame(bool preRenderOnly, bool bufferSwap /* = true */)
    if(preRenderOnly)
       return;
 
+   // Upload pending textures within the frame budget.
+   TextureManager::processTextureUploads();
+
    // for now, just always reset the update regions - this is a
    // fix for FSAA on ATI cards
    resetUpdateRegions();
@@ -434,7 +434,7 @@ bool ZipSubWStream::_write(const U32 numBytes, const void *pBuffer)
    }
 
    setStatus(Ok);
-   m_currPosition += m_pZipStream->total_out;
+   m_currPosition += numBytes;
 
    return true;
 }
@@ -83,18 +83,18 @@ ConsoleFunctionWithDocs( mSolveQuartic, ConsoleString, 6, 6, (float a, float b,
     @return Returns an integer representing the next lowest integer from val.
     @sa mCeil
 */
-ConsoleFunctionWithDocs( mFloor, ConsoleInt, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mFloor, 2, 2, ( val ))
 {
-   return (S32)mFloor(dAtof(argv[1]));
+   return ConsoleValue::makeInt( (S32)mFloor((F32)argv[1].getFloatValue()) );
 }
 /*! Rounds a number. 0.5 is rounded up.
     @param val A floating-point value
     @return Returns the integer value closest to the given float
 
 */
-ConsoleFunctionWithDocs( mRound, ConsoleFloat, 2, 2, (float v))
+ConsoleValueFunctionWithDocs( mRound, 2, 2, (float v))
 {
-   return mRound( dAtof(argv[1]) );
+   return ConsoleValue::makeFloat( mRound( (F32)argv[1].getFloatValue() ) );
 }
 
 /*! Use the mCeil function to calculate the next highest integer value from val.
@@ -102,9 +102,9 @@ ConsoleFunctionWithDocs( mRound, ConsoleFloat, 2, 2, (float v))
     @return Returns an integer representing the next highest integer from val.
     @sa mFloor
 */
-ConsoleFunctionWithDocs( mCeil, ConsoleInt, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mCeil, 2, 2, ( val ))
 {
-   return (S32)mCeil(dAtof(argv[1]));
+   return ConsoleValue::makeInt( (S32)mCeil((F32)argv[1].getFloatValue()) );
 }
 
 
@@ -131,18 +131,18 @@ ConsoleFunctionWithDocs( mFloatLength, ConsoleString, 3, 3, ( val , numDecimals
     @param val An integer or a floating-point value.
     @return Returns the magnitude of val
 */
-ConsoleFunctionWithDocs( mAbs, ConsoleFloat, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mAbs, 2, 2, ( val ))
 {
-   return(mFabs(dAtof(argv[1])));
+   return ConsoleValue::makeFloat( mFabs((F32)argv[1].getFloatValue()) );
 }
 
 /*! Use the mSqrt function to calculated the square root of val.
     @param val A numeric value.
     @return Returns the the squareroot of val
 */
-ConsoleFunctionWithDocs( mSqrt, ConsoleFloat, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mSqrt, 2, 2, ( val ))
 {
-   return(mSqrt(dAtof(argv[1])));
+   return ConsoleValue::makeFloat( mSqrt((F32)argv[1].getFloatValue()) );
 }
 
 /*! Use the mPow function to calculated val raised to the power of power.
@@ -150,18 +150,18 @@ ConsoleFunctionWithDocs( mSqrt, ConsoleFloat, 2, 2, ( val ))
     @param power A numeric (integer or floating-point) power to raise val to.
     @return Returns val^power
 */
-ConsoleFunctionWithDocs( mPow, ConsoleFloat, 3, 3, ( val , power ))
+ConsoleValueFunctionWithDocs( mPow, 3, 3, ( val , power ))
 {
-   return(mPow(dAtof(argv[1]), dAtof(argv[2])));
+   return ConsoleValue::makeFloat( mPow((F32)argv[1].getFloatValue(), (F32)argv[2].getFloatValue()) );
 }
 
 /*! Use the mLog function to calculate the natural logarithm of val.
     @param val A numeric value.
     @return Returns the natural logarithm of val
 */
-ConsoleFunctionWithDocs( mLog, ConsoleFloat, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mLog, 2, 2, ( val ))
 {
-   return(mLog(dAtof(argv[1])));
+   return ConsoleValue::makeFloat( mLog((F32)argv[1].getFloatValue()) );
 }
 
 /*! Use the mSin function to get the sine of the angle val.
@@ -169,9 +169,9 @@ ConsoleFunctionWithDocs( mLog, ConsoleFloat, 2, 2, ( val ))
     @return Returns the sine of val. This value will be in the range [ -1.0 , 1.0 ].
     @sa mAsin
 */
-ConsoleFunctionWithDocs( mSin, ConsoleFloat, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mSin, 2, 2, ( val ))
 {
-   return(mSin(mDegToRad(dAtof(argv[1]))));
+   return ConsoleValue::makeFloat( mSin(mDegToRad((F32)argv[1].getFloatValue())) );
 }
 
 /*! Use the mCos function to get the cosine of the angle val.
@@ -179,9 +179,9 @@ ConsoleFunctionWithDocs( mSin, ConsoleFloat, 2, 2, ( val ))
     @return Returns the cosine of val. This value will be in the range [ -1.0 , 1.0 ].
     @sa mAcos
 */
-ConsoleFunctionWithDocs( mCos, ConsoleFloat, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mCos, 2, 2, ( val ))
 {
-   return(mCos(mDegToRad(dAtof(argv[1]))));
+   return ConsoleValue::makeFloat( mCos(mDegToRad((F32)argv[1].getFloatValue())) );
 }
 
 /*! Use the mTan function to get the tangent of the angle val.
@@ -189,9 +189,9 @@ ConsoleFunctionWithDocs( mCos, ConsoleFloat, 2, 2, ( val ))
     @return Returns the tangent of val. This value will be in the range [ -inf.0 , inf.0 ].
     @sa mAtan
 */
-ConsoleFunctionWithDocs( mTan, ConsoleFloat, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mTan, 2, 2, ( val ))
 {
-   return(mTan(mDegToRad(dAtof(argv[1]))));
+   return ConsoleValue::makeFloat( mTan(mDegToRad((F32)argv[1].getFloatValue())) );
 }
 
 /*! Use the mAsin function to get the inverse sine of val in degrees.
@@ -199,9 +199,9 @@ ConsoleFunctionWithDocs( mTan, ConsoleFloat, 2, 2, ( val ))
     @return Returns the inverse sine of val in degrees. This value will be in the range [ -90, 90 ].
     @sa mSin
 */
-ConsoleFunctionWithDocs( mAsin, ConsoleFloat, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mAsin, 2, 2, ( val ))
 {
-   return(mRadToDeg(mAsin(dAtof(argv[1]))));
+   return ConsoleValue::makeFloat( mRadToDeg(mAsin((F32)argv[1].getFloatValue())) );
 }
 
 /*! Use the mAcos function to get the inverse cosine of val in degrees.
@@ -209,9 +209,9 @@ ConsoleFunctionWithDocs( mAsin, ConsoleFloat, 2, 2, ( val ))
     @return Returns the inverse cosine of val in radians. This value will be in the range [ 0 , 180 ].
     @sa mCos
 */
-ConsoleFunctionWithDocs( mAcos, ConsoleFloat, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mAcos, 2, 2, ( val ))
 {
-   return(mRadToDeg(mAcos(dAtof(argv[1]))));
+   return ConsoleValue::makeFloat( mRadToDeg(mAcos((F32)argv[1].getFloatValue())) );
 }
 
 /*! Use the mAtan function to get the inverse tangent of rise/run in degrees.
@@ -246,9 +246,9 @@ ConsoleFunctionWithDocs( mAtan, ConsoleFloat, 2, 3, ( val ))
     @return Returns the equivalent of the radian value val in degrees.
     @sa mDegToRad
 */
-ConsoleFunctionWithDocs( mRadToDeg, ConsoleFloat, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mRadToDeg, 2, 2, ( val ))
 {
-   return(mRadToDeg(dAtof(argv[1])));
+   return ConsoleValue::makeFloat( mRadToDeg((F32)argv[1].getFloatValue()) );
 }
 
 /*! Use the mDegToRad function to convert degrees to radians.
@@ -256,9 +256,9 @@ ConsoleFunctionWithDocs( mRadToDeg, ConsoleFloat, 2, 2, ( val ))
     @return Returns the equivalent of the degree value val in radians.
     @sa mRadToDeg
 */
-ConsoleFunctionWithDocs( mDegToRad, ConsoleFloat, 2, 2, ( val ))
+ConsoleValueFunctionWithDocs( mDegToRad, 2, 2, ( val ))
 {
-   return(mDegToRad(dAtof(argv[1])));
+   return ConsoleValue::makeFloat( mDegToRad((F32)argv[1].getFloatValue()) );
 }
 
 /*! Clamp a value between two other values.
@@ -267,30 +267,30 @@ ConsoleFunctionWithDocs( mDegToRad, ConsoleFloat, 2, 2, ( val ))
     @param max The upper bound
     @return A float value the is within the given range
 */
-ConsoleFunctionWithDocs( mClamp, ConsoleFloat, 4, 4, (float number, float min, float max))
+ConsoleValueFunctionWithDocs( mClamp, 4, 4, (float number, float min, float max))
 {
-   F32 value = dAtof( argv[1] );
-   F32 min = dAtof( argv[2] );
-   F32 max = dAtof( argv[3] );
-   return mClampF( value, min, max );
+   F32 value = (F32)argv[1].getFloatValue();
+   F32 min = (F32)argv[2].getFloatValue();
+   F32 max = (F32)argv[3].getFloatValue();
+   return ConsoleValue::makeFloat( mClampF( value, min, max ) );
 }
 
 //-----------------------------------------------------------------------------
 
 /*! Returns the Minimum of two values.
 */
-ConsoleFunctionWithDocs( mGetMin, ConsoleFloat, 3, 3, (a, b))
+ConsoleValueFunctionWithDocs( mGetMin, 3, 3, (a, b))
 {
-   return getMin(dAtof(argv[1]), dAtof(argv[2]));
+   return ConsoleValue::makeFloat( getMin((F32)argv[1].getFloatValue(), (F32)argv[2].getFloatValue()) );
 }
 
 //-----------------------------------------------------------------------------
 
 /*! Returns the Maximum of two values.
 */
-ConsoleFunctionWithDocs( mGetMax, ConsoleFloat, 3, 3, (a, b))
+ConsoleValueFunctionWithDocs( mGetMax, 3, 3, (a, b))
 {
-   return getMax(dAtof(argv[1]), dAtof(argv[2]));
+   return ConsoleValue::makeFloat( getMax((F32)argv[1].getFloatValue(), (F32)argv[2].getFloatValue()) );
 }
 
 //-----------------------------------------------------------------------------
@@ -0,0 +1,200 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+#include "frameAllocator.h"
+#include "console/console.h"
+#include "platform/threads/mutex.h"
+
+TORQUE_THREAD_LOCAL FrameAllocator::Arena* FrameAllocator::smThreadArena = NULL;
+FrameAllocator::Arena*  FrameAllocator::smMainArena = NULL;
+FrameAllocator::Arena*  FrameAllocator::smArenas = NULL;
+U32                     FrameAllocator::smThreadArenaSize = 0;
+FrameAllocator::Stats   FrameAllocator::smStats;
+
+/// Guards the arena list and the statistics.
+static Mutex sgArenaMutex;
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::init(const U32 frameSize, const U32 threadFrameSize)
+{
+   AssertFatal(smMainArena == NULL, "Error, already initialized");
+
+   smMainArena = new Arena;
+   smMainArena->mBuffer = new U8[frameSize];
+   smMainArena->mWaterMark = 0;
+   smMainArena->mHighWaterMark = frameSize;
+   smMainArena->mFramePeak = 0;
+   smMainArena->mInUse = true;
+   smMainArena->mNext = NULL;
+   smArenas = smMainArena;
+   smThreadArena = smMainArena;
+
+   smThreadArenaSize = threadFrameSize > 0 ? threadFrameSize : frameSize / 4;
+
+   dMemset( &smStats, 0, sizeof(smStats) );
+   smStats.mainArenaSize = frameSize;
+   smStats.threadArenaSize = smThreadArenaSize;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::destroy()
+{
+   AssertFatal(smMainArena != NULL, "Error, not initialized");
+   AssertFatal(smThreadArena == smMainArena, "FrameAllocator::destroy() - Must be called on the main thread.");
+
+   sgArenaMutex.lock();
+   while ( smArenas != NULL )
+   {
+      Arena* arena = smArenas;
+      smArenas = arena->mNext;
+
+      AssertWarn( arena == smMainArena || !arena->mInUse, "FrameAllocator::destroy() - A thread arena is still in use." );
+
+      delete [] arena->mBuffer;
+      delete arena;
+   }
+   sgArenaMutex.unlock();
+
+   smMainArena = NULL;
+   smThreadArena = NULL;
+   smThreadArenaSize = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+FrameAllocator::Arena* FrameAllocator::createThreadArena()
+{
+   AssertFatal(smMainArena != NULL, "FrameAllocator::createThreadArena() - Not initialized.");
+
+   sgArenaMutex.lock();
+
+   // Reuse an arena released by a thread if possible.
+   Arena* arena = smArenas;
+   while ( arena != NULL && arena->mInUse )
+      arena = arena->mNext;
+
+   if ( arena == NULL )
+   {
+      arena = new Arena;
+      arena->mBuffer = new U8[smThreadArenaSize];
+      arena->mWaterMark = 0;
+      arena->mHighWaterMark = smThreadArenaSize;
+      arena->mFramePeak = 0;
+      arena->mNext = smArenas;
+      smArenas = arena;
+      smStats.threadArenaCount++;
+   }
+
+   arena->mInUse = true;
+
+   sgArenaMutex.unlock();
+
+   smThreadArena = arena;
+   return arena;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::endThreadFrame()
+{
+   Arena* arena = smThreadArena;
+
+   // Finish if the thread has never used the FrameAllocator.
+   if ( arena == NULL || arena->mWaterMark == 0 )
+      return;
+
+   AssertFatal( false, avar("FrameAllocator::endThreadFrame() - %d bytes were not released before the end of the frame.", arena->mWaterMark) );
+
+   // Reclaim the leaked memory.
+#ifdef TORQUE_DEBUG
+   dMemset( arena->mBuffer, TORQUE_FRAMEALLOCATOR_POISON, arena->mWaterMark );
+#endif
+   arena->mWaterMark = 0;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::releaseThreadArena()
+{
+   Arena* arena = smThreadArena;
+
+   // Finish if the thread has never used the FrameAllocator or the arenas are destroyed.
+   if ( arena == NULL || smMainArena == NULL )
+   {
+      smThreadArena = NULL;
+      return;
+   }
+
+   AssertFatal( arena != smMainArena, "FrameAllocator::releaseThreadArena() - Cannot release the main thread arena." );
+
+   endThreadFrame();
+
+   sgArenaMutex.lock();
+   arena->mInUse = false;
+   sgArenaMutex.unlock();
+
+   smThreadArena = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::endFrame()
+{
+   AssertFatal( smThreadArena == smMainArena, "FrameAllocator::endFrame() - Must be called on the main thread." );
+
+   endThreadFrame();
+
+   sgArenaMutex.lock();
+
+   // Gather the peak usage of the frame.
+   U32 threadFramePeak = 0;
+   for ( Arena* arena = smArenas; arena != NULL; arena = arena->mNext )
+   {
+      // NOTE:- Threads other than the thread pool workers may be allocating so their peaks can be approximate.
+      const U32 framePeak = arena->mFramePeak;
+      arena->mFramePeak = arena->mWaterMark;
+
+      if ( arena == smMainArena )
+         smStats.mainFramePeak = framePeak;
+      else if ( framePeak > threadFramePeak )
+         threadFramePeak = framePeak;
+   }
+
+   smStats.threadFramePeak = threadFramePeak;
+   if ( smStats.mainFramePeak > smStats.mainPeak )
+      smStats.mainPeak = smStats.mainFramePeak;
+   if ( threadFramePeak > smStats.threadPeak )
+      smStats.threadPeak = threadFramePeak;
+
+   sgArenaMutex.unlock();
+}
+
+//-----------------------------------------------------------------------------
+
+void FrameAllocator::getStats(Stats& stats)
+{
+   sgArenaMutex.lock();
+   stats = smStats;
+   sgArenaMutex.unlock();
+}
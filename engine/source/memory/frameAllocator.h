@@ -27,6 +27,10 @@
 #include "platform/platform.h"
 #endif
 
+#ifndef _PLATFORMTLS_H_
+#include "platform/platformTLS.h"
+#endif
+
 /// Temporary memory pool for per-frame allocations.
 ///
 /// In the course of rendering a frame, it is often necessary to allocate
@@ -43,44 +47,79 @@
 ///   // Free frameAllocator memory
 ///   FrameAllocator::setWaterMark(waterMark);
 /// @endcode
+///
+/// Each thread has its own arena so the FrameAllocator can be used by worker threads
+/// without any locking.  The main thread arena is created by "init()" whereas other
+/// threads are given an arena the first time they use the FrameAllocator.  Water marks
+/// are only meaningful on the thread they were fetched on.
+///
+/// All allocations must be released by the end of the frame.  The main thread arena is
+/// checked at "endFrame()" and thread pool workers are checked at the end of each job.
+/// Other long-running threads should call "endThreadFrame()" when they are idle and
+/// "releaseThreadArena()" before they exit.  In debug builds released memory is poisoned.
 class FrameAllocator
 {
-   static U8*   smBuffer;
-   static U32   smHighWaterMark;
-   static U32   smWaterMark;
+public:
+   /// Arena usage statistics (in bytes).
+   struct Stats
+   {
+      U32   mainArenaSize;
+      U32   mainFramePeak;       ///< Main thread peak usage in the last frame.
+      U32   mainPeak;            ///< Main thread peak usage in any frame.
+      U32   threadArenaSize;
+      U32   threadArenaCount;    ///< Arenas created for threads other than the main thread.
+      U32   threadFramePeak;     ///< Peak usage of any other thread in the last frame.
+      U32   threadPeak;          ///< Peak usage of any other thread in any frame.
+   };
+
+private:
+   struct Arena
+   {
+      U8*            mBuffer;
+      U32            mWaterMark;
+      U32            mHighWaterMark;
+      volatile U32   mFramePeak;
+      bool           mInUse;
+      Arena*         mNext;
+   };
+
+   static TORQUE_THREAD_LOCAL Arena* smThreadArena;
+   static Arena*  smMainArena;
+   static Arena*  smArenas;
+   static U32     smThreadArenaSize;
+   static Stats   smStats;
+
+   static Arena*  createThreadArena();
+
+   inline static Arena* getThreadArena()
+   {
+      Arena* arena = smThreadArena;
+      return arena != NULL ? arena : createThreadArena();
+   }
 
   public:
-   inline static void init(const U32 frameSize);
-   inline static void destroy();
+   /// Creates the main thread arena.  Other threads are given "threadFrameSize" arenas
+   /// or a quarter of the main thread arena if not specified.
+   static void init(const U32 frameSize, const U32 threadFrameSize = 0);
+   static void destroy();
 
    inline static void* alloc(const U32 allocSize);
 
    inline static void setWaterMark(const U32);
    inline static U32  getWaterMark();
    inline static U32  getHighWaterMark();
-};
 
-#if defined(TORQUE_DEBUG)
-static U32 sgMaxFrameAllocation = 0;
-#endif
+   /// Ends the frame on the main thread, checking its arena and updating the statistics.
+   static void endFrame();
 
-void FrameAllocator::init(const U32 frameSize)
-{
-   AssertFatal(smBuffer == NULL, "Error, already initialized");
-   smBuffer = new U8[frameSize];
-   smWaterMark = 0;
-   smHighWaterMark = frameSize;
-}
+   /// Checks that all allocations on the calling thread were released and resets its arena.
+   static void endThreadFrame();
 
-void FrameAllocator::destroy()
-{
-   AssertFatal(smBuffer != NULL, "Error, not initialized");
+   /// Releases the arena of the calling thread for reuse by another thread.
+   static void releaseThreadArena();
 
-   delete [] smBuffer;
-   smBuffer = NULL;
-   smWaterMark = 0;
-   smHighWaterMark = 0;
-}
+   static void getStats(Stats& stats);
+};
 
 /// This #define is used by the FrameAllocator to align starting addresses to
 /// be byte aligned to this value. This is important on the 360 and possibly
@@ -91,34 +130,38 @@ void FrameAllocator::destroy()
 /// memory which is allocated and expected to be contiguous.
 #define TORQUE_BYTE_ALIGNMENT 4
 
+/// Byte used to poison released FrameAllocator memory in debug builds.
+#define TORQUE_FRAMEALLOCATOR_POISON 0xCD
+
 
 void* FrameAllocator::alloc(const U32 allocSize)
 {
+   Arena* arena = getThreadArena();
+
    U32 _allocSize = allocSize;
 #ifdef TORQUE_DEBUG
    _allocSize+=4;
 #endif
-   AssertFatal(smBuffer != NULL, "Error, no buffer!");
-   AssertFatal(smWaterMark + _allocSize <= smHighWaterMark, "Error alloc too large, increase frame size!");
 
    // Keep all frame allocator allocations aligned to DWORD boundries on the 360
    // Add 3, mask out the lower 3 bits.
-   smWaterMark = ( smWaterMark + ( TORQUE_BYTE_ALIGNMENT - 1 ) ) & (~( TORQUE_BYTE_ALIGNMENT - 1 ));
+   U32 waterMark = ( arena->mWaterMark + ( TORQUE_BYTE_ALIGNMENT - 1 ) ) & (~( TORQUE_BYTE_ALIGNMENT - 1 ));
+
+   AssertFatal(waterMark + _allocSize <= arena->mHighWaterMark, "Error alloc too large, increase frame size!");
 
    // Sanity check.
-   AssertFatal( !( smWaterMark & ( TORQUE_BYTE_ALIGNMENT - 1 ) ), "Frame allocation is not on a 4-byte boundry." );
+   AssertFatal( !( waterMark & ( TORQUE_BYTE_ALIGNMENT - 1 ) ), "Frame allocation is not on a 4-byte boundry." );
 
-   U8* p = &smBuffer[smWaterMark];
-   smWaterMark += _allocSize;
+   U8* p = &arena->mBuffer[waterMark];
+   waterMark += _allocSize;
+   arena->mWaterMark = waterMark;
 
-#if defined(TORQUE_DEBUG)
-   if (smWaterMark > sgMaxFrameAllocation)
-      sgMaxFrameAllocation = smWaterMark;
-#endif
+   if (waterMark > arena->mFramePeak)
+      arena->mFramePeak = waterMark;
 
 #ifdef TORQUE_DEBUG
-   U32 *flag = (U32*) &smBuffer[smWaterMark-4];
-   *flag = 0xdeadbeef ^ smWaterMark;
+   U32 *flag = (U32*) &arena->mBuffer[waterMark-4];
+   *flag = 0xdeadbeef ^ waterMark;
 #endif
    return p;
 }
@@ -126,26 +169,32 @@ void* FrameAllocator::alloc(const U32 allocSize)
 
 void FrameAllocator::setWaterMark(const U32 waterMark)
 {
-   AssertFatal(waterMark < smHighWaterMark, "Error, invalid waterMark");
+   Arena* arena = getThreadArena();
+
+   AssertFatal(waterMark < arena->mHighWaterMark, "Error, invalid waterMark");
 
 #ifdef TORQUE_DEBUG
-   if(smWaterMark >= 4 )
+   if(arena->mWaterMark >= 4 )
    {
-      U32 *flag = (U32*) &smBuffer[smWaterMark-4];
-      AssertFatal( *flag == (0xdeadbeef ^ smWaterMark), "FrameAllocator guard overwritten!");
+      U32 *flag = (U32*) &arena->mBuffer[arena->mWaterMark-4];
+      AssertFatal( *flag == (0xdeadbeef ^ arena->mWaterMark), "FrameAllocator guard overwritten!");
    }
+
+   // Poison the released memory.
+   if ( waterMark < arena->mWaterMark )
+      dMemset( &arena->mBuffer[waterMark], TORQUE_FRAMEALLOCATOR_POISON, arena->mWaterMark - waterMark );
 #endif
-   smWaterMark = waterMark;
+   arena->mWaterMark = waterMark;
 }
 
 U32 FrameAllocator::getWaterMark()
 {
-   return smWaterMark;
+   return getThreadArena()->mWaterMark;
 }
 
 U32 FrameAllocator::getHighWaterMark()
 {
-   return smHighWaterMark;
+   return getThreadArena()->mHighWaterMark;
 }
 
 /// Helper class to deal with FrameAllocator usage.
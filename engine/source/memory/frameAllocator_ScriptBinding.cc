@@ -23,24 +23,35 @@
 #include "frameAllocator.h"
 #include "console/console.h"
 
-U8*   FrameAllocator::smBuffer = NULL;
-U32   FrameAllocator::smWaterMark = 0;
-U32   FrameAllocator::smHighWaterMark = 0;
-
-#if defined(TORQUE_DEBUG)
-
 /*! @defgroup MemoryFrameAllocation Memory Frames
 	@ingroup TorqueScriptFunctions
 	@{
 */
 
-/*!
+/*! Gets the peak usage of the main thread frame allocator in any frame.
+    @return The peak usage in bytes.
 */
 ConsoleFunctionWithDocs(getMaxFrameAllocation, S32, 1,1, ())
 {
-   return sgMaxFrameAllocation;
+   FrameAllocator::Stats stats;
+   FrameAllocator::getStats( stats );
+   return stats.mainPeak;
 }
 
-/*! @} */ // end group MemoryFrameAllocation
+/*! Prints the size and peak usage of the frame allocator arenas.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs(dumpFrameAllocatorStats, ConsoleVoid, 1,1, ())
+{
+   FrameAllocator::Stats stats;
+   FrameAllocator::getStats( stats );
+
+   Con::printf( "Frame Allocator: Main Size=%dKB, Main Peak=%0.1fKB<%0.1fKB>, Thread Arenas=%d, Thread Size=%dKB, Thread Peak=%0.1fKB<%0.1fKB>",
+      stats.mainArenaSize / 1024,
+      stats.mainFramePeak / 1024.0f, stats.mainPeak / 1024.0f,
+      stats.threadArenaCount,
+      stats.threadArenaSize / 1024,
+      stats.threadFramePeak / 1024.0f, stats.threadPeak / 1024.0f );
+}
 
-#endif
+/*! @} */ // end group MemoryFrameAllocation
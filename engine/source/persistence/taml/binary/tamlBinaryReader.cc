@@ -26,6 +26,14 @@
 #include "io/zip/zipSubStream.h"
 #endif
 
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+#ifndef _CONSOLETYPES_H_
+#include "console/consoleTypes.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -57,6 +65,48 @@ SimObject* TamlBinaryReader::read( FileStream& stream )
 
     SimObject* pSimObject = NULL;
 
+    // Does the version have a payload size?
+    if ( versionId >= TAML_BINARY_STRINGTABLE_VERSION )
+    {
+        // Yes, so read payload size.
+        U32 payloadSize;
+        stream.read( &payloadSize );
+
+        // Fetch the remaining stream size.
+        const U32 remainingSize = stream.getStreamSize() - stream.getPosition();
+
+        // Sanity!
+        // NOTE:- Deflate cannot compress better than about 1032:1 so a larger compressed payload size is invalid.
+        if ( payloadSize > remainingSize && ( !compressed || payloadSize / 1032 > remainingSize ) )
+        {
+            // Warn.
+            Con::warnf( "Taml: Cannot read binary file as the payload size '%d' is invalid.", payloadSize );
+            return NULL;
+        }
+
+        // Is the stream compressed?
+        if ( compressed )
+        {
+            // Yes, so attach zip stream.
+            ZipSubRStream zipStream;
+            zipStream.attachStream( &stream );
+            zipStream.setUncompressedSize( payloadSize );
+
+            // Read payload.
+            pSimObject = readPayload( zipStream, payloadSize, versionId );
+
+            // Detach zip stream.
+            zipStream.detachStream();
+        }
+        else
+        {
+            // No, so read payload.
+            pSimObject = readPayload( stream, payloadSize, versionId );
+        }
+
+        return pSimObject;
+    }
+
     // Is the stream compressed?
     if ( compressed )
     {
@@ -92,6 +142,214 @@ void TamlBinaryReader::resetParse( void )
 
 //-----------------------------------------------------------------------------
 
+void TamlBinaryReader::resetPayload( void )
+{
+    // Release the payload.
+    delete [] mpPayload;
+    mpPayload = NULL;
+    mPayloadSize = 0;
+
+    // Clear the string table.
+    mStringTable.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+SimObject* TamlBinaryReader::readPayload( Stream& stream, const U32 payloadSize, const U32 versionId )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ReadPayload);
+
+    // Reset any previous payload.
+    resetPayload();
+
+    // Finish if there is no payload.
+    if ( payloadSize == 0 )
+    {
+        // Warn.
+        Con::warnf( "Taml: Cannot read binary file as the payload is empty." );
+        return NULL;
+    }
+
+    // Read the whole payload in a single request.
+    mpPayload = new char[payloadSize];
+    mPayloadSize = payloadSize;
+    const U32 payloadPosition = stream.getPosition();
+    if ( !stream.read( payloadSize, mpPayload ) || stream.getPosition() - payloadPosition != payloadSize )
+    {
+        // Warn.
+        Con::warnf( "Taml: Cannot read binary file as the payload is truncated." );
+        resetPayload();
+        return NULL;
+    }
+
+    // Parse the payload in-place.
+    MemStream payloadStream( mPayloadSize, mpPayload, true, false );
+    SimObject* pSimObject = parseStringTable( payloadStream ) ? parseElement( payloadStream, versionId ) : NULL;
+
+    // Release the payload.
+    // NOTE:- All values read in-place have been copied by the objects by now.
+    resetPayload();
+
+    return pSimObject;
+}
+
+//-----------------------------------------------------------------------------
+
+bool TamlBinaryReader::parseStringTable( Stream& stream )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryReader_ParseStringTable);
+
+    // Read string count.
+    U32 stringCount;
+    stream.read( &stringCount );
+
+    // Sanity!
+    if ( stringCount > mPayloadSize )
+    {
+        // Warn.
+        Con::warnf( "Taml: Cannot read binary file as the string table is invalid." );
+        return false;
+    }
+
+    // Intern each string once for the whole file.
+    mStringTable.reserve( stringCount );
+    for ( U32 index = 0; index < stringCount; ++index )
+    {
+        mStringTable.push_back( StringTable->insert( readValue( stream, NULL, 0, TAML_BINARY_STRINGTABLE_VERSION ) ) );
+    }
+
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+
+StringTableEntry TamlBinaryReader::readName( Stream& stream, const U32 versionId )
+{
+    // Read the name in-line for older versions.
+    if ( versionId < TAML_BINARY_STRINGTABLE_VERSION )
+        return stream.readSTString();
+
+    // Read string index.
+    U32 stringIndex;
+    stream.read( &stringIndex );
+
+    // Is the string index valid?
+    if ( stringIndex >= (U32)mStringTable.size() )
+    {
+        // No, so warn.
+        Con::warnf( "Taml: Invalid string table index '%d'.", stringIndex );
+        return StringTable->EmptyString;
+    }
+
+    return mStringTable[stringIndex];
+}
+
+//-----------------------------------------------------------------------------
+
+const char* TamlBinaryReader::readValue( Stream& stream, char* pValueBuffer, const U32 valueBufferSize, const U32 versionId )
+{
+    // Read the value into the buffer for older versions.
+    if ( versionId < TAML_BINARY_STRINGTABLE_VERSION )
+    {
+        stream.readLongString( valueBufferSize, pValueBuffer );
+        return pValueBuffer;
+    }
+
+    // Read value length.
+    U32 valueLength;
+    stream.read( &valueLength );
+
+    // Fetch value position.
+    const U32 valuePosition = stream.getPosition();
+
+    // Is the value (including its terminator) within the payload?
+    if ( valuePosition >= mPayloadSize || valueLength >= mPayloadSize - valuePosition || mpPayload[valuePosition + valueLength] != 0 )
+    {
+        // No, so warn.
+        Con::warnf( "Taml: Invalid value found at offset '%d'.", valuePosition );
+        stream.setPosition( mPayloadSize );
+        return StringTable->EmptyString;
+    }
+
+    // Skip the value.
+    stream.setPosition( valuePosition + valueLength + 1 );
+
+    // Use the value in-place.
+    return mpPayload + valuePosition;
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryReader::setAttribute( SimObject* pSimObject, StringTableEntry attributeName, const TamlBinaryAttributeType attributeType, Stream& stream )
+{
+    // Fetch the static field.
+    const AbstractClassRep::Field* pField = pSimObject->getClassRep()->findField( attributeName );
+
+    // Read the typed value and format its text.
+    char valueBuffer[64];
+    S32 typeId;
+    S32 valueS32 = 0;
+    F32 valueF32 = 0.0f;
+    bool valueBool = false;
+    switch( attributeType )
+    {
+        case TamlBinaryAttributeS32:
+            stream.read( &valueS32 );
+            dSprintf( valueBuffer, sizeof(valueBuffer), "%d", valueS32 );
+            typeId = TypeS32;
+            break;
+
+        case TamlBinaryAttributeF32:
+            stream.read( &valueF32 );
+            dSprintf( valueBuffer, sizeof(valueBuffer), "%.9g", valueF32 );
+            typeId = TypeF32;
+            break;
+
+        default:
+            stream.read( &valueBool );
+            dStrcpy( valueBuffer, valueBool ? "1" : "0" );
+            typeId = TypeBool;
+    }
+
+    // Can the value be assigned directly to the field?
+    if (    pField != NULL &&
+            pField->type == (U32)typeId &&
+            pField->elementCount == 1 &&
+            pField->setDataFn == &defaultProtectedSetFn &&
+            pField->validator == NULL &&
+            pSimObject->isModStaticFields() )
+    {
+        // Yes, so fetch the field storage.
+        void* pFieldData = (void*)(((const char*)pSimObject) + pField->offset);
+
+        // Assign the value.
+        switch( attributeType )
+        {
+            case TamlBinaryAttributeS32:
+                *((S32*)pFieldData) = valueS32;
+                break;
+
+            case TamlBinaryAttributeF32:
+                *((F32*)pFieldData) = valueF32;
+                break;
+
+            default:
+                *((bool*)pFieldData) = valueBool;
+        }
+
+        // Notify as the text path would.
+        pSimObject->onStaticModified( attributeName, valueBuffer );
+        return;
+    }
+
+    // No, so set the field from its text.
+    pSimObject->setPrefixedDataField( attributeName, NULL, valueBuffer );
+}
+
+//-----------------------------------------------------------------------------
+
 SimObject* TamlBinaryReader::parseElement( Stream& stream, const U32 versionId )
 {
     // Debug Profiling.
@@ -106,10 +364,10 @@ SimObject* TamlBinaryReader::parseElement( Stream& stream, const U32 versionId )
 #endif
 
     // Fetch element name.    
-    StringTableEntry typeName = stream.readSTString();
+    StringTableEntry typeName = readName( stream, versionId );
 
     // Fetch object name.
-    StringTableEntry objectName = stream.readSTString();
+    StringTableEntry objectName = readName( stream, versionId );
 
     // Read references.
     U32 tamlRefId;
@@ -233,12 +491,30 @@ void TamlBinaryReader::parseAttributes( Stream& stream, SimObject* pSimObject, c
     // Iterate attributes.
     for ( U32 index = 0; index < attributeCount; ++index )
     {
-        // Fetch attribute.
-        StringTableEntry attributeName = stream.readSTString();
-        stream.readLongString( 4096, valueBuffer );
+        // Fetch attribute name.
+        StringTableEntry attributeName = readName( stream, versionId );
+
+        // Do we have a typed attribute?
+        if ( versionId >= TAML_BINARY_STRINGTABLE_VERSION )
+        {
+            // Maybe, so read attribute type.
+            U8 attributeType;
+            stream.read( &attributeType );
+
+            // Is the attribute typed?
+            if ( attributeType != TamlBinaryAttributeString )
+            {
+                // Yes, so set the attribute without parsing text.
+                setAttribute( pSimObject, attributeName, (TamlBinaryAttributeType)attributeType, stream );
+                continue;
+            }
+        }
+
+        // Fetch attribute value.
+        const char* pValue = readValue( stream, valueBuffer, sizeof(valueBuffer), versionId );
 
         // We can assume this is a field for now.
-        pSimObject->setPrefixedDataField( attributeName, NULL, valueBuffer );
+        pSimObject->setPrefixedDataField( attributeName, NULL, pValue );
     }
 }
 
@@ -338,13 +614,21 @@ void TamlBinaryReader::parseCustomElements( Stream& stream, TamlCallbacks* pCall
     for ( U32 nodeIndex = 0; nodeIndex < customNodeCount; ++nodeIndex )
     {
         //Read custom node name.
-        StringTableEntry nodeName = stream.readSTString();
+        StringTableEntry nodeName = readName( stream, versionId );
 
         // Add custom node.
         TamlCustomNode* pCustomNode = customNodes.addNode( nodeName );
 
-        // Parse the custom node.
-        parseCustomNode( stream, pCustomNode, versionId );
+        // Older versions don't store the children count.
+        U32 childNodeCount = 1;
+        if ( versionId >= TAML_BINARY_STRINGTABLE_VERSION )
+            stream.read( &childNodeCount );
+
+        // Parse the custom node children.
+        for ( U32 childIndex = 0; childIndex < childNodeCount; ++childIndex )
+        {
+            parseCustomNode( stream, pCustomNode, versionId );
+        }
     }
 
     // Do we have callbacks?
@@ -380,15 +664,14 @@ void TamlBinaryReader::parseCustomNode( Stream& stream, TamlCustomNode* pCustomN
     }
 
     // No, so read custom node name.
-    StringTableEntry nodeName = stream.readSTString();
+    StringTableEntry nodeName = readName( stream, versionId );
 
     // Add child node.
     TamlCustomNode* pChildNode = pCustomNode->addNode( nodeName );
 
     // Read child node text.
     char childNodeTextBuffer[MAX_TAML_NODE_FIELDVALUE_LENGTH];
-    stream.readLongString( MAX_TAML_NODE_FIELDVALUE_LENGTH, childNodeTextBuffer );
-    pChildNode->setNodeText( childNodeTextBuffer );
+    pChildNode->setNodeText( readValue( stream, childNodeTextBuffer, MAX_TAML_NODE_FIELDVALUE_LENGTH, versionId ) );
 
     // Read child node count.
     U32 childNodeCount;
@@ -416,14 +699,14 @@ void TamlBinaryReader::parseCustomNode( Stream& stream, TamlCustomNode* pCustomN
         for( U32 childFieldIndex = 0; childFieldIndex < childFieldCount; ++childFieldIndex )
         {
             // Read field name.
-            StringTableEntry fieldName = stream.readSTString();
+            StringTableEntry fieldName = readName( stream, versionId );
 
             // Read field value.
             char valueBuffer[MAX_TAML_NODE_FIELDVALUE_LENGTH];
-            stream.readLongString( MAX_TAML_NODE_FIELDVALUE_LENGTH, valueBuffer );
+            const char* pFieldValue = readValue( stream, valueBuffer, MAX_TAML_NODE_FIELDVALUE_LENGTH, versionId );
 
             // Add field.
-            pChildNode->addField( fieldName, valueBuffer );
+            pChildNode->addField( fieldName, pFieldValue );
         }
     }
 }
\ No newline at end of file
@@ -31,6 +31,10 @@
 #include "persistence/taml/taml.h"
 #endif
 
+#ifndef _TAML_BINARYWRITER_H_
+#include "persistence/taml/binary/tamlBinaryWriter.h"
+#endif
+
 //-----------------------------------------------------------------------------
 
 /// @ingroup tamlGroup
@@ -39,11 +43,13 @@ class TamlBinaryReader
 {
 public:
     TamlBinaryReader( Taml* pTaml ) :
-        mpTaml( pTaml )
+        mpTaml( pTaml ),
+        mpPayload( NULL ),
+        mPayloadSize( 0 )
     {
     }
 
-    virtual ~TamlBinaryReader() {}
+    virtual ~TamlBinaryReader() { resetPayload(); }
 
     /// Read.
     SimObject* read( FileStream& stream );
@@ -55,8 +61,20 @@ private:
 
     typeObjectReferenceHash mObjectReferenceMap;
 
+    /// The whole payload is held in a single buffer so string values can be used in-place.
+    char* mpPayload;
+    U32 mPayloadSize;
+    Vector<StringTableEntry> mStringTable;
+
 private:
     void resetParse( void );
+    void resetPayload( void );
+
+    SimObject* readPayload( Stream& stream, const U32 payloadSize, const U32 versionId );
+    bool parseStringTable( Stream& stream );
+    StringTableEntry readName( Stream& stream, const U32 versionId );
+    const char* readValue( Stream& stream, char* pValueBuffer, const U32 valueBufferSize, const U32 versionId );
+    void setAttribute( SimObject* pSimObject, StringTableEntry attributeName, const TamlBinaryAttributeType attributeType, Stream& stream );
 
     SimObject* parseElement( Stream& stream, const U32 versionId );
     void parseAttributes( Stream& stream, SimObject* pSimObject, const U32 versionId );
@@ -26,6 +26,10 @@
 #include "io/zip/zipSubStream.h"
 #endif
 
+#ifndef _CONSOLETYPES_H_
+#include "console/consoleTypes.h"
+#endif
+
 // Debug Profiling.
 #include "debug/profiler.h"
 
@@ -45,6 +49,17 @@ bool TamlBinaryWriter::write( FileStream& stream, const TamlWriteNode* pTamlWrit
     // Write compressed flag.
     stream.write( compressed );
 
+    // Write placeholder payload size.
+    // NOTE:- The reader uses this to read the whole payload in a single request.
+    const U32 payloadSizePosition = stream.getPosition();
+    stream.write( (U32)0 );
+
+    // Gather all the names so they can be written once.
+    resetStringTable();
+    collectStrings( pTamlWriteNode );
+
+    U32 payloadSize;
+
     // Are we compressed?
     if ( compressed )
     {
@@ -52,23 +67,226 @@ bool TamlBinaryWriter::write( FileStream& stream, const TamlWriteNode* pTamlWrit
         ZipSubWStream zipStream;
         zipStream.attachStream( &stream );
 
-        // Write element.
+        // Write string table and element.
+        writeStringTable( zipStream );
         writeElement( zipStream, pTamlWriteNode );
 
+        // Fetch the uncompressed payload size.
+        payloadSize = zipStream.getPosition();
+
         // Detach zip stream.
         zipStream.detachStream();
     }
     else
     {
-        // No, so write element.
+        const U32 payloadPosition = stream.getPosition();
+
+        // No, so write string table and element.
+        writeStringTable( stream );
         writeElement( stream, pTamlWriteNode );
+
+        // Fetch the payload size.
+        payloadSize = stream.getPosition() - payloadPosition;
     }
 
+    // Write the payload size.
+    const U32 endPosition = stream.getPosition();
+    stream.setPosition( payloadSizePosition );
+    stream.write( payloadSize );
+    stream.setPosition( endPosition );
+
+    // Release the string table.
+    resetStringTable();
+
     return true;
 }
 
 //-----------------------------------------------------------------------------
 
+void TamlBinaryWriter::resetStringTable( void )
+{
+    mStringIndexMap.clear();
+    mStringTable.clear();
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::addString( const char* pString )
+{
+    // Fetch string entry.
+    StringTableEntry string = StringTable->insert( pString != NULL ? pString : StringTable->EmptyString );
+
+    // Finish if the string is already present.
+    if ( mStringIndexMap.find( string ) != mStringIndexMap.end() )
+        return;
+
+    // Add the string.
+    mStringIndexMap.insert( string, (U32)mStringTable.size() );
+    mStringTable.push_back( string );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::collectStrings( const TamlWriteNode* pTamlWriteNode )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryWriter_CollectStrings);
+
+    // Add element and object names.
+    addString( pTamlWriteNode->mpSimObject->getClassName() );
+    addString( pTamlWriteNode->mpObjectName );
+
+    // Finish if this is a reference to another node.
+    if ( pTamlWriteNode->mRefToNode != NULL )
+        return;
+
+    // Add attribute names.
+    const Vector<TamlWriteNode::FieldValuePair*>& fields = pTamlWriteNode->mFields;
+    for( Vector<TamlWriteNode::FieldValuePair*>::const_iterator itr = fields.begin(); itr != fields.end(); ++itr )
+    {
+        addString( (*itr)->mName );
+    }
+
+    // Add children names.
+    Vector<TamlWriteNode*>* pChildren = pTamlWriteNode->mChildren;
+    if ( pChildren != NULL )
+    {
+        for( Vector<TamlWriteNode*>::iterator itr = pChildren->begin(); itr != pChildren->end(); ++itr )
+        {
+            collectStrings( (*itr) );
+        }
+    }
+
+    // Add custom node names.
+    const TamlCustomNodeVector& nodes = pTamlWriteNode->mCustomNodes.getNodes();
+    for( TamlCustomNodeVector::const_iterator customNodesItr = nodes.begin(); customNodesItr != nodes.end(); ++customNodesItr )
+    {
+        // Fetch the custom node.
+        const TamlCustomNode* pCustomNode = *customNodesItr;
+
+        addString( pCustomNode->getNodeName() );
+
+        // Fetch node children.
+        const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
+        for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
+        {
+            collectCustomNodeStrings( *childNodeItr );
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::collectCustomNodeStrings( const TamlCustomNode* pCustomNode )
+{
+    // Is the node a proxy object?
+    if ( pCustomNode->isProxyObject() )
+    {
+        // Yes, so add the element names.
+        collectStrings( pCustomNode->getProxyWriteNode() );
+        return;
+    }
+
+    // Add custom node name.
+    addString( pCustomNode->getNodeName() );
+
+    // Add children names.
+    const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
+    for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
+    {
+        collectCustomNodeStrings( *childNodeItr );
+    }
+
+    // Add field names.
+    const TamlCustomFieldVector& fields = pCustomNode->getFields();
+    for ( TamlCustomFieldVector::const_iterator fieldItr = fields.begin(); fieldItr != fields.end(); ++fieldItr )
+    {
+        addString( (*fieldItr)->getFieldName() );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeStringTable( Stream& stream )
+{
+    // Debug Profiling.
+    PROFILE_SCOPE(TamlBinaryWriter_WriteStringTable);
+
+    // Write string count.
+    stream.write( (U32)mStringTable.size() );
+
+    // Write strings.
+    for( Vector<StringTableEntry>::iterator itr = mStringTable.begin(); itr != mStringTable.end(); ++itr )
+    {
+        writeValue( stream, *itr );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeName( Stream& stream, const char* pName )
+{
+    // Find the string index.
+    typeStringIndexHash::iterator indexItr = mStringIndexMap.find( StringTable->insert( pName != NULL ? pName : StringTable->EmptyString ) );
+
+    // Sanity!
+    AssertFatal( indexItr != mStringIndexMap.end(), "Taml: Name was not added to the string table." );
+
+    // Write string index.
+    stream.write( indexItr->value );
+}
+
+//-----------------------------------------------------------------------------
+
+void TamlBinaryWriter::writeValue( Stream& stream, const char* pValue )
+{
+    // Fetch value length.
+    const U32 valueLength = dStrlen( pValue );
+
+    // Write the value including its terminator so it can be used in-place when read.
+    stream.write( valueLength );
+    stream.write( valueLength + 1, pValue );
+}
+
+//-----------------------------------------------------------------------------
+
+TamlBinaryAttributeType TamlBinaryWriter::getAttributeType( const TamlWriteNode* pTamlWriteNode, const TamlWriteNode::FieldValuePair* pFieldValue ) const
+{
+    // Find the static field.
+    const AbstractClassRep::Field* pField = pTamlWriteNode->mpSimObject->getClassRep()->findField( pFieldValue->mName );
+
+    // Finish if not a single element field.
+    if ( pField == NULL || pField->elementCount != 1 )
+        return TamlBinaryAttributeString;
+
+    // Fetch the field value.
+    const char* pValue = pFieldValue->mpValue;
+
+    char valueBuffer[64];
+
+    // Only store a typed value if it formats back to exactly the same text.
+    if ( pField->type == (U32)TypeS32 )
+    {
+        dSprintf( valueBuffer, sizeof(valueBuffer), "%d", dAtoi(pValue) );
+        return dStrcmp( valueBuffer, pValue ) == 0 ? TamlBinaryAttributeS32 : TamlBinaryAttributeString;
+    }
+
+    if ( pField->type == (U32)TypeF32 )
+    {
+        dSprintf( valueBuffer, sizeof(valueBuffer), "%.9g", dAtof(pValue) );
+        return dStrcmp( valueBuffer, pValue ) == 0 ? TamlBinaryAttributeF32 : TamlBinaryAttributeString;
+    }
+
+    if ( pField->type == (U32)TypeBool )
+    {
+        return dStrcmp( pValue, "0" ) == 0 || dStrcmp( pValue, "1" ) == 0 ? TamlBinaryAttributeBool : TamlBinaryAttributeString;
+    }
+
+    return TamlBinaryAttributeString;
+}
+
+//-----------------------------------------------------------------------------
+
 void TamlBinaryWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlWriteNode )
 {
     // Debug Profiling.
@@ -81,13 +299,13 @@ void TamlBinaryWriter::writeElement( Stream& stream, const TamlWriteNode* pTamlW
     const char* pElementName = pSimObject->getClassName();
 
     // Write element name.
-    stream.writeString( pElementName );
+    writeName( stream, pElementName );
 
     // Fetch object name.
     const char* pObjectName = pTamlWriteNode->mpObjectName;
 
     // Write object name.
-    stream.writeString( pObjectName != NULL ? pObjectName : StringTable->EmptyString );
+    writeName( stream, pObjectName );
 
     // Fetch reference Id.
     const U32 tamlRefId = pTamlWriteNode->mRefId;
@@ -147,9 +365,33 @@ void TamlBinaryWriter::writeAttributes( Stream& stream, const TamlWriteNode* pTa
         // Fetch field/value pair.
         TamlWriteNode::FieldValuePair* pFieldValue = (*itr);
 
-        // Write attribute.
-        stream.writeString( pFieldValue->mName );
-        stream.writeLongString( 4096, pFieldValue->mpValue );
+        // Write attribute name.
+        writeName( stream, pFieldValue->mName );
+
+        // Fetch attribute type.
+        const TamlBinaryAttributeType attributeType = getAttributeType( pTamlWriteNode, pFieldValue );
+
+        // Write attribute type.
+        stream.write( (U8)attributeType );
+
+        // Write attribute value.
+        switch( attributeType )
+        {
+            case TamlBinaryAttributeS32:
+                stream.write( (S32)dAtoi( pFieldValue->mpValue ) );
+                break;
+
+            case TamlBinaryAttributeF32:
+                stream.write( (F32)dAtof( pFieldValue->mpValue ) );
+                break;
+
+            case TamlBinaryAttributeBool:
+                stream.write( dAtob( pFieldValue->mpValue ) );
+                break;
+
+            default:
+                writeValue( stream, pFieldValue->mpValue );
+        }
     }
 }
 
@@ -207,11 +449,14 @@ void TamlBinaryWriter::writeCustomElements( Stream& stream, const TamlWriteNode*
         TamlCustomNode* pCustomNode = *customNodesItr;
 
         // Write custom node name.
-        stream.writeString( pCustomNode->getNodeName() );
+        writeName( stream, pCustomNode->getNodeName() );
 
         // Fetch node children.
         const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
 
+        // Write children node count.
+        stream.write( (U32)nodeChildren.size() );
+
         // Iterate children nodes.
         for( TamlCustomNodeVector::const_iterator childNodeItr = nodeChildren.begin(); childNodeItr != nodeChildren.end(); ++childNodeItr )
         {
@@ -243,10 +488,10 @@ void TamlBinaryWriter::writeCustomNode( Stream& stream, const TamlCustomNode* pC
     stream.write( false );
 
     // Write custom node name.
-    stream.writeString( pCustomNode->getNodeName() );
+    writeName( stream, pCustomNode->getNodeName() );
 
     // Write custom node text.
-    stream.writeLongString(MAX_TAML_NODE_FIELDVALUE_LENGTH, pCustomNode->getNodeTextField().getFieldValue());
+    writeValue( stream, pCustomNode->getNodeTextField().getFieldValue() );
 
     // Fetch node children.
     const TamlCustomNodeVector& nodeChildren = pCustomNode->getChildren();
@@ -290,8 +535,8 @@ void TamlBinaryWriter::writeCustomNode( Stream& stream, const TamlCustomNode* pC
             const TamlCustomField* pField = *fieldItr;
 
             // Write the node field.
-            stream.writeString( pField->getFieldName() );
-            stream.writeLongString( MAX_TAML_NODE_FIELDVALUE_LENGTH, pField->getFieldValue() );
+            writeName( stream, pField->getFieldName() );
+            writeValue( stream, pField->getFieldValue() );
         }
     }
 }
\ No newline at end of file
@@ -29,6 +29,20 @@
 
 //-----------------------------------------------------------------------------
 
+// Version from which names are stored in a string table and attributes are typed.
+#define TAML_BINARY_STRINGTABLE_VERSION     3
+
+/// Binary attribute value types.
+enum TamlBinaryAttributeType
+{
+    TamlBinaryAttributeString,
+    TamlBinaryAttributeS32,
+    TamlBinaryAttributeF32,
+    TamlBinaryAttributeBool,
+};
+
+//-----------------------------------------------------------------------------
+
 /// @ingroup tamlGroup
 /// @see tamlGroup
 class TamlBinaryWriter
@@ -36,7 +50,7 @@ class TamlBinaryWriter
 public:
     TamlBinaryWriter( Taml* pTaml ) :
         mpTaml( pTaml ),
-        mVersionId(2)
+        mVersionId(TAML_BINARY_STRINGTABLE_VERSION)
     {
     }
     virtual ~TamlBinaryWriter() {}
@@ -48,7 +62,21 @@ private:
     Taml* mpTaml;
     const U32 mVersionId;
 
+    typedef HashMap<StringTableEntry, U32> typeStringIndexHash;
+
+    typeStringIndexHash mStringIndexMap;
+    Vector<StringTableEntry> mStringTable;
+
 private:
+    void resetStringTable( void );
+    void addString( const char* pString );
+    void collectStrings( const TamlWriteNode* pTamlWriteNode );
+    void collectCustomNodeStrings( const TamlCustomNode* pCustomNode );
+    void writeStringTable( Stream& stream );
+    void writeName( Stream& stream, const char* pName );
+    void writeValue( Stream& stream, const char* pValue );
+    TamlBinaryAttributeType getAttributeType( const TamlWriteNode* pTamlWriteNode, const TamlWriteNode::FieldValuePair* pFieldValue ) const;
+
     void writeElement( Stream& stream, const TamlWriteNode* pTamlWriteNode );
     void writeAttributes( Stream& stream, const TamlWriteNode* pTamlWriteNode );
     void writeChildren( Stream& stream, const TamlWriteNode* pTamlWriteNode );
@@ -86,6 +86,24 @@ GL_FUNCTION(void,       glLockArraysEXT, (GLint first, GLsizei count), return; )
 GL_FUNCTION(void,       glUnlockArraysEXT, (void), return; )
 GL_GROUP_END()
 
+// ARB_vertex_buffer_object
+// Bound using the OpenGL 1.5 core names so callers are shared with GLES platforms.
+#ifndef GL_ARRAY_BUFFER
+#define GL_ARRAY_BUFFER                      0x8892
+#define GL_ELEMENT_ARRAY_BUFFER              0x8893
+#define GL_STREAM_DRAW                       0x88E0
+#define GL_STATIC_DRAW                       0x88E4
+#define GL_DYNAMIC_DRAW                      0x88E8
+#endif
+
+GL_GROUP_BEGIN(ARB_vertex_buffer_object)
+GL_FUNCTION(void,       glBindBuffer, (GLenum target, GLuint buffer), return; )
+GL_FUNCTION(void,       glDeleteBuffers, (GLsizei n, const GLuint* buffers), return; )
+GL_FUNCTION(void,       glGenBuffers, (GLsizei n, GLuint* buffers), return; )
+GL_FUNCTION(void,       glBufferData, (GLenum target, GLsizeiptr size, const void* data, GLenum usage), return; )
+GL_FUNCTION(void,       glBufferSubData, (GLenum target, GLintptr offset, GLsizeiptr size, const void* data), return; )
+GL_GROUP_END()
+
 //EXT_fog_coord
 GL_GROUP_BEGIN(EXT_fog_coord)
 GL_FUNCTION(void,			glFogCoordfEXT, (GLfloat), return; )
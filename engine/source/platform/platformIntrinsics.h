@@ -0,0 +1,107 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _PLATFORM_INTRINSICS_H_
+#define _PLATFORM_INTRINSICS_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+#if defined(TORQUE_COMPILER_VISUALC)
+#include <intrin.h>
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// Atomically adds "value" to "ref" returning the value prior to the addition.
+inline U32 dFetchAndAdd( volatile U32& ref, const U32 value )
+{
+#if defined(TORQUE_COMPILER_VISUALC)
+    return (U32)_InterlockedExchangeAdd( (volatile long*)&ref, (long)value );
+#else
+    return __sync_fetch_and_add( &ref, value );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/// Atomically increments "ref" returning the incremented value.
+inline U32 dAtomicIncrement( volatile U32& ref )
+{
+    return dFetchAndAdd( ref, 1 ) + 1;
+}
+
+//-----------------------------------------------------------------------------
+
+/// Atomically decrements "ref" returning the decremented value.
+inline U32 dAtomicDecrement( volatile U32& ref )
+{
+    return dFetchAndAdd( ref, (U32)-1 ) - 1;
+}
+
+//-----------------------------------------------------------------------------
+
+/// Atomically sets "ref" to "newValue" if it currently equals "oldValue".
+/// @return Whether the exchange took place.
+inline bool dCompareAndSwap( volatile U32& ref, const U32 oldValue, const U32 newValue )
+{
+#if defined(TORQUE_COMPILER_VISUALC)
+    return (U32)_InterlockedCompareExchange( (volatile long*)&ref, (long)newValue, (long)oldValue ) == oldValue;
+#else
+    return __sync_bool_compare_and_swap( &ref, oldValue, newValue );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/// Atomically sets the pointer "ref" to "newValue" if it currently equals "oldValue".
+/// @return Whether the exchange took place.
+inline bool dCompareAndSwap( void* volatile& ref, void* oldValue, void* newValue )
+{
+#if defined(TORQUE_COMPILER_VISUALC)
+    return _InterlockedCompareExchangePointer( &ref, newValue, oldValue ) == oldValue;
+#else
+    return __sync_bool_compare_and_swap( &ref, oldValue, newValue );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+/// Atomically sets the pointer "ref" to "newValue" returning the previous value.
+inline void* dAtomicExchange( void* volatile& ref, void* newValue )
+{
+#if defined(TORQUE_COMPILER_VISUALC)
+    return _InterlockedExchangePointer( &ref, newValue );
+#else
+    void* oldValue;
+    do
+    {
+        oldValue = ref;
+    }
+    while( !__sync_bool_compare_and_swap( &ref, oldValue, newValue ) );
+    return oldValue;
+#endif
+}
+
+#endif // _PLATFORM_INTRINSICS_H_
@@ -25,26 +25,564 @@
 #include "console/console.h"
 #include "debug/profiler.h"
 #include "platform/threads/mutex.h"
+#include "platform/platformTLS.h"
 #include "math/mMath.h"
 #include <stdlib.h>
 
+#include "platformMemory_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+#ifdef TORQUE_TRACK_MEMORY
+
+namespace Memory
+{
+
+// Every tracked allocation is prefixed with a header padded to 16 bytes so that
+// the returned memory keeps the alignment of the system allocator.
+struct BlockHeader
+{
+   dsize_t  mSize;
+   U32      mTagIndex;
+   U32      mSentinel;
+};
+
+static const dsize_t BlockHeaderSize = 16;
+static const U32 BlockSentinel = 0x4D454D54;
+static const U32 MaxTags = 2048;
+static const U32 TagLookupSize = 8192;
+static const U32 MaxSnapshots = 16;
+
+struct Tag
+{
+   const char* mpName;
+   Usage       mUsage;
+};
+
+struct TagLookup
+{
+   const char* mpName;
+   U32         mTagIndex;
+};
+
+struct Snapshot
+{
+   U32         mId;
+   U32         mTagCount;
+   Usage       mTotalUsage;
+   Usage*      mpTagUsage;
+};
+
+// All of these are zero-initialized before any allocation can happen.
+static Tag          smTags[MaxTags];
+static U32          smTagCount;
+static TagLookup    smTagLookup[TagLookupSize];
+static U32          smTagLookupCount;
+static Usage        smTotalUsage;
+static Snapshot     smSnapshots[MaxSnapshots];
+static U32          smLastSnapshotId;
+
+static TORQUE_THREAD_LOCAL const char* smpCurrentTag;
+
+//-----------------------------------------------------------------------------
+
+static Mutex& getTrackingMutex()
+{
+   // Never deleted so that allocations freed during shutdown can still be tracked.
+   static Mutex* pTrackingMutex = new Mutex;
+   return *pTrackingMutex;
+}
+
+//-----------------------------------------------------------------------------
+
+static U32 findTagIndex( const char* pName )
+{
+   // Tag zero collects allocations with no name and those beyond the tag limit.
+   if ( smTagCount == 0 )
+   {
+      smTags[0].mpName = "<other>";
+      smTagCount = 1;
+   }
+
+   if ( pName == NULL )
+      return 0;
+
+   // Find the name address.  Source file names are usually the same address each time.
+   U32 slot = (U32)(((dsize_t)pName >> 2) * 2654435761u) & (TagLookupSize-1);
+   while ( smTagLookup[slot].mpName != NULL )
+   {
+      if ( smTagLookup[slot].mpName == pName )
+         return smTagLookup[slot].mTagIndex;
+
+      slot = (slot + 1) & (TagLookupSize-1);
+   }
+
+   // Find the name itself as the same name can have several addresses.
+   U32 tagIndex = 1;
+   while ( tagIndex < smTagCount && dStrcmp( smTags[tagIndex].mpName, pName ) != 0 )
+      tagIndex++;
+
+   if ( tagIndex == smTagCount )
+   {
+      // Use the "other" tag if there's no space left.
+      if ( smTagCount == MaxTags )
+         return 0;
+
+      smTags[tagIndex].mpName = pName;
+      smTagCount++;
+   }
+
+   // Remember the name address whilst keeping the lookup sparse.
+   if ( smTagLookupCount < TagLookupSize / 2 )
+   {
+      smTagLookup[slot].mpName = pName;
+      smTagLookup[slot].mTagIndex = tagIndex;
+      smTagLookupCount++;
+   }
+
+   return tagIndex;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline void addUsage( Usage& usage, const dsize_t size )
+{
+   usage.liveBytes += size;
+   usage.liveCount++;
+   usage.allocCount++;
+
+   if ( usage.liveBytes > usage.peakBytes )
+      usage.peakBytes = usage.liveBytes;
+}
+
+//-----------------------------------------------------------------------------
+
+static inline void removeUsage( Usage& usage, const dsize_t size )
+{
+   usage.liveBytes -= size;
+   usage.liveCount--;
+   usage.freeCount++;
+}
+
+//-----------------------------------------------------------------------------
+
+static void* trackBlock( BlockHeader* pHeader, const dsize_t size, const char* pFileName )
+{
+   // Finish if the allocation failed.
+   if ( pHeader == NULL )
+      return NULL;
+
+   // Attribute the allocation to the current tag or else the source file.
+   const char* pTagName = smpCurrentTag != NULL ? smpCurrentTag : pFileName;
+
+   Mutex& trackingMutex = getTrackingMutex();
+   trackingMutex.lock();
+   const U32 tagIndex = findTagIndex( pTagName );
+   addUsage( smTags[tagIndex].mUsage, size );
+   addUsage( smTotalUsage, size );
+   trackingMutex.unlock();
+
+   pHeader->mSize = size;
+   pHeader->mTagIndex = tagIndex;
+   pHeader->mSentinel = BlockSentinel;
+
+   return (U8*)pHeader + BlockHeaderSize;
+}
+
+//-----------------------------------------------------------------------------
+
+static BlockHeader* untrackBlock( void* pMemory )
+{
+   BlockHeader* pHeader = (BlockHeader*)((U8*)pMemory - BlockHeaderSize);
+
+   // Sanity!
+   AssertFatal( pHeader->mSentinel == BlockSentinel, "Memory::untrackBlock() - Memory was not allocated with dMalloc or has already been freed." );
+
+   Mutex& trackingMutex = getTrackingMutex();
+   trackingMutex.lock();
+   removeUsage( smTags[pHeader->mTagIndex].mUsage, pHeader->mSize );
+   removeUsage( smTotalUsage, pHeader->mSize );
+   trackingMutex.unlock();
+
+   pHeader->mSentinel = 0;
+
+   return pHeader;
+}
+
+//-----------------------------------------------------------------------------
+
+TagScope::TagScope( const char* pTag )
+{
+   mpPreviousTag = smpCurrentTag;
+   smpCurrentTag = pTag;
+}
+
+//-----------------------------------------------------------------------------
+
+TagScope::~TagScope()
+{
+   smpCurrentTag = mpPreviousTag;
+}
+
+//-----------------------------------------------------------------------------
+
+static const char* getTagDisplayName( const char* pName )
+{
+   // Strip the path up to the source folder from source file names.
+   const char* pDisplayName = pName;
+   for ( const char* pSource = dStrstr( pName, "source" ); pSource != NULL; pSource = dStrstr( pSource + 1, "source" ) )
+   {
+      if ( pSource[6] == '/' || pSource[6] == '\\' )
+         pDisplayName = pSource + 7;
+   }
+
+   return pDisplayName;
+}
+
+//-----------------------------------------------------------------------------
+
+struct TagEntry
+{
+   const char* mpName;
+   Usage       mUsage;
+   F64         mDeltaBytes;
+   S32         mDeltaCount;
+   U64         mAllocCount;
+   U64         mFreeCount;
+};
+
+static S32 QSORT_CALLBACK compareTagEntryLiveBytes( const void* a, const void* b )
+{
+   const TagEntry* pEntryA = (const TagEntry*)a;
+   const TagEntry* pEntryB = (const TagEntry*)b;
+
+   if ( pEntryA->mUsage.liveBytes == pEntryB->mUsage.liveBytes )
+      return 0;
+
+   return pEntryA->mUsage.liveBytes > pEntryB->mUsage.liveBytes ? -1 : 1;
+}
+
+static S32 QSORT_CALLBACK compareTagEntryDelta( const void* a, const void* b )
+{
+   const TagEntry* pEntryA = (const TagEntry*)a;
+   const TagEntry* pEntryB = (const TagEntry*)b;
+
+   const F64 deltaA = mFabsD( pEntryA->mDeltaBytes );
+   const F64 deltaB = mFabsD( pEntryB->mDeltaBytes );
+
+   // Order by the change in live bytes then by the allocation churn.
+   if ( deltaA != deltaB )
+      return deltaA > deltaB ? -1 : 1;
+
+   if ( pEntryA->mAllocCount != pEntryB->mAllocCount )
+      return pEntryA->mAllocCount > pEntryB->mAllocCount ? -1 : 1;
+
+   return 0;
+}
+
+} // namespace Memory
+
+#endif // TORQUE_TRACK_MEMORY
+
+//-----------------------------------------------------------------------------
+
+bool Memory::isTrackingEnabled()
+{
+#ifdef TORQUE_TRACK_MEMORY
+   return true;
+#else
+   return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+bool Memory::getUsage( Usage& usage )
+{
+#ifdef TORQUE_TRACK_MEMORY
+   Mutex& trackingMutex = getTrackingMutex();
+   trackingMutex.lock();
+   usage = smTotalUsage;
+   trackingMutex.unlock();
+   return true;
+#else
+   dMemset( &usage, 0, sizeof(usage) );
+   return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+bool Memory::getTagUsage( const char* pTag, Usage& usage )
+{
+   dMemset( &usage, 0, sizeof(usage) );
+
+#ifdef TORQUE_TRACK_MEMORY
+   // Sanity!
+   AssertFatal( pTag != NULL, "Memory::getTagUsage() - Cannot fetch a NULL tag." );
+
+   bool found = false;
+
+   Mutex& trackingMutex = getTrackingMutex();
+   trackingMutex.lock();
+   for ( U32 tagIndex = 0; tagIndex < smTagCount; ++tagIndex )
+   {
+      // Match either the tag name or the display name of a source file.
+      if ( dStrcmp( smTags[tagIndex].mpName, pTag ) == 0 || dStrcmp( getTagDisplayName( smTags[tagIndex].mpName ), pTag ) == 0 )
+      {
+         usage = smTags[tagIndex].mUsage;
+         found = true;
+         break;
+      }
+   }
+   trackingMutex.unlock();
+
+   return found;
+#else
+   return false;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void Memory::resetPeakUsage()
+{
+#ifdef TORQUE_TRACK_MEMORY
+   Mutex& trackingMutex = getTrackingMutex();
+   trackingMutex.lock();
+   smTotalUsage.peakBytes = smTotalUsage.liveBytes;
+   for ( U32 tagIndex = 0; tagIndex < smTagCount; ++tagIndex )
+      smTags[tagIndex].mUsage.peakBytes = smTags[tagIndex].mUsage.liveBytes;
+   trackingMutex.unlock();
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+void Memory::dumpUsage( const U32 maxTags )
+{
+#ifdef TORQUE_TRACK_MEMORY
+   // Copy the tags so that printing (which allocates) happens outside the lock.
+   TagEntry* pEntries = (TagEntry*)dRealMalloc( sizeof(TagEntry) * MaxTags );
+
+   Mutex& trackingMutex = getTrackingMutex();
+   trackingMutex.lock();
+   const Usage totalUsage = smTotalUsage;
+   const U32 tagCount = smTagCount;
+   for ( U32 tagIndex = 0; tagIndex < tagCount; ++tagIndex )
+   {
+      pEntries[tagIndex].mpName = smTags[tagIndex].mpName;
+      pEntries[tagIndex].mUsage = smTags[tagIndex].mUsage;
+   }
+   trackingMutex.unlock();
+
+   dQsort( pEntries, tagCount, sizeof(TagEntry), compareTagEntryLiveBytes );
+
+   Con::printSeparator();
+   Con::printf( "Memory Usage: Live=%.2fMB (%d blocks), Peak=%.2fMB, Allocs=%.0f, Frees=%.0f, Tags=%d",
+      totalUsage.liveBytes / (1024.0 * 1024.0),
+      totalUsage.liveCount,
+      totalUsage.peakBytes / (1024.0 * 1024.0),
+      (F64)totalUsage.allocCount,
+      (F64)totalUsage.freeCount,
+      tagCount );
+
+   const U32 printCount = getMin( maxTags, tagCount );
+   for ( U32 index = 0; index < printCount; ++index )
+   {
+      const TagEntry& entry = pEntries[index];
+
+      Con::printf( "%10.1fKB live %8d blocks %10.1fKB peak %12.0f allocs - %s",
+         entry.mUsage.liveBytes / 1024.0,
+         entry.mUsage.liveCount,
+         entry.mUsage.peakBytes / 1024.0,
+         (F64)entry.mUsage.allocCount,
+         getTagDisplayName( entry.mpName ) );
+   }
+   Con::printSeparator();
+
+   dRealFree( pEntries );
+#else
+   Con::warnf( "Memory::dumpUsage() - Memory tracking is not enabled.  Define TORQUE_TRACK_MEMORY to enable it." );
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+U32 Memory::takeSnapshot()
+{
+#ifdef TORQUE_TRACK_MEMORY
+   Mutex& trackingMutex = getTrackingMutex();
+   trackingMutex.lock();
+
+   // Reuse the oldest snapshot.
+   const U32 snapshotId = ++smLastSnapshotId;
+   Snapshot& snapshot = smSnapshots[snapshotId % MaxSnapshots];
+   if ( snapshot.mpTagUsage == NULL )
+      snapshot.mpTagUsage = (Usage*)dRealMalloc( sizeof(Usage) * MaxTags );
+
+   snapshot.mId = snapshotId;
+   snapshot.mTagCount = smTagCount;
+   snapshot.mTotalUsage = smTotalUsage;
+   for ( U32 tagIndex = 0; tagIndex < smTagCount; ++tagIndex )
+      snapshot.mpTagUsage[tagIndex] = smTags[tagIndex].mUsage;
+
+   trackingMutex.unlock();
+
+   return snapshotId;
+#else
+   Con::warnf( "Memory::takeSnapshot() - Memory tracking is not enabled.  Define TORQUE_TRACK_MEMORY to enable it." );
+   return 0;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+
+bool Memory::dumpSnapshotDiff( const U32 fromSnapshotId, const U32 toSnapshotId, const U32 maxTags )
+{
+#ifdef TORQUE_TRACK_MEMORY
+   Mutex& trackingMutex = getTrackingMutex();
+   trackingMutex.lock();
+
+   // Fetch the snapshots.
+   const Snapshot& fromSnapshot = smSnapshots[fromSnapshotId % MaxSnapshots];
+   const Snapshot& toSnapshot = smSnapshots[toSnapshotId % MaxSnapshots];
+
+   // Finish if either snapshot is not available.
+   if ( fromSnapshotId == 0 || toSnapshotId == 0 || fromSnapshot.mId != fromSnapshotId || toSnapshot.mId != toSnapshotId )
+   {
+      trackingMutex.unlock();
+      Con::warnf( "Memory::dumpSnapshotDiff() - Snapshots '%d' and '%d' are not both available.  Only the last %d snapshots are kept.", fromSnapshotId, toSnapshotId, MaxSnapshots );
+      return false;
+   }
+
+   // Copy the tags that changed so that printing (which allocates) happens outside the lock.
+   TagEntry* pEntries = (TagEntry*)dRealMalloc( sizeof(TagEntry) * MaxTags );
+   const Usage fromTotalUsage = fromSnapshot.mTotalUsage;
+   const Usage toTotalUsage = toSnapshot.mTotalUsage;
+   const U32 tagCount = getMax( fromSnapshot.mTagCount, toSnapshot.mTagCount );
+   U32 entryCount = 0;
+   for ( U32 tagIndex = 0; tagIndex < tagCount; ++tagIndex )
+   {
+      // Tags added after a snapshot had no usage at that time.
+      Usage fromUsage;
+      Usage toUsage;
+      dMemset( &fromUsage, 0, sizeof(Usage) );
+      dMemset( &toUsage, 0, sizeof(Usage) );
+      if ( tagIndex < fromSnapshot.mTagCount )
+         fromUsage = fromSnapshot.mpTagUsage[tagIndex];
+      if ( tagIndex < toSnapshot.mTagCount )
+         toUsage = toSnapshot.mpTagUsage[tagIndex];
+
+      // Skip tags without any activity.
+      if ( fromUsage.allocCount == toUsage.allocCount && fromUsage.freeCount == toUsage.freeCount )
+         continue;
+
+      TagEntry& entry = pEntries[entryCount++];
+      entry.mpName = smTags[tagIndex].mpName;
+      entry.mUsage = toUsage;
+      entry.mDeltaBytes = (F64)toUsage.liveBytes - (F64)fromUsage.liveBytes;
+      entry.mDeltaCount = (S32)toUsage.liveCount - (S32)fromUsage.liveCount;
+      entry.mAllocCount = toUsage.allocCount - fromUsage.allocCount;
+      entry.mFreeCount = toUsage.freeCount - fromUsage.freeCount;
+   }
+
+   trackingMutex.unlock();
+
+   dQsort( pEntries, entryCount, sizeof(TagEntry), compareTagEntryDelta );
+
+   Con::printSeparator();
+   Con::printf( "Memory Snapshot Diff %d -> %d: Live=%+.2fMB (%+d blocks), Allocs=%.0f, Frees=%.0f, Tags Changed=%d",
+      fromSnapshotId,
+      toSnapshotId,
+      ((F64)toTotalUsage.liveBytes - (F64)fromTotalUsage.liveBytes) / (1024.0 * 1024.0),
+      (S32)toTotalUsage.liveCount - (S32)fromTotalUsage.liveCount,
+      (F64)(toTotalUsage.allocCount - fromTotalUsage.allocCount),
+      (F64)(toTotalUsage.freeCount - fromTotalUsage.freeCount),
+      entryCount );
+
+   const U32 printCount = getMin( maxTags, entryCount );
+   for ( U32 index = 0; index < printCount; ++index )
+   {
+      const TagEntry& entry = pEntries[index];
+
+      Con::printf( "%+10.1fKB live %+8d blocks %12.0f allocs %12.0f frees - %s",
+         entry.mDeltaBytes / 1024.0,
+         entry.mDeltaCount,
+         (F64)entry.mAllocCount,
+         (F64)entry.mFreeCount,
+         getTagDisplayName( entry.mpName ) );
+   }
+   Con::printSeparator();
+
+   dRealFree( pEntries );
+
+   return true;
+#else
+   Con::warnf( "Memory::dumpSnapshotDiff() - Memory tracking is not enabled.  Define TORQUE_TRACK_MEMORY to enable it." );
+   return false;
+#endif
+}
+
 //-----------------------------------------------------------------------------
 
 void* dMalloc_r(dsize_t in_size, const char* fileName, const dsize_t line)
 {
+#ifdef TORQUE_TRACK_MEMORY
+   return Memory::trackBlock( (Memory::BlockHeader*)malloc(in_size + Memory::BlockHeaderSize), in_size, fileName );
+#else
    return malloc(in_size);
+#endif
 }
 
 //-----------------------------------------------------------------------------
 
 void dFree(void* in_pFree)
 {
+#ifdef TORQUE_TRACK_MEMORY
+   if ( in_pFree == NULL )
+      return;
+
+   free(Memory::untrackBlock(in_pFree));
+#else
    free(in_pFree);
+#endif
 }
 
 //-----------------------------------------------------------------------------
 
 void* dRealloc_r(void* in_pResize, dsize_t in_size, const char* fileName, const dsize_t line)
 {
+#ifdef TORQUE_TRACK_MEMORY
+   if ( in_pResize == NULL )
+      return dMalloc_r(in_size, fileName, line);
+
+   if ( in_size == 0 )
+   {
+      dFree(in_pResize);
+      return NULL;
+   }
+
+   // A reallocation counts as a free of the old block and an allocation of the new one.
+   Memory::BlockHeader* pHeader = (Memory::BlockHeader*)((U8*)in_pResize - Memory::BlockHeaderSize);
+   const Memory::BlockHeader oldHeader = *pHeader;
+   Memory::untrackBlock(in_pResize);
+
+   Memory::BlockHeader* pNewHeader = (Memory::BlockHeader*)realloc(pHeader, in_size + Memory::BlockHeaderSize);
+   if ( pNewHeader == NULL )
+   {
+      // The original block is untouched so track it again.
+      *pHeader = oldHeader;
+      Mutex& trackingMutex = Memory::getTrackingMutex();
+      trackingMutex.lock();
+      Memory::addUsage( Memory::smTags[oldHeader.mTagIndex].mUsage, oldHeader.mSize );
+      Memory::addUsage( Memory::smTotalUsage, oldHeader.mSize );
+      trackingMutex.unlock();
+      return NULL;
+   }
+
+   return Memory::trackBlock(pNewHeader, in_size, fileName);
+#else
    return realloc(in_pResize,in_size);
+#endif
 }
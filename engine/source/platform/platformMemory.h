@@ -76,4 +76,63 @@ extern void* dMemmove(void *dst, const void *src, dsize_t size);
 extern void* dMemset(void *dst, int c, dsize_t size);
 extern int   dMemcmp(const void *ptr1, const void *ptr2, dsize_t size);
 
+//------------------------------------------------------------------------------
+
+/// Memory tracking for dMalloc/dRealloc/dFree.
+///
+/// Only active when 'TORQUE_TRACK_MEMORY' is defined. Each allocation is attributed
+/// to the memory tag active on the allocating thread or, if there is none, to the
+/// source file that made the allocation.
+namespace Memory
+{
+   /// Usage of a memory tag or of all memory.
+   struct Usage
+   {
+      dsize_t  liveBytes;
+      dsize_t  peakBytes;
+      U32      liveCount;
+      U64      allocCount;
+      U64      freeCount;
+   };
+
+   /// Is memory tracking compiled in?
+   bool isTrackingEnabled();
+
+   /// Fetch the usage of all tracked memory.
+   bool getUsage( Usage& usage );
+
+   /// Fetch the usage of the specified memory tag or source file.
+   bool getTagUsage( const char* pTag, Usage& usage );
+
+   /// Reset the peak bytes of all memory and all tags to their current live bytes.
+   void resetPeakUsage();
+
+   /// Print the total usage and the tags with the most live bytes.
+   void dumpUsage( const U32 maxTags );
+
+   /// Take a snapshot of the usage of all tags.
+   /// @return The snapshot Id or zero if the snapshot could not be taken.
+   U32 takeSnapshot();
+
+   /// Print the tags whose usage changed the most between two snapshots.
+   /// @return Whether both snapshots were available.
+   bool dumpSnapshotDiff( const U32 fromSnapshotId, const U32 toSnapshotId, const U32 maxTags );
+
+   /// Attributes allocations on the current thread to a named tag whilst in scope.
+   /// The tag must be a string literal (or otherwise never freed).
+   class TagScope
+   {
+   public:
+#ifdef TORQUE_TRACK_MEMORY
+      TagScope( const char* pTag );
+      ~TagScope();
+
+   private:
+      const char* mpPreviousTag;
+#else
+      TagScope( const char* pTag ) {}
+#endif
+   };
+}
+
 #endif // _PLATFORM_MEMORY_H_
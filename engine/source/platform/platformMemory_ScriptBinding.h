@@ -0,0 +1,92 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+/*! @defgroup MemoryFunctions Memory
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Prints the total tracked memory usage and the memory tags with the most live bytes.
+    Memory tracking is only available when the engine is built with TORQUE_TRACK_MEMORY.
+    @param maxTags The maximum number of tags to print (default 20).
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( dumpMemoryUsage, ConsoleVoid, 1, 2, ([maxTags]) )
+{
+    Memory::dumpUsage( argc > 1 ? dAtoi(argv[1]) : 20 );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the tracked usage of all memory or of a memory tag.
+    @param tag The memory tag or source file (relative to the engine source folder).  All memory is used if not specified.
+    @return The usage formatted as "liveBytes liveBlocks peakBytes allocCount freeCount" or an empty string if unavailable.
+*/
+ConsoleFunctionWithDocs( getMemoryUsage, ConsoleString, 1, 2, ([tag]) )
+{
+    Memory::Usage usage;
+    const bool found = argc > 1 ? Memory::getTagUsage( argv[1], usage ) : Memory::getUsage( usage );
+
+    if ( !found )
+        return StringTable->EmptyString;
+
+    char* pBuffer = Con::getReturnBuffer(128);
+    dSprintf( pBuffer, 128, "%.0f %d %.0f %.0f %.0f", (F64)usage.liveBytes, usage.liveCount, (F64)usage.peakBytes, (F64)usage.allocCount, (F64)usage.freeCount );
+    return pBuffer;
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Resets the tracked peak memory usage to the current live usage.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( resetMemoryPeakUsage, ConsoleVoid, 1, 1, () )
+{
+    Memory::resetPeakUsage();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Takes a snapshot of the tracked memory usage of all memory tags.
+    Only the most recent 16 snapshots are kept.
+    @return The snapshot Id or zero if memory tracking is not enabled.
+*/
+ConsoleFunctionWithDocs( takeMemorySnapshot, ConsoleInt, 1, 1, () )
+{
+    return Memory::takeSnapshot();
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Prints the memory tags whose usage changed the most between two snapshots.
+    Tags are ordered by the change in live bytes and then by the number of allocations so both leaks and churn are shown.
+    @param fromSnapshotId The earlier snapshot Id.
+    @param toSnapshotId The later snapshot Id.
+    @param maxTags The maximum number of tags to print (default 20).
+    @return Whether both snapshots were available.
+*/
+ConsoleFunctionWithDocs( dumpMemorySnapshotDiff, ConsoleBool, 3, 4, (fromSnapshotId, toSnapshotId, [maxTags]) )
+{
+    return Memory::dumpSnapshotDiff( dAtoi(argv[1]), dAtoi(argv[2]), argc > 3 ? dAtoi(argv[3]) : 20 );
+}
+
+/*! @} */ // group MemoryFunctions
@@ -27,6 +27,14 @@
 #include "platform/types.h"
 #endif
 
+/// Declares a static variable with a separate instance per thread.
+/// Only suitable for plain-old-data such as pointers and integers.
+#if defined(TORQUE_COMPILER_VISUALC)
+#define TORQUE_THREAD_LOCAL __declspec(thread)
+#else
+#define TORQUE_THREAD_LOCAL __thread
+#endif
+
 struct PlatformThreadStorage;
 
 /// Platform independent per-thread storage class.
@@ -0,0 +1,262 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#include "platform/threads/threadPool.h"
+
+#ifndef _PLATFORM_INTRINSICS_H_
+#include "platform/platformIntrinsics.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _FRAMEALLOCATOR_H_
+#include "memory/frameAllocator.h"
+#endif
+
+#if defined(TORQUE_OS_WIN32)
+#include <windows.h>
+#elif !defined(TORQUE_OS_EMSCRIPTEN)
+#include <unistd.h>
+#endif
+
+// Script bindings.
+#include "threadPool_ScriptBinding.h"
+
+//-----------------------------------------------------------------------------
+
+/// The maximum number of workers.
+#define THREADPOOL_MAX_WORKERS  15
+
+//-----------------------------------------------------------------------------
+
+ThreadPool* ThreadPool::Instance = NULL;
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::init( void )
+{
+    // Create the thread pool.
+    Instance = new ThreadPool( getDefaultWorkerCount() );
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::destroy( void )
+{
+    // Delete the thread pool.
+    delete Instance;
+    Instance = NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+U32 ThreadPool::getDefaultWorkerCount( void )
+{
+    // Fetch the processor count.
+#if defined(TORQUE_OS_WIN32)
+    SYSTEM_INFO systemInfo;
+    GetSystemInfo( &systemInfo );
+    const S32 processorCount = (S32)systemInfo.dwNumberOfProcessors;
+#elif defined(TORQUE_OS_EMSCRIPTEN)
+    const S32 processorCount = 1;
+#else
+    const S32 processorCount = (S32)sysconf( _SC_NPROCESSORS_ONLN );
+#endif
+
+    // Use a worker for each processor other than the main thread one.
+    return (U32)mClamp( processorCount - 1, 0, THREADPOOL_MAX_WORKERS );
+}
+
+//-----------------------------------------------------------------------------
+
+ThreadPool::ThreadPool( const U32 workerCount ) :
+    mWakeSemaphore( 0 ),
+    mDoneSemaphore( 0 ),
+    mShutdown( false ),
+    mpJobFunction( NULL ),
+    mpJobContext( NULL ),
+    mJobItemCount( 0 ),
+    mJobBatchSize( 0 ),
+    mJobNextItem( 0 ),
+    mJobActive( false )
+{
+    VECTOR_SET_ASSOCIATION( mWorkers );
+
+    // Start the workers.
+    setWorkerCount( workerCount );
+}
+
+//-----------------------------------------------------------------------------
+
+ThreadPool::~ThreadPool()
+{
+    // Stop the workers.
+    setWorkerCount( 0 );
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::setWorkerCount( const U32 workerCount )
+{
+    // Sanity!
+    AssertFatal( !mJobActive, "ThreadPool::setWorkerCount() - Cannot change the worker count while a job is active." );
+
+    // Clamp the worker count.
+    const U32 newWorkerCount = getMin( workerCount, (U32)THREADPOOL_MAX_WORKERS );
+
+    // Finish if nothing to do.
+    if ( newWorkerCount == getWorkerCount() )
+        return;
+
+    // Stop any existing workers.
+    if ( mWorkers.size() > 0 )
+    {
+        // Wake all the workers with the shutdown flag set.
+        mShutdown = true;
+        for ( U32 n = 0; n < getWorkerCount(); ++n )
+            mWakeSemaphore.release();
+
+        // Wait for the workers to finish.
+        for ( U32 n = 0; n < getWorkerCount(); ++n )
+        {
+            mWorkers[n]->join();
+            delete mWorkers[n];
+        }
+
+        mWorkers.clear();
+        mShutdown = false;
+    }
+
+    // Start the new workers.
+    for ( U32 n = 0; n < newWorkerCount; ++n )
+    {
+        // Worker thread indices start after the calling thread.
+        WorkerThread* pWorker = new WorkerThread( this, n + 1 );
+        mWorkers.push_back( pWorker );
+        pWorker->start();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::parallelFor( JobFunction pJobFunction, void* pContext, const U32 itemCount, const U32 batchSize )
+{
+    // Sanity!
+    AssertFatal( pJobFunction != NULL, "ThreadPool::parallelFor() - Invalid job function." );
+    AssertFatal( !mJobActive, "ThreadPool::parallelFor() - Jobs cannot be nested." );
+
+    // Finish if nothing to do.
+    if ( itemCount == 0 )
+        return;
+
+    // Calculate the batch count.
+    const U32 clampedBatchSize = getMax( batchSize, (U32)1 );
+    const U32 batchCount = (itemCount + clampedBatchSize - 1) / clampedBatchSize;
+
+    // Only wake as many workers as there are batches for them.
+    const U32 wakeCount = getMin( batchCount - 1, getWorkerCount() );
+
+    // Process the whole range on the calling thread if no workers are required.
+    if ( wakeCount == 0 )
+    {
+        pJobFunction( pContext, 0, itemCount, 0 );
+        return;
+    }
+
+    // Set the job.
+    mpJobFunction = pJobFunction;
+    mpJobContext = pContext;
+    mJobItemCount = itemCount;
+    mJobBatchSize = clampedBatchSize;
+    mJobNextItem = 0;
+    mJobActive = true;
+
+    // Wake the workers.
+    for ( U32 n = 0; n < wakeCount; ++n )
+        mWakeSemaphore.release();
+
+    // Process batches on the calling thread too.
+    processBatches( 0 );
+
+    // Wait for the woken workers to finish.  This ensures that no worker is still
+    // referencing the job when we return.
+    for ( U32 n = 0; n < wakeCount; ++n )
+        mDoneSemaphore.acquire();
+
+    // Reset the job.
+    mpJobFunction = NULL;
+    mpJobContext = NULL;
+    mJobActive = false;
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::processBatches( const U32 threadIndex )
+{
+    while( true )
+    {
+        // Claim the next batch.
+        const U32 startIndex = dFetchAndAdd( mJobNextItem, mJobBatchSize );
+
+        // Finish if no batches remain.
+        if ( startIndex >= mJobItemCount )
+            return;
+
+        // Process the batch.
+        const U32 endIndex = getMin( startIndex + mJobBatchSize, mJobItemCount );
+        mpJobFunction( mpJobContext, startIndex, endIndex, threadIndex );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+void ThreadPool::WorkerThread::run( void* arg )
+{
+    while( true )
+    {
+        // Wait to be woken.
+        mpThreadPool->mWakeSemaphore.acquire();
+
+        // Finish if shutting down.
+        if ( mpThreadPool->mShutdown )
+        {
+            FrameAllocator::releaseThreadArena();
+            return;
+        }
+
+        // Process batches.
+        mpThreadPool->processBatches( mThreadIndex );
+
+        // Jobs must release their frame allocations.
+        FrameAllocator::endThreadFrame();
+
+        // Signal that we're done with this job.
+        mpThreadPool->mDoneSemaphore.release();
+    }
+}
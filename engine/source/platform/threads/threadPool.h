@@ -0,0 +1,109 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#define _PLATFORM_THREADS_THREADPOOL_H_
+
+#ifndef _TORQUE_TYPES_H_
+#include "platform/types.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+#ifndef _PLATFORM_THREAD_SEMAPHORE_H_
+#include "platform/threads/semaphore.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+/// A fixed set of worker threads used to split data-parallel work across cores.
+///
+/// Work is submitted with "parallelFor()" which splits an item range into batches,
+/// runs them on the workers as well as the calling thread and blocks until all the
+/// batches are complete.  Only a single job can be in-flight at any one time and
+/// jobs must be submitted from the main thread.
+///
+/// Each batch is given the index of the thread processing it where the calling thread
+/// is always index zero and the workers are indices one onwards.  This allows a job to
+/// use per-thread scratch storage without any locking, see "getConcurrency()".
+class ThreadPool
+{
+public:
+    /// Processes the items in the range [startIndex, endIndex).
+    typedef void (*JobFunction)( void* pContext, const U32 startIndex, const U32 endIndex, const U32 threadIndex );
+
+private:
+    class WorkerThread : public Thread
+    {
+    public:
+        WorkerThread( ThreadPool* pThreadPool, const U32 threadIndex ) :
+            Thread( 0, 0, false ),
+            mpThreadPool( pThreadPool ),
+            mThreadIndex( threadIndex )
+        {
+        }
+
+        virtual void run( void* arg = 0 );
+
+    private:
+        ThreadPool*     mpThreadPool;
+        U32             mThreadIndex;
+    };
+
+    Vector<WorkerThread*>   mWorkers;
+    Semaphore               mWakeSemaphore;
+    Semaphore               mDoneSemaphore;
+    volatile bool           mShutdown;
+
+    /// Current job.
+    JobFunction             mpJobFunction;
+    void*                   mpJobContext;
+    U32                     mJobItemCount;
+    U32                     mJobBatchSize;
+    volatile U32            mJobNextItem;
+    bool                    mJobActive;
+
+    void                    processBatches( const U32 threadIndex );
+
+public:
+    ThreadPool( const U32 workerCount );
+    ~ThreadPool();
+
+    /// Worker control.
+    void                    setWorkerCount( const U32 workerCount );
+    inline U32              getWorkerCount( void ) const                { return (U32)mWorkers.size(); }
+    inline U32              getConcurrency( void ) const                { return getWorkerCount() + 1; }
+    static U32              getDefaultWorkerCount( void );
+
+    /// Splits [0, itemCount) into batches of "batchSize" items and blocks until they have all been processed.
+    void                    parallelFor( JobFunction pJobFunction, void* pContext, const U32 itemCount, const U32 batchSize );
+
+    /// Global thread pool.
+    static void             init( void );
+    static void             destroy( void );
+    static ThreadPool*      Instance;
+};
+
+#endif // _PLATFORM_THREADS_THREADPOOL_H_
@@ -0,0 +1,72 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+/*! @addtogroup ThreadPool Thread Pool
+	@ingroup TorqueScriptFunctions
+	@{
+*/
+
+/*! Sets the number of worker threads used by the engine for parallel jobs.
+    @param workerCount The number of workers, excluding the main thread.  Zero disables parallel jobs.
+    @return No return value.
+*/
+ConsoleFunctionWithDocs( setThreadPoolWorkerCount, ConsoleVoid, 2, 2, (workerCount) )
+{
+    // Finish if no thread pool.
+    if ( ThreadPool::Instance == NULL )
+    {
+        Con::warnf( "setThreadPoolWorkerCount() - The thread pool is not available." );
+        return;
+    }
+
+    // Fetch the worker count.
+    const S32 workerCount = dAtoi(argv[1]);
+
+    // Sanity!
+    if ( workerCount < 0 )
+    {
+        Con::warnf( "setThreadPoolWorkerCount() - Invalid worker count '%d'.", workerCount );
+        return;
+    }
+
+    ThreadPool::Instance->setWorkerCount( (U32)workerCount );
+}
+
+//-----------------------------------------------------------------------------
+
+/*! Gets the number of worker threads used by the engine for parallel jobs.
+    @return The number of workers, excluding the main thread.
+*/
+ConsoleFunctionWithDocs( getThreadPoolWorkerCount, ConsoleInt, 1, 1, () )
+{
+    // Finish if no thread pool.
+    if ( ThreadPool::Instance == NULL )
+    {
+        Con::warnf( "getThreadPoolWorkerCount() - The thread pool is not available." );
+        return 0;
+    }
+
+    return (S32)ThreadPool::Instance->getWorkerCount();
+}
+
+/*! @} */ // group ThreadPool
@@ -140,12 +140,9 @@ void getGLCapabilities( )
       if (dStrstr(pExtString, (const char*)"GL_EXT_texture_compression_s3tc") != NULL)
          gGLState.suppS3TC = true;
 
-      // EXT_vertex_buffer ========================================
-      // This extension is deprecated, and not supported by Apple. ( 10.4.3 )
-      // Instead, the ARB Vertex Buffer extension is supported.
-      // The new extension has a different API, so TGE should be updated to use it.
-      if (dStrstr(pExtString, (const char*)"GL_EXT_vertex_buffer") != NULL)
-         gGLState.suppVertexBuffer = true;
+      // Vertex buffer objects ========================================
+      // These are core in OpenGL ES 1.1 so need no extension.
+      gGLState.suppVertexBuffer = true;
 
       // Anisotropic filtering ========================================
       gGLState.suppTexAnisotropic    = (dStrstr(pExtString, (const char*)"GL_EXT_texture_filter_anisotropic") != NULL);
@@ -196,6 +193,7 @@ void getGLCapabilities( )
    if (gGLState.suppPalettedTexture)    Con::printf("  EXT_paletted_texture");
    if (gGLState.suppLockedArrays)       Con::printf("  EXT_compiled_vertex_array");
    if (gGLState.suppVertexArrayRange)   Con::printf("  NV_vertex_array_range");
+   if (gGLState.suppVertexBuffer)       Con::printf("  ARB_vertex_buffer_object");
    if (gGLState.suppTextureEnvCombine)  Con::printf("  EXT_texture_env_combine");
    if (gGLState.suppPackedPixels)       Con::printf("  EXT_packed_pixels");
    if (gGLState.suppFogCoord)           Con::printf("  EXT_fog_coord");
@@ -214,6 +212,7 @@ void getGLCapabilities( )
    if (!gGLState.suppPalettedTexture)    Con::warnf("  EXT_paletted_texture");
    if (!gGLState.suppLockedArrays)       Con::warnf("  EXT_compiled_vertex_array");
    if (!gGLState.suppVertexArrayRange)   Con::warnf("  NV_vertex_array_range");
+   if (!gGLState.suppVertexBuffer)       Con::warnf("  ARB_vertex_buffer_object");
    if (!gGLState.suppTextureEnvCombine)  Con::warnf("  EXT_texture_env_combine");
    if (!gGLState.suppPackedPixels)       Con::warnf("  EXT_packed_pixels");
    if (!gGLState.suppFogCoord)           Con::warnf("  EXT_fog_coord");
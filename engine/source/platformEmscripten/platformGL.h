@@ -47,6 +47,8 @@ GLint gluUnProject( GLdouble winx, GLdouble winy, GLdouble winz, const F64 *mode
 
 #else
 
+// Expose the buffer object entry points used by the batch renderer.
+#define GL_GLEXT_PROTOTYPES
 #include <GL/gl.h>
 #include <GL/glext.h>
 
@@ -219,11 +219,8 @@ void getGLCapabilities()
         if (dStrstr(pExtString, (const char*)"GL_EXT_texture_compression_s3tc") != NULL)
             gGLState.suppS3TC = true;
         
-        // EXT_vertex_buffer ========================================
-        // This extension is deprecated, and not supported by Apple. (10.4.3)
-        // Instead, the ARB Vertex Buffer extension is supported.
-        // The new extension has a different API, so TGE should be updated to use it.
-        if (dStrstr(pExtString, (const char*)"GL_EXT_vertex_buffer") != NULL)
+        // ARB_vertex_buffer_object ========================================
+        if (dStrstr(pExtString, (const char*)"GL_ARB_vertex_buffer_object") != NULL)
             gGLState.suppVertexBuffer = true;
         
         // Anisotropic filtering ========================================
@@ -285,6 +282,9 @@ void getGLCapabilities()
     if (gGLState.suppVertexArrayRange)
         Con::printf("  NV_vertex_array_range");
     
+    if (gGLState.suppVertexBuffer)
+        Con::printf("  ARB_vertex_buffer_object");
+    
     if (gGLState.suppTextureEnvCombine)
         Con::printf("  EXT_texture_env_combine");
     
@@ -335,6 +335,9 @@ void getGLCapabilities()
     if (!gGLState.suppVertexArrayRange)
         Con::warnf("  NV_vertex_array_range");
     
+    if (!gGLState.suppVertexBuffer)
+        Con::warnf("  ARB_vertex_buffer_object");
+    
     if (!gGLState.suppTextureEnvCombine)
         Con::warnf("  EXT_texture_env_combine");
     
@@ -25,6 +25,8 @@
 #ifndef _WIN32_GL_TYPES_H_
 #define _WIN32_GL_TYPES_H_
 
+#include <stddef.h>
+
 // added by BJG:
 #define GL_RGB_SCALE 0x8573
 
@@ -171,6 +173,8 @@ typedef float		GLfloat;	/* single precision float */
 typedef float		GLclampf;	/* single precision float in [0,1] */
 typedef double		GLdouble;	/* double precision float */
 typedef double		GLclampd;	/* double precision float in [0,1] */
+typedef ptrdiff_t	GLintptr;	/* pointer-sized signed offset */
+typedef ptrdiff_t	GLsizeiptr;	/* pointer-sized signed size */
 
 
 
@@ -211,10 +211,12 @@ namespace Sim
    }
 
    void cancelEvent(U32 eventId);
+   void cancelPendingEvents(SimObject *obj);
    bool isEventPending(U32 eventId);
    U32  getEventTimeLeft(U32 eventId);
    U32  getTimeSinceStart(U32 eventId);
    U32  getScheduleDuration(U32 eventId);
+   U32  getPendingEventCount();
 
    bool saveObject(SimObject *obj, Stream *stream);
    SimObject *loadObjectStream(Stream *stream);
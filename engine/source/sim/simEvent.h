@@ -53,14 +53,17 @@ typedef U32 SimTime;
 class SimEvent
 {
   public:
-   SimEvent *nextEvent;     ///< Linked list details - pointer to next item in the list.
+   SimEvent *nextEvent;     ///< Links events posted from other threads until they are queued.
+   SimEvent *prevObjectEvent; ///< Previous pending event for the same destination object.
+   SimEvent *nextObjectEvent; ///< Next pending event for the same destination object.
+   U32 queueIndex;          ///< Position of the event in the event queue heap.
    SimTime startTime;       ///< When the event was posted.
    SimTime time;            ///< When the event is scheduled to occur.
    U32 sequenceCount;       ///< Unique ID. These are assigned sequentially based on order
                             ///  of addition to the list.
    SimObject *destObject;   ///< Object on which this event will be applied.
 
-   SimEvent() { destObject = NULL; }
+   SimEvent() { nextEvent = prevObjectEvent = nextObjectEvent = NULL; queueIndex = 0; destObject = NULL; }
    virtual ~SimEvent() {}   ///< Destructor
                             ///
                             /// A dummy virtual destructor is required
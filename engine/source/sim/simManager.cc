@@ -30,6 +30,9 @@
 #include "io/fileObject.h"
 #include "console/consoleInternal.h"
 #include "memory/safeDelete.h"
+#include "collection/hashTable.h"
+#include "platform/threads/thread.h"
+#include "platform/platformIntrinsics.h"
 
 //---------------------------------------------------------------------------
 
@@ -44,8 +47,193 @@ SimTime gCurrentTime;
 SimTime gTargetTime;
 
 void *gEventQueueMutex;
-SimEvent *gEventQueue;
-U32 gEventSequence;
+volatile U32 gEventSequence;
+
+/// The thread that processes the event queue.
+ThreadIdent gEventQueueThread;
+
+/// Events posted from other threads, most recent first.
+/// NOTE:- This is a lock-free stack linked with "SimEvent::nextEvent" that is drained into the queue under the queue mutex.
+void* volatile gEventInbox;
+
+/// Pending events as a binary min-heap ordered by time then sequence.
+Vector<SimEvent*> gEventQueue;
+
+/// Pending events by sequence number.
+HashTable<U32, SimEvent*> gEventSequenceIndex;
+
+/// Head of the pending events list for each destination object.
+HashTable<SimObject*, SimEvent*> gEventObjectIndex;
+
+//---------------------------------------------------------------------------
+// event queue heap
+
+static inline bool eventPrecedes(const SimEvent *a, const SimEvent *b)
+{
+   // Events at the same time are dispatched in the order they were posted.
+   if(a->time != b->time)
+      return a->time < b->time;
+
+   return (S32)(a->sequenceCount - b->sequenceCount) < 0;
+}
+
+static inline void setEventQueueSlot(const U32 index, SimEvent *event)
+{
+   gEventQueue[index] = event;
+   event->queueIndex = index;
+}
+
+static void siftEventUp(U32 index)
+{
+   SimEvent *event = gEventQueue[index];
+   while(index > 0)
+   {
+      const U32 parent = (index - 1) >> 1;
+      if(!eventPrecedes(event, gEventQueue[parent]))
+         break;
+
+      setEventQueueSlot(index, gEventQueue[parent]);
+      index = parent;
+   }
+   setEventQueueSlot(index, event);
+}
+
+static void siftEventDown(U32 index)
+{
+   const U32 count = (U32)gEventQueue.size();
+   SimEvent *event = gEventQueue[index];
+   while(true)
+   {
+      U32 child = (index << 1) + 1;
+      if(child >= count)
+         break;
+
+      if(child + 1 < count && eventPrecedes(gEventQueue[child + 1], gEventQueue[child]))
+         child++;
+
+      if(!eventPrecedes(gEventQueue[child], event))
+         break;
+
+      setEventQueueSlot(index, gEventQueue[child]);
+      index = child;
+   }
+   setEventQueueSlot(index, event);
+}
+
+static void insertEvent(SimEvent *event)
+{
+   // Add to the heap.
+   gEventQueue.push_back(event);
+   siftEventUp(gEventQueue.size() - 1);
+
+   // Add to the sequence index.
+   gEventSequenceIndex.insertUnique(event->sequenceCount, event);
+
+   // Add to the head of the destination object list.
+   HashTable<SimObject*, SimEvent*>::iterator itr = gEventObjectIndex.findOrInsert(event->destObject);
+   event->prevObjectEvent = NULL;
+   event->nextObjectEvent = itr->value;
+   if(itr->value)
+      itr->value->prevObjectEvent = event;
+   itr->value = event;
+}
+
+static void removeEvent(SimEvent *event)
+{
+   // Remove from the heap.
+   const U32 index = event->queueIndex;
+   const U32 lastIndex = gEventQueue.size() - 1;
+   if(index != lastIndex)
+   {
+      setEventQueueSlot(index, gEventQueue[lastIndex]);
+      gEventQueue.pop_back();
+
+      // The moved event may need to go either way.
+      if(index > 0 && eventPrecedes(gEventQueue[index], gEventQueue[(index - 1) >> 1]))
+         siftEventUp(index);
+      else
+         siftEventDown(index);
+   }
+   else
+   {
+      gEventQueue.pop_back();
+   }
+
+   // Remove from the sequence index.
+   gEventSequenceIndex.erase(event->sequenceCount);
+
+   // Remove from the destination object list.
+   if(event->nextObjectEvent)
+      event->nextObjectEvent->prevObjectEvent = event->prevObjectEvent;
+
+   if(event->prevObjectEvent)
+   {
+      event->prevObjectEvent->nextObjectEvent = event->nextObjectEvent;
+   }
+   else if(event->nextObjectEvent)
+   {
+      gEventObjectIndex.find(event->destObject)->value = event->nextObjectEvent;
+   }
+   else
+   {
+      gEventObjectIndex.erase(event->destObject);
+   }
+
+   event->prevObjectEvent = event->nextObjectEvent = NULL;
+}
+
+static void drainEventInbox()
+{
+   // Finish if nothing has been posted from other threads.
+   if(gEventInbox == NULL)
+      return;
+
+   // Take all the posted events.
+   SimEvent *event = (SimEvent*)dAtomicExchange(gEventInbox, NULL);
+
+   // Reverse the events into posting order.
+   SimEvent *postedEvents = NULL;
+   while(event)
+   {
+      SimEvent *next = event->nextEvent;
+      event->nextEvent = postedEvents;
+      postedEvents = event;
+      event = next;
+   }
+
+   // Queue the events.
+   while(postedEvents)
+   {
+      event = postedEvents;
+      postedEvents = event->nextEvent;
+      event->nextEvent = NULL;
+
+      // The queue may have advanced since the event was posted.
+      if(event->time < gCurrentTime)
+         event->time = gCurrentTime;
+
+      insertEvent(event);
+   }
+}
+
+static inline U32 allocateEventSequence()
+{
+   // Skip the invalid event Id if the sequence wraps.
+   U32 sequence;
+   do
+   {
+      sequence = dFetchAndAdd(gEventSequence, 1);
+   }
+   while(sequence == InvalidEventId);
+
+   return sequence;
+}
+
+static inline SimEvent *findEvent(U32 eventSequence)
+{
+   HashTable<U32, SimEvent*>::iterator itr = gEventSequenceIndex.find(eventSequence);
+   return itr != gEventSequenceIndex.end() ? itr->value : NULL;
+}
 
 //---------------------------------------------------------------------------
 // event queue init/shutdown
@@ -55,7 +243,11 @@ void initEventQueue()
    gCurrentTime = 0;
    gTargetTime = 0;
    gEventSequence = 1;
-   gEventQueue = NULL;
+   gEventQueueThread = ThreadManager::getCurrentThreadId();
+   gEventInbox = NULL;
+   gEventQueue.clear();
+   gEventSequenceIndex.clear();
+   gEventObjectIndex.clear();
    gEventQueueMutex = Mutex::createMutex();
 }
 
@@ -63,13 +255,12 @@ void shutdownEventQueue()
 {
    // Delete all pending events
    Mutex::lockMutex(gEventQueueMutex);
-   SimEvent *walk = gEventQueue;
-   while(walk)
-   {
-      SimEvent *temp = walk->nextEvent;
-      delete walk;
-      walk = temp;
-   }
+   drainEventInbox();
+   for(S32 i = 0; i < gEventQueue.size(); i++)
+      delete gEventQueue[i];
+   gEventQueue.clear();
+   gEventSequenceIndex.clear();
+   gEventObjectIndex.clear();
    Mutex::unlockMutex(gEventQueueMutex);
    Mutex::destroyMutex(gEventQueueMutex);
 }
@@ -83,37 +274,53 @@ U32 postEvent(SimObject *destObject, SimEvent* event,U32 time)
         "Sim::postEvent: Cannot go back in time. (flux capacitor unavailable -- BJG)");
    AssertFatal(destObject, "Destination object for event doesn't exist.");
 
+   if(!destObject)
+   {
+      delete event;
+      return InvalidEventId;
+   }
+
+   // Posting from another thread?
+   if(!ThreadManager::isCurrentThread(gEventQueueThread))
+   {
+      // Yes, so post into the inbox without locking.
+      // NOTE:- The event is queued by the next queue operation (at the latest, the start of the next time advance).
+      const SimTime currentTime = gCurrentTime;
+      event->time = time == -1 ? currentTime : time;
+      event->startTime = currentTime;
+      event->destObject = destObject;
+      event->sequenceCount = allocateEventSequence();
+
+      const U32 seqCount = event->sequenceCount;
+
+      void *head;
+      do
+      {
+         head = gEventInbox;
+         event->nextEvent = (SimEvent*)head;
+      }
+      while(!dCompareAndSwap(gEventInbox, head, event));
+
+      return seqCount;
+   }
+
    Mutex::lockMutex(gEventQueueMutex);
 
+   // Queue any events posted from other threads first.
+   drainEventInbox();
+
    if( time == -1 )
       time = gCurrentTime;
 
    event->time = time;
    event->startTime = gCurrentTime;
    event->destObject = destObject;
+   event->sequenceCount = allocateEventSequence();
 
-   if(!destObject)
-   {
-      delete event;
-
-      Mutex::unlockMutex(gEventQueueMutex);
-
-      return InvalidEventId;
-   }
-   event->sequenceCount = gEventSequence++;
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL && (current->time < event->time))
-      walk = &(current->nextEvent);
-   
    // [tom, 6/24/2005] This ensures that SimEvents are dispatched in the same order that they are posted.
    // This is needed to ensure Con::threadSafeExecute() executes script code in the correct order.
-   while((current = *walk) != NULL && (current->time == event->time))
-      walk = &(current->nextEvent);
-   
-   event->nextEvent = current;
-   *walk = event;
+   // NOTE:- The queue orders events at the same time by their sequence.
+   insertEvent(event);
 
    U32 seqCount = event->sequenceCount;
 
@@ -133,21 +340,13 @@ U32 postEvent(SimObject *destObject, SimEvent* event,U32 time)
 void cancelEvent(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
+   drainEventInbox();
 
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL)
+   SimEvent *event = findEvent(eventSequence);
+   if(event)
    {
-      if(current->sequenceCount == eventSequence)
-      {
-         *walk = current->nextEvent;
-         delete current;
-         Mutex::unlockMutex(gEventQueueMutex);
-         return;
-      }
-      else
-         walk = &(current->nextEvent);
+      removeEvent(event);
+      delete event;
    }
 
    Mutex::unlockMutex(gEventQueueMutex);
@@ -156,20 +355,22 @@ void cancelEvent(U32 eventSequence)
 void cancelPendingEvents(SimObject *obj)
 {
    Mutex::lockMutex(gEventQueueMutex);
+   drainEventInbox();
 
-   SimEvent **walk = &gEventQueue;
-   SimEvent *current;
-   
-   while((current = *walk) != NULL)
+   HashTable<SimObject*, SimEvent*>::iterator itr = gEventObjectIndex.find(obj);
+   if(itr != gEventObjectIndex.end())
    {
-      if(current->destObject == obj)
+      // Removing the last event for the object also removes it from the index.
+      SimEvent *event = itr->value;
+      while(event)
       {
-         *walk = current->nextEvent;
-         delete current;
+         SimEvent *next = event->nextObjectEvent;
+         removeEvent(event);
+         delete event;
+         event = next;
       }
-      else
-         walk = &(current->nextEvent);
    }
+
    Mutex::unlockMutex(gEventQueueMutex);
 }
 
@@ -187,15 +388,10 @@ void cancelPendingEvents(SimObject *obj)
 bool isEventPending(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
-
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-      {
-         Mutex::unlockMutex(gEventQueueMutex);
-         return true;
-      }
+   drainEventInbox();
+   const bool pending = findEvent(eventSequence) != NULL;
    Mutex::unlockMutex(gEventQueueMutex);
-   return false;
+   return pending;
 }
 
 /*!
@@ -208,18 +404,14 @@ bool isEventPending(U32 eventSequence)
 U32 getEventTimeLeft(U32 eventSequence)
 {
    Mutex::lockMutex(gEventQueueMutex);
+   drainEventInbox();
 
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-      {
-         SimTime t = walk->time - getCurrentTime();
-         Mutex::unlockMutex(gEventQueueMutex);
-         return t;
-      }
+   SimEvent *event = findEvent(eventSequence);
+   SimTime t = event ? event->time - getCurrentTime() : 0;
 
    Mutex::unlockMutex(gEventQueueMutex);
 
-   return 0;   
+   return t;   
 }
 
 /*!
@@ -231,10 +423,15 @@ U32 getEventTimeLeft(U32 eventSequence)
 */
 U32 getScheduleDuration(U32 eventSequence)
 {
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-         return (walk->time-walk->startTime);
-   return 0;
+   Mutex::lockMutex(gEventQueueMutex);
+   drainEventInbox();
+
+   SimEvent *event = findEvent(eventSequence);
+   SimTime t = event ? event->time - event->startTime : 0;
+
+   Mutex::unlockMutex(gEventQueueMutex);
+
+   return t;
 }
 
 /*!
@@ -246,10 +443,25 @@ U32 getScheduleDuration(U32 eventSequence)
 */
 U32 getTimeSinceStart(U32 eventSequence)
 {
-   for(SimEvent *walk = gEventQueue; walk; walk = walk->nextEvent)
-      if(walk->sequenceCount == eventSequence)
-         return (getCurrentTime()-walk->startTime);
-   return 0;
+   Mutex::lockMutex(gEventQueueMutex);
+   drainEventInbox();
+
+   SimEvent *event = findEvent(eventSequence);
+   SimTime t = event ? getCurrentTime() - event->startTime : 0;
+
+   Mutex::unlockMutex(gEventQueueMutex);
+
+   return t;
+}
+
+/// Get the number of pending events.
+U32 getPendingEventCount()
+{
+   Mutex::lockMutex(gEventQueueMutex);
+   drainEventInbox();
+   const U32 count = (U32)gEventQueue.size();
+   Mutex::unlockMutex(gEventQueueMutex);
+   return count;
 }
 
 //---------------------------------------------------------------------------
@@ -260,11 +472,15 @@ void advanceToTime(SimTime targetTime)
    AssertFatal(targetTime >= getCurrentTime(), "EventQueue::process: cannot advance to time in the past.");
 
    Mutex::lockMutex(gEventQueueMutex);
+
+   // Queue any events posted from other threads.
+   drainEventInbox();
+
    gTargetTime = targetTime;
-   while(gEventQueue && gEventQueue->time <= targetTime)
+   while(gEventQueue.size() && gEventQueue[0]->time <= targetTime)
    {
-      SimEvent *event = gEventQueue;
-      gEventQueue = gEventQueue->nextEvent;
+      SimEvent *event = gEventQueue[0];
+      removeEvent(event);
       AssertFatal(event->time >= gCurrentTime,
             "SimEventQueue::pop: Cannot go back in time (flux capacitor not installed - BJG).");
       gCurrentTime = event->time;
@@ -290,15 +506,8 @@ void advanceTime(SimTime delta)
 */
 U32 getCurrentTime()
 {
-   if(gEventQueueMutex)
-      Mutex::lockMutex(gEventQueueMutex);
-   
-   SimTime t = gCurrentTime;
-   
-   if(gEventQueueMutex)
-      Mutex::unlockMutex(gEventQueueMutex);
-
-   return t;
+   // NOTE:- This is read without locking so that other threads never contend with the queue.
+   return gCurrentTime;
 }
 
 U32 getTargetTime()
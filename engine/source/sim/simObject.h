@@ -698,6 +698,7 @@ public:
     /// @{
     bool isSelected() const { return mFlags.test(Selected); }
     bool isExpanded() const { return mFlags.test(Expanded); }
+    bool isModStaticFields() const { return mFlags.test(ModStaticFields); }
     void setSelected(bool sel) { if(sel) mFlags.set(Selected); else mFlags.clear(Selected); }
     void setExpanded(bool exp) { if(exp) mFlags.set(Expanded); else mFlags.clear(Expanded); }
     void setModDynamicFields(bool dyn) { if(dyn) mFlags.set(ModDynamicFields); else mFlags.clear(ModDynamicFields); }
@@ -37,6 +37,57 @@ void StringStack::getArgcArgv(StringTableEntry name, U32 *argc, const char ***in
    
    *argc = argCount;
 
+   // Format any typed arguments.
+   formatArgs();
+
    if(popStackFrame)
       popFrame();
 }
+
+void StringStack::getArgcArgvValues(StringTableEntry name, U32 *argc, const char ***in_argv, ConsoleValue **in_values)
+{
+   U32 startStack = mFrameOffsets[mNumFrames-1] + 1;
+   U32 argCount   = getMin(mStartStackSize - startStack, (U32)MaxArgs - 1);
+
+   *in_argv = mArgV;
+   *in_values = mArgValues;
+   mArgV[0] = name;
+   mArgValues[0].setStringValue(name);
+
+   for(U32 i = 0; i < argCount; i++)
+   {
+      char* pArg = mBuffer + mStartOffsets[startStack + i];
+      mArgV[i+1] = pArg;
+
+      // Typed arguments are formatted in-place only if their string is requested.
+      ConsoleValue& argValue = mArgValues[i+1];
+      argValue = mStartValues[startStack + i];
+      if(argValue.isString())
+         argValue.setStringValue(pArg);
+      else
+         argValue.setFormatBuffer(pArg);
+   }
+   argCount++;
+
+   *argc = argCount;
+}
+
+void StringStack::formatArgs()
+{
+   U32 startStack = mFrameOffsets[mNumFrames-1] + 1;
+   U32 argCount   = getMin(mStartStackSize - startStack, (U32)MaxArgs);
+
+   for(U32 i = 0; i < argCount; i++)
+   {
+      ConsoleValue& startValue = mStartValues[startStack + i];
+
+      // Skip if already a string.
+      if(startValue.isString())
+         continue;
+
+      // Format the argument in-place.
+      char* pArg = mBuffer + mStartOffsets[startStack + i];
+      startValue.format(pArg);
+      startValue.setStringValue(pArg);
+   }
+}
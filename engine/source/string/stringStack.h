@@ -27,11 +27,16 @@
 #include "console/console.h"
 #include "console/compiler.h"
 #include "string/stringTable.h"
+#include "console/consoleValue.h"
 
 /// Core stack for interpreter operations.
 ///
 /// This class provides some powerful semantics for working with strings, and is
 /// used heavily by the console interpreter.
+///
+/// Numeric values set on the top of the stack are kept typed and are only formatted
+/// when their string is requested.  Typed values pushed as function arguments reserve
+/// space in the buffer so they can be formatted in-place if the callee requires strings.
 struct StringStack
 {
    enum {
@@ -56,6 +61,14 @@ struct StringStack
    U32 mArgBufferSize;
    char *mArgBuffer;
 
+   /// Typed value of the top of the stack, valid whilst mValuePending.
+   ConsoleValue mValue;
+   bool mValuePending;
+
+   /// Typed values of the start stack entries (pushed arguments).
+   ConsoleValue mStartValues[MaxStackDepth];
+   ConsoleValue mArgValues[MaxArgs];
+
    void validateBufferSize(U32 size)
    {
       if(size > mBufferSize)
@@ -81,23 +94,41 @@ struct StringStack
       mLen = 0;
       mStartStackSize = 0;
       mFunctionOffset = 0;
+      mValuePending = false;
       validateBufferSize(8192);
       validateArgBufferSize(2048);
    }
 
    /// Set the top of the stack to be an integer value.
+   ///
+   /// @note The value is not formatted until its string is requested.
    void setIntValue(U32 i)
    {
-      validateBufferSize(mStart + 32);
-      dSprintf(mBuffer + mStart, 32, "%d", i);
-      mLen = dStrlen(mBuffer + mStart);
+      validateBufferSize(mStart + ConsoleValue::FormatBufferSize + 1);
+      mValue.setIntValue((S32)i);
+      mValuePending = true;
+      mLen = 0;
    }
 
    /// Set the top of the stack to be a float value.
+   ///
+   /// @note The value is not formatted until its string is requested.
    void setFloatValue(F64 v)
    {
-      validateBufferSize(mStart + 32);
-      dSprintf(mBuffer + mStart, 32, "%.9g", v);
+      validateBufferSize(mStart + ConsoleValue::FormatBufferSize + 1);
+      mValue.setFloatValue(v);
+      mValuePending = true;
+      mLen = 0;
+   }
+
+   /// Format a pending typed value on the top of the stack.
+   inline void formatValue()
+   {
+      if(!mValuePending)
+         return;
+
+      mValuePending = false;
+      mValue.format(mBuffer + mStart);
       mLen = dStrlen(mBuffer + mStart);
    }
 
@@ -106,6 +137,7 @@ struct StringStack
    /// @note This clobbers anything in our buffers!
    char *getReturnBuffer(U32 size)
    {
+      mValuePending = false;
       if(size > ReturnBufferSpace)
       {
          validateArgBufferSize(size);
@@ -123,6 +155,7 @@ struct StringStack
    /// This updates the function offset.
    char *getArgBuffer(U32 size)
    {
+      mValuePending = false;
       validateBufferSize(mStart + mFunctionOffset + size);
       char *ret = mBuffer + mStart + mFunctionOffset;
       mFunctionOffset += size;
@@ -138,6 +171,7 @@ struct StringStack
    /// Set a string value on the top of the stack.
    void setStringValue(const char *s)
    {
+      mValuePending = false;
       if(!s)
       {
          mLen = 0;
@@ -155,18 +189,25 @@ struct StringStack
    /// @note Don't free this memory!
    inline StringTableEntry getSTValue()
    {
+      formatValue();
       return StringTable->insert(mBuffer + mStart);
    }
 
    /// Get an integer representation of the top of the stack.
    inline U32 getIntValue()
    {
+      if(mValuePending)
+         return (U32)mValue.getIntValue();
+
       return dAtoi(mBuffer + mStart);
    }
 
    /// Get a float representation of the top of the stack.
    inline F64 getFloatValue()
    {
+      if(mValuePending)
+         return mValue.getFloatValue();
+
       return dAtof(mBuffer + mStart);
    }
 
@@ -175,6 +216,7 @@ struct StringStack
    /// @note This returns a pointer to the actual top of the stack, be careful!
    inline const char *getStringValue()
    {
+      formatValue();
       return mBuffer + mStart;
    }
 
@@ -184,6 +226,8 @@ struct StringStack
    ///       properly push the stack.
    void advance()
    {
+      formatValue();
+      mStartValues[mStartStackSize].setStringValue(NULL);
       mStartOffsets[mStartStackSize++] = mStart;
       mStart += mLen;
       mLen = 0;
@@ -196,6 +240,8 @@ struct StringStack
    ///       properly push the stack.
    void advanceChar(char c)
    {
+      formatValue();
+      mStartValues[mStartStackSize].setStringValue(NULL);
       mStartOffsets[mStartStackSize++] = mStart;
       mStart += mLen;
       mBuffer[mStart] = c;
@@ -205,19 +251,38 @@ struct StringStack
    }
 
    /// Push the stack, placing a zero-length string on the top.
+   ///
+   /// A pending typed value is pushed without being formatted.
    void push()
    {
-      advanceChar(0);
+      if(!mValuePending)
+      {
+         advanceChar(0);
+         return;
+      }
+
+      // Reserve space to format the value if it's required as a string.
+      mValuePending = false;
+      mStartValues[mStartStackSize] = mValue;
+      mStartOffsets[mStartStackSize++] = mStart;
+      mBuffer[mStart] = 0;
+      mStart += ConsoleValue::FormatBufferSize;
+      mBuffer[mStart] = 0;
+      mLen = 0;
    }
 
    inline void setLen(U32 newlen)
    {
+      mValuePending = false;
       mLen = newlen;
    }
 
    /// Pop the start stack.
+   ///
+   /// A pending typed value is formatted first so it is concatenated.
    void rewind()
    {
+      formatValue();
       mStart = mStartOffsets[--mStartStackSize];
       mLen = dStrlen(mBuffer + mStart);
    }
@@ -225,6 +290,7 @@ struct StringStack
    // Terminate the current string, and pop the start stack.
    void rewindTerminate()
    {
+      formatValue();
       mBuffer[mStart] = 0;
       mStart = mStartOffsets[--mStartStackSize];
       mLen   = dStrlen(mBuffer + mStart);
@@ -234,6 +300,8 @@ struct StringStack
    /// and returning true if they matched, false if they didn't.
    U32 compare()
    {
+      formatValue();
+
       // Figure out the 1st and 2nd item offsets.
       U32 oldStart = mStart;
       mStart = mStartOffsets[--mStartStackSize];
@@ -251,6 +319,7 @@ struct StringStack
    
    void pushFrame()
    {
+      formatValue();
       mFrameOffsets[mNumFrames++] = mStartStackSize;
       mStartOffsets[mStartStackSize++] = mStart;
       mStart += ReturnBufferSpace;
@@ -259,6 +328,7 @@ struct StringStack
 
    void popFrame()
    {
+      mValuePending = false;
       mStartStackSize = mFrameOffsets[--mNumFrames];
       mStart = mStartOffsets[mStartStackSize];
       mLen = 0;
@@ -266,6 +336,15 @@ struct StringStack
 
    /// Get the arguments for a function call from the stack.
    void getArgcArgv(StringTableEntry name, U32 *argc, const char ***in_argv, bool popStackFrame = false);
+
+   /// Get the arguments for a function call from the stack as typed values.
+   ///
+   /// @note Typed arguments are not formatted so the argument strings must not be
+   ///       used until formatArgs() has been called.
+   void getArgcArgvValues(StringTableEntry name, U32 *argc, const char ***in_argv, ConsoleValue **in_values);
+
+   /// Format any typed arguments for the current function call.
+   void formatArgs();
 };
 
 #endif
@@ -36,6 +36,12 @@ namespace StringUnit
    }
 
    const char* getUnit(const char* string, U32 index, const char* set)
+   {
+      return getUnit(string, index, set, _returnBuffer, sizeof(_returnBuffer));
+   }
+
+   // Thread-safe variant returning the unit in the specified buffer.
+   const char* getUnit(const char* string, U32 index, const char* set, char* buffer, U32 bufferSize)
    {
       U32 sz;
       while(index--)
@@ -51,9 +57,9 @@ namespace StringUnit
       if (sz == 0)
          return "";
 
-      AssertFatal( sz + 1 < sizeof( _returnBuffer ), "Size of returned string too large for return buffer" );
+      AssertFatal( sz + 1 < bufferSize, "Size of returned string too large for return buffer" );
 
-      char *ret = &_returnBuffer[0];
+      char *ret = buffer;
       dStrncpy(ret, string, sz);
       ret[sz] = '\0';
       return ret;
@@ -29,6 +29,7 @@ namespace StringUnit
 {
     StringTableEntry getStringTableUnit(const char* string, U32 index, const char* set);
     const char* getUnit(const char* string, U32 index, const char* set);
+    const char* getUnit(const char* string, U32 index, const char* set, char* buffer, U32 bufferSize);
     const char* getUnits(const char* string, S32 startIndex, S32 endIndex, const char* set);
     U32 getUnitCount(const char* string, const char* set);
     const char* setUnit(const char* string, U32 index, const char *replace, const char* set);
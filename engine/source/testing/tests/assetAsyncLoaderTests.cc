@@ -0,0 +1,141 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _ASSET_ASYNC_LOADER_H_
+#include "assets/assetAsyncLoader.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define ASSETASYNCLOADER_UNITTEST_FILE          "_unitTestAsyncLoader_RemoveMe.png"
+#define ASSETASYNCLOADER_UNITTEST_WIDTH         64
+#define ASSETASYNCLOADER_UNITTEST_HEIGHT        48
+#define ASSETASYNCLOADER_UNITTEST_REQUESTS      16
+#define ASSETASYNCLOADER_UNITTEST_TIMEOUT       10000
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetAsyncLoaderTests, CanPrefetchFileTest )
+{
+    // Check.
+    ASSERT_TRUE( AssetAsyncLoader::canPrefetchFile( StringTable->insert( "images/background.jpg" ) ) ) << "JPEG images should be prefetched.";
+    ASSERT_FALSE( AssetAsyncLoader::canPrefetchFile( StringTable->insert( "audio/music.ogg" ) ) ) << "Audio files should not be prefetched.";
+    ASSERT_FALSE( AssetAsyncLoader::canPrefetchFile( StringTable->insert( "images/noExtension" ) ) ) << "Files without an extension should not be prefetched.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetAsyncLoaderTests, PrefetchBitmapTest )
+{
+    // Create a bitmap with a known pattern.
+    GBitmap sourceBitmap( ASSETASYNCLOADER_UNITTEST_WIDTH, ASSETASYNCLOADER_UNITTEST_HEIGHT, false, GBitmap::RGBA );
+    for ( U32 y = 0; y < ASSETASYNCLOADER_UNITTEST_HEIGHT; ++y )
+    {
+        for ( U32 x = 0; x < ASSETASYNCLOADER_UNITTEST_WIDTH; ++x )
+        {
+            U8* pPixel = sourceBitmap.getAddress( x, y );
+            pPixel[0] = (U8)x;
+            pPixel[1] = (U8)y;
+            pPixel[2] = (U8)(x ^ y);
+            pPixel[3] = 255;
+        }
+    }
+
+    // Write the bitmap.
+    FileStream writeStream;
+    ASSERT_TRUE( writeStream.open( ASSETASYNCLOADER_UNITTEST_FILE, FileStream::Write ) ) << "Failed to open the bitmap file for write.";
+    ASSERT_TRUE( sourceBitmap.writePNG( writeStream ) ) << "Failed to write the bitmap.";
+    writeStream.close();
+
+    StringTableEntry bitmapFile = StringTable->insert( ASSETASYNCLOADER_UNITTEST_FILE );
+
+    // Check.
+    ASSERT_TRUE( AssetAsyncLoader::canPrefetchFile( bitmapFile ) ) << "PNG images should be prefetched.";
+
+    // Queue the requests.
+    AssetAsyncLoader asyncLoader;
+    asyncLoader.start( 2 );
+    AssetAsyncRequest requests[ASSETASYNCLOADER_UNITTEST_REQUESTS];
+    for ( U32 n = 0; n < ASSETASYNCLOADER_UNITTEST_REQUESTS; ++n )
+    {
+        requests[n].mRequestId = n + 1;
+        requests[n].mPrefetchFiles.push_back( bitmapFile );
+        requests[n].mPrefetchBitmaps.push_back( NULL );
+        asyncLoader.queueRequest( &requests[n] );
+    }
+
+    // Wait for the requests to be prefetched.
+    const U32 startTime = Platform::getRealMilliseconds();
+    U32 prefetchedCount = 0;
+    while( prefetchedCount < ASSETASYNCLOADER_UNITTEST_REQUESTS && Platform::getRealMilliseconds() - startTime < ASSETASYNCLOADER_UNITTEST_TIMEOUT )
+    {
+        prefetchedCount = 0;
+        for ( U32 n = 0; n < ASSETASYNCLOADER_UNITTEST_REQUESTS; ++n )
+        {
+            if ( asyncLoader.getRequestState( &requests[n] ) == AssetAsyncRequest::Prefetched )
+                prefetchedCount++;
+        }
+
+        Platform::sleep( 1 );
+    }
+
+    asyncLoader.stop();
+
+    // Check the decoded bitmaps.
+    U32 matchedCount = 0;
+    for ( U32 n = 0; n < ASSETASYNCLOADER_UNITTEST_REQUESTS; ++n )
+    {
+        GBitmap* pBitmap = requests[n].mPrefetchBitmaps[0];
+        if ( pBitmap != NULL &&
+            pBitmap->getWidth() == ASSETASYNCLOADER_UNITTEST_WIDTH &&
+            pBitmap->getHeight() == ASSETASYNCLOADER_UNITTEST_HEIGHT &&
+            dMemcmp( pBitmap->getBits(), sourceBitmap.getBits(), ASSETASYNCLOADER_UNITTEST_WIDTH * ASSETASYNCLOADER_UNITTEST_HEIGHT * 4 ) == 0 )
+        {
+            matchedCount++;
+        }
+
+        delete pBitmap;
+    }
+
+    Platform::fileDelete( ASSETASYNCLOADER_UNITTEST_FILE );
+
+    // Check.
+    ASSERT_EQ( (U32)ASSETASYNCLOADER_UNITTEST_REQUESTS, prefetchedCount ) << "Not all requests were prefetched.";
+    ASSERT_EQ( (U32)ASSETASYNCLOADER_UNITTEST_REQUESTS, matchedCount ) << "Not all prefetched bitmaps matched the source bitmap.";
+}
+
+#endif // TORQUE_SHIPPING
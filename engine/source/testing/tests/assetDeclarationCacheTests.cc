@@ -0,0 +1,117 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _ASSET_DECLARATION_CACHE_H_
+#include "assets/assetDeclarationCache.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define ASSETDECLARATIONCACHE_UNITTEST_FILE     "_unitTestAssetDeclarationCache_RemoveMe.cache"
+
+//-----------------------------------------------------------------------------
+
+static FileTime assetDeclarationCacheTestFileTime( const U32 value )
+{
+    // NOTE:- File times are not scalar on all platforms.
+    FileTime fileTime;
+    dMemset( &fileTime, 0, sizeof(fileTime) );
+    dMemcpy( &fileTime, &value, sizeof(value) );
+    return fileTime;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetDeclarationCacheTests, SaveLoadTest )
+{
+    // Create a declaration.
+    AssetDeclaration declaration;
+    declaration.mAssetFile = StringTable->insert( "modules/Test/1/assets/images/test.asset.taml" );
+    declaration.mFileSize = 1234;
+    declaration.mModifyTime = assetDeclarationCacheTestFileTime( 5678 );
+    declaration.mAssetType = StringTable->insert( "ImageAsset" );
+    declaration.mAssetName = StringTable->insert( "test" );
+    declaration.mAssetDescription = StringTable->insert( "A test asset." );
+    declaration.mAssetCategory = StringTable->insert( "tests" );
+    declaration.mAssetAutoUnload = false;
+    declaration.mAssetInternal = true;
+    declaration.mAssetDependencies.push_back( StringTable->insert( "Test:dependency" ) );
+    declaration.mAssetLooseFiles.push_back( StringTable->insert( "modules/Test/1/assets/images/test.png" ) );
+
+    // Store and save the declaration.
+    AssetDeclarationCache saveCache;
+    saveCache.storeDeclaration( declaration );
+    ASSERT_TRUE( saveCache.isDirty() ) << "Cache should be dirty after storing a declaration.";
+    ASSERT_TRUE( saveCache.save( ASSETDECLARATIONCACHE_UNITTEST_FILE ) ) << "Failed to save the cache.";
+    ASSERT_FALSE( saveCache.isDirty() ) << "Cache should not be dirty after saving.";
+
+    // Load the declaration.
+    AssetDeclarationCache loadCache;
+    const bool loaded = loadCache.load( ASSETDECLARATIONCACHE_UNITTEST_FILE );
+    Platform::fileDelete( ASSETDECLARATIONCACHE_UNITTEST_FILE );
+    ASSERT_TRUE( loaded ) << "Failed to load the cache.";
+    ASSERT_EQ( 1, loadCache.getDeclarationCount() ) << "Unexpected declaration count.";
+
+    // Check the declaration round-tripped.
+    const AssetDeclaration* pDeclaration = loadCache.findDeclaration( declaration.mAssetFile, declaration.mFileSize, declaration.mModifyTime );
+    ASSERT_TRUE( pDeclaration != NULL ) << "Failed to find the declaration.";
+    EXPECT_EQ( declaration.mAssetType, pDeclaration->mAssetType );
+    EXPECT_EQ( declaration.mAssetName, pDeclaration->mAssetName );
+    EXPECT_EQ( declaration.mAssetDescription, pDeclaration->mAssetDescription );
+    EXPECT_EQ( declaration.mAssetCategory, pDeclaration->mAssetCategory );
+    EXPECT_EQ( declaration.mAssetAutoUnload, pDeclaration->mAssetAutoUnload );
+    EXPECT_EQ( declaration.mAssetInternal, pDeclaration->mAssetInternal );
+    ASSERT_EQ( 1, pDeclaration->mAssetDependencies.size() );
+    EXPECT_EQ( declaration.mAssetDependencies[0], pDeclaration->mAssetDependencies[0] );
+    ASSERT_EQ( 1, pDeclaration->mAssetLooseFiles.size() );
+    EXPECT_EQ( declaration.mAssetLooseFiles[0], pDeclaration->mAssetLooseFiles[0] );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( AssetDeclarationCacheTests, StaleDeclarationTest )
+{
+    // Store a declaration.
+    AssetDeclaration declaration;
+    declaration.mAssetFile = StringTable->insert( "modules/Test/1/assets/images/stale.asset.taml" );
+    declaration.mFileSize = 100;
+    declaration.mModifyTime = assetDeclarationCacheTestFileTime( 200 );
+    declaration.mAssetName = StringTable->insert( "stale" );
+
+    AssetDeclarationCache cache;
+    cache.storeDeclaration( declaration );
+
+    // Check only an unchanged file uses the declaration.
+    EXPECT_TRUE( cache.findDeclaration( declaration.mAssetFile, 100, assetDeclarationCacheTestFileTime( 200 ) ) != NULL ) << "Unchanged file should be cached.";
+    EXPECT_TRUE( cache.findDeclaration( declaration.mAssetFile, 101, assetDeclarationCacheTestFileTime( 200 ) ) == NULL ) << "Resized file should not be cached.";
+    EXPECT_TRUE( cache.findDeclaration( declaration.mAssetFile, 100, assetDeclarationCacheTestFileTime( 201 ) ) == NULL ) << "Modified file should not be cached.";
+    EXPECT_TRUE( cache.findDeclaration( StringTable->insert( "modules/Test/1/assets/images/missing.asset.taml" ), 100, assetDeclarationCacheTestFileTime( 200 ) ) == NULL ) << "Unknown file should not be cached.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,186 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _BATCH_RENDER_H_
+#include "2d/core/BatchRender.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Quads submitted per pass (kept below the buffer size so passes never render).
+#define BATCHRENDER_UNITTEST_QUADS      (BATCHRENDER_MAXTRIANGLES/2 - 1)
+#define BATCHRENDER_UNITTEST_PASSES     4
+
+//-----------------------------------------------------------------------------
+
+static const BatchRender::VertexFormat batchRenderTestFormats[] =
+{
+    BatchRender::VERTEX_FORMAT_FLOAT,
+    BatchRender::VERTEX_FORMAT_PACKED_COLOR,
+    BatchRender::VERTEX_FORMAT_PACKED,
+};
+
+// Expected vertex strides of the formats above.
+static const U32 batchRenderTestStrides[] = { 32, 20, 16 };
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchRenderTests, SubmitQuadTest )
+{
+    DebugStats debugStats;
+    debugStats.reset();
+    TextureHandle texture;
+    const ColorF color( 1.0f, 0.5f, 0.25f, 1.0f );
+
+    for( U32 formatIndex = 0; formatIndex < sizeof(batchRenderTestFormats) / sizeof(BatchRender::VertexFormat); ++formatIndex )
+    {
+        // Create a batch renderer with the vertex format.
+        BatchRender* pBatchRender = new BatchRender();
+        pBatchRender->setDebugStats( &debugStats );
+        pBatchRender->setVertexFormat( batchRenderTestFormats[formatIndex] );
+
+        // Check.
+        ASSERT_EQ( batchRenderTestFormats[formatIndex], pBatchRender->getVertexFormat() ) << "Vertex format was not set.";
+        ASSERT_EQ( batchRenderTestStrides[formatIndex], pBatchRender->getVertexStride() ) << "Unexpected vertex stride.";
+
+        debugStats.batchTrianglesSubmitted = 0;
+
+        for( U32 pass = 0; pass < BATCHRENDER_UNITTEST_PASSES; ++pass )
+        {
+            for( U32 quad = 0; quad < BATCHRENDER_UNITTEST_QUADS; ++quad )
+            {
+                const F32 x = (F32)(quad % 128);
+                const F32 y = (F32)(quad / 128);
+                pBatchRender->SubmitQuad(
+                    Vector2( x, y ), Vector2( x + 1.0f, y ), Vector2( x + 1.0f, y + 1.0f ), Vector2( x, y + 1.0f ),
+                    Vector2( 0.0f, 0.0f ), Vector2( 1.0f, 0.0f ), Vector2( 1.0f, 1.0f ), Vector2( 0.0f, 1.0f ),
+                    texture,
+                    color );
+            }
+
+            // Discard the batch so nothing is rendered.
+            pBatchRender->discard();
+        }
+
+        // Check.
+        ASSERT_EQ( (U32)(BATCHRENDER_UNITTEST_PASSES * BATCHRENDER_UNITTEST_QUADS * 2), debugStats.batchTrianglesSubmitted ) << "Unexpected triangle count.";
+
+        delete pBatchRender;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchRenderTests, SubmitTrianglesTest )
+{
+    DebugStats debugStats;
+    debugStats.reset();
+    TextureHandle texture;
+    const ColorF color( 1.0f, 0.5f, 0.25f, 1.0f );
+
+    // Two triangles per submission.
+    const Vector2 vertexArray[6] = { Vector2(0.0f, 0.0f), Vector2(1.0f, 0.0f), Vector2(0.0f, 1.0f), Vector2(1.0f, 0.0f), Vector2(1.0f, 1.0f), Vector2(0.0f, 1.0f) };
+    const Vector2 textureArray[6] = { Vector2(0.0f, 0.0f), Vector2(1.0f, 0.0f), Vector2(0.0f, 1.0f), Vector2(1.0f, 0.0f), Vector2(1.0f, 1.0f), Vector2(0.0f, 1.0f) };
+
+    for( U32 formatIndex = 0; formatIndex < sizeof(batchRenderTestFormats) / sizeof(BatchRender::VertexFormat); ++formatIndex )
+    {
+        // Create a batch renderer with the vertex format.
+        BatchRender* pBatchRender = new BatchRender();
+        pBatchRender->setDebugStats( &debugStats );
+        pBatchRender->setVertexFormat( batchRenderTestFormats[formatIndex] );
+
+        debugStats.batchTrianglesSubmitted = 0;
+
+        for( U32 pass = 0; pass < BATCHRENDER_UNITTEST_PASSES; ++pass )
+        {
+            for( U32 submit = 0; submit < BATCHRENDER_UNITTEST_QUADS; ++submit )
+            {
+                pBatchRender->SubmitTriangles( 6, vertexArray, textureArray, texture, color );
+            }
+
+            // Discard the batch so nothing is rendered.
+            pBatchRender->discard();
+        }
+
+        // Check.
+        ASSERT_EQ( (U32)(BATCHRENDER_UNITTEST_PASSES * BATCHRENDER_UNITTEST_QUADS * 2), debugStats.batchTrianglesSubmitted ) << "Unexpected triangle count.";
+
+        delete pBatchRender;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( BatchRenderTests, PackedTexCoordRangeTest )
+{
+    DebugStats debugStats;
+    debugStats.reset();
+    TextureHandle texture;
+    const ColorF color( 1.0f, 0.5f, 0.25f, 1.0f );
+
+    // Create a batch renderer packing the texture coordinates.
+    BatchRender* pBatchRender = new BatchRender();
+    pBatchRender->setDebugStats( &debugStats );
+    pBatchRender->setVertexFormat( BatchRender::VERTEX_FORMAT_PACKED );
+
+    for( U32 pass = 0; pass < BATCHRENDER_UNITTEST_PASSES; ++pass )
+    {
+        // Start with a tiled quad on odd passes.
+        const F32 tileCount = (pass & 1) ? 2.0f : 1.0f;
+
+        for( U32 quad = 0; quad < BATCHRENDER_UNITTEST_QUADS; ++quad )
+        {
+            const F32 x = (F32)(quad % 128);
+            const F32 y = (F32)(quad / 128);
+            const F32 tile = quad == 0 ? tileCount : 1.0f;
+            pBatchRender->SubmitQuad(
+                Vector2( x, y ), Vector2( x + 1.0f, y ), Vector2( x + 1.0f, y + 1.0f ), Vector2( x, y + 1.0f ),
+                Vector2( 0.0f, 0.0f ), Vector2( tile, 0.0f ), Vector2( tile, tile ), Vector2( 0.0f, tile ),
+                texture,
+                color );
+        }
+
+        // Check.
+        // NOTE: The whole batch must stay unpacked once a tiled quad is in it.
+        const BatchRender::VertexFormat batchFormat = (pass & 1) ? BatchRender::VERTEX_FORMAT_PACKED_COLOR : BatchRender::VERTEX_FORMAT_PACKED;
+        ASSERT_EQ( batchFormat, pBatchRender->getBatchVertexFormat() ) << "Unexpected batch vertex format.";
+        ASSERT_EQ( BatchRender::VERTEX_FORMAT_PACKED, pBatchRender->getVertexFormat() ) << "Vertex format should not change.";
+
+        // Discard the batch so nothing is rendered.
+        pBatchRender->discard();
+    }
+
+    // Check.
+    ASSERT_EQ( (U32)0, debugStats.batchTexCoordRangeFlush ) << "Empty batches should not flush.";
+    ASSERT_EQ( (U32)(BATCHRENDER_UNITTEST_PASSES * BATCHRENDER_UNITTEST_QUADS * 2), debugStats.batchTrianglesSubmitted ) << "Unexpected triangle count.";
+
+    delete pBatchRender;
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,418 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+#ifndef _MMATHFN_H_
+#include "math/mMathFn.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+#ifndef BOX2D_H
+#include "Box2D/Box2D.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define BOX2DPARALLEL_UNITTEST_PILES            200
+#define BOX2DPARALLEL_UNITTEST_PILE_HEIGHT      6
+#define BOX2DPARALLEL_UNITTEST_CHAIN_LINKS      4
+#define BOX2DPARALLEL_UNITTEST_STEPS            180
+#define BOX2DPARALLEL_UNITTEST_RAIN_BODIES      1000
+
+//-----------------------------------------------------------------------------
+
+/// Runs tasks on the calling thread in reverse batch order whilst pretending to be several threads.
+class Box2DSequentialTestExecutor : public b2ParallelExecutor
+{
+public:
+    virtual int32 GetThreadCount() const { return 4; }
+
+    virtual void ParallelFor( b2ParallelTask task, void* context, int32 count, int32 batchSize )
+    {
+        const int32 batchCount = (count + batchSize - 1) / batchSize;
+        for ( int32 batch = batchCount - 1; batch >= 0; --batch )
+        {
+            const int32 startIndex = batch * batchSize;
+            task( context, startIndex, getMin( startIndex + batchSize, count ), batch % GetThreadCount() );
+        }
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+/// Runs tasks on the thread pool.
+class Box2DThreadPoolTestExecutor : public b2ParallelExecutor
+{
+    struct PhysicsJob
+    {
+        b2ParallelTask  mpTask;
+        void*           mpContext;
+    };
+
+    static void physicsJob( void* pContext, const U32 startIndex, const U32 endIndex, const U32 threadIndex )
+    {
+        PhysicsJob* pPhysicsJob = static_cast<PhysicsJob*>( pContext );
+        pPhysicsJob->mpTask( pPhysicsJob->mpContext, (int32)startIndex, (int32)endIndex, (int32)threadIndex );
+    }
+
+public:
+    virtual int32 GetThreadCount() const { return (int32)ThreadPool::Instance->getConcurrency(); }
+
+    virtual void ParallelFor( b2ParallelTask task, void* context, int32 count, int32 batchSize )
+    {
+        PhysicsJob job;
+        job.mpTask = task;
+        job.mpContext = context;
+        ThreadPool::Instance->parallelFor( &Box2DThreadPoolTestExecutor::physicsJob, &job, (U32)count, (U32)batchSize );
+    }
+};
+
+//-----------------------------------------------------------------------------
+
+/// Records the reported contact events and impulses in order.
+class Box2DImpulseTestListener : public b2ContactListener
+{
+public:
+    virtual void BeginContact( b2Contact* contact )
+    {
+        mEvents.push_back( 1 );
+        recordBodies( contact );
+    }
+
+    virtual void EndContact( b2Contact* contact )
+    {
+        mEvents.push_back( 2 );
+        recordBodies( contact );
+    }
+
+    virtual void PostSolve( b2Contact* contact, const b2ContactImpulse* impulse )
+    {
+        for ( int32 index = 0; index < impulse->count; ++index )
+        {
+            mImpulses.push_back( impulse->normalImpulses[index] );
+            mImpulses.push_back( impulse->tangentImpulses[index] );
+        }
+    }
+
+    void recordBodies( b2Contact* contact )
+    {
+        // Bodies are identified by the index stored in their user data.
+        mEvents.push_back( (U32)(uintptr_t)contact->GetFixtureA()->GetBody()->GetUserData() );
+        mEvents.push_back( (U32)(uintptr_t)contact->GetFixtureB()->GetBody()->GetUserData() );
+    }
+
+    Vector<U32> mEvents;
+    Vector<F32> mImpulses;
+};
+
+//-----------------------------------------------------------------------------
+
+static void createBox2DParallelTestWorld( b2World& world, const U32 pileCount )
+{
+    // Create a ground shared by all the piles.
+    b2BodyDef groundDef;
+    b2Body* pGround = world.CreateBody( &groundDef );
+    b2PolygonShape groundShape;
+    groundShape.SetAsBox( pileCount * 2.0f + 10.0f, 1.0f );
+    pGround->CreateFixture( &groundShape, 0.0f );
+
+    b2PolygonShape boxShape;
+    boxShape.SetAsBox( 0.5f, 0.5f );
+
+    for ( U32 pile = 0; pile < pileCount; ++pile )
+    {
+        const F32 pileX = pile * 4.0f - pileCount * 2.0f;
+
+        // Create a pile of boxes resting on the ground.
+        for ( U32 height = 0; height < BOX2DPARALLEL_UNITTEST_PILE_HEIGHT; ++height )
+        {
+            b2BodyDef boxDef;
+            boxDef.type = b2_dynamicBody;
+            boxDef.position.Set( pileX + (height % 2) * 0.1f, 1.5f + height * 1.05f );
+            boxDef.angle = height * 0.05f;
+            world.CreateBody( &boxDef )->CreateFixture( &boxShape, 1.0f );
+        }
+
+        // Create a chain hanging from its own static anchor every few piles.
+        if ( pile % 8 != 0 )
+            continue;
+
+        b2BodyDef anchorDef;
+        anchorDef.position.Set( pileX + 2.0f, 20.0f );
+        b2Body* pPrevious = world.CreateBody( &anchorDef );
+
+        for ( U32 link = 0; link < BOX2DPARALLEL_UNITTEST_CHAIN_LINKS; ++link )
+        {
+            b2BodyDef linkDef;
+            linkDef.type = b2_dynamicBody;
+            linkDef.position.Set( pileX + 2.5f + link, 20.0f );
+            b2Body* pLink = world.CreateBody( &linkDef );
+            pLink->CreateFixture( &boxShape, 1.0f );
+
+            b2RevoluteJointDef jointDef;
+            jointDef.Initialize( pPrevious, pLink, b2Vec2( pileX + 2.0f + link, 20.0f ) );
+            world.CreateJoint( &jointDef );
+            pPrevious = pLink;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+static void createBox2DParallelRainTestWorld( b2World& world, const U32 bodyCount )
+{
+    // Create a bin with a sensor near its floor.
+    b2BodyDef binDef;
+    b2Body* pBin = world.CreateBody( &binDef );
+    b2PolygonShape wallShape;
+    wallShape.SetAsBox( 40.0f, 1.0f );
+    pBin->CreateFixture( &wallShape, 0.0f );
+    wallShape.SetAsBox( 1.0f, 60.0f, b2Vec2( -40.0f, 60.0f ), 0.0f );
+    pBin->CreateFixture( &wallShape, 0.0f );
+    wallShape.SetAsBox( 1.0f, 60.0f, b2Vec2( 40.0f, 60.0f ), 0.0f );
+    pBin->CreateFixture( &wallShape, 0.0f );
+
+    b2PolygonShape sensorShape;
+    sensorShape.SetAsBox( 10.0f, 5.0f, b2Vec2( 0.0f, 10.0f ), 0.0f );
+    b2FixtureDef sensorDef;
+    sensorDef.shape = &sensorShape;
+    sensorDef.isSensor = true;
+    pBin->CreateFixture( &sensorDef );
+
+    b2PolygonShape boxShape;
+    boxShape.SetAsBox( 0.3f, 0.3f );
+    b2CircleShape circleShape;
+    circleShape.m_radius = 0.3f;
+
+    // Drop a mixture of boxes and circles from scattered positions.
+    U32 seed = 1;
+    for ( U32 index = 0; index < bodyCount; ++index )
+    {
+        b2BodyDef bodyDef;
+        bodyDef.type = b2_dynamicBody;
+        seed = seed * 1103515245 + 12345;
+        bodyDef.position.x = ((seed >> 8) % 7800) * 0.01f - 39.0f;
+        seed = seed * 1103515245 + 12345;
+        bodyDef.position.y = ((seed >> 8) % 20000) * 0.01f + 5.0f;
+        bodyDef.bullet = (index % 97) == 0;
+        world.CreateBody( &bodyDef )->CreateFixture( index % 2 ? (b2Shape*)&boxShape : (b2Shape*)&circleShape, 1.0f );
+    }
+
+    // Identify the bodies for the contact events.
+    uintptr_t bodyIndex = 0;
+    for ( b2Body* pBody = world.GetBodyList(); pBody != NULL; pBody = pBody->GetNext() )
+        pBody->SetUserData( (void*)++bodyIndex );
+}
+
+//-----------------------------------------------------------------------------
+
+static void createBox2DParallelSleepTestWorld( b2World& world, b2Body** ppGround, b2Body** ppSleeper, b2Body** ppInsomniac )
+{
+    // Create a ground shared by both boxes.
+    b2BodyDef groundDef;
+    *ppGround = world.CreateBody( &groundDef );
+    b2PolygonShape groundShape;
+    groundShape.SetAsBox( 20.0f, 1.0f );
+    (*ppGround)->CreateFixture( &groundShape, 0.0f );
+
+    b2PolygonShape boxShape;
+    boxShape.SetAsBox( 0.5f, 0.5f );
+
+    // Create a box that is never allowed to sleep.
+    b2BodyDef insomniacDef;
+    insomniacDef.type = b2_dynamicBody;
+    insomniacDef.position.Set( 10.0f, 1.5f );
+    insomniacDef.allowSleep = false;
+    *ppInsomniac = world.CreateBody( &insomniacDef );
+    (*ppInsomniac)->CreateFixture( &boxShape, 1.0f );
+
+    // Create a box that goes to sleep once it settles.
+    b2BodyDef sleeperDef;
+    sleeperDef.type = b2_dynamicBody;
+    sleeperDef.position.Set( -10.0f, 1.5f );
+    *ppSleeper = world.CreateBody( &sleeperDef );
+    (*ppSleeper)->CreateFixture( &boxShape, 1.0f );
+}
+
+//-----------------------------------------------------------------------------
+
+static bool compareBox2DParallelTestWorlds( const b2World& worldA, const b2World& worldB )
+{
+    const b2Body* pBodyB = worldB.GetBodyList();
+    for ( const b2Body* pBodyA = worldA.GetBodyList(); pBodyA != NULL; pBodyA = pBodyA->GetNext(), pBodyB = pBodyB->GetNext() )
+    {
+        if ( pBodyB == NULL )
+            return false;
+
+        // Compare bitwise.
+        if ( dMemcmp( &pBodyA->GetTransform(), &pBodyB->GetTransform(), sizeof(b2Transform) ) != 0 ||
+             dMemcmp( &pBodyA->GetLinearVelocity(), &pBodyB->GetLinearVelocity(), sizeof(b2Vec2) ) != 0 ||
+             pBodyA->GetAngularVelocity() != pBodyB->GetAngularVelocity() ||
+             pBodyA->IsAwake() != pBodyB->IsAwake() )
+            return false;
+    }
+
+    return pBodyB == NULL;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( Box2DParallelSolveTests, DeterminismTest )
+{
+    const b2Vec2 gravity( 0.0f, -10.0f );
+    b2World serialWorld( gravity );
+    b2World parallelWorld( gravity );
+    Box2DImpulseTestListener serialListener;
+    Box2DImpulseTestListener parallelListener;
+    Box2DSequentialTestExecutor executor;
+
+    createBox2DParallelTestWorld( serialWorld, BOX2DPARALLEL_UNITTEST_PILES / 10 );
+    createBox2DParallelTestWorld( parallelWorld, BOX2DPARALLEL_UNITTEST_PILES / 10 );
+    serialWorld.SetContactListener( &serialListener );
+    parallelWorld.SetContactListener( &parallelListener );
+    parallelWorld.SetParallelExecutor( &executor );
+
+    // Step until the piles have settled and gone to sleep.
+    for ( U32 step = 0; step < BOX2DPARALLEL_UNITTEST_STEPS * 4; ++step )
+    {
+        serialWorld.Step( 1.0f / 60.0f, 8, 3 );
+        parallelWorld.Step( 1.0f / 60.0f, 8, 3 );
+
+        ASSERT_TRUE( compareBox2DParallelTestWorlds( serialWorld, parallelWorld ) ) << "Parallel island solve differs from the serial solve at step " << step << ".";
+    }
+
+    // Check the impulses were reported in the same order.
+    ASSERT_EQ( serialListener.mImpulses.size(), parallelListener.mImpulses.size() ) << "Unexpected reported impulse count.";
+    ASSERT_EQ( 0, dMemcmp( serialListener.mImpulses.address(), parallelListener.mImpulses.address(), serialListener.mImpulses.size() * sizeof(F32) ) ) << "Reported impulses differ.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( Box2DParallelSolveTests, SharedStaticSleepTest )
+{
+    const b2Vec2 gravity( 0.0f, -10.0f );
+    b2World serialWorld( gravity );
+    b2World parallelWorld( gravity );
+    Box2DSequentialTestExecutor executor;
+
+    b2Body* pSerialGround;
+    b2Body* pSerialSleeper;
+    b2Body* pSerialInsomniac;
+    b2Body* pParallelGround;
+    b2Body* pParallelSleeper;
+    b2Body* pParallelInsomniac;
+    createBox2DParallelSleepTestWorld( serialWorld, &pSerialGround, &pSerialSleeper, &pSerialInsomniac );
+    createBox2DParallelSleepTestWorld( parallelWorld, &pParallelGround, &pParallelSleeper, &pParallelInsomniac );
+    parallelWorld.SetParallelExecutor( &executor );
+
+    // Step until the sleeping island has gone to sleep and then some more.
+    for ( U32 step = 0; step < BOX2DPARALLEL_UNITTEST_STEPS * 2; ++step )
+    {
+        serialWorld.Step( 1.0f / 60.0f, 8, 3 );
+        parallelWorld.Step( 1.0f / 60.0f, 8, 3 );
+
+        ASSERT_EQ( pSerialGround->IsAwake(), pParallelGround->IsAwake() ) << "Shared static sleep state differs from the serial solve at step " << step << ".";
+        ASSERT_TRUE( compareBox2DParallelTestWorlds( serialWorld, parallelWorld ) ) << "Parallel island solve differs from the serial solve at step " << step << ".";
+    }
+
+    // Check the scenario was exercised.
+    ASSERT_FALSE( pSerialSleeper->IsAwake() ) << "Sleeping box did not go to sleep.";
+    ASSERT_TRUE( pSerialInsomniac->IsAwake() ) << "Awake box went to sleep.";
+    ASSERT_FALSE( pParallelSleeper->IsAwake() ) << "Sleeping box did not go to sleep in the parallel solve.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( Box2DParallelSolveTests, ContactDeterminismTest )
+{
+    const b2Vec2 gravity( 0.0f, -10.0f );
+    b2World serialWorld( gravity );
+    b2World parallelWorld( gravity );
+    Box2DImpulseTestListener serialListener;
+    Box2DImpulseTestListener parallelListener;
+    Box2DSequentialTestExecutor executor;
+
+    createBox2DParallelRainTestWorld( serialWorld, BOX2DPARALLEL_UNITTEST_RAIN_BODIES );
+    createBox2DParallelRainTestWorld( parallelWorld, BOX2DPARALLEL_UNITTEST_RAIN_BODIES );
+    serialWorld.SetContactListener( &serialListener );
+    parallelWorld.SetContactListener( &parallelListener );
+    parallelWorld.SetParallelExecutor( &executor );
+
+    for ( U32 step = 0; step < BOX2DPARALLEL_UNITTEST_STEPS * 2; ++step )
+    {
+        serialWorld.Step( 1.0f / 60.0f, 8, 3 );
+        parallelWorld.Step( 1.0f / 60.0f, 8, 3 );
+
+        ASSERT_TRUE( compareBox2DParallelTestWorlds( serialWorld, parallelWorld ) ) << "Parallel contact update differs from the serial update at step " << step << ".";
+        ASSERT_EQ( serialListener.mEvents.size(), parallelListener.mEvents.size() ) << "Unexpected contact event count at step " << step << ".";
+    }
+
+    // Check the contact events were reported in the same order.
+    ASSERT_EQ( serialWorld.GetContactCount(), parallelWorld.GetContactCount() ) << "Unexpected contact count.";
+    ASSERT_EQ( 0, dMemcmp( serialListener.mEvents.address(), parallelListener.mEvents.address(), serialListener.mEvents.size() * sizeof(U32) ) ) << "Contact events differ.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( Box2DParallelSolveTests, ThreadPoolTest )
+{
+    // Finish if no thread pool.
+    if ( ThreadPool::Instance == NULL )
+        return;
+
+    const b2Vec2 gravity( 0.0f, -10.0f );
+    b2World serialWorld( gravity );
+    b2World parallelWorld( gravity );
+    Box2DThreadPoolTestExecutor executor;
+
+    createBox2DParallelTestWorld( serialWorld, BOX2DPARALLEL_UNITTEST_PILES );
+    createBox2DParallelTestWorld( parallelWorld, BOX2DPARALLEL_UNITTEST_PILES );
+    serialWorld.SetAllowSleeping( false );
+    parallelWorld.SetAllowSleeping( false );
+    parallelWorld.SetParallelExecutor( &executor );
+
+    for ( U32 step = 0; step < BOX2DPARALLEL_UNITTEST_STEPS; ++step )
+    {
+        serialWorld.Step( 1.0f / 60.0f, 8, 3 );
+        parallelWorld.Step( 1.0f / 60.0f, 8, 3 );
+
+        ASSERT_TRUE( compareBox2DParallelTestWorlds( serialWorld, parallelWorld ) ) << "Thread pool solve differs from the serial solve at step " << step << ".";
+    }
+
+    // Check.
+    ASSERT_EQ( serialWorld.GetContactCount(), parallelWorld.GetContactCount() ) << "Unexpected contact count.";
+}
+
+#endif // TORQUE_SHIPPING
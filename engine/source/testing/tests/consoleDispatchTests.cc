@@ -0,0 +1,101 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define CONSOLEDISPATCH_UNITTEST_CALLS  "1000"
+
+//-----------------------------------------------------------------------------
+
+static const char* consoleDispatchTestScript =
+    "function consoleDispatchTestAdd( %value ) { return %value + 1; }\n"
+    "function ConsoleDispatchTestClass::add( %this, %value ) { return %value + 1; }\n"
+    "function ConsoleDispatchTestClass::getValue( %this ) { return 1; }\n"
+    "function ConsoleDispatchTestChild::getValue( %this ) { return Parent::getValue( %this ) + 1; }\n"
+    "function consoleDispatchTestFunctionLoop( %count ) { %value = 0; for( %i = 0; %i < %count; %i++ ) %value = consoleDispatchTestAdd( %value ); return %value; }\n"
+    "function consoleDispatchTestMethodLoop( %object, %count ) { %value = 0; for( %i = 0; %i < %count; %i++ ) %value = %object.add( %value ); return %value; }\n"
+    "function consoleDispatchTestParentLoop( %object, %count ) { %value = 0; for( %i = 0; %i < %count; %i++ ) %value += %object.getValue(); return %value; }\n"
+    "function consoleDispatchTestValue() { return 1; }\n"
+    "function consoleDispatchTestCall() { return consoleDispatchTestValue(); }\n"
+    "package ConsoleDispatchTestPackage { function consoleDispatchTestValue() { return 2; } };\n";
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleDispatchTests, CallLoopTest )
+{
+    Con::evaluate( consoleDispatchTestScript );
+    Con::evaluate( "$ConsoleDispatchTestObject = new ScriptObject() { class = \"ConsoleDispatchTestChild\"; superClass = \"ConsoleDispatchTestClass\"; };" );
+
+    const char* pObjectId = Con::getVariable( "$ConsoleDispatchTestObject" );
+    const S32 callCount = dAtoi( CONSOLEDISPATCH_UNITTEST_CALLS );
+
+    // Repeated calls from the same call sites.
+    ASSERT_EQ( callCount, dAtoi( Con::executef( 2, "consoleDispatchTestFunctionLoop", CONSOLEDISPATCH_UNITTEST_CALLS ) ) ) << "Unexpected function call result.";
+    ASSERT_EQ( callCount, dAtoi( Con::executef( 3, "consoleDispatchTestMethodLoop", pObjectId, CONSOLEDISPATCH_UNITTEST_CALLS ) ) ) << "Unexpected method call result.";
+    ASSERT_EQ( callCount * 2, dAtoi( Con::executef( 3, "consoleDispatchTestParentLoop", pObjectId, CONSOLEDISPATCH_UNITTEST_CALLS ) ) ) << "Unexpected parent call result.";
+
+    // Redefining a parent method must invalidate both the method and parent call sites.
+    Con::evaluate( "function ConsoleDispatchTestClass::getValue( %this ) { return 5; }" );
+    ASSERT_EQ( callCount * 6, dAtoi( Con::executef( 3, "consoleDispatchTestParentLoop", pObjectId, CONSOLEDISPATCH_UNITTEST_CALLS ) ) ) << "Method call sites were not invalidated by method redefinition.";
+
+    Con::evaluate( "$ConsoleDispatchTestObject.delete();" );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleDispatchTests, CacheInvalidationTest )
+{
+    Con::evaluate( consoleDispatchTestScript );
+
+    // Check.
+    ASSERT_EQ( 1, dAtoi( Con::executef( 1, "consoleDispatchTestCall" ) ) ) << "Unexpected result before package activation.";
+
+    // Activating a package must invalidate the call site.
+    Con::evaluate( "activatePackage( ConsoleDispatchTestPackage );" );
+    const S32 activatedResult = dAtoi( Con::executef( 1, "consoleDispatchTestCall" ) );
+
+    // Deactivating a package must invalidate the call site.
+    Con::evaluate( "deactivatePackage( ConsoleDispatchTestPackage );" );
+    const S32 deactivatedResult = dAtoi( Con::executef( 1, "consoleDispatchTestCall" ) );
+
+    // Redefining a function must invalidate the call site.
+    Con::evaluate( "function consoleDispatchTestValue() { return 3; }" );
+    const S32 redefinedResult = dAtoi( Con::executef( 1, "consoleDispatchTestCall" ) );
+
+    // Check.
+    ASSERT_EQ( 2, activatedResult ) << "Call site was not invalidated by package activation.";
+    ASSERT_EQ( 1, deactivatedResult ) << "Call site was not invalidated by package deactivation.";
+    ASSERT_EQ( 3, redefinedResult ) << "Call site was not invalidated by function redefinition.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,114 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _CONSOLE_H_
+#include "console/console.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+static const char* consoleValueTestScript =
+    "function consoleValueTestIdentity( %value ) { return %value; }\n"
+    "function consoleValueTestAdd( %a, %b ) { return %a + %b; }\n"
+    "function consoleValueTestConcat( %a, %b ) { return %a @ \"|\" @ %b; }\n"
+    "function consoleValueTestMathLoop( %count ) { %value = 0; for( %i = 0; %i < %count; %i++ ) %value += mFloor( mSqrt( %i ) ) + mGetMax( %i, 1 ); return %value; }\n"
+    "function consoleValueTestCallLoop( %count ) { %value = 0; for( %i = 0; %i < %count; %i++ ) %value = consoleValueTestAdd( %value, 1 ); return %value; }\n";
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleValueTests, ValueFormatTest )
+{
+    char buffer[ConsoleValue::FormatBufferSize];
+
+    // Integer values.
+    ConsoleValue value = ConsoleValue::makeInt( -42 );
+    value.format( buffer );
+    ASSERT_STREQ( "-42", buffer ) << "Unexpected integer format.";
+
+    // Float values must format as the string stack always has.
+    value = ConsoleValue::makeFloat( 0.25 );
+    value.format( buffer );
+    ASSERT_STREQ( "0.25", buffer ) << "Unexpected float format.";
+
+    // String values.
+    value = ConsoleValue::makeString( "12.5" );
+    ASSERT_TRUE( value.isString() ) << "Value should be a string.";
+    ASSERT_EQ( 12, value.getIntValue() ) << "Unexpected integer conversion.";
+    ASSERT_EQ( 12.5, value.getFloatValue() ) << "Unexpected float conversion.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleValueTests, TypedArgumentTest )
+{
+    Con::evaluate( consoleValueTestScript );
+
+    // Typed arguments must be seen identically by script functions.
+    ASSERT_STREQ( "7", Con::evaluate( "return consoleValueTestIdentity( 3 + 4 );" ) ) << "Unexpected integer argument.";
+    ASSERT_STREQ( "0.5", Con::evaluate( "return consoleValueTestIdentity( 1 / 2 );" ) ) << "Unexpected float argument.";
+    ASSERT_STREQ( "3|0.5", Con::evaluate( "return consoleValueTestConcat( 1 + 2, 1 / 2 );" ) ) << "Unexpected mixed arguments.";
+
+    // Typed arguments must be formatted for string callbacks.
+    ASSERT_STREQ( "5", Con::evaluate( "return getWord( \"0 1 2 3 4 5\", 2 + 3 );" ) ) << "Unexpected string callback argument.";
+
+    // Value callbacks.
+    ASSERT_STREQ( "3", Con::evaluate( "return mFloor( 7 / 2 );" ) ) << "Unexpected value callback result.";
+    ASSERT_STREQ( "2", Con::evaluate( "return mSqrt( \"4\" );" ) ) << "Unexpected value callback string argument.";
+    ASSERT_STREQ( "3.5", Con::evaluate( "return mGetMax( 1 + 1, 7 / 2 );" ) ) << "Unexpected value callback typed arguments.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleValueTests, TypedConcatTest )
+{
+    Con::evaluate( consoleValueTestScript );
+
+    // Typed values on the right-hand side must be formatted before being concatenated.
+    ASSERT_STREQ( "a3", Con::evaluate( "return \"a\" @ 1 + 2;" ) ) << "Unexpected integer concatenation.";
+    ASSERT_STREQ( "a0.5", Con::evaluate( "return \"a\" @ 1 / 2;" ) ) << "Unexpected float concatenation.";
+    ASSERT_STREQ( "a 3", Con::evaluate( "return \"a\" SPC 1 + 2;" ) ) << "Unexpected space concatenation.";
+    ASSERT_STREQ( "3 4", Con::evaluate( "%value = 3; return %value SPC %value + 1;" ) ) << "Unexpected variable concatenation.";
+    ASSERT_STREQ( "1|2|3", Con::evaluate( "return 1 @ \"|\" @ 1 + 1 @ \"|\" @ mFloor( 7 / 2 );" ) ) << "Unexpected chained concatenation.";
+    ASSERT_STREQ( "x7|0.5", Con::evaluate( "return consoleValueTestConcat( \"x\" @ 3 + 4, 1 / 2 );" ) ) << "Unexpected argument concatenation.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ConsoleValueTests, ScriptLoopTest )
+{
+    Con::evaluate( consoleValueTestScript );
+
+    // Math calls.
+    ASSERT_STREQ( "62", Con::executef( 2, "consoleValueTestMathLoop", "10" ) ) << "Unexpected math result.";
+
+    // Script calls.
+    ASSERT_STREQ( "1000", Con::executef( 2, "consoleValueTestCallLoop", "1000" ) ) << "Unexpected call result.";
+}
+
+#endif // TORQUE_SHIPPING
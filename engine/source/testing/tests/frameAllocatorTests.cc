@@ -0,0 +1,148 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _FRAMEALLOCATOR_H_
+#include "memory/frameAllocator.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREADPOOL_H_
+#include "platform/threads/threadPool.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define FRAMEALLOCATOR_UNITTEST_ITEMS           256
+#define FRAMEALLOCATOR_UNITTEST_ITEM_BYTES      1024
+
+//-----------------------------------------------------------------------------
+
+struct FrameAllocatorTestJob
+{
+    bool mValid[FRAMEALLOCATOR_UNITTEST_ITEMS];
+};
+
+//-----------------------------------------------------------------------------
+
+static void frameAllocatorTestJob( void* pContext, const U32 startIndex, const U32 endIndex, const U32 threadIndex )
+{
+    FrameAllocatorTestJob* pJob = static_cast<FrameAllocatorTestJob*>( pContext );
+
+    for ( U32 index = startIndex; index < endIndex; ++index )
+    {
+        FrameAllocatorMarker marker;
+
+        // Fill an allocation with a pattern unique to the item.
+        U8* pBuffer = (U8*)marker.alloc( FRAMEALLOCATOR_UNITTEST_ITEM_BYTES );
+        dMemset( pBuffer, index & 0xFF, FRAMEALLOCATOR_UNITTEST_ITEM_BYTES );
+
+        // Make some more allocations which other threads would overwrite if the arena was shared.
+        for ( U32 count = 0; count < 16; ++count )
+        {
+            FrameTemp<U32> scratch( 64 );
+            dMemset( ~scratch, 0xFF, sizeof(U32) * 64 );
+        }
+
+        // Check the pattern survived.
+        bool valid = true;
+        for ( U32 byteIndex = 0; byteIndex < FRAMEALLOCATOR_UNITTEST_ITEM_BYTES; ++byteIndex )
+            valid &= pBuffer[byteIndex] == (index & 0xFF);
+
+        pJob->mValid[index] = valid;
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( FrameAllocatorTests, MarkerTest )
+{
+    const U32 waterMark = FrameAllocator::getWaterMark();
+
+    // Allocate within a marker.
+    {
+        FrameAllocatorMarker marker;
+        void* pBuffer = marker.alloc( 100 );
+
+        // Check.
+        ASSERT_NE( (void*)0, pBuffer ) << "Memory not allocated.";
+        ASSERT_LE( waterMark + 100, FrameAllocator::getWaterMark() ) << "Water mark not advanced.";
+    }
+
+    // Check.
+    ASSERT_EQ( waterMark, FrameAllocator::getWaterMark() ) << "Water mark not restored by the marker.";
+}
+
+//-----------------------------------------------------------------------------
+
+#ifdef TORQUE_DEBUG
+TEST( FrameAllocatorTests, PoisonTest )
+{
+    const U32 waterMark = FrameAllocator::getWaterMark();
+
+    U8* pBuffer = (U8*)FrameAllocator::alloc( 64 );
+    dMemset( pBuffer, 0, 64 );
+    FrameAllocator::setWaterMark( waterMark );
+
+    // Check the released memory was poisoned.
+    for ( U32 index = 0; index < 64; ++index )
+    {
+        ASSERT_EQ( TORQUE_FRAMEALLOCATOR_POISON, pBuffer[index] ) << "Released memory was not poisoned.";
+    }
+}
+#endif
+
+//-----------------------------------------------------------------------------
+
+TEST( FrameAllocatorTests, ThreadArenaTest )
+{
+    // Finish if no thread pool.
+    if ( ThreadPool::Instance == NULL )
+        return;
+
+    FrameAllocatorTestJob job;
+    dMemset( &job, 0, sizeof(job) );
+
+    const U32 waterMark = FrameAllocator::getWaterMark();
+
+    // Allocate on all the threads at once.
+    ThreadPool::Instance->parallelFor( &frameAllocatorTestJob, &job, FRAMEALLOCATOR_UNITTEST_ITEMS, 1 );
+
+    // Check.
+    ASSERT_EQ( waterMark, FrameAllocator::getWaterMark() ) << "Main thread water mark not restored.";
+    for ( U32 index = 0; index < FRAMEALLOCATOR_UNITTEST_ITEMS; ++index )
+    {
+        ASSERT_TRUE( job.mValid[index] ) << "Frame allocation was overwritten by another thread at item " << index << ".";
+    }
+
+    FrameAllocator::Stats stats;
+    FrameAllocator::getStats( stats );
+    ASSERT_NE( 0U, stats.threadArenaSize ) << "Unexpected thread arena size.";
+    ASSERT_EQ( stats.mainArenaSize, FrameAllocator::getHighWaterMark() ) << "Unexpected main arena size.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,141 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _PARTICLE_ASSET_FIELD_H_
+#include "2d/assets/ParticleAssetField.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+// Samples compared against the keyed evaluation.
+#define PARTICLEASSETFIELD_UNITTEST_SAMPLES     10000
+
+//-----------------------------------------------------------------------------
+
+static void createParticleAssetTestField( ParticleAssetField& field, const U32 resolution )
+{
+    field.initialize( 2.0f, 0.0f, 10.0f, 1.0f );
+
+    // Add data-keys with some sharp corners.
+    field.setSingleDataKey( 1.0f );
+    field.addDataKey( 0.13f, 7.5f );
+    field.addDataKey( 0.57f, 0.25f );
+    field.addDataKey( 0.6f, 9.0f );
+    field.addDataKey( 1.37f, 3.0f );
+    field.addDataKey( 1.8f, 4.0f );
+
+    // Scale the values.
+    field.setValueScale( 2.5f );
+
+    // Bake at the resolution.
+    field.bakeLookupTable( resolution );
+}
+
+//-----------------------------------------------------------------------------
+
+static F32 getParticleAssetFieldMaxError( const ParticleAssetField& field, const F32 maxTime )
+{
+    F32 maxError = 0.0f;
+    for( U32 sample = 0; sample <= PARTICLEASSETFIELD_UNITTEST_SAMPLES; ++sample )
+    {
+        const F32 time = maxTime * (F32)sample / (F32)PARTICLEASSETFIELD_UNITTEST_SAMPLES;
+        maxError = getMax( maxError, mFabs( field.getFieldValue( time ) - field.getFieldValueKeyed( time ) ) );
+    }
+
+    return maxError;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, LookupTableMatchesKeyedTest )
+{
+    const U32 resolutions[] = { 16, 64, 256, 1024 };
+
+    for( U32 resolutionIndex = 0; resolutionIndex < sizeof(resolutions) / sizeof(U32); ++resolutionIndex )
+    {
+        ParticleAssetField field;
+        createParticleAssetTestField( field, resolutions[resolutionIndex] );
+
+        // Check.
+        ASSERT_EQ( resolutions[resolutionIndex], field.getLookupResolution() ) << "Lookup table was not baked.";
+
+        // Check the lookup table against the keyed evaluation.
+        const F32 maxError = getParticleAssetFieldMaxError( field, field.getMaxTime() );
+        ASSERT_LE( maxError, field.getLookupError() + 1.0e-4f ) << "Lookup error exceeds the reported error.";
+
+        Con::printf( "ParticleAssetFieldTests - Lookup: Resolution=%d, ReportedError=%0.6f, MeasuredError=%0.6f",
+            field.getLookupResolution(),
+            field.getLookupError(),
+            maxError );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, LookupTableRepeatTest )
+{
+    ParticleAssetField field;
+    createParticleAssetTestField( field, 512 );
+    field.setRepeatTime( 3.0f );
+
+    // Check the lookup table against the keyed evaluation, including times outside the field.
+    const F32 maxError = getParticleAssetFieldMaxError( field, field.getMaxTime() * 1.5f );
+    ASSERT_LE( maxError, field.getLookupError() + 1.0e-4f ) << "Repeated lookup error exceeds the reported error.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( ParticleAssetFieldTests, LookupTableExactKeysTest )
+{
+    // Keys on the sample spacing must be reproduced exactly.
+    ParticleAssetField field;
+    field.initialize( 1.0f, 0.0f, 10.0f, 1.0f );
+    field.setSingleDataKey( 2.0f );
+    field.addDataKey( 0.25f, 8.0f );
+    field.addDataKey( 0.5f, 4.0f );
+    field.addDataKey( 1.0f, 6.0f );
+    field.bakeLookupTable( 5 );
+
+    ASSERT_NEAR( 0.0f, field.getLookupError(), 1.0e-5f ) << "Unexpected lookup error.";
+    ASSERT_NEAR( 8.0f, field.getFieldValue( 0.25f ), 1.0e-5f );
+    ASSERT_NEAR( 5.0f, field.getFieldValue( 0.75f ), 1.0e-5f );
+
+    // A disabled lookup table uses the keyed evaluation.
+    field.bakeLookupTable( 0 );
+    ASSERT_EQ( (U32)0, field.getLookupResolution() ) << "Lookup table was not disabled.";
+    ASSERT_EQ( field.getFieldValueKeyed( 0.3f ), field.getFieldValue( 0.3f ) );
+
+    // A constant field has no lookup table.
+    field.setSingleDataKey( 3.0f );
+    ASSERT_EQ( (U32)0, field.getLookupResolution() ) << "Constant field was baked.";
+    ASSERT_EQ( 3.0f, field.getFieldValue( 0.3f ) );
+}
+
+#endif // TORQUE_SHIPPING
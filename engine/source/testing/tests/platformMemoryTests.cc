@@ -82,6 +82,57 @@ TEST( PlatformMemoryTests, dReallocrAnddFreeTest )
 
 //-----------------------------------------------------------------------------
 
+TEST( PlatformMemoryTests, TrackingTest )
+{
+    Memory::Usage usage;
+
+    // Finish if memory tracking is not compiled in.
+    if ( !Memory::isTrackingEnabled() )
+    {
+        ASSERT_FALSE( Memory::getUsage( usage ) ) << "Usage should not be available.";
+        ASSERT_EQ( 0U, Memory::takeSnapshot() ) << "Snapshots should not be available.";
+        return;
+    }
+
+    const U32 fromSnapshotId = Memory::takeSnapshot();
+    ASSERT_NE( 0U, fromSnapshotId ) << "Snapshot not taken.";
+
+    // Allocate and reallocate some tagged memory.
+    void* pTagged;
+    {
+        Memory::TagScope memoryTagScope( "PlatformMemoryTests" );
+        pTagged = dMalloc( PLATFORM_UNITTEST_MEMORY_BUFFERSIZE );
+        pTagged = dRealloc( pTagged, PLATFORM_UNITTEST_MEMORY_BUFFERSIZE * 2 );
+    }
+
+    // Allocate some memory outside of the tag.
+    void* pUntagged = dMalloc( PLATFORM_UNITTEST_MEMORY_BUFFERSIZE );
+
+    // Check.
+    ASSERT_TRUE( Memory::getTagUsage( "PlatformMemoryTests", usage ) ) << "Tag not found.";
+    ASSERT_EQ( (dsize_t)PLATFORM_UNITTEST_MEMORY_BUFFERSIZE * 2, usage.liveBytes ) << "Unexpected live bytes.";
+    ASSERT_EQ( (dsize_t)PLATFORM_UNITTEST_MEMORY_BUFFERSIZE * 2, usage.peakBytes ) << "Unexpected peak bytes.";
+    ASSERT_EQ( 1U, usage.liveCount ) << "Unexpected live count.";
+    ASSERT_EQ( (U64)2, usage.allocCount ) << "Unexpected allocation count.";
+    ASSERT_EQ( (U64)1, usage.freeCount ) << "Unexpected free count.";
+
+    dFree( pTagged );
+    dFree( pUntagged );
+
+    // Check.
+    ASSERT_TRUE( Memory::getTagUsage( "PlatformMemoryTests", usage ) ) << "Tag not found.";
+    ASSERT_EQ( (dsize_t)0, usage.liveBytes ) << "Unexpected live bytes.";
+    ASSERT_EQ( 0U, usage.liveCount ) << "Unexpected live count.";
+    ASSERT_EQ( (U64)2, usage.freeCount ) << "Unexpected free count.";
+
+    // Check the snapshot diff.
+    const U32 toSnapshotId = Memory::takeSnapshot();
+    ASSERT_TRUE( Memory::dumpSnapshotDiff( fromSnapshotId, toSnapshotId, 5 ) ) << "Snapshot diff failed.";
+    ASSERT_FALSE( Memory::dumpSnapshotDiff( fromSnapshotId, toSnapshotId + 1, 5 ) ) << "Snapshot should not be available.";
+}
+
+//-----------------------------------------------------------------------------
+
 TEST( PlatformMemoryTests, dMemcpyTest )
 {
     U8 source[] = { 0,1,2,3,4,5,6,7,8,9 };
@@ -0,0 +1,211 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SCENE_CONTACT_SET_H_
+#include "2d/scene/SceneContactSet.h"
+#endif
+
+#ifndef _SCENE_OBJECT_H_
+#include "2d/sceneobject/SceneObject.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENECONTACTSET_UNITTEST_CONTACTS   100
+
+//-----------------------------------------------------------------------------
+
+static const char* sceneContactSetTestScript =
+    "function SceneContactSetTestClass::onCollision( %this, %object, %collisionDetails ) { %this.contacts++; %this.shapes += getWord( %collisionDetails, 0 ); }\n"
+    "function SceneContactSetTestClass::onSceneCollisionBatch( %this, %contacts ) { %count = %contacts.getContactCount(); for( %i = 0; %i < %count; %i++ ) %this.shapes += %contacts.getShapeIndexA( %i ); %this.contacts += %count; }\n";
+
+static const char* sceneContactSetTestSceneScript =
+    "function SceneContactSetTestScene::onSceneCollision( %this, %objectA, %objectB, %collisionDetails ) { %this.begins++; }\n"
+    "function SceneContactSetTestScene::onSceneEndCollision( %this, %objectA, %objectB, %collisionDetails ) { %this.ends++; }\n"
+    "function SceneContactSetTestObject::onCollision( %this, %object, %collisionDetails ) { %this.begins++; }\n";
+
+static const char* sceneContactSetTestLateScript =
+    "function SceneContactSetTestObject::onEndCollision( %this, %object, %collisionDetails ) { %this.ends++; }\n"
+    "function SceneContactSetTestScene::onSceneCollisionBatch( %this, %contacts ) { %this.batches++; %this.batchContacts += %contacts.getContactCount(); }\n";
+
+//-----------------------------------------------------------------------------
+
+static void sceneContactSetTestContact( SceneContact& contact, const U32 index )
+{
+    contact.mSceneObjectA = index + 1;
+    contact.mSceneObjectB = index + 2;
+    contact.mShapeIndexA = 1;
+    contact.mShapeIndexB = 0;
+    contact.mPointCount = 2;
+    contact.mNormal.Set( 0.0f, 1.0f );
+    contact.mPoints[0].Set( (F32)index, 0.0f );
+    contact.mPoints[1].Set( (F32)index + 1.0f, 0.0f );
+    contact.mNormalImpulses[0] = contact.mNormalImpulses[1] = 0.5f;
+    contact.mTangentImpulses[0] = contact.mTangentImpulses[1] = 0.25f;
+}
+
+//-----------------------------------------------------------------------------
+
+static S32 sceneContactSetTestField( SimObject* pSimObject, const char* pFieldName )
+{
+    return dAtoi( pSimObject->getDataField( StringTable->insert( pFieldName ), NULL ) );
+}
+
+//-----------------------------------------------------------------------------
+
+static SceneObject* sceneContactSetTestBody( Scene* pScene, const b2BodyType bodyType, const Vector2& position, const F32 width )
+{
+    SceneObject* pSceneObject = new SceneObject();
+    pSceneObject->setClassNamespace( "SceneContactSetTestObject" );
+    pSceneObject->registerObject();
+    pSceneObject->setBodyType( bodyType );
+    pSceneObject->setPosition( position );
+    pSceneObject->setCollisionCallback( true );
+    pScene->addToScene( pSceneObject );
+    pSceneObject->createPolygonBoxCollisionShape( width, 1.0f );
+    return pSceneObject;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneContactSetTests, CallbackBatchTest )
+{
+    Con::evaluate( sceneContactSetTestScript );
+
+    // Create the callback object.
+    SimObject* pCallbackObject = new SimObject();
+    pCallbackObject->setClassNamespace( "SceneContactSetTestClass" );
+    ASSERT_TRUE( pCallbackObject->registerObject() ) << "Could not register callback object.";
+
+    // Per-contact callbacks with a formatted string per contact.
+    for( U32 index = 0; index < SCENECONTACTSET_UNITTEST_CONTACTS; ++index )
+    {
+        SceneContact contact;
+        sceneContactSetTestContact( contact, index );
+
+        char sceneObjectBuffer[16];
+        dSprintf( sceneObjectBuffer, sizeof(sceneObjectBuffer), "%d", contact.mSceneObjectB );
+
+        char miscInfoBuffer[128];
+        dSprintf( miscInfoBuffer, sizeof(miscInfoBuffer),
+            "%d %d %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f %0.4f",
+            contact.mShapeIndexA, contact.mShapeIndexB,
+            contact.mNormal.x, contact.mNormal.y,
+            contact.mPoints[0].x, contact.mPoints[0].y, contact.mNormalImpulses[0], contact.mTangentImpulses[0],
+            contact.mPoints[1].x, contact.mPoints[1].y, contact.mNormalImpulses[1], contact.mTangentImpulses[1] );
+
+        Con::executef( pCallbackObject, 3, "onCollision", sceneObjectBuffer, miscInfoBuffer );
+    }
+
+    // Check.
+    ASSERT_EQ( SCENECONTACTSET_UNITTEST_CONTACTS, sceneContactSetTestField( pCallbackObject, "contacts" ) ) << "Unexpected per-contact callback count.";
+    ASSERT_EQ( SCENECONTACTSET_UNITTEST_CONTACTS, sceneContactSetTestField( pCallbackObject, "shapes" ) ) << "Unexpected per-contact shape total.";
+
+    // Reset the counters.
+    pCallbackObject->setDataField( StringTable->insert( "contacts" ), NULL, "0" );
+    pCallbackObject->setDataField( StringTable->insert( "shapes" ), NULL, "0" );
+
+    // Create the contact set.
+    SceneContactSet* pContactSet = new SceneContactSet();
+    ASSERT_TRUE( pContactSet->registerObject() ) << "Could not register contact set.";
+
+    // Batched callback with a typed contact set.
+    for( U32 index = 0; index < SCENECONTACTSET_UNITTEST_CONTACTS; ++index )
+    {
+        SceneContact contact;
+        sceneContactSetTestContact( contact, index );
+        pContactSet->addContact( contact );
+    }
+    Con::executef( pCallbackObject, 2, "onSceneCollisionBatch", pContactSet->getIdString() );
+
+    // Check.
+    ASSERT_EQ( (U32)SCENECONTACTSET_UNITTEST_CONTACTS, pContactSet->getContactCount() ) << "Unexpected contact set count.";
+    ASSERT_EQ( SCENECONTACTSET_UNITTEST_CONTACTS, sceneContactSetTestField( pCallbackObject, "contacts" ) ) << "Unexpected batched callback count.";
+    ASSERT_EQ( SCENECONTACTSET_UNITTEST_CONTACTS, sceneContactSetTestField( pCallbackObject, "shapes" ) ) << "Unexpected batched shape total.";
+
+    pContactSet->deleteObject();
+    pCallbackObject->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneContactSetTests, SceneDispatchTest )
+{
+    Con::evaluate( sceneContactSetTestSceneScript );
+
+    // Create the scene.
+    Scene* pScene = new Scene();
+    pScene->setClassNamespace( "SceneContactSetTestScene" );
+    ASSERT_TRUE( pScene->registerObject() ) << "Could not register scene.";
+    pScene->setGravity( b2Vec2( 0.0f, 0.0f ) );
+
+    // Create a dynamic body overlapping a static body.
+    SceneObject* pGround = sceneContactSetTestBody( pScene, b2_staticBody, Vector2( 0.0f, 0.0f ), 4.0f );
+    SceneObject* pBody = sceneContactSetTestBody( pScene, b2_dynamicBody, Vector2( 0.0f, 0.75f ), 1.0f );
+
+    // Begin contact.
+    pScene->processTick();
+
+    // Check.
+    ASSERT_EQ( 1, sceneContactSetTestField( pScene, "begins" ) ) << "Unexpected scene begin callback count.";
+    ASSERT_EQ( 1, sceneContactSetTestField( pGround, "begins" ) ) << "Unexpected ground begin callback count.";
+    ASSERT_EQ( 1, sceneContactSetTestField( pBody, "begins" ) ) << "Unexpected body begin callback count.";
+
+    // Define the end callback after the scene has cached the object namespace callbacks.
+    Con::evaluate( sceneContactSetTestLateScript );
+
+    // End contact.
+    pBody->setPosition( Vector2( 0.0f, 100.0f ) );
+    pScene->processTick();
+
+    // Check.
+    ASSERT_EQ( 1, sceneContactSetTestField( pScene, "ends" ) ) << "Unexpected scene end callback count.";
+    ASSERT_EQ( 1, sceneContactSetTestField( pGround, "ends" ) ) << "Newly defined end callback was not dispatched to the ground.";
+    ASSERT_EQ( 1, sceneContactSetTestField( pBody, "ends" ) ) << "Newly defined end callback was not dispatched to the body.";
+
+    // Batched begin contact.
+    pScene->setBatchCollisionCallbacks( true );
+    pBody->setPosition( Vector2( 0.0f, 0.75f ) );
+    pScene->processTick();
+
+    // Check.
+    ASSERT_EQ( 1, sceneContactSetTestField( pScene, "begins" ) ) << "Per-contact scene callback dispatched when batched.";
+    ASSERT_EQ( 1, sceneContactSetTestField( pScene, "batches" ) ) << "Unexpected scene batch callback count.";
+    ASSERT_EQ( 1, sceneContactSetTestField( pScene, "batchContacts" ) ) << "Unexpected scene batch contact count.";
+    ASSERT_EQ( 2, sceneContactSetTestField( pGround, "begins" ) ) << "Unexpected ground begin callback count.";
+    ASSERT_EQ( 2, sceneContactSetTestField( pBody, "begins" ) ) << "Unexpected body begin callback count.";
+
+    pScene->deleteObject();
+}
+
+#endif // TORQUE_SHIPPING
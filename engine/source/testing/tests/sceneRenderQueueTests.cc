@@ -0,0 +1,254 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_RENDER_OBJECT_H_
+#include "2d/scene/SceneRenderObject.h"
+#endif
+
+#ifndef B2_TIMER_H
+#include "Box2D/Common/b2Timer.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SCENERENDERQUEUE_UNITTEST_REQUESTS  100000
+#define SCENERENDERQUEUE_UNITTEST_PASSES    20
+
+//-----------------------------------------------------------------------------
+
+class SceneRenderQueueTestObject : public SceneRenderObject
+{
+public:
+    SceneRenderQueueTestObject( const bool batchIsolated = false ) : mBatchIsolated( batchIsolated ) {}
+
+    virtual bool isBatchRendered( void ) { return true; }
+    virtual bool getBatchIsolated( void ) { return mBatchIsolated; }
+    virtual bool validRender( void ) const { return true; }
+    virtual bool shouldRender( void ) const { return true; }
+    virtual void scenePrepareRender(const SceneRenderState* pSceneRenderState, SceneRenderQueue* pSceneRenderQueue ) {}
+    virtual void sceneRender( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer ) {}
+    virtual void sceneRenderFallback( const SceneRenderState* pSceneRenderState, const SceneRenderRequest* pSceneRenderRequest, BatchRender* pBatchRenderer ) {}
+
+private:
+    bool mBatchIsolated;
+};
+
+//-----------------------------------------------------------------------------
+
+static S32 QSORT_CALLBACK sceneRenderQueueTestDepthSort(const void* a, const void* b)
+{
+    // Fetch scene render requests.
+    SceneRenderRequest* pSceneRenderRequestA  = *((SceneRenderRequest**)a);
+    SceneRenderRequest* pSceneRenderRequestB  = *((SceneRenderRequest**)b);
+
+    // Fetch depths.
+    const F32 depthA = pSceneRenderRequestA->mDepth;
+    const F32 depthB = pSceneRenderRequestB->mDepth;
+
+    return depthA < depthB ? 1 : depthA > depthB ? -1 : pSceneRenderRequestA->mSerialId - pSceneRenderRequestB->mSerialId;
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, SortModeTest )
+{
+    SceneRenderQueueTestObject renderObject;
+    SceneRenderQueueTestObject isolatedRenderObject( true );
+    SceneRenderQueue renderQueue;
+
+    // Create requests with some equal depths and negative positions.
+    const F32 depths[] = { 1.0f, -2.0f, 3.0f, 1.0f, 0.0f, -2.0f };
+    const U32 requestCount = sizeof(depths) / sizeof(F32);
+    for( U32 index = 0; index < requestCount; ++index )
+    {
+        renderQueue.createRenderRequest()->set( &renderObject, Vector2( depths[index], -depths[index] ), depths[index], Vector2::getZero(), (S32)index );
+    }
+
+    SceneRenderQueue::typeRenderRequestVector& renderRequests = renderQueue.getRenderRequests();
+
+    // Check depth sort (higher depths first, then age).
+    renderQueue.setSortMode( SceneRenderQueue::RENDER_SORT_ZAXIS );
+    renderQueue.sort();
+    const S32 depthOrder[] = { 2, 0, 3, 4, 1, 5 };
+    for( U32 index = 0; index < requestCount; ++index )
+    {
+        ASSERT_EQ( depthOrder[index], renderRequests[index]->mSerialId ) << "Unexpected depth sort order.";
+    }
+
+    // Check inverse x sort (higher x first, then age).
+    renderQueue.setSortMode( SceneRenderQueue::RENDER_SORT_INVERSE_XAXIS );
+    renderQueue.sort();
+    for( U32 index = 0; index < requestCount; ++index )
+    {
+        ASSERT_EQ( depthOrder[index], renderRequests[index]->mSerialId ) << "Unexpected inverse x sort order.";
+    }
+
+    // Check y sort (lower y first, then age).
+    renderQueue.setSortMode( SceneRenderQueue::RENDER_SORT_YAXIS );
+    renderQueue.sort();
+    for( U32 index = 0; index < requestCount; ++index )
+    {
+        ASSERT_EQ( depthOrder[index], renderRequests[index]->mSerialId ) << "Unexpected y sort order.";
+    }
+
+    // Check oldest sort.
+    renderQueue.setSortMode( SceneRenderQueue::RENDER_SORT_OLDEST );
+    renderQueue.sort();
+    for( U32 index = 0; index < requestCount; ++index )
+    {
+        ASSERT_EQ( (S32)(requestCount - 1 - index), renderRequests[index]->mSerialId ) << "Unexpected oldest sort order.";
+    }
+
+    // Check batch sort (isolated first, then age).
+    renderRequests[3]->mpSceneRenderObject = &isolatedRenderObject;
+    renderQueue.setSortMode( SceneRenderQueue::RENDER_SORT_BATCH );
+    renderQueue.sort();
+    const S32 batchOrder[] = { 3, 0, 1, 2, 4, 5 };
+    for( U32 index = 0; index < requestCount; ++index )
+    {
+        ASSERT_EQ( batchOrder[index], renderRequests[index]->mSerialId ) << "Unexpected batch sort order.";
+    }
+    ASSERT_FALSE( renderQueue.getStrictOrderMode() ) << "Batch sort should not need strict order.";
+
+    // Check group sort (grouped, then age).
+    for( U32 index = 0; index < requestCount; ++index )
+    {
+        renderRequests[index]->mRenderGroup = StringTable->insert( (renderRequests[index]->mSerialId % 2) ? "odd" : "even" );
+    }
+    renderQueue.setSortMode( SceneRenderQueue::RENDER_SORT_GROUP );
+    renderQueue.sort();
+    for( U32 index = 1; index < requestCount; ++index )
+    {
+        if ( renderRequests[index]->mRenderGroup == renderRequests[index-1]->mRenderGroup )
+        {
+            ASSERT_LT( renderRequests[index-1]->mSerialId, renderRequests[index]->mSerialId ) << "Render group should be ordered by age.";
+        }
+    }
+    ASSERT_NE( renderRequests[0]->mRenderGroup, renderRequests[requestCount-1]->mRenderGroup ) << "Render groups should be contiguous.";
+    ASSERT_EQ( renderRequests[0]->mRenderGroup, renderRequests[requestCount/2-1]->mRenderGroup ) << "Render groups should be contiguous.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SceneRenderQueueTests, KeySortTest )
+{
+    SceneRenderQueueTestObject renderObject;
+    SceneRenderQueue renderQueue;
+
+    // Prepare the requests once so the arena is allocated.
+    for( U32 index = 0; index < SCENERENDERQUEUE_UNITTEST_REQUESTS; ++index )
+    {
+        renderQueue.createRenderRequest();
+    }
+    SceneRenderRequest* pFirstRenderRequest = renderQueue.getRenderRequests().first();
+    renderQueue.resetState();
+
+    // Prepare the requests with scattered depths.
+    for( U32 index = 0; index < SCENERENDERQUEUE_UNITTEST_REQUESTS; ++index )
+    {
+        const F32 depth = (F32)((index * 7919) % 10007) - 5000.0f;
+        renderQueue.createRenderRequest()->set( &renderObject, Vector2::getZero(), depth, Vector2::getZero(), (S32)index );
+    }
+
+    // Check.
+    SceneRenderQueue::typeRenderRequestVector& renderRequests = renderQueue.getRenderRequests();
+    ASSERT_EQ( (U32)SCENERENDERQUEUE_UNITTEST_REQUESTS, (U32)renderRequests.size() ) << "Unexpected render request count.";
+    ASSERT_EQ( pFirstRenderRequest, renderRequests.first() ) << "The request arena should be reused.";
+
+    // Sort the requests using a comparator.
+    SceneRenderQueue::typeRenderRequestVector comparatorRequests = renderRequests;
+    dQsort( comparatorRequests.address(), comparatorRequests.size(), sizeof(SceneRenderRequest*), sceneRenderQueueTestDepthSort );
+
+    // Sort the requests using the packed keys.
+    renderQueue.setSortMode( SceneRenderQueue::RENDER_SORT_ZAXIS );
+    renderQueue.sort();
+
+    // Check.
+    for( U32 index = 0; index < SCENERENDERQUEUE_UNITTEST_REQUESTS; ++index )
+    {
+        ASSERT_EQ( comparatorRequests[index], renderRequests[index] ) << "Key sort does not match the comparator sort.";
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+// NOTE: Disabled as timings are machine dependent, run with --gtest_also_run_disabled_tests.
+TEST( SceneRenderQueueTests, DISABLED_SortBenchmarkTest )
+{
+    SceneRenderQueueTestObject renderObject;
+    SceneRenderQueue renderQueue;
+
+    // Prepare the requests with scattered depths.
+    for( U32 index = 0; index < SCENERENDERQUEUE_UNITTEST_REQUESTS; ++index )
+    {
+        const F32 depth = (F32)((index * 7919) % 10007) - 5000.0f;
+        renderQueue.createRenderRequest()->set( &renderObject, Vector2::getZero(), depth, Vector2::getZero(), (S32)index );
+    }
+
+    // Keep the unsorted requests so each pass sorts the same order.
+    SceneRenderQueue::typeRenderRequestVector& renderRequests = renderQueue.getRenderRequests();
+    const SceneRenderQueue::typeRenderRequestVector unsortedRequests = renderRequests;
+    SceneRenderQueue::typeRenderRequestVector comparatorRequests = renderRequests;
+    renderQueue.setSortMode( SceneRenderQueue::RENDER_SORT_ZAXIS );
+
+    F32 comparatorSortTime = 0.0f;
+    F32 keySortTime = 0.0f;
+    b2Timer timer;
+
+    for( U32 pass = 0; pass < SCENERENDERQUEUE_UNITTEST_PASSES; ++pass )
+    {
+        // Sort the requests using a comparator.
+        comparatorRequests = unsortedRequests;
+        timer.Reset();
+        dQsort( comparatorRequests.address(), comparatorRequests.size(), sizeof(SceneRenderRequest*), sceneRenderQueueTestDepthSort );
+        comparatorSortTime += timer.GetMilliseconds();
+
+        // Sort the requests using the packed keys.
+        renderRequests = unsortedRequests;
+        timer.Reset();
+        renderQueue.sort();
+        keySortTime += timer.GetMilliseconds();
+    }
+
+    // Check.
+    for( U32 index = 0; index < SCENERENDERQUEUE_UNITTEST_REQUESTS; ++index )
+    {
+        ASSERT_EQ( comparatorRequests[index], renderRequests[index] ) << "Key sort does not match the comparator sort.";
+    }
+
+    Con::printf( "SceneRenderQueueTests - Requests=%d, ComparatorSort=%0.2fms, KeySort=%0.2fms",
+        SCENERENDERQUEUE_UNITTEST_REQUESTS,
+        comparatorSortTime / SCENERENDERQUEUE_UNITTEST_PASSES,
+        keySortTime / SCENERENDERQUEUE_UNITTEST_PASSES );
+
+    // Check.
+    ASSERT_LT( keySortTime, comparatorSortTime ) << "Key sort should be faster than the comparator sort.";
+}
+
+#endif // TORQUE_SHIPPING
@@ -0,0 +1,247 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SIMBASE_H_
+#include "sim/simBase.h"
+#endif
+
+#ifndef _PLATFORM_THREADS_THREAD_H_
+#include "platform/threads/thread.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SIMEVENTQUEUE_UNITTEST_EVENTS   100000
+#define SIMEVENTQUEUE_UNITTEST_OBJECTS  100
+#define SIMEVENTQUEUE_UNITTEST_THREADS  4
+
+//-----------------------------------------------------------------------------
+
+class SimEventQueueTestEvent : public SimEvent
+{
+public:
+    SimEventQueueTestEvent( Vector<U32>* pProcessed, const U32 tag = 0 ) : mpProcessed( pProcessed ), mTag( tag ) {}
+
+    virtual void process( SimObject* object )
+    {
+        mpProcessed->push_back( mTag );
+    }
+
+private:
+    Vector<U32>* mpProcessed;
+    U32 mTag;
+};
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, ScheduleCancelTest )
+{
+    Vector<U32> processed;
+    const U32 startPendingCount = Sim::getPendingEventCount();
+
+    // Create the destination objects.
+    SimObject* objects[SIMEVENTQUEUE_UNITTEST_OBJECTS];
+    for( U32 index = 0; index < SIMEVENTQUEUE_UNITTEST_OBJECTS; ++index )
+    {
+        objects[index] = new SimObject();
+        ASSERT_TRUE( objects[index]->registerObject() ) << "Failed to register object.";
+    }
+
+    Vector<U32> eventIds;
+    eventIds.reserve( SIMEVENTQUEUE_UNITTEST_EVENTS );
+
+    // Schedule the events well into the future with scattered times.
+    const SimTime baseTime = Sim::getCurrentTime() + 1000000;
+    for( U32 index = 0; index < SIMEVENTQUEUE_UNITTEST_EVENTS; ++index )
+    {
+        const SimTime time = baseTime + ((index * 7919) % 10007);
+        eventIds.push_back( Sim::postEvent( objects[index % SIMEVENTQUEUE_UNITTEST_OBJECTS], new SimEventQueueTestEvent( &processed ), time ) );
+    }
+
+    // Check.
+    ASSERT_EQ( startPendingCount + SIMEVENTQUEUE_UNITTEST_EVENTS, Sim::getPendingEventCount() ) << "Unexpected pending event count.";
+    ASSERT_TRUE( Sim::isEventPending( eventIds[SIMEVENTQUEUE_UNITTEST_EVENTS/2] ) ) << "Event should be pending.";
+
+    // Cancel half the events individually.
+    for( U32 index = 0; index < SIMEVENTQUEUE_UNITTEST_EVENTS; index += 2 )
+    {
+        Sim::cancelEvent( eventIds[index] );
+    }
+
+    // Check.
+    ASSERT_EQ( startPendingCount + SIMEVENTQUEUE_UNITTEST_EVENTS/2, Sim::getPendingEventCount() ) << "Unexpected pending event count.";
+    ASSERT_FALSE( Sim::isEventPending( eventIds[0] ) ) << "Event should be cancelled.";
+    ASSERT_TRUE( Sim::isEventPending( eventIds[1] ) ) << "Event should be pending.";
+
+    // Cancel the remaining events by object.
+    for( U32 index = 0; index < SIMEVENTQUEUE_UNITTEST_OBJECTS; ++index )
+    {
+        Sim::cancelPendingEvents( objects[index] );
+    }
+
+    // Check.
+    ASSERT_EQ( startPendingCount, Sim::getPendingEventCount() ) << "Unexpected pending event count.";
+    ASSERT_FALSE( Sim::isEventPending( eventIds[1] ) ) << "Event should be cancelled.";
+    ASSERT_EQ( (U32)0, (U32)processed.size() ) << "No events should have been processed.";
+
+    for( U32 index = 0; index < SIMEVENTQUEUE_UNITTEST_OBJECTS; ++index )
+    {
+        objects[index]->deleteObject();
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, DispatchOrderTest )
+{
+    Vector<U32> processed;
+
+    SimObject* pObject = new SimObject();
+    ASSERT_TRUE( pObject->registerObject() ) << "Failed to register object.";
+
+    // Post events at the same time, they must keep their posting order.
+    const SimTime time = Sim::getCurrentTime() + 10;
+    const U32 laterId = Sim::postEvent( pObject, new SimEventQueueTestEvent( &processed, 3 ), time + 10 );
+    const U32 firstId = Sim::postEvent( pObject, new SimEventQueueTestEvent( &processed, 1 ), time );
+    const U32 secondId = Sim::postEvent( pObject, new SimEventQueueTestEvent( &processed, 2 ), time );
+
+    // Check.
+    ASSERT_EQ( (U32)10, Sim::getEventTimeLeft( firstId ) );
+    ASSERT_EQ( (U32)20, Sim::getScheduleDuration( laterId ) );
+
+    // Advance to the first time.
+    Sim::advanceTime( 10 );
+
+    // Check.
+    ASSERT_EQ( (U32)2, (U32)processed.size() ) << "Both events at the same time should have been processed.";
+    ASSERT_EQ( (U32)1, processed[0] ) << "Events at the same time should be processed in posting order.";
+    ASSERT_EQ( (U32)2, processed[1] ) << "Events at the same time should be processed in posting order.";
+    ASSERT_FALSE( Sim::isEventPending( firstId ) );
+    ASSERT_FALSE( Sim::isEventPending( secondId ) );
+    ASSERT_TRUE( Sim::isEventPending( laterId ) );
+
+    // Deleting the object cancels its pending events.
+    pObject->deleteObject();
+    ASSERT_FALSE( Sim::isEventPending( laterId ) ) << "Deleting the object should cancel its events.";
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, ScatteredDispatchTest )
+{
+    Vector<U32> processed;
+
+    SimObject* pObject = new SimObject();
+    ASSERT_TRUE( pObject->registerObject() ) << "Failed to register object.";
+
+    // Post events with scattered times, tagged with their time offset.
+    const U32 eventCount = 1000;
+    const SimTime baseTime = Sim::getCurrentTime();
+    for( U32 index = 0; index < eventCount; ++index )
+    {
+        const U32 timeOffset = 1 + ((index * 7919) % 997);
+        Sim::postEvent( pObject, new SimEventQueueTestEvent( &processed, timeOffset ), baseTime + timeOffset );
+    }
+
+    // Cancel an event so it is removed from within the queue.
+    const U32 cancelledId = Sim::postEvent( pObject, new SimEventQueueTestEvent( &processed, 0 ), baseTime + 500 );
+    Sim::cancelEvent( cancelledId );
+
+    // Advance past all the events.
+    Sim::advanceTime( 1000 );
+
+    // Check.
+    ASSERT_EQ( eventCount, (U32)processed.size() ) << "All the events should have been processed.";
+    for( U32 index = 1; index < eventCount; ++index )
+    {
+        ASSERT_LE( processed[index-1], processed[index] ) << "Events should be processed in time order.";
+    }
+
+    pObject->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+struct SimEventQueueTestPost
+{
+    SimObject* mpObject;
+    Vector<U32>* mpProcessed;
+    U32 mEventCount;
+    SimTime mTime;
+};
+
+static void simEventQueueTestPostThread( void* pArg )
+{
+    SimEventQueueTestPost* pPost = (SimEventQueueTestPost*)pArg;
+    for( U32 index = 0; index < pPost->mEventCount; ++index )
+    {
+        Sim::postEvent( pPost->mpObject, new SimEventQueueTestEvent( pPost->mpProcessed ), pPost->mTime );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SimEventQueueTests, ThreadPostTest )
+{
+    Vector<U32> processed;
+    const U32 startPendingCount = Sim::getPendingEventCount();
+
+    SimObject* pObject = new SimObject();
+    ASSERT_TRUE( pObject->registerObject() ) << "Failed to register object.";
+
+    SimEventQueueTestPost post;
+    post.mpObject = pObject;
+    post.mpProcessed = &processed;
+    post.mEventCount = SIMEVENTQUEUE_UNITTEST_EVENTS / SIMEVENTQUEUE_UNITTEST_THREADS;
+    post.mTime = Sim::getCurrentTime() + 1000000;
+
+    // Post from several threads at once.
+    Thread* threads[SIMEVENTQUEUE_UNITTEST_THREADS];
+    for( U32 index = 0; index < SIMEVENTQUEUE_UNITTEST_THREADS; ++index )
+    {
+        threads[index] = new Thread( simEventQueueTestPostThread, &post, true );
+    }
+
+    for( U32 index = 0; index < SIMEVENTQUEUE_UNITTEST_THREADS; ++index )
+    {
+        threads[index]->join();
+        delete threads[index];
+    }
+
+    // Check the posted events have been queued.
+    ASSERT_EQ( startPendingCount + post.mEventCount * SIMEVENTQUEUE_UNITTEST_THREADS, Sim::getPendingEventCount() ) << "Unexpected pending event count.";
+
+    // Deleting the object cancels its pending events.
+    pObject->deleteObject();
+    ASSERT_EQ( startPendingCount, Sim::getPendingEventCount() ) << "Unexpected pending event count.";
+    ASSERT_EQ( (U32)0, (U32)processed.size() ) << "No events should have been processed.";
+}
+
+#endif // TORQUE_SHIPPING
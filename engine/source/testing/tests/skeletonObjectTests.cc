@@ -0,0 +1,220 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SKELETON_OBJECT_H_
+#include "2d/sceneobject/SkeletonObject.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _GBITMAP_H_
+#include "graphics/gBitmap.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define SKELETONOBJECT_UNITTEST_IMAGE       "_unitTestSkeleton_RemoveMe.png"
+#define SKELETONOBJECT_UNITTEST_ATLAS       "_unitTestSkeleton_RemoveMe.atlas"
+#define SKELETONOBJECT_UNITTEST_SKELETON    "_unitTestSkeleton_RemoveMe.json"
+#define SKELETONOBJECT_UNITTEST_SLOTS       3
+#define SKELETONOBJECT_UNITTEST_TICKS       120
+
+//-----------------------------------------------------------------------------
+
+// Two regions side-by-side in a 64x32 image.
+static const char* skeletonObjectTestAtlas =
+    "\n"
+    SKELETONOBJECT_UNITTEST_IMAGE "\n"
+    "format: RGBA8888\n"
+    "filter: Linear,Linear\n"
+    "repeat: none\n"
+    "front\n"
+    "  rotate: false\n"
+    "  xy: 0, 0\n"
+    "  size: 32, 32\n"
+    "  orig: 32, 32\n"
+    "  offset: 0, 0\n"
+    "  index: -1\n"
+    "back\n"
+    "  rotate: false\n"
+    "  xy: 32, 0\n"
+    "  size: 32, 32\n"
+    "  orig: 32, 32\n"
+    "  offset: 0, 0\n"
+    "  index: -1\n";
+
+// Three slots where the "front" slot swaps its attachment half-way through the animation and the "empty" slot has none.
+static const char* skeletonObjectTestSkeleton =
+    "{\n"
+    "\"bones\": [ { \"name\": \"root\" } ],\n"
+    "\"slots\": [\n"
+    "    { \"name\": \"back\", \"bone\": \"root\", \"attachment\": \"back\" },\n"
+    "    { \"name\": \"front\", \"bone\": \"root\", \"attachment\": \"front\" },\n"
+    "    { \"name\": \"empty\", \"bone\": \"root\" }\n"
+    "],\n"
+    "\"skins\": {\n"
+    "    \"default\": {\n"
+    "        \"back\": { \"back\": { \"width\": 32, \"height\": 32 } },\n"
+    "        \"front\": { \"front\": { \"width\": 32, \"height\": 32 }, \"back\": { \"width\": 32, \"height\": 32 } }\n"
+    "    }\n"
+    "},\n"
+    "\"animations\": {\n"
+    "    \"swap\": {\n"
+    "        \"bones\": { \"root\": { \"rotate\": [ { \"time\": 0, \"angle\": 0 }, { \"time\": 1, \"angle\": 90 } ] } },\n"
+    "        \"slots\": { \"front\": { \"attachment\": [ { \"time\": 0, \"name\": \"front\" }, { \"time\": 0.5, \"name\": \"back\" }, { \"time\": 1, \"name\": \"front\" } ] } }\n"
+    "    }\n"
+    "}\n"
+    "}\n";
+
+//-----------------------------------------------------------------------------
+
+static bool skeletonObjectTestWriteFile( const char* pFileName, const char* pText )
+{
+    FileStream writeStream;
+    if ( !writeStream.open( pFileName, FileStream::Write ) )
+        return false;
+
+    const bool written = writeStream.writeStringBuffer( pText );
+    writeStream.close();
+    return written;
+}
+
+//-----------------------------------------------------------------------------
+
+static void skeletonObjectTestDeleteFiles( void )
+{
+    Platform::fileDelete( SKELETONOBJECT_UNITTEST_IMAGE );
+    Platform::fileDelete( SKELETONOBJECT_UNITTEST_ATLAS );
+    Platform::fileDelete( SKELETONOBJECT_UNITTEST_SKELETON );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( SkeletonObjectTests, SlotSpriteReuseTest )
+{
+    // Write the image.
+    GBitmap bitmap( 64, 32, false, GBitmap::RGBA );
+    dMemset( bitmap.getWritableBits(), 255, bitmap.byteSize );
+    FileStream imageStream;
+    ASSERT_TRUE( imageStream.open( SKELETONOBJECT_UNITTEST_IMAGE, FileStream::Write ) ) << "Failed to open the image file for write.";
+    ASSERT_TRUE( bitmap.writePNG( imageStream ) ) << "Failed to write the image.";
+    imageStream.close();
+
+    // Write the atlas and skeleton.
+    ASSERT_TRUE( skeletonObjectTestWriteFile( SKELETONOBJECT_UNITTEST_ATLAS, skeletonObjectTestAtlas ) ) << "Failed to write the atlas file.";
+    ASSERT_TRUE( skeletonObjectTestWriteFile( SKELETONOBJECT_UNITTEST_SKELETON, skeletonObjectTestSkeleton ) ) << "Failed to write the skeleton file.";
+
+    // Create the skeleton asset.
+    SkeletonAsset* pSkeletonAsset = new SkeletonAsset();
+    pSkeletonAsset->setAtlasFile( SKELETONOBJECT_UNITTEST_ATLAS );
+    pSkeletonAsset->setSkeletonFile( SKELETONOBJECT_UNITTEST_SKELETON );
+    StringTableEntry skeletonAssetId = AssetDatabase.addPrivateAsset( pSkeletonAsset );
+
+    // Fetch the frames of the regions.
+    ImageAsset* pImageAsset = pSkeletonAsset->mImageAsset;
+    ASSERT_TRUE( pImageAsset != NULL ) << "The skeleton image asset was not created.";
+    const S32 frontFrame = pImageAsset->getNamedFrameIndex( "front" );
+    const S32 backFrame = pImageAsset->getNamedFrameIndex( "back" );
+    ASSERT_TRUE( frontFrame >= 0 && backFrame >= 0 && frontFrame != backFrame ) << "Unexpected region frames.";
+
+    // Create the scene.
+    Scene* pScene = new Scene();
+    ASSERT_TRUE( pScene->registerObject() ) << "Could not register scene.";
+
+    // Create the skeleton.
+    SkeletonObject* pSkeletonObject = new SkeletonObject();
+    ASSERT_TRUE( pSkeletonObject->registerObject() ) << "Could not register skeleton.";
+    pSkeletonObject->setSkeletonAsset( skeletonAssetId );
+    ASSERT_TRUE( pSkeletonObject->setAnimationName( "swap", true ) ) << "Could not set the animation.";
+    pScene->addToScene( pSkeletonObject );
+
+    // Check.
+    ASSERT_EQ( (U32)SKELETONOBJECT_UNITTEST_SLOTS, pSkeletonObject->getSpriteCount() ) << "Expected a sprite per slot.";
+
+    // Tag the slot sprites.
+    // NOTE: The sprites are created in slot order so have sequential batch Ids.
+    U32 slotTags[SKELETONOBJECT_UNITTEST_SLOTS];
+    for( U32 slot = 0; slot < SKELETONOBJECT_UNITTEST_SLOTS; ++slot )
+    {
+        ASSERT_TRUE( pSkeletonObject->selectSpriteId( slot + 1 ) ) << "Could not find the slot sprite.";
+        pSkeletonObject->setUserData( &slotTags[slot] );
+    }
+
+    U32 frontTicks = 0;
+    U32 swappedTicks = 0;
+
+    for( U32 tick = 0; tick < SKELETONOBJECT_UNITTEST_TICKS; ++tick )
+    {
+        pScene->processTick();
+
+        // Check the slot sprites are the same tagged sprites.
+        ASSERT_EQ( (U32)SKELETONOBJECT_UNITTEST_SLOTS, pSkeletonObject->getSpriteCount() ) << "Slot sprites should not be recreated.";
+        for( U32 slot = 0; slot < SKELETONOBJECT_UNITTEST_SLOTS; ++slot )
+        {
+            ASSERT_TRUE( pSkeletonObject->selectSpriteId( slot + 1 ) ) << "Could not find the slot sprite.";
+            ASSERT_EQ( (void*)&slotTags[slot], pSkeletonObject->getUserData() ) << "Slot sprites should not be recreated.";
+        }
+
+        // Check the back slot sprite.
+        pSkeletonObject->selectSpriteId( 1 );
+        ASSERT_TRUE( pSkeletonObject->getSpriteVisible() ) << "The back slot sprite should be visible.";
+        ASSERT_EQ( (U32)backFrame, pSkeletonObject->getSpriteImageFrame() ) << "Unexpected back slot frame.";
+
+        // Check the empty slot sprite.
+        pSkeletonObject->selectSpriteId( 3 );
+        ASSERT_FALSE( pSkeletonObject->getSpriteVisible() ) << "The empty slot sprite should be hidden.";
+
+        // Check the front slot sprite and count its attachments.
+        pSkeletonObject->selectSpriteId( 2 );
+        ASSERT_TRUE( pSkeletonObject->getSpriteVisible() ) << "The front slot sprite should be visible.";
+        const U32 imageFrame = pSkeletonObject->getSpriteImageFrame();
+        if ( imageFrame == (U32)frontFrame )
+            frontTicks++;
+        else if ( imageFrame == (U32)backFrame )
+            swappedTicks++;
+    }
+
+    // Check.
+    ASSERT_EQ( (U32)SKELETONOBJECT_UNITTEST_TICKS, frontTicks + swappedTicks ) << "Unexpected front slot frame.";
+    ASSERT_TRUE( frontTicks > 0 && swappedTicks > 0 ) << "The front slot sprite should follow the attachment swap.";
+
+    // Delete the scene and its skeleton.
+    pScene->deleteObject();
+
+    skeletonObjectTestDeleteFiles();
+}
+
+#endif // TORQUE_SHIPPING
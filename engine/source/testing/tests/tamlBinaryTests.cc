@@ -0,0 +1,205 @@
+//-----------------------------------------------------------------------------
+// Copyright (c) 2013 GarageGames, LLC
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to
+// deal in the Software without restriction, including without limitation the
+// rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+// sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+//-----------------------------------------------------------------------------
+
+// We don't want tests in a shipping version.
+#ifndef TORQUE_SHIPPING
+
+#ifndef _UNIT_TESTING_H_
+#include "testing/unitTesting.h"
+#endif
+
+#ifndef _TAML_H_
+#include "persistence/taml/taml.h"
+#endif
+
+#ifndef _SCENE_H_
+#include "2d/scene/Scene.h"
+#endif
+
+#ifndef _SPRITE_H_
+#include "2d/sceneobject/Sprite.h"
+#endif
+
+#ifndef _FILESTREAM_H_
+#include "io/fileStream.h"
+#endif
+
+#ifndef _MEMSTREAM_H_
+#include "io/memstream.h"
+#endif
+
+//-----------------------------------------------------------------------------
+
+#define TAMLBINARY_UNITTEST_OBJECTS         2000
+#define TAMLBINARY_UNITTEST_XML_FILE        "_unitTestTamlBinary_RemoveMe.taml"
+#define TAMLBINARY_UNITTEST_JSON_FILE       "_unitTestTamlBinary_RemoveMe.json"
+#define TAMLBINARY_UNITTEST_BINARY_FILE     "_unitTestTamlBinary_RemoveMe.baml"
+
+//-----------------------------------------------------------------------------
+
+static Scene* tamlBinaryTestCreateScene( const U32 objectCount )
+{
+    // Create a scene.
+    Scene* pScene = new Scene();
+    pScene->registerObject();
+
+    // Populate the scene with a mix of typed and text fields.
+    for ( U32 index = 0; index < objectCount; ++index )
+    {
+        Sprite* pSprite = new Sprite();
+        pSprite->registerObject();
+        pSprite->setSceneLayer( index % 31 );
+        pSprite->setDefaultDensity( 1.0f + (F32)index * 0.25f );
+        pSprite->setCollisionSuppress( (index & 1) == 0 );
+        pSprite->setVisible( (index % 3) != 0 );
+        pSprite->setPosition( Vector2( (F32)index, (F32)index * 0.5f ) );
+        pScene->addToScene( pSprite );
+    }
+
+    return pScene;
+}
+
+//-----------------------------------------------------------------------------
+
+static void tamlBinaryTestReadScene( Taml& taml, const char* pFilename, const U32 objectCount )
+{
+    // Read the scene.
+    Scene* pScene = taml.read<Scene>( pFilename );
+
+    // Check.
+    ASSERT_TRUE( pScene != NULL ) << "Failed to read scene from '" << pFilename << "'.";
+
+    EXPECT_EQ( objectCount, pScene->getSceneObjectCount() ) << "Unexpected object count in '" << pFilename << "'.";
+
+    // Check the objects round-tripped.
+    U32 matchedCount = 0;
+    for ( U32 index = 0; index < pScene->getSceneObjectCount(); ++index )
+    {
+        const SceneObject* pSceneObject = pScene->getSceneObject( index );
+        const U32 sceneLayer = pSceneObject->getSceneLayer();
+        const U32 sourceIndex = (U32)mFloor( pSceneObject->getPosition().x + 0.5f );
+        if ( sceneLayer == sourceIndex % 31 &&
+            pSceneObject->getDefaultDensity() == 1.0f + (F32)sourceIndex * 0.25f &&
+            pSceneObject->getCollisionSuppress() == ((sourceIndex & 1) == 0) &&
+            pSceneObject->getVisible() == ((sourceIndex % 3) != 0) )
+        {
+            matchedCount++;
+        }
+    }
+
+    EXPECT_EQ( objectCount, matchedCount ) << "Not all objects round-tripped from '" << pFilename << "'.";
+
+    pScene->deleteObject();
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlBinaryTests, SceneReadTest )
+{
+    // Create the scene.
+    Scene* pScene = tamlBinaryTestCreateScene( TAMLBINARY_UNITTEST_OBJECTS );
+
+    // Write the scene in all formats.
+    Taml taml;
+    ASSERT_TRUE( taml.write( pScene, TAMLBINARY_UNITTEST_XML_FILE ) ) << "Failed to write XML scene.";
+    ASSERT_TRUE( taml.write( pScene, TAMLBINARY_UNITTEST_JSON_FILE ) ) << "Failed to write JSON scene.";
+
+    taml.setBinaryCompression( false );
+    ASSERT_TRUE( taml.write( pScene, TAMLBINARY_UNITTEST_BINARY_FILE ) ) << "Failed to write binary scene.";
+
+    pScene->deleteObject();
+
+    // Read the scene in all formats.
+    tamlBinaryTestReadScene( taml, TAMLBINARY_UNITTEST_XML_FILE, TAMLBINARY_UNITTEST_OBJECTS );
+    tamlBinaryTestReadScene( taml, TAMLBINARY_UNITTEST_JSON_FILE, TAMLBINARY_UNITTEST_OBJECTS );
+    tamlBinaryTestReadScene( taml, TAMLBINARY_UNITTEST_BINARY_FILE, TAMLBINARY_UNITTEST_OBJECTS );
+
+    Platform::fileDelete( TAMLBINARY_UNITTEST_XML_FILE );
+    Platform::fileDelete( TAMLBINARY_UNITTEST_JSON_FILE );
+    Platform::fileDelete( TAMLBINARY_UNITTEST_BINARY_FILE );
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlBinaryTests, CompressedSceneReadTest )
+{
+    Taml taml;
+    taml.setBinaryCompression( true );
+
+    // Round-trip both a payload smaller and larger than the compression buffers.
+    const U32 objectCounts[] = { 1, TAMLBINARY_UNITTEST_OBJECTS };
+    for ( U32 index = 0; index < sizeof(objectCounts) / sizeof(U32); ++index )
+    {
+        // Write the compressed scene.
+        Scene* pScene = tamlBinaryTestCreateScene( objectCounts[index] );
+        ASSERT_TRUE( taml.write( pScene, TAMLBINARY_UNITTEST_BINARY_FILE ) ) << "Failed to write compressed binary scene.";
+        pScene->deleteObject();
+
+        // Read the compressed scene.
+        tamlBinaryTestReadScene( taml, TAMLBINARY_UNITTEST_BINARY_FILE, objectCounts[index] );
+
+        Platform::fileDelete( TAMLBINARY_UNITTEST_BINARY_FILE );
+    }
+}
+
+//-----------------------------------------------------------------------------
+
+TEST( TamlBinaryTests, InvalidPayloadSizeTest )
+{
+    // Write the compressed scene.
+    Scene* pScene = tamlBinaryTestCreateScene( 10 );
+    Taml taml;
+    taml.setBinaryCompression( true );
+    ASSERT_TRUE( taml.write( pScene, TAMLBINARY_UNITTEST_BINARY_FILE ) ) << "Failed to write compressed binary scene.";
+    pScene->deleteObject();
+
+    // Read the file.
+    char filePathBuffer[1024];
+    Con::expandPath( filePathBuffer, sizeof(filePathBuffer), TAMLBINARY_UNITTEST_BINARY_FILE );
+    FileStream stream;
+    ASSERT_TRUE( stream.open( filePathBuffer, FileStream::Read ) ) << "Failed to open compressed binary scene.";
+    const U32 fileSize = stream.getStreamSize();
+    U8* pFileBuffer = new U8[fileSize];
+    ASSERT_TRUE( stream.read( fileSize, pFileBuffer ) ) << "Failed to read compressed binary scene.";
+    stream.close();
+
+    // Overwrite the payload size which follows the signature, version Id and compressed flag.
+    MemStream patchStream( fileSize, pFileBuffer, false, true );
+    patchStream.setPosition( 1 + dStrlen( TAML_SIGNATURE ) + sizeof(U32) + sizeof(U8) );
+    patchStream.write( (U32)0xFFFFFFF0 );
+
+    // Write the file.
+    ASSERT_TRUE( stream.open( filePathBuffer, FileStream::Write ) ) << "Failed to open compressed binary scene.";
+    stream.write( fileSize, pFileBuffer );
+    stream.close();
+    delete [] pFileBuffer;
+
+    // The scene must be rejected rather than read.
+    Scene* pInvalidScene = taml.read<Scene>( TAMLBINARY_UNITTEST_BINARY_FILE );
+    EXPECT_TRUE( pInvalidScene == NULL ) << "Read scene with an invalid payload size.";
+    if ( pInvalidScene != NULL )
+        pInvalidScene->deleteObject();
+
+    Platform::fileDelete( TAMLBINARY_UNITTEST_BINARY_FILE );
+}
+
+#endif // TORQUE_SHIPPING
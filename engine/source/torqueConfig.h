@@ -83,6 +83,12 @@
 /// 'TORQUE_GATHER_METRICS'
 /// When defined, Torque will gather additional performance metrics.
 ///
+/// 'TORQUE_TRACK_MEMORY'
+/// When defined, Torque will track the live bytes, allocation counts and peak usage of
+/// memory allocated with dMalloc/dRealloc for each memory tag or source file.  Use the
+/// 'dumpMemoryUsage', 'takeMemorySnapshot' and 'dumpMemorySnapshotDiff' console functions
+/// to find leaks and churn.
+///
 /// 'TORQUE_MULTITHREAD'
 /// When defined, Torque will attempt to make select systems thread-safe.  This does not
 /// make the entire engine thread-safe nor is it a magic bullet that will make the engine
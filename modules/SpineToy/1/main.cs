@@ -31,8 +31,10 @@ function SpineToy::create(%this)
     %this.asset = "SpineToy:goblins";
     %this.skin = "goblin";
     %this.animation = "walk";
+    %this.crowdCount = 0;
     
     addSelectionOption( "goblin,goblingirl", "Select Skin", 4, "setSkin", false, "Sets the skin for the skeleton object." );
+    addNumericOption( "Crowd Count", 0, 200, 25, "setCrowdCount", %this.crowdCount, true, "Sets the number of extra skeletons animated in a crowd (useful to benchmark skeleton animation)." );
     
     // Reset the toy.
     SpineToy.reset();
@@ -59,6 +61,7 @@ function SpineToy::reset(%this)
 
     %this.createBackground();
     %this.createGoblin();
+    %this.createCrowd();
 }
 
 //-----------------------------------------------------------------------------
@@ -83,6 +86,49 @@ function SpineToy::setSkin(%this, %value)
 
 //-----------------------------------------------------------------------------
 
+function SpineToy::setCrowdCount(%this, %value)
+{
+    %this.crowdCount = %value;
+}
+
+//-----------------------------------------------------------------------------
+
+function SpineToy::createCrowd(%this)
+{
+    // Finish if no crowd.
+    if ( %this.crowdCount <= 0 )
+        return;
+        
+    // Arrange the crowd in a grid.
+    %columns = mCeil( mSqrt( %this.crowdCount ) );
+    %rows = mCeil( %this.crowdCount / %columns );
+    %stepX = 36 / %columns;
+    %stepY = 20 / %rows;
+    
+    for ( %index = 0; %index < %this.crowdCount; %index++ )
+    {
+        // Create the skeleton object
+        %goblin = new SkeletonObject();
+        
+        // Assign it an asset
+        %goblin.Asset = "SpineToy:goblins";
+        %goblin.Skin = (%index % 2) ? "goblingirl" : "goblin";
+        
+        // Set the animation name
+        %goblin.setAnimationName(%this.animation, true);
+        
+        %goblin.RootBoneScale = 0.0125;
+        
+        %goblin.position = (-18 + (%stepX * ((%index % %columns) + 0.5))) SPC (-12 + (%stepY * (mFloor(%index / %columns) + 0.5)));
+        %goblin.SceneLayer = 28;
+        
+        // Add it to the scene
+        SandboxScene.add(%goblin);
+    }
+}
+
+//-----------------------------------------------------------------------------
+
 function SpineToy::createGoblin(%this)
 {
     // Create the skeleton object